@@ -0,0 +1,152 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer.hpp>
+
+using namespace bc;
+using namespace bc::explorer;
+
+// Compare the rate of bc::decode_base58 with that of the limb codec, one
+// payload at a time and in bulk, over 25 byte payment address payloads.
+
+static const size_t address_count = 100000;
+static const size_t address_size = 25;
+
+static std::vector<std::string> make_addresses()
+{
+    std::vector<std::string> addresses;
+    addresses.reserve(address_count);
+    for (uint32_t index = 0; index < address_count; ++index)
+    {
+        const auto hash = bitcoin_short_hash(to_chunk(to_little_endian(index)));
+        auto payload = build_chunk({ to_array(0x00), hash });
+        append_checksum(payload);
+        addresses.push_back(encode_base58(payload));
+    }
+
+    return addresses;
+}
+
+template <typename Function>
+static void measure(const std::string& name, Function function)
+{
+    const auto start = std::chrono::steady_clock::now();
+    const auto valid = function();
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    const auto seconds = std::chrono::duration_cast<
+        std::chrono::duration<double>>(elapsed).count();
+
+    BOOST_REQUIRE_EQUAL(valid, address_count);
+    std::cout << "    " << std::setw(20) << name << std::setw(12) <<
+        std::fixed << std::setprecision(0) << address_count / seconds <<
+        " per second" << std::endl;
+}
+
+BOOST_AUTO_TEST_SUITE(base58_codec)
+
+BOOST_AUTO_TEST_CASE(base58_codec__decode_addresses)
+{
+    const auto addresses = make_addresses();
+
+    std::cout << "base58 decode" << std::endl;
+    measure("decode_base58", [&]()
+    {
+        size_t valid = 0;
+        data_chunk out;
+        for (const auto& address: addresses)
+            valid += decode_base58(out, address) &&
+                out.size() == address_size;
+
+        return valid;
+    });
+
+    measure("fast_decode_base58", [&]()
+    {
+        size_t valid = 0;
+        data_chunk out;
+        for (const auto& address: addresses)
+            valid += fast_decode_base58(out, address) &&
+                out.size() == address_size;
+
+        return valid;
+    });
+
+    measure("decode_base58_batch", [&]()
+    {
+        data_chunk out;
+        const auto valid = decode_base58_batch(out, addresses, address_size);
+        return static_cast<size_t>(std::count(valid.begin(), valid.end(),
+            true));
+    });
+
+    // The checksum (two sha256 rounds) dominates the checked rate.
+    measure("checked batch", [&]()
+    {
+        data_chunk out;
+        const auto valid = decode_base58_batch(out, addresses, address_size,
+            true);
+
+        return static_cast<size_t>(std::count(valid.begin(), valid.end(),
+            true));
+    });
+}
+
+BOOST_AUTO_TEST_CASE(base58_codec__encode_addresses)
+{
+    const auto addresses = make_addresses();
+    data_chunk payloads;
+    decode_base58_batch(payloads, addresses, address_size);
+
+    std::vector<data_chunk> values;
+    for (size_t index = 0; index < address_count; ++index)
+        values.emplace_back(payloads.begin() + index * address_size,
+            payloads.begin() + (index + 1) * address_size);
+
+    std::cout << "base58 encode" << std::endl;
+    measure("encode_base58", [&]()
+    {
+        size_t valid = 0;
+        for (const auto& value: values)
+            valid += !encode_base58(value).empty();
+
+        return valid;
+    });
+
+    measure("fast_encode_base58", [&]()
+    {
+        size_t valid = 0;
+        for (const auto& value: values)
+            valid += !fast_encode_base58(value).empty();
+
+        return valid;
+    });
+}
+
+BOOST_AUTO_TEST_SUITE_END()
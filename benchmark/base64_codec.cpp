@@ -0,0 +1,167 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer.hpp>
+
+using namespace bc;
+using namespace bc::explorer;
+
+// Compare the throughput of bc::encode_base64 and bc::decode_base64 with
+// each supported base64 kernel and with the streaming encoder and decoder,
+// over a megabyte of data.
+
+static const size_t data_size = 1024 * 1024;
+static const size_t iterations = 50;
+
+static const char* kernel_name(base64_kernel kernel)
+{
+    switch (kernel)
+    {
+        case base64_kernel::avx2:
+            return "avx2";
+        default:
+            return "scalar";
+    }
+}
+
+static data_chunk make_data()
+{
+    data_chunk data(data_size);
+    for (size_t index = 0; index < data.size(); ++index)
+        data[index] = static_cast<uint8_t>(index * 131 + (index >> 8));
+
+    return data;
+}
+
+// Count the streamed output, as writing to STDOUT would, without retaining it.
+class counting_buffer
+  : public std::streambuf
+{
+public:
+    size_t count = 0;
+
+protected:
+    std::streamsize xsputn(const char*, std::streamsize size) override
+    {
+        count += static_cast<size_t>(size);
+        return size;
+    }
+
+    int_type overflow(int_type character) override
+    {
+        ++count;
+        return character;
+    }
+};
+
+template <typename Function>
+static void measure(const std::string& name, Function function)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t iteration = 0; iteration < iterations; ++iteration)
+        function();
+
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    const auto seconds = std::chrono::duration_cast<
+        std::chrono::duration<double>>(elapsed).count();
+    const auto megabytes = double(data_size) * iterations / (1024 * 1024);
+
+    std::cout << "    " << std::setw(16) << name << std::setw(10) <<
+        std::fixed << std::setprecision(1) << megabytes / seconds <<
+        " MiB/s" << std::endl;
+}
+
+BOOST_AUTO_TEST_SUITE(base64_codec)
+
+BOOST_AUTO_TEST_CASE(base64_codec__encode)
+{
+    const auto data = make_data();
+    size_t size = 0;
+
+    std::cout << "base64 encode" << std::endl;
+    measure("encode_base64", [&]()
+    {
+        size += encode_base64(data).size();
+    });
+
+    for (const auto kernel: base64_kernels())
+        measure(kernel_name(kernel), [&]()
+        {
+            size += fast_encode_base64(data, kernel).size();
+        });
+
+    measure("base64_encoder", [&]()
+    {
+        counting_buffer buffer;
+        std::ostream output(&buffer);
+        base64_encoder encoder(output);
+        encoder.write(data);
+        encoder.finish();
+        size += buffer.count;
+    });
+
+    BOOST_REQUIRE(size != 0);
+}
+
+BOOST_AUTO_TEST_CASE(base64_codec__decode)
+{
+    const auto text = encode_base64(make_data());
+    const data_chunk chunk(text.begin(), text.end());
+    size_t size = 0;
+
+    std::cout << "base64 decode" << std::endl;
+    measure("decode_base64", [&]()
+    {
+        data_chunk out;
+        decode_base64(out, text);
+        size += out.size();
+    });
+
+    for (const auto kernel: base64_kernels())
+        measure(kernel_name(kernel), [&]()
+        {
+            data_chunk out;
+            fast_decode_base64(out, text, kernel);
+            size += out.size();
+        });
+
+    measure("base64_decoder", [&]()
+    {
+        counting_buffer buffer;
+        std::ostream output(&buffer);
+        base64_decoder decoder(output);
+        decoder.write(chunk);
+        decoder.finish();
+        size += buffer.count;
+    });
+
+    BOOST_REQUIRE(size != 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,165 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer.hpp>
+
+using namespace bc;
+using namespace bc::explorer;
+
+// Compare the throughput of bc::encode_base85 and bc::decode_base85 with
+// the table codec over a megabyte of data, and over the same data as 32
+// byte curve keys.
+
+static const size_t data_size = 1024 * 1024;
+static const size_t key_size = 32;
+static const size_t iterations = 50;
+
+static data_chunk make_data()
+{
+    data_chunk data(data_size);
+    for (size_t index = 0; index < data.size(); ++index)
+        data[index] = static_cast<uint8_t>(index * 131 + (index >> 8));
+
+    return data;
+}
+
+static std::vector<data_chunk> make_keys(const data_chunk& data)
+{
+    std::vector<data_chunk> keys;
+    for (auto it = data.begin(); it != data.end(); it += key_size)
+        keys.emplace_back(it, it + key_size);
+
+    return keys;
+}
+
+template <typename Function>
+static void measure(const std::string& name, Function function)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t iteration = 0; iteration < iterations; ++iteration)
+        function();
+
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    const auto seconds = std::chrono::duration_cast<
+        std::chrono::duration<double>>(elapsed).count();
+    const auto megabytes = double(data_size) * iterations / (1024 * 1024);
+
+    std::cout << "    " << std::setw(20) << name << std::setw(10) <<
+        std::fixed << std::setprecision(1) << megabytes / seconds <<
+        " MiB/s" << std::endl;
+}
+
+BOOST_AUTO_TEST_SUITE(base85_codec)
+
+BOOST_AUTO_TEST_CASE(base85_codec__encode)
+{
+    const auto data = make_data();
+    const auto keys = make_keys(data);
+    size_t size = 0;
+
+    std::cout << "base85 encode" << std::endl;
+    measure("encode_base85", [&]()
+    {
+        std::string out;
+        encode_base85(out, data);
+        size += out.size();
+    });
+
+    measure("fast_encode_base85", [&]()
+    {
+        std::string out;
+        fast_encode_base85(out, data);
+        size += out.size();
+    });
+
+    measure("encode_base85 keys", [&]()
+    {
+        for (const auto& key: keys)
+        {
+            std::string out;
+            encode_base85(out, key);
+            size += out.size();
+        }
+    });
+
+    measure("encode_base85_batch", [&]()
+    {
+        std::vector<std::string> out;
+        encode_base85_batch(out, data, key_size);
+        size += out.size();
+    });
+
+    BOOST_REQUIRE(size != 0);
+}
+
+BOOST_AUTO_TEST_CASE(base85_codec__decode)
+{
+    const auto data = make_data();
+    std::string text;
+    std::vector<std::string> texts;
+    BOOST_REQUIRE(encode_base85(text, data));
+    BOOST_REQUIRE(encode_base85_batch(texts, data, key_size));
+    size_t size = 0;
+
+    std::cout << "base85 decode" << std::endl;
+    measure("decode_base85", [&]()
+    {
+        data_chunk out;
+        decode_base85(out, text);
+        size += out.size();
+    });
+
+    measure("fast_decode_base85", [&]()
+    {
+        data_chunk out;
+        fast_decode_base85(out, text);
+        size += out.size();
+    });
+
+    measure("decode_base85 keys", [&]()
+    {
+        for (const auto& key: texts)
+        {
+            data_chunk out;
+            decode_base85(out, key);
+            size += out.size();
+        }
+    });
+
+    measure("decode_base85_batch", [&]()
+    {
+        data_chunk out;
+        decode_base85_batch(out, texts, key_size);
+        size += out.size();
+    });
+
+    BOOST_REQUIRE(size != 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
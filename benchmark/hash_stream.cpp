@@ -0,0 +1,142 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer.hpp>
+
+using namespace bc;
+using namespace bc::explorer;
+
+// Compare the throughput of bc::sha256_hash and bc::bitcoin_hash of each
+// message with each multi-buffer kernel, over a megabyte of messages of
+// the sizes of a base58check body, a hash and a small transaction.
+
+static const size_t data_size = 1024 * 1024;
+static const size_t iterations = 20;
+static const size_t message_sizes[] = { 21, 32, 250 };
+
+static std::vector<data_chunk> make_messages(size_t size)
+{
+    std::vector<data_chunk> messages(data_size / size, data_chunk(size));
+    for (size_t index = 0; index < messages.size(); ++index)
+        for (size_t byte = 0; byte < size; ++byte)
+            messages[index][byte] = static_cast<uint8_t>(index * 131 + byte);
+
+    return messages;
+}
+
+static std::string kernel_name(sha256_batch_kernel kernel)
+{
+    switch (kernel)
+    {
+        case sha256_batch_kernel::avx2:
+            return "avx2";
+        case sha256_batch_kernel::avx512:
+            return "avx512";
+        default:
+            return "single";
+    }
+}
+
+template <typename Function>
+static void measure(const std::string& name, size_t bytes,
+    Function function)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t iteration = 0; iteration < iterations; ++iteration)
+        function();
+
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    const auto seconds = std::chrono::duration_cast<
+        std::chrono::duration<double>>(elapsed).count();
+    const auto megabytes = double(bytes) * iterations / (1024 * 1024);
+
+    std::cout << "    " << std::setw(24) << name << std::setw(10) <<
+        std::fixed << std::setprecision(1) << megabytes / seconds <<
+        " MiB/s" << std::endl;
+}
+
+BOOST_AUTO_TEST_SUITE(hash_stream)
+
+BOOST_AUTO_TEST_CASE(hash_stream__sha256_batch)
+{
+    for (const auto message_size: message_sizes)
+    {
+        const auto messages = make_messages(message_size);
+        const std::vector<data_slice> slices(messages.begin(),
+            messages.end());
+        const auto bytes = messages.size() * message_size;
+        size_t count = 0;
+
+        std::cout << "sha256 " << message_size << " byte messages" <<
+            std::endl;
+        measure("sha256_hash", bytes, [&]()
+        {
+            for (const auto& message: messages)
+                count += sha256_hash(message)[0];
+        });
+
+        for (const auto kernel: sha256_batch_kernels())
+            measure("sha256_batch " + kernel_name(kernel), bytes, [&]()
+            {
+                count += sha256_batch(slices, kernel).size();
+            });
+
+        BOOST_REQUIRE(count != 0);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hash_stream__bitcoin256_batch)
+{
+    for (const auto message_size: message_sizes)
+    {
+        const auto messages = make_messages(message_size);
+        const std::vector<data_slice> slices(messages.begin(),
+            messages.end());
+        const auto bytes = messages.size() * message_size;
+        size_t count = 0;
+
+        std::cout << "bitcoin256 " << message_size << " byte messages" <<
+            std::endl;
+        measure("bitcoin_hash", bytes, [&]()
+        {
+            for (const auto& message: messages)
+                count += bitcoin_hash(message)[0];
+        });
+
+        for (const auto kernel: sha256_batch_kernels())
+            measure("bitcoin256_batch " + kernel_name(kernel), bytes, [&]()
+            {
+                count += bitcoin256_batch(slices, kernel).size();
+            });
+
+        BOOST_REQUIRE(count != 0);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,123 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer.hpp>
+
+using namespace bc;
+using namespace bc::explorer;
+using namespace bc::wallet;
+
+// Compare the single thread throughput of deriving each child with
+// hd_public::derive_public against hd_public_batch, for addresses and for
+// extended public keys. Both run on one thread, so the rates are per core.
+
+static const std::string parent_key = "xpub68Gmy5EdvgibQVfPdqkBBCHxA5htiqg55crXYuXoQRKfDBFA1WEjWgP6LHhwBZeNK1VTsfTFUHCdrfp1bgwQ9xv5ski8PX9rL2dZXvgGDnw";
+static const size_t batch_size = 256;
+static const size_t children = 80 * batch_size;
+
+template <typename Function>
+static void measure(const std::string& name, Function function)
+{
+    const auto start = std::chrono::steady_clock::now();
+    function();
+
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    const auto seconds = std::chrono::duration_cast<
+        std::chrono::duration<double>>(elapsed).count();
+
+    std::cout << "    " << std::setw(24) << name << std::setw(12) <<
+        std::fixed << std::setprecision(0) << children / seconds <<
+        " keys/s" << std::endl;
+}
+
+BOOST_AUTO_TEST_SUITE(hd_batch)
+
+BOOST_AUTO_TEST_CASE(hd_batch__address)
+{
+    const hd_public parent(parent_key);
+    const hd_public_batch batch(parent);
+    size_t count = 0;
+
+    // The generator table is built on first use.
+    std::vector<hd_public_child> out;
+    batch.derive(out, 0, 1);
+
+    std::cout << "address, one thread" << std::endl;
+    measure("derive_public", [&]()
+    {
+        for (uint32_t index = 0; index < children; ++index)
+        {
+            const auto child = parent.derive_public(index);
+            count += payment_address(ec_public(child.point())).encoded()
+                .size();
+        }
+    });
+
+    measure("hd_public_batch", [&]()
+    {
+        for (uint32_t first = 0; first < children; first += batch_size)
+        {
+            batch.derive(out, first, batch_size);
+            for (const auto& child: out)
+                count += batch.address(child, payment_address::mainnet_p2kh)
+                    .size();
+        }
+    });
+
+    BOOST_REQUIRE(count != 0);
+}
+
+BOOST_AUTO_TEST_CASE(hd_batch__encoded)
+{
+    const hd_public parent(parent_key);
+    const hd_public_batch batch(parent);
+    std::vector<hd_public_child> out;
+    size_t count = 0;
+
+    std::cout << "extended public key, one thread" << std::endl;
+    measure("derive_public", [&]()
+    {
+        for (uint32_t index = 0; index < children; ++index)
+            count += parent.derive_public(index).encoded().size();
+    });
+
+    measure("hd_public_batch", [&]()
+    {
+        for (uint32_t first = 0; first < children; first += batch_size)
+        {
+            batch.derive(out, first, batch_size);
+            for (const auto& child: out)
+                count += batch.encoded(child).size();
+        }
+    });
+
+    BOOST_REQUIRE(count != 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,136 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <boost/property_tree/ptree.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/client.hpp>
+#include <bitcoin/explorer.hpp>
+
+using namespace bc;
+using namespace bc::client;
+using namespace bc::explorer;
+using namespace bc::explorer::primitives;
+
+// Compare the size and encoding time of each output engine over large
+// fetch-history and tx-decode documents.
+
+static const size_t history_rows = 100000;
+static const size_t transaction_puts = 20000;
+static const size_t iterations = 5;
+
+static hash_digest make_hash(uint32_t index)
+{
+    return bitcoin_hash(to_chunk(to_little_endian(index)));
+}
+
+static std::vector<history_row> make_history()
+{
+    std::vector<history_row> rows(history_rows);
+    for (uint32_t index = 0; index < rows.size(); ++index)
+    {
+        auto& row = rows[index];
+        row.output = { make_hash(index), index % 4 };
+        row.output_height = 300000 + index;
+        row.value = 100000 + index;
+
+        // Half of the outputs are spent.
+        row.spend = { index % 2 == 0 ? make_hash(~index) : null_hash, 0 };
+        row.spend_height = index % 2 == 0 ? 300001 + index : 0;
+    }
+
+    return rows;
+}
+
+static tx_type make_transaction()
+{
+    tx_type tx;
+    tx.version = 1;
+    tx.locktime = 0;
+
+    for (uint32_t index = 0; index < transaction_puts; ++index)
+    {
+        tx_input_type input;
+        input.previous_output = { make_hash(index), index % 4 };
+        input.sequence = max_uint32;
+        tx.inputs.push_back(input);
+
+        tx_output_type output;
+        output.value = 100000 + index;
+        tx.outputs.push_back(output);
+    }
+
+    return tx;
+}
+
+static void measure(const std::string& name, const pt::ptree& tree)
+{
+    static const encoding_engine engines[] =
+    {
+        encoding_engine::info,
+        encoding_engine::json,
+        encoding_engine::ndjson,
+        encoding_engine::xml,
+        encoding_engine::cbor,
+        encoding_engine::msgpack
+    };
+
+    std::cout << name << std::endl;
+    for (const auto engine: engines)
+    {
+        size_t size = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t iteration = 0; iteration < iterations; ++iteration)
+        {
+            std::ostringstream output;
+            write_stream(output, tree, engine);
+            size = output.str().size();
+        }
+
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        const auto milliseconds = std::chrono::duration_cast<
+            std::chrono::milliseconds>(elapsed).count() / iterations;
+
+        std::cout << "    " << std::setw(8) << encoding(engine) <<
+            std::setw(12) << size << " bytes" << std::setw(8) <<
+            milliseconds << " ms" << std::endl;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(prop_encoding)
+
+BOOST_AUTO_TEST_CASE(prop_encoding__fetch_history)
+{
+    measure("fetch-history", prop_tree(make_history()));
+}
+
+BOOST_AUTO_TEST_CASE(prop_encoding__tx_decode)
+{
+    measure("tx-decode", prop_tree(transaction(make_transaction())));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -16,16 +16,41 @@
 
 #include <bitcoin/client.hpp>
 #include <bitcoin/network.hpp>
+#include <bitcoin/explorer/address_filter.hpp>
+#include <bitcoin/explorer/address_index.hpp>
+#include <bitcoin/explorer/base16_codec.hpp>
+#include <bitcoin/explorer/base58_codec.hpp>
+#include <bitcoin/explorer/base64_codec.hpp>
+#include <bitcoin/explorer/base85_codec.hpp>
+#include <bitcoin/explorer/binary_writer.hpp>
+#include <bitcoin/explorer/block_file.hpp>
+#include <bitcoin/explorer/block_parser.hpp>
 #include <bitcoin/explorer/callback_state.hpp>
+#include <bitcoin/explorer/coin_selection.hpp>
 #include <bitcoin/explorer/command.hpp>
 #include <bitcoin/explorer/define.hpp>
 #include <bitcoin/explorer/dispatch.hpp>
 #include <bitcoin/explorer/display.hpp>
+#include <bitcoin/explorer/ec_batch.hpp>
 #include <bitcoin/explorer/generated.hpp>
+#include <bitcoin/explorer/hash_stream.hpp>
+#include <bitcoin/explorer/hd_batch.hpp>
+#include <bitcoin/explorer/mapped_file.hpp>
 #include <bitcoin/explorer/obelisk_client.hpp>
+#include <bitcoin/explorer/output_sink.hpp>
 #include <bitcoin/explorer/parser.hpp>
+#include <bitcoin/explorer/primitives/base16_stream.hpp>
+#include <bitcoin/explorer/primitives/byte_stream.hpp>
+#include <bitcoin/explorer/primitives/hd_path.hpp>
+#include <bitcoin/explorer/primitives/index_range.hpp>
+#include <bitcoin/explorer/primitives/transaction_stream.hpp>
+#include <bitcoin/explorer/prop_fields.hpp>
 #include <bitcoin/explorer/prop_tree.hpp>
+#include <bitcoin/explorer/prop_writer.hpp>
+#include <bitcoin/explorer/table_writer.hpp>
 #include <bitcoin/explorer/utility.hpp>
+#include <bitcoin/explorer/utxo_set.hpp>
+#include <bitcoin/explorer/vanity_search.hpp>
 #include <bitcoin/explorer/version.hpp>
 #include <bitcoin/explorer/commands/address-decode.hpp>
 #include <bitcoin/explorer/commands/address-embed.hpp>
@@ -40,6 +65,7 @@
 #include <bitcoin/explorer/commands/base64-encode.hpp>
 #include <bitcoin/explorer/commands/bitcoin160.hpp>
 #include <bitcoin/explorer/commands/bitcoin256.hpp>
+#include <bitcoin/explorer/commands/block-decode.hpp>
 #include <bitcoin/explorer/commands/btc-to-satoshi.hpp>
 #include <bitcoin/explorer/commands/cert-new.hpp>
 #include <bitcoin/explorer/commands/cert-public.hpp>
@@ -52,6 +78,7 @@
 #include <bitcoin/explorer/commands/ec-to-ek.hpp>
 #include <bitcoin/explorer/commands/ec-to-public.hpp>
 #include <bitcoin/explorer/commands/ec-to-wif.hpp>
+#include <bitcoin/explorer/commands/ec-vanity.hpp>
 #include <bitcoin/explorer/commands/ek-address.hpp>
 #include <bitcoin/explorer/commands/ek-new.hpp>
 #include <bitcoin/explorer/commands/ek-public-to-address.hpp>
@@ -68,14 +95,17 @@
 #include <bitcoin/explorer/commands/fetch-tx-index.hpp>
 #include <bitcoin/explorer/commands/fetch-tx.hpp>
 #include <bitcoin/explorer/commands/fetch-utxo.hpp>
+#include <bitcoin/explorer/commands/hd-derive.hpp>
 #include <bitcoin/explorer/commands/hd-new.hpp>
 #include <bitcoin/explorer/commands/hd-private.hpp>
 #include <bitcoin/explorer/commands/hd-public.hpp>
+#include <bitcoin/explorer/commands/hd-scan.hpp>
 #include <bitcoin/explorer/commands/hd-to-address.hpp>
 #include <bitcoin/explorer/commands/hd-to-ec.hpp>
 #include <bitcoin/explorer/commands/hd-to-public.hpp>
 #include <bitcoin/explorer/commands/hd-to-wif.hpp>
 #include <bitcoin/explorer/commands/help.hpp>
+#include <bitcoin/explorer/commands/index-blocks.hpp>
 #include <bitcoin/explorer/commands/input-set.hpp>
 #include <bitcoin/explorer/commands/input-sign.hpp>
 #include <bitcoin/explorer/commands/input-validate.hpp>
@@ -88,6 +118,7 @@
 #include <bitcoin/explorer/commands/qrcode.hpp>
 #include <bitcoin/explorer/commands/ripemd160.hpp>
 #include <bitcoin/explorer/commands/satoshi-to-btc.hpp>
+#include <bitcoin/explorer/commands/scan-blocks.hpp>
 #include <bitcoin/explorer/commands/script-decode.hpp>
 #include <bitcoin/explorer/commands/script-encode.hpp>
 #include <bitcoin/explorer/commands/script-to-address.hpp>
@@ -110,6 +141,7 @@
 #include <bitcoin/explorer/commands/tx-sign.hpp>
 #include <bitcoin/explorer/commands/uri-decode.hpp>
 #include <bitcoin/explorer/commands/uri-encode.hpp>
+#include <bitcoin/explorer/commands/utxo-snapshot.hpp>
 #include <bitcoin/explorer/commands/validate-tx.hpp>
 #include <bitcoin/explorer/commands/watch-address.hpp>
 #include <bitcoin/explorer/commands/watch-tx.hpp>
@@ -0,0 +1,81 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_ADDRESS_FILTER_HPP
+#define BX_ADDRESS_FILTER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_set>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * A set of address hashes for matching the scripts of a large number of
+ * transactions, where nearly every lookup is a miss. A bloom filter of the
+ * hashes is tested before the set, so that a miss rarely leaves the cache.
+ */
+class BCX_API address_filter
+{
+public:
+
+    /**
+     * Default constructor, the filter is empty.
+     */
+    address_filter();
+
+    /**
+     * Add the hash of an address to the filter.
+     * @param[in]  hash  The address hash.
+     */
+    void insert(const short_hash& hash);
+
+    /**
+     * Determine whether the filter contains the hash of an address.
+     * @param[in]  hash  The address hash.
+     * @return           True if the hash was inserted.
+     */
+    bool contains(const short_hash& hash) const;
+
+    /**
+     * The number of distinct hashes in the filter.
+     * @return  The number of hashes.
+     */
+    size_t size() const;
+
+private:
+    void set_bits(const short_hash& hash);
+    bool test_bits(const short_hash& hash) const;
+
+    size_t mask_;
+    std::vector<uint64_t> bits_;
+    std::unordered_set<short_hash, digest_hasher<short_hash_size>> hashes_;
+};
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,230 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_ADDRESS_INDEX_HPP
+#define BX_ADDRESS_INDEX_HPP
+
+#include <cstddef>
+#include <vector>
+#include <boost/filesystem.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/client.hpp>
+#include <bitcoin/explorer/block_file.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/mapped_file.hpp>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * A transfer of a payment address, keyed by the hash of the address.
+ */
+struct BCX_API address_row
+{
+    short_hash address;
+    client::history_row transfer;
+};
+
+/**
+ * The number of output and spend rows of a run of an address index.
+ */
+struct BCX_API address_run
+{
+    size_t outputs;
+    size_t spends;
+};
+
+/**
+ * The maximum number of runs of an address index, which bounds the binary
+ * searches of a query.
+ */
+BC_CONSTEXPR size_t maximum_index_runs = 16;
+
+/**
+ * A local index of the transfers of the payment addresses of a block chain,
+ * for answering history queries without a server. The file holds a header,
+ * a run of rows for each update of the index, and a trailer of the hashes of
+ * the indexed blocks by height and the sizes of the runs. A run holds the
+ * addressed outputs of consecutive blocks sorted by address hash and height,
+ * and the spends of these blocks sorted by the point spent. A query is a
+ * binary search of each run of the mapped file, and there are at most
+ * maximum_index_runs runs.
+ */
+class BCX_API address_index
+{
+public:
+
+    /**
+     * Map an index file. Check valid() for success.
+     * @param[in]  path  The path of the index file.
+     */
+    address_index(const boost::filesystem::path& path);
+
+    /**
+     * Determine whether the file was mapped and is an index.
+     * @return  True if the index is valid.
+     */
+    bool valid() const;
+
+    /**
+     * The number of indexed blocks, which is the height of the next block.
+     * @return  The number of blocks.
+     */
+    size_t blocks() const;
+
+    /**
+     * The number of output rows of the index, one for each transfer.
+     * @return  The number of rows.
+     */
+    size_t rows() const;
+
+    /**
+     * The runs of the index, in the order that they were appended.
+     * @return  The runs.
+     */
+    const std::vector<address_run>& runs() const;
+
+    /**
+     * The hash of an indexed block.
+     * @param[in]  height  The height of the block, less than blocks().
+     * @return             The block hash.
+     */
+    hash_digest block_hash(size_t height) const;
+
+    /**
+     * The transfers of an address, in order of height. Addresses are
+     * indexed by hash, so the version of the address is not considered.
+     * @param[in]  address  The address hash.
+     * @return              The transfers, in the fetch-history schema.
+     */
+    client::history_list history(const short_hash& address) const;
+
+private:
+    bool find_spend(client::history_row& row, size_t run) const;
+
+    mapped_file file_;
+    bool valid_;
+    size_t blocks_;
+    size_t rows_;
+    std::vector<address_run> runs_;
+    std::vector<size_t> offsets_;
+};
+
+/**
+ * Builds or updates an address index from the blocks of block files. An
+ * update parses only the blocks that extend the indexed chain. The rows of
+ * each window of blocks are sorted and written to temporary files, which are
+ * merged into the new run of the index, so that memory use is bounded by the
+ * window rather than by the size of the index.
+ */
+class BCX_API address_index_writer
+{
+public:
+
+    /**
+     * Open the index at the path, if there is a file at the path.
+     * Check valid() for success.
+     * @param[in]  path  The path of the index file.
+     */
+    address_index_writer(const boost::filesystem::path& path);
+
+    /**
+     * Remove the temporary files of the writer.
+     */
+    ~address_index_writer();
+
+    /**
+     * Determine whether there is no file at the path or the file is an
+     * index, since any other file is not replaced.
+     * @return  True if the index can be written.
+     */
+    bool valid() const;
+
+    /**
+     * The number of indexed blocks.
+     * @return  The number of blocks.
+     */
+    size_t blocks() const;
+
+    /**
+     * The number of output rows.
+     * @return  The number of rows.
+     */
+    size_t rows() const;
+
+    /**
+     * The number of blocks indexed by add.
+     * @return  The number of blocks added.
+     */
+    size_t added() const;
+
+    /**
+     * Determine whether a chain starts with the indexed chain.
+     * @param[in]  records  The block records of the files.
+     * @param[in]  chain    The chain of the records, see block_chain.
+     * @return              True if the chain extends the index.
+     */
+    bool extends(const std::vector<block_record>& records,
+        const std::vector<size_t>& chain) const;
+
+    /**
+     * Index the blocks of a chain that are not yet indexed.
+     * @param[in]  files    The content of the block files.
+     * @param[in]  records  The block records of the files.
+     * @param[in]  chain    The chain of the records, see block_chain.
+     * @return              False if the chain does not extend the index or
+     *                      a block is not valid.
+     */
+    bool add(const std::vector<data_slice>& files,
+        const std::vector<block_record>& records,
+        const std::vector<size_t>& chain);
+
+    /**
+     * Write the index with a run of the added blocks to a temporary file and
+     * then move it to the path, so that a failed write leaves the index
+     * unchanged. The runs of the index are copied, except that the new run
+     * absorbs the last runs that are not larger than it, which bounds the
+     * number of runs.
+     * @return  False if the index could not be written.
+     */
+    bool write();
+
+private:
+    bool write_index(std::ostream& file, size_t kept,
+        const address_run& run) const;
+
+    const boost::filesystem::path path_;
+    const boost::filesystem::path outputs_path_;
+    const boost::filesystem::path spends_path_;
+    bool exists_;
+    bool valid_;
+    bool failed_;
+    size_t rows_;
+    size_t added_;
+    std::vector<hash_digest> blocks_;
+    std::vector<address_run> runs_;
+    std::vector<address_run> windows_;
+};
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
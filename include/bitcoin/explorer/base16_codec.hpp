@@ -0,0 +1,80 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_BASE16_CODEC_HPP
+#define BX_BASE16_CODEC_HPP
+
+#include <string>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * Base16 codec kernels. The vector kernels are compiled for x86 by gcc and
+ * clang and are used only when the processor supports them.
+ */
+enum class base16_kernel
+{
+    scalar,
+    ssse3,
+    avx2
+};
+
+/**
+ * The fastest kernel supported by this processor, detected once.
+ * @return  The kernel used by default.
+ */
+BCX_API base16_kernel base16_default_kernel();
+
+/**
+ * The kernels supported by this processor, including scalar.
+ * @return  The supported kernels.
+ */
+BCX_API std::vector<base16_kernel> base16_kernels();
+
+/**
+ * Encode data as lower case base16, equivalent to bc::encode_base16.
+ * @param[in]  data    The data to encode.
+ * @param[in]  kernel  The kernel to use, which must be supported.
+ * @return             The base16 text.
+ */
+BCX_API std::string fast_encode_base16(data_slice data);
+BCX_API std::string fast_encode_base16(data_slice data, base16_kernel kernel);
+
+/**
+ * Decode base16 text of either case, equivalent to bc::decode_base16. The
+ * text must be of even length and contain only base16 digits.
+ * @param[out] out     The decoded data, unchanged on failure.
+ * @param[in]  in      The base16 text to decode.
+ * @param[in]  kernel  The kernel to use, which must be supported.
+ * @return             True if the text is valid.
+ */
+BCX_API bool fast_decode_base16(data_chunk& out, const std::string& in);
+BCX_API bool fast_decode_base16(data_chunk& out, const std::string& in,
+    base16_kernel kernel);
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
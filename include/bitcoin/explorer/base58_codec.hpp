@@ -0,0 +1,69 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_BASE58_CODEC_HPP
+#define BX_BASE58_CODEC_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * Encode data as base58, equivalent to bc::encode_base58. The conversion
+ * works in 32 bit limbs, four bytes or five digits (a power of 58) at a
+ * time, in place of one byte or digit at a time.
+ * @param[in]  data  The data to encode.
+ * @return           The base58 text.
+ */
+BCX_API std::string fast_encode_base58(data_slice data);
+
+/**
+ * Decode base58 text, equivalent to bc::decode_base58.
+ * @param[out] out  The decoded data, unchanged on failure.
+ * @param[in]  in   The base58 text to decode.
+ * @return          True if the text is valid.
+ */
+BCX_API bool fast_decode_base58(data_chunk& out, const std::string& in);
+
+/**
+ * Validate and decode many base58 payloads of the same size, such as the
+ * 25 byte payloads of payment addresses. The limbs of a payload are fixed
+ * by its size, so no text requires an allocation.
+ * @param[out] out      The payloads, size bytes each in the order of the
+ *                      texts, with zeros in place of each invalid payload.
+ * @param[in]  in       The base58 texts to decode.
+ * @param[in]  size     The size of each payload.
+ * @param[in]  checked  Also require a valid base58check checksum.
+ * @return              For each text, true if it decodes to a payload of
+ *                      the size (with a valid checksum if checked).
+ */
+BCX_API std::vector<bool> decode_base58_batch(data_chunk& out,
+    const std::vector<std::string>& in, size_t size, bool checked=false);
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,159 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_BASE64_CODEC_HPP
+#define BX_BASE64_CODEC_HPP
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * Base64 codec kernels. The vector kernel is compiled for x86 by gcc and
+ * clang and is used only when the processor supports it.
+ */
+enum class base64_kernel
+{
+    scalar,
+    avx2
+};
+
+/**
+ * The fastest kernel supported by this processor, detected once.
+ * @return  The kernel used by default.
+ */
+BCX_API base64_kernel base64_default_kernel();
+
+/**
+ * The kernels supported by this processor, including scalar.
+ * @return  The supported kernels.
+ */
+BCX_API std::vector<base64_kernel> base64_kernels();
+
+/**
+ * Encode data as padded base64, equivalent to bc::encode_base64.
+ * @param[in]  data    The data to encode.
+ * @param[in]  kernel  The kernel to use, which must be supported.
+ * @return             The base64 text.
+ */
+BCX_API std::string fast_encode_base64(data_slice data);
+BCX_API std::string fast_encode_base64(data_slice data, base64_kernel kernel);
+
+/**
+ * Decode padded base64 text, equivalent to bc::decode_base64 for text that
+ * is padded with either one or two '=' characters or not at all.
+ * @param[out] out     The decoded data, unchanged on failure.
+ * @param[in]  in      The base64 text to decode.
+ * @param[in]  kernel  The kernel to use, which must be supported.
+ * @return             True if the text is valid.
+ */
+BCX_API bool fast_decode_base64(data_chunk& out, const std::string& in);
+BCX_API bool fast_decode_base64(data_chunk& out, const std::string& in,
+    base64_kernel kernel);
+
+/**
+ * Streaming base64 encoder. Data is encoded as it is written and the text
+ * is written to the output in fixed size chunks, so memory use does not
+ * depend on the size of the data.
+ */
+class BCX_API base64_encoder
+{
+public:
+
+    /**
+     * Construct an encoder.
+     * @param[in]  output  The stream to write the text to.
+     * @param[in]  kernel  The kernel to use, which must be supported.
+     */
+    base64_encoder(std::ostream& output,
+        base64_kernel kernel=base64_default_kernel());
+
+    /**
+     * Encode the next part of the data.
+     * @param[in]  data  The data.
+     */
+    void write(data_slice data);
+
+    /**
+     * Encode the remaining data with padding.
+     */
+    void finish();
+
+private:
+    void encode(const uint8_t* data, size_t size);
+
+    std::ostream& output_;
+    const base64_kernel kernel_;
+    data_chunk pending_;
+    std::string buffer_;
+};
+
+/**
+ * Streaming base64 decoder. Text is decoded as it is written, ignoring
+ * whitespace (such as line breaks), and the data is written to the output
+ * in fixed size chunks, so memory use does not depend on the size of the
+ * text.
+ */
+class BCX_API base64_decoder
+{
+public:
+
+    /**
+     * Construct a decoder.
+     * @param[in]  output  The stream to write the data to.
+     * @param[in]  kernel  The kernel to use, which must be supported.
+     */
+    base64_decoder(std::ostream& output,
+        base64_kernel kernel=base64_default_kernel());
+
+    /**
+     * Decode the next part of the text.
+     * @param[in]  text  The text.
+     * @return           False if the text is invalid.
+     */
+    bool write(data_slice text);
+
+    /**
+     * Complete the decoding.
+     * @return  False if the text ends with an incomplete quantum.
+     */
+    bool finish();
+
+private:
+    bool decode(const char* text, size_t size);
+
+    std::ostream& output_;
+    const base64_kernel kernel_;
+    std::string text_;
+    data_chunk buffer_;
+    bool padded_;
+};
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
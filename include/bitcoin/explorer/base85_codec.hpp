@@ -0,0 +1,154 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_BASE85_CODEC_HPP
+#define BX_BASE85_CODEC_HPP
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * Encode data as Z85, equivalent to bc::encode_base85. Each four byte group
+ * is written as one digit and two digit pairs from a table, in place of
+ * five divisions.
+ * @param[out] out  The Z85 text, unchanged on failure.
+ * @param[in]  in   The data to encode, a multiple of four bytes.
+ * @return          False if the data is not a multiple of four bytes.
+ */
+BCX_API bool fast_encode_base85(std::string& out, data_slice in);
+
+/**
+ * Decode Z85 text, equivalent to bc::decode_base85 for valid text. Unlike
+ * bc::decode_base85 a character outside of the alphabet, or a group that
+ * exceeds four bytes, is rejected.
+ * @param[out] out  The decoded data, unchanged on failure.
+ * @param[in]  in   The Z85 text to decode, a multiple of five characters.
+ * @return          True if the text is valid.
+ */
+BCX_API bool fast_decode_base85(data_chunk& out, const std::string& in);
+
+/**
+ * Encode many payloads of the same size, such as 32 byte curve keys, from
+ * consecutive bytes of the data.
+ * @param[out] out   The Z85 texts, one for each payload.
+ * @param[in]  in    The payloads, size bytes each.
+ * @param[in]  size  The size of each payload, a multiple of four bytes.
+ * @return           False if the size is not a (non-zero) multiple of four
+ *                   bytes or does not divide the data.
+ */
+BCX_API bool encode_base85_batch(std::vector<std::string>& out,
+    data_slice in, size_t size);
+
+/**
+ * Validate and decode many Z85 payloads of the same size.
+ * @param[out] out   The payloads, size bytes each in the order of the texts,
+ *                   with zeros in place of each invalid payload.
+ * @param[in]  in    The Z85 texts to decode.
+ * @param[in]  size  The size of each payload.
+ * @return           For each text, true if it decodes to a payload of the
+ *                   size.
+ */
+BCX_API std::vector<bool> decode_base85_batch(data_chunk& out,
+    const std::vector<std::string>& in, size_t size);
+
+/**
+ * Streaming Z85 encoder. Data is encoded as it is written and the text is
+ * written to the output in fixed size chunks, so memory use does not
+ * depend on the size of the data.
+ */
+class BCX_API base85_encoder
+{
+public:
+
+    /**
+     * Construct an encoder.
+     * @param[in]  output  The stream to write the text to.
+     */
+    base85_encoder(std::ostream& output);
+
+    /**
+     * Encode the next part of the data.
+     * @param[in]  data  The data.
+     */
+    void write(data_slice data);
+
+    /**
+     * Complete the encoding.
+     * @return  False if the data is not a multiple of four bytes.
+     */
+    bool finish();
+
+private:
+    void encode(const uint8_t* data, size_t size);
+
+    std::ostream& output_;
+    data_chunk pending_;
+    std::string buffer_;
+};
+
+/**
+ * Streaming Z85 decoder. Text is decoded as it is written, ignoring
+ * whitespace (which is not in the alphabet), and the data is written to the
+ * output in fixed size chunks, so memory use does not depend on the size
+ * of the text.
+ */
+class BCX_API base85_decoder
+{
+public:
+
+    /**
+     * Construct a decoder.
+     * @param[in]  output  The stream to write the data to.
+     */
+    base85_decoder(std::ostream& output);
+
+    /**
+     * Decode the next part of the text.
+     * @param[in]  text  The text.
+     * @return           False if the text is invalid.
+     */
+    bool write(data_slice text);
+
+    /**
+     * Complete the decoding.
+     * @return  False if the text is not a multiple of five characters.
+     */
+    bool finish();
+
+private:
+    bool decode(const char* text, size_t size);
+
+    std::ostream& output_;
+    std::string text_;
+    data_chunk buffer_;
+};
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,60 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_BINARY_WRITER_HPP
+#define BX_BINARY_WRITER_HPP
+
+#include <iostream>
+#include <boost/property_tree/ptree.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * Binary property tree serialization. The schema is that of the property
+ * tree: containers are maps with the same field names, and a field that
+ * repeats (or the single element of a list) is written as an array. Values
+ * are typed by field name, from the fields that prop_tree writes as numbers
+ * or as base16. A numeric field is written as a native integer and a base16
+ * field (a hash) as a byte string in the order in which it is displayed. Any
+ * other field is written as text, whatever its value, so that output does
+ * not depend on the data.
+ */
+
+/**
+ * Serialize a property tree as CBOR (RFC 7049).
+ * @param[out] output  The output stream to write to.
+ * @param[in]  tree    The property tree to serialize.
+ */
+BCX_API void write_cbor(std::ostream& output, const pt::ptree& tree);
+
+/**
+ * Serialize a property tree as MessagePack.
+ * @param[out] output  The output stream to write to.
+ * @param[in]  tree    The property tree to serialize.
+ */
+BCX_API void write_msgpack(std::ostream& output, const pt::ptree& tree);
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
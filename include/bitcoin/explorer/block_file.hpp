@@ -0,0 +1,172 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_BLOCK_FILE_HPP
+#define BX_BLOCK_FILE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+#include <boost/filesystem.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/mapped_file.hpp>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * The size of the blocks parsed together by replay_blocks, which bounds the
+ * memory used by the parsed blocks.
+ */
+BC_CONSTEXPR size_t replay_window_size = 64 * 1024 * 1024;
+
+/**
+ * The location and linkage of a block in a block file (blk*.dat), in which
+ * each block is preceded by the four byte network magic and the four byte
+ * little-endian size of the block.
+ */
+struct BCX_API block_record
+{
+    size_t file;
+    size_t offset;
+    size_t size;
+    hash_digest hash;
+    hash_digest previous;
+};
+
+/**
+ * The result of indexing a block file.
+ */
+enum class block_file_status
+{
+    /**
+     * The blocks of the file are indexed.
+     */
+    valid,
+
+    /**
+     * The file could not be mapped.
+     */
+    unreadable,
+
+    /**
+     * A block of the file is truncated.
+     */
+    truncated,
+
+    /**
+     * A block of the file is preceded by the magic of another network.
+     */
+    other_network
+};
+
+/**
+ * Index the blocks of a block file without parsing the transactions. The
+ * file may end in zeros, as preallocated by the node. The headers of the
+ * file are hashed together with bitcoin256_batch.
+ * @param[out] records  The records of the blocks are appended.
+ * @param[in]  file     The identifier of the file, copied to each record.
+ * @param[in]  data     The content of the file.
+ * @param[in]  magic    The network magic, as the little-endian integer of
+ *                      the four bytes that precede each block.
+ * @return              The status of the file.
+ */
+BCX_API block_file_status index_block_file(
+    std::vector<block_record>& records, size_t file, data_slice data,
+    uint32_t magic);
+
+/**
+ * Index the blocks of a set of block files, in parallel by file.
+ * @param[out] records  The records of the blocks, in order of file.
+ * @param[out] status   The status of the first file that is not valid.
+ * @param[in]  files    The content of the block files.
+ * @param[in]  magic    The network magic, see index_block_file.
+ * @return              The position of the first file that is not valid,
+ *                      the number of files if all are valid.
+ */
+BCX_API size_t index_block_files(std::vector<block_record>& records,
+    block_file_status& status, const std::vector<data_slice>& files,
+    uint32_t magic);
+
+/**
+ * Order the blocks of the longest chain of the records, which starts at the
+ * block without a previous block. Blocks that are not in the chain, or that
+ * are not linked to it, are excluded.
+ * @param[in]  records  The block records, in any order.
+ * @return              The positions of the chain blocks in the records,
+ *                      where the position in the result is the height.
+ */
+BCX_API std::vector<size_t> block_chain(
+    const std::vector<block_record>& records);
+
+/**
+ * Map and index a set of block files. The files must stay mapped for as long
+ * as their content is used, and a deque does not move its elements as it
+ * grows.
+ * @param[out] mapped   The mapped files, in order of path.
+ * @param[out] files    The content of the mapped files.
+ * @param[out] records  The records of the blocks, see index_block_files.
+ * @param[out] status   The status of the first path that is not valid.
+ * @param[in]  paths    The paths of the block files.
+ * @param[in]  magic    The network magic, see index_block_file.
+ * @return              The position of the first path that could not be
+ *                      mapped or is not valid, the number of paths if all
+ *                      are valid.
+ */
+BCX_API size_t load_block_files(std::deque<mapped_file>& mapped,
+    std::vector<data_slice>& files, std::vector<block_record>& records,
+    block_file_status& status,
+    const std::vector<boost::filesystem::path>& paths, uint32_t magic);
+
+/**
+ * Replay a range of the blocks of a chain in windows of consecutive blocks.
+ * The blocks of a window are parsed in parallel, and then the window is
+ * applied, so that windows are applied in order of height.
+ * @param      <Block>    The type of a parsed block, default constructible.
+ * @param      <Parse>    The type of the parse function, which is called as
+ *                        parse(Block&, size_t height, data_slice block) and
+ *                        must be safe to call concurrently.
+ * @param      <Apply>    The type of the apply function, which is called as
+ *                        apply(std::vector<Block>& window, size_t first) and
+ *                        returns false to stop the replay.
+ * @param[in]  files      The content of the block files.
+ * @param[in]  records    The block records of the files.
+ * @param[in]  chain      The chain of the records, see block_chain.
+ * @param[in]  first      The height of the first block to replay.
+ * @param[in]  last       The height after the last block to replay.
+ * @param[in]  parse      The function to parse each block.
+ * @param[in]  apply      The function to apply each window.
+ * @return                False if the replay was stopped.
+ */
+template <typename Block, typename Parse, typename Apply>
+bool replay_blocks(const std::vector<data_slice>& files,
+    const std::vector<block_record>& records,
+    const std::vector<size_t>& chain, size_t first, size_t last,
+    Parse parse, Apply apply);
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#include <bitcoin/explorer/impl/block_file.ipp>
+
+#endif
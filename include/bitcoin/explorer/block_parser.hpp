@@ -0,0 +1,69 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_BLOCK_PARSER_HPP
+#define BX_BLOCK_PARSER_HPP
+
+#include <cstddef>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * Parse a serialized block in place, such as from a mapped file, recording
+ * the serialized data of each transaction so that the transaction hashes
+ * can be computed from the data rather than by serializing again.
+ * @param[out] block         The parsed block.
+ * @param[out] transactions  The serialized data of each transaction, which
+ *                           refers to the data.
+ * @param[in]  data          The serialized block, which may be followed by
+ *                           other data.
+ * @return                   The size of the block, zero if not valid.
+ */
+BCX_API size_t parse_block(chain::block& block,
+    std::vector<data_slice>& transactions, data_slice data);
+
+/**
+ * Hash serialized transactions, equivalent to bc::bitcoin_hash of each.
+ * Runs of transactions are hashed in parallel with bitcoin256_batch.
+ * @param[in]  transactions  The serialized transactions.
+ * @param[in]  threads       The number of threads, zero for hardware threads.
+ * @return                   The hash of each transaction, in order.
+ */
+BCX_API std::vector<hash_digest> transaction_hashes(
+    const std::vector<data_slice>& transactions, size_t threads=0);
+
+/**
+ * Compute the merkle root of transaction hashes, equivalent to
+ * chain::block::generate_merkle_root. Each level of the tree is hashed with
+ * bitcoin256_batch.
+ * @param[in]  hashes  The transaction hashes, in block order.
+ * @return             The merkle root, null_hash if there are no hashes.
+ */
+BCX_API hash_digest merkle_root(const std::vector<hash_digest>& hashes);
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
@@ -22,11 +22,14 @@
 
 #include <iostream>
 #include <cstdint>
+#include <functional>
 #include <string>
 #include <boost/format.hpp>
 #include <boost/property_tree/ptree.hpp>
 #include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/output_sink.hpp>
 #include <bitcoin/explorer/primitives/encoding.hpp>
+#include <bitcoin/explorer/prop_writer.hpp>
 
 /* NOTE: don't declare 'using namespace foo' in headers. */
 
@@ -52,6 +55,18 @@ public:
     BCX_API callback_state(std::ostream& error, std::ostream& output,
         const encoding_engine engine);
 
+    /**
+     * Construct an instance of the callback_state class with buffered output.
+     * Output is written to the output stream according to the flush policy
+     * and when the instance is destroyed.
+     * @param[in]  error   The error stream for the callback handler.
+     * @param[in]  output  The output stream for the callback handler.
+     * @param[in]  engine  The desired output format.
+     * @param[in]  policy  The output flush policy.
+     */
+    BCX_API callback_state(std::ostream& error, std::ostream& output,
+        const encoding_engine engine, flush_policy policy);
+
     /**
      * Construct an instance of the callback_state class with native encoding.
      * @param[in]  error   The error stream for the callback handler.
@@ -87,6 +102,14 @@ public:
      */
     BCX_API virtual void output(const pt::ptree tree);
 
+    /**
+     * Stream a property document to output, element by element, without
+     * first building a property tree. The stream is flushed before returning.
+     * @param[in]  write  The function that writes the document elements.
+     */
+    BCX_API virtual void output(
+        const std::function<void(prop_writer&)>& write);
+
     /**
      * Write a line to the output stream. The stream must be flushed before 
      * returning in order to prevent interleaving on the shared stream.
@@ -108,6 +131,11 @@ public:
      */
     BCX_API virtual void output(uint64_t value);
 
+    /**
+     * Write any buffered output to the output stream.
+     */
+    BCX_API virtual void flush();
+
     /**
      * Set the callback refcount to one and reset result to okay.
      */
@@ -183,6 +211,8 @@ private:
     console_result result_;
     encoding_engine engine_;
     std::ostream& error_;
+    output_sink sink_;
+    std::ostream buffered_;
     std::ostream& output_;
 };
 
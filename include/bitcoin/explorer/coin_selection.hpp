@@ -0,0 +1,131 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_COIN_SELECTION_HPP
+#define BX_COIN_SELECTION_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * Suppported coin selection algorithms.
+ */
+enum class selection_algorithm
+{
+    /**
+     * Search for a set of outputs that pays the amount without change,
+     * falling back to largest if there is no such set.
+     */
+    exact,
+
+    /**
+     * As exact, but outputs are valued net of the fee to spend them.
+     */
+    fee,
+
+    /**
+     * The smallest single output that pays the amount, otherwise the
+     * fewest outputs accumulated from the largest down.
+     */
+    largest
+};
+
+/**
+ * An unspent output available for selection.
+ */
+struct BCX_API unspent_output
+{
+    chain::output_point point;
+    uint64_t value;
+};
+
+/**
+ * A set of unspent outputs.
+ */
+typedef std::vector<unspent_output> unspent_list;
+
+/**
+ * The maximum number of branches that an exact search will visit before
+ * abandoning the search. This bounds selection time for very large sets.
+ */
+BC_CONSTEXPR size_t selection_search_limit = 100000;
+
+/**
+ * Parse a coin selection algorithm from its name.
+ * @param[out] out    The parsed algorithm.
+ * @param[in]  token  The algorithm name.
+ * @return            True if the token is a valid algorithm name.
+ */
+BCX_API bool parse_selection_algorithm(selection_algorithm& out,
+    const std::string& token);
+
+/**
+ * Select unspent outputs sufficient to pay an amount.
+ * @param[out] out        The selected outputs, in selection order.
+ * @param[in]  unspent    The unspent outputs from which to select.
+ * @param[in]  amount     The amount in satoshi to pay.
+ * @param[in]  algorithm  The selection algorithm.
+ * @param[in]  fee        The fee in satoshi to spend each selected output,
+ *                        used by the fee algorithm.
+ * @param[in]  tolerance  The amount in satoshi by which an exact or fee
+ *                        selection may exceed the amount (and its fees).
+ * @return                True if the unspent outputs are sufficient.
+ */
+BCX_API bool select_outputs(unspent_list& out, const unspent_list& unspent,
+    uint64_t amount, selection_algorithm algorithm, uint64_t fee=0,
+    uint64_t tolerance=0);
+
+/**
+ * Select the smallest single output that pays the amount, otherwise
+ * accumulate outputs from the largest down until the amount is paid.
+ * @param[out] out      The selected outputs, in selection order.
+ * @param[in]  unspent  The unspent outputs from which to select.
+ * @param[in]  amount   The amount in satoshi to pay.
+ * @return              True if the unspent outputs are sufficient.
+ */
+BCX_API bool select_largest(unspent_list& out, const unspent_list& unspent,
+    uint64_t amount);
+
+/**
+ * Branch-and-bound search for the set of outputs with the least total that
+ * pays the amount within the tolerance. The search is bounded by
+ * selection_search_limit and does not fall back on failure.
+ * @param[out] out        The selected outputs, in descending value order.
+ * @param[in]  unspent    The unspent outputs from which to select.
+ * @param[in]  amount     The amount in satoshi to pay.
+ * @param[in]  tolerance  The amount in satoshi by which the selection may
+ *                        exceed the amount.
+ * @return                True if a set was found.
+ */
+BCX_API bool select_exact(unspent_list& out, const unspent_list& unspent,
+    uint64_t amount, uint64_t tolerance=0);
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
@@ -232,7 +232,7 @@ public:
         (
             "network.identifier",
             value<uint32_t>(&setting_.network.identifier)->default_value(3652501241),
-            "The magic number for message headers, defaults to 3652501241."
+            "The magic number for message headers and block files, defaults to 3652501241."
         )
         (
             "network.connect_retries",
@@ -31,6 +31,7 @@
 #include <bitcoin/explorer/generated.hpp>
 #include <bitcoin/explorer/primitives/address.hpp>
 #include <bitcoin/explorer/primitives/base16.hpp>
+#include <bitcoin/explorer/primitives/base16_stream.hpp>
 #include <bitcoin/explorer/primitives/base2.hpp>
 #include <bitcoin/explorer/primitives/base58.hpp>
 #include <bitcoin/explorer/primitives/base64.hpp>
@@ -38,13 +39,16 @@
 #include <bitcoin/explorer/primitives/btc.hpp>
 #include <bitcoin/explorer/primitives/btc160.hpp>
 #include <bitcoin/explorer/primitives/byte.hpp>
+#include <bitcoin/explorer/primitives/byte_stream.hpp>
 #include <bitcoin/explorer/primitives/cert_key.hpp>
 #include <bitcoin/explorer/primitives/ec_private.hpp>
 #include <bitcoin/explorer/primitives/encoding.hpp>
 #include <bitcoin/explorer/primitives/endorsement.hpp>
 #include <bitcoin/explorer/primitives/hashtype.hpp>
 #include <bitcoin/explorer/primitives/hd_key.hpp>
+#include <bitcoin/explorer/primitives/hd_path.hpp>
 #include <bitcoin/explorer/primitives/header.hpp>
+#include <bitcoin/explorer/primitives/index_range.hpp>
 #include <bitcoin/explorer/primitives/input.hpp>
 #include <bitcoin/explorer/primitives/language.hpp>
 #include <bitcoin/explorer/primitives/output.hpp>
@@ -52,6 +56,7 @@
 #include <bitcoin/explorer/primitives/script.hpp>
 #include <bitcoin/explorer/primitives/signature.hpp>
 #include <bitcoin/explorer/primitives/transaction.hpp>
+#include <bitcoin/explorer/primitives/transaction_stream.hpp>
 #include <bitcoin/explorer/primitives/wrapper.hpp>
 #include <bitcoin/explorer/utility.hpp>
 
@@ -61,6 +66,14 @@ namespace libbitcoin {
 namespace explorer {
 namespace commands {
 
+/**
+ * Various localizable strings.
+ */
+#define BX_BASE64_DECODE_FILE_INVALID \
+    "The file could not be read: %1%."
+#define BX_BASE64_DECODE_INVALID \
+    "The Base64 value is not valid."
+
 /**
  * Class to implement the base64-decode command.
  */
@@ -102,6 +115,15 @@ public:
         return "Convert a Base64 value to binary data.";
     }
 
+    /**
+     * Determines if STDIN is required to be raw.
+     * @return  True if the type of the STDIN argument is primitive::raw.
+     */
+    virtual bool requires_raw_input()
+    {
+        return true;
+    }
+
     /**
      * Determines if STDOUT is required to be raw.
      * @return  True if the type of the STDOUT argument is primitive::raw.
@@ -154,10 +176,15 @@ public:
             value<boost::filesystem::path>(),
             "The path to the configuration settings file."
         )
+        (
+            "file,f",
+            value<boost::filesystem::path>(&option_.file),
+            "The path of a file to decode in place of BASE64. The file is memory mapped and decoded in chunks."
+        )
         (
             "BASE64",
-            value<primitives::base64>(&argument_.base64),
-            "The Base64 value to decode as binary data. If not specified the value is read from STDIN."
+            value<primitives::byte_stream>(&argument_.base64),
+            "The Base64 value to decode as binary data. Whitespace is ignored. If not specified the value is read from STDIN in chunks."
         );
 
         return options;
@@ -185,7 +212,7 @@ public:
     /**
      * Get the value of the BASE64 argument.
      */
-    virtual primitives::base64& get_base64_argument()
+    virtual primitives::byte_stream& get_base64_argument()
     {
         return argument_.base64;
     }
@@ -194,11 +221,28 @@ public:
      * Set the value of the BASE64 argument.
      */
     virtual void set_base64_argument(
-        const primitives::base64& value)
+        const primitives::byte_stream& value)
     {
         argument_.base64 = value;
     }
 
+    /**
+     * Get the value of the file option.
+     */
+    virtual boost::filesystem::path& get_file_option()
+    {
+        return option_.file;
+    }
+
+    /**
+     * Set the value of the file option.
+     */
+    virtual void set_file_option(
+        const boost::filesystem::path& value)
+    {
+        option_.file = value;
+    }
+
 private:
 
     /**
@@ -213,7 +257,7 @@ private:
         {
         }
 
-        primitives::base64 base64;
+        primitives::byte_stream base64;
     } argument_;
 
     /**
@@ -224,9 +268,11 @@ private:
     struct option
     {
         option()
+          : file()
         {
         }
 
+        boost::filesystem::path file;
     } option_;
 };
 
@@ -31,6 +31,7 @@
 #include <bitcoin/explorer/generated.hpp>
 #include <bitcoin/explorer/primitives/address.hpp>
 #include <bitcoin/explorer/primitives/base16.hpp>
+#include <bitcoin/explorer/primitives/base16_stream.hpp>
 #include <bitcoin/explorer/primitives/base2.hpp>
 #include <bitcoin/explorer/primitives/base58.hpp>
 #include <bitcoin/explorer/primitives/base64.hpp>
@@ -38,13 +39,16 @@
 #include <bitcoin/explorer/primitives/btc.hpp>
 #include <bitcoin/explorer/primitives/btc160.hpp>
 #include <bitcoin/explorer/primitives/byte.hpp>
+#include <bitcoin/explorer/primitives/byte_stream.hpp>
 #include <bitcoin/explorer/primitives/cert_key.hpp>
 #include <bitcoin/explorer/primitives/ec_private.hpp>
 #include <bitcoin/explorer/primitives/encoding.hpp>
 #include <bitcoin/explorer/primitives/endorsement.hpp>
 #include <bitcoin/explorer/primitives/hashtype.hpp>
 #include <bitcoin/explorer/primitives/hd_key.hpp>
+#include <bitcoin/explorer/primitives/hd_path.hpp>
 #include <bitcoin/explorer/primitives/header.hpp>
+#include <bitcoin/explorer/primitives/index_range.hpp>
 #include <bitcoin/explorer/primitives/input.hpp>
 #include <bitcoin/explorer/primitives/language.hpp>
 #include <bitcoin/explorer/primitives/output.hpp>
@@ -52,6 +56,7 @@
 #include <bitcoin/explorer/primitives/script.hpp>
 #include <bitcoin/explorer/primitives/signature.hpp>
 #include <bitcoin/explorer/primitives/transaction.hpp>
+#include <bitcoin/explorer/primitives/transaction_stream.hpp>
 #include <bitcoin/explorer/primitives/wrapper.hpp>
 #include <bitcoin/explorer/utility.hpp>
 
@@ -61,6 +66,12 @@ namespace libbitcoin {
 namespace explorer {
 namespace commands {
 
+/**
+ * Various localizable strings.
+ */
+#define BX_BASE64_ENCODE_FILE_INVALID \
+    "The file could not be read: %1%."
+
 /**
  * Class to implement the base64-encode command.
  */
@@ -154,10 +165,15 @@ public:
             value<boost::filesystem::path>(),
             "The path to the configuration settings file."
         )
+        (
+            "file,f",
+            value<boost::filesystem::path>(&option_.file),
+            "The path of a file to encode in place of DATA. The file is memory mapped and encoded in chunks."
+        )
         (
             "DATA",
-            value<primitives::raw>(&argument_.data),
-            "The binary data to encode as Base64. This can be text or any other data. If not specified the data is read from STDIN."
+            value<primitives::byte_stream>(&argument_.data),
+            "The binary data to encode as Base64. This can be text or any other data. If not specified the data is read from STDIN in chunks."
         );
 
         return options;
@@ -185,7 +201,7 @@ public:
     /**
      * Get the value of the DATA argument.
      */
-    virtual primitives::raw& get_data_argument()
+    virtual primitives::byte_stream& get_data_argument()
     {
         return argument_.data;
     }
@@ -194,11 +210,28 @@ public:
      * Set the value of the DATA argument.
      */
     virtual void set_data_argument(
-        const primitives::raw& value)
+        const primitives::byte_stream& value)
     {
         argument_.data = value;
     }
 
+    /**
+     * Get the value of the file option.
+     */
+    virtual boost::filesystem::path& get_file_option()
+    {
+        return option_.file;
+    }
+
+    /**
+     * Set the value of the file option.
+     */
+    virtual void set_file_option(
+        const boost::filesystem::path& value)
+    {
+        option_.file = value;
+    }
+
 private:
 
     /**
@@ -213,7 +246,7 @@ private:
         {
         }
 
-        primitives::raw data;
+        primitives::byte_stream data;
     } argument_;
 
     /**
@@ -224,9 +257,11 @@ private:
     struct option
     {
         option()
+          : file()
         {
         }
 
+        boost::filesystem::path file;
     } option_;
 };
 
@@ -0,0 +1,354 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_EC_VANITY_HPP
+#define BX_EC_VANITY_HPP
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/program_options.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/command.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/generated.hpp>
+#include <bitcoin/explorer/primitives/address.hpp>
+#include <bitcoin/explorer/primitives/base16.hpp>
+#include <bitcoin/explorer/primitives/base16_stream.hpp>
+#include <bitcoin/explorer/primitives/base2.hpp>
+#include <bitcoin/explorer/primitives/base58.hpp>
+#include <bitcoin/explorer/primitives/base64.hpp>
+#include <bitcoin/explorer/primitives/base85.hpp>
+#include <bitcoin/explorer/primitives/btc.hpp>
+#include <bitcoin/explorer/primitives/btc160.hpp>
+#include <bitcoin/explorer/primitives/byte.hpp>
+#include <bitcoin/explorer/primitives/byte_stream.hpp>
+#include <bitcoin/explorer/primitives/cert_key.hpp>
+#include <bitcoin/explorer/primitives/ec_private.hpp>
+#include <bitcoin/explorer/primitives/encoding.hpp>
+#include <bitcoin/explorer/primitives/endorsement.hpp>
+#include <bitcoin/explorer/primitives/hashtype.hpp>
+#include <bitcoin/explorer/primitives/hd_key.hpp>
+#include <bitcoin/explorer/primitives/hd_path.hpp>
+#include <bitcoin/explorer/primitives/header.hpp>
+#include <bitcoin/explorer/primitives/index_range.hpp>
+#include <bitcoin/explorer/primitives/input.hpp>
+#include <bitcoin/explorer/primitives/language.hpp>
+#include <bitcoin/explorer/primitives/output.hpp>
+#include <bitcoin/explorer/primitives/raw.hpp>
+#include <bitcoin/explorer/primitives/script.hpp>
+#include <bitcoin/explorer/primitives/signature.hpp>
+#include <bitcoin/explorer/primitives/transaction.hpp>
+#include <bitcoin/explorer/primitives/transaction_stream.hpp>
+#include <bitcoin/explorer/primitives/wrapper.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+/********* GENERATED SOURCE CODE, DO NOT EDIT EXCEPT EXPERIMENTALLY **********/
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+
+/**
+ * Various localizable strings.
+ */
+#define BX_EC_VANITY_DIFFICULTY \
+    "The expected number of keys to search is %1$.0f."
+#define BX_EC_VANITY_IMPOSSIBLE_PREFIX \
+    "No payment address of the version begins with the prefix: %1%."
+#define BX_EC_VANITY_INVALID_PREFIX \
+    "The prefix is not Base58: %1%."
+#define BX_EC_VANITY_LIMIT \
+    "No key was found in the limit of %1% keys."
+#define BX_EC_VANITY_NOT_FOUND \
+    "The seed produced an invalid key."
+#define BX_EC_VANITY_RATE \
+    "Searched %1% keys in %2$.1f seconds, %3$.0f keys per second."
+#define BX_EC_VANITY_SHORT_SEED \
+    "The seed is less than 128 bits long."
+
+/**
+ * Class to implement the ec-vanity command.
+ */
+class BCX_API ec_vanity 
+  : public command
+{
+public:
+
+    /**
+     * The symbolic (not localizable) command name, lower case.
+     */
+    static const char* symbol()
+    {
+        return "ec-vanity";
+    }
+
+
+    /**
+     * The member symbolic (not localizable) command name, lower case.
+     */
+    virtual const char* name()
+    {
+        return ec_vanity::symbol();
+    }
+
+    /**
+     * The localizable command category name, upper case.
+     */
+    virtual const char* category()
+    {
+        return "WALLET";
+    }
+
+    /**
+     * The localizable command description.
+     */
+    virtual const char* description()
+    {
+        return "Search for a new Base16 EC private key whose payment address begins with a Base58 prefix. The key and its address are written on separate lines, and the expected number of keys to search and the search rate, each second and at the end of the search, are written to STDERR.";
+    }
+
+    /**
+     * Load program argument definitions.
+     * A value of -1 indicates that the number of instances is unlimited.
+     * @return  The loaded program argument definitions.
+     */
+    virtual arguments_metadata& load_arguments()
+    {
+        return get_argument_metadata()
+            .add("PREFIX", 1)
+            .add("SEED", 1);
+    }
+
+	/**
+     * Load parameter fallbacks from file or input as appropriate.
+     * @param[in]  input  The input stream for loading the parameters.
+     * @param[in]         The loaded variables.
+     */
+    virtual void load_fallbacks(std::istream& input, 
+        po::variables_map& variables)
+    {
+        const auto raw = requires_raw_input();
+        load_input(get_seed_argument(), "SEED", variables, input, raw);
+    }
+
+    /**
+     * Load program option definitions.
+     * BUGBUG: see boost bug/fix: svn.boost.org/trac/boost/ticket/8009
+     * @return  The loaded program option definitions.
+     */
+    virtual options_metadata& load_options()
+    {
+        using namespace po;
+        options_description& options = get_option_metadata();
+        options.add_options()
+        (
+            BX_HELP_VARIABLE ",h",
+            value<bool>()->zero_tokens(),
+            "Get a description and instructions for this command."
+        )
+        (
+            BX_CONFIG_VARIABLE ",c",
+            value<boost::filesystem::path>(),
+            "The path to the configuration settings file."
+        )
+        (
+            "limit,l",
+            value<uint64_t>(&option_.limit),
+            "The number of keys after which to stop the search, defaults to zero for no limit."
+        )
+        (
+            "threads,t",
+            value<uint32_t>(&option_.threads),
+            "The number of search threads, defaults to zero for one per processor core."
+        )
+        (
+            "version,v",
+            value<primitives::byte>(&option_.version)->default_value(0),
+            "The desired payment address version."
+        )
+        (
+            "PREFIX",
+            value<std::string>(&argument_.prefix)->required(),
+            "The Base58 prefix of the payment address, such as 1Bx."
+        )
+        (
+            "SEED",
+            value<primitives::base16>(&argument_.seed),
+            "The Base16 entropy from which each thread starts its search. Must be at least 128 bits in length. If not specified the seed is read from STDIN."
+        );
+
+        return options;
+    }
+
+    /**
+     * Set variable defaults from configuration variable values.
+     * @param[in]  variables  The loaded variables.
+     */
+    virtual void set_defaults_from_config(po::variables_map& variables)
+    {
+        const auto& option_version = variables["version"];
+        const auto& option_version_config = variables["wallet.pay_to_public_key_hash_version"];
+        if (option_version.defaulted() && !option_version_config.defaulted())
+        {
+            option_.version = option_version_config.as<primitives::byte>();
+        }
+    }
+
+    /**
+     * Invoke the command.
+     * @param[out]  output  The input stream for the command execution.
+     * @param[out]  error   The input stream for the command execution.
+     * @return              The appropriate console return code { -1, 0, 1 }.
+     */
+    virtual console_result invoke(std::ostream& output,
+        std::ostream& cerr);
+
+    /* Properties */
+
+    /**
+     * Get the value of the PREFIX argument.
+     */
+    virtual std::string& get_prefix_argument()
+    {
+        return argument_.prefix;
+    }
+
+    /**
+     * Set the value of the PREFIX argument.
+     */
+    virtual void set_prefix_argument(
+        const std::string& value)
+    {
+        argument_.prefix = value;
+    }
+
+    /**
+     * Get the value of the SEED argument.
+     */
+    virtual primitives::base16& get_seed_argument()
+    {
+        return argument_.seed;
+    }
+
+    /**
+     * Set the value of the SEED argument.
+     */
+    virtual void set_seed_argument(
+        const primitives::base16& value)
+    {
+        argument_.seed = value;
+    }
+
+    /**
+     * Get the value of the limit option.
+     */
+    virtual uint64_t& get_limit_option()
+    {
+        return option_.limit;
+    }
+
+    /**
+     * Set the value of the limit option.
+     */
+    virtual void set_limit_option(
+        const uint64_t& value)
+    {
+        option_.limit = value;
+    }
+
+    /**
+     * Get the value of the threads option.
+     */
+    virtual uint32_t& get_threads_option()
+    {
+        return option_.threads;
+    }
+
+    /**
+     * Set the value of the threads option.
+     */
+    virtual void set_threads_option(
+        const uint32_t& value)
+    {
+        option_.threads = value;
+    }
+
+    /**
+     * Get the value of the version option.
+     */
+    virtual primitives::byte& get_version_option()
+    {
+        return option_.version;
+    }
+
+    /**
+     * Set the value of the version option.
+     */
+    virtual void set_version_option(
+        const primitives::byte& value)
+    {
+        option_.version = value;
+    }
+
+private:
+
+    /**
+     * Command line argument bound variables.
+     * Uses cross-compiler safe constructor-based zeroize.
+     * Zeroize for unit test consistency with program_options initialization.
+     */
+    struct argument
+    {
+        argument()
+          : prefix(),
+            seed()
+        {
+        }
+
+        std::string prefix;
+        primitives::base16 seed;
+    } argument_;
+
+    /**
+     * Command line option bound variables.
+     * Uses cross-compiler safe constructor-based zeroize.
+     * Zeroize for unit test consistency with program_options initialization.
+     */
+    struct option
+    {
+        option()
+          : limit(),
+            threads(),
+            version()
+        {
+        }
+
+        uint64_t limit;
+        uint32_t threads;
+        primitives::byte version;
+    } option_;
+};
+
+} // namespace commands
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
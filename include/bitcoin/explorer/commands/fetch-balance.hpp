@@ -31,6 +31,7 @@
 #include <bitcoin/explorer/generated.hpp>
 #include <bitcoin/explorer/primitives/address.hpp>
 #include <bitcoin/explorer/primitives/base16.hpp>
+#include <bitcoin/explorer/primitives/base16_stream.hpp>
 #include <bitcoin/explorer/primitives/base2.hpp>
 #include <bitcoin/explorer/primitives/base58.hpp>
 #include <bitcoin/explorer/primitives/base64.hpp>
@@ -38,13 +39,16 @@
 #include <bitcoin/explorer/primitives/btc.hpp>
 #include <bitcoin/explorer/primitives/btc160.hpp>
 #include <bitcoin/explorer/primitives/byte.hpp>
+#include <bitcoin/explorer/primitives/byte_stream.hpp>
 #include <bitcoin/explorer/primitives/cert_key.hpp>
 #include <bitcoin/explorer/primitives/ec_private.hpp>
 #include <bitcoin/explorer/primitives/encoding.hpp>
 #include <bitcoin/explorer/primitives/endorsement.hpp>
 #include <bitcoin/explorer/primitives/hashtype.hpp>
 #include <bitcoin/explorer/primitives/hd_key.hpp>
+#include <bitcoin/explorer/primitives/hd_path.hpp>
 #include <bitcoin/explorer/primitives/header.hpp>
+#include <bitcoin/explorer/primitives/index_range.hpp>
 #include <bitcoin/explorer/primitives/input.hpp>
 #include <bitcoin/explorer/primitives/language.hpp>
 #include <bitcoin/explorer/primitives/output.hpp>
@@ -52,6 +56,7 @@
 #include <bitcoin/explorer/primitives/script.hpp>
 #include <bitcoin/explorer/primitives/signature.hpp>
 #include <bitcoin/explorer/primitives/transaction.hpp>
+#include <bitcoin/explorer/primitives/transaction_stream.hpp>
 #include <bitcoin/explorer/primitives/wrapper.hpp>
 #include <bitcoin/explorer/utility.hpp>
 
@@ -61,6 +66,16 @@ namespace libbitcoin {
 namespace explorer {
 namespace commands {
 
+/**
+ * Various localizable strings.
+ */
+#define BX_FETCH_BALANCE_INDEX_INVALID \
+    "The index could not be read: %1%."
+#define BX_FETCH_BALANCE_SNAPSHOT_AND_INDEX \
+    "The snapshot and local_index options cannot be specified together."
+#define BX_FETCH_BALANCE_SNAPSHOT_INVALID \
+    "The snapshot could not be read: %1%."
+
 /**
  * Class to implement the fetch-balance command.
  */
@@ -148,7 +163,17 @@ public:
         (
             "format,f",
             value<primitives::encoding>(&option_.format),
-            "The output format. Options are 'info', 'json' and 'xml', defaults to 'info'."
+            "The output format. Options are 'info', 'json', 'ndjson', 'xml', 'cbor', 'msgpack', 'csv' and 'tsv', defaults to 'info'."
+        )
+        (
+            "local_index,l",
+            value<boost::filesystem::path>(&option_.local_index),
+            "The path of a local address index to query in place of the server. See index-blocks."
+        )
+        (
+            "snapshot,s",
+            value<boost::filesystem::path>(&option_.snapshot),
+            "The path of a UTXO snapshot to query in place of the server. A snapshot holds only unspent outputs, so the received value is omitted. Cannot be used with local_index. See utxo-snapshot."
         )
         (
             "PAYMENT_ADDRESS",
@@ -212,6 +237,40 @@ public:
         option_.format = value;
     }
 
+    /**
+     * Get the value of the local_index option.
+     */
+    virtual boost::filesystem::path& get_local_index_option()
+    {
+        return option_.local_index;
+    }
+
+    /**
+     * Set the value of the local_index option.
+     */
+    virtual void set_local_index_option(
+        const boost::filesystem::path& value)
+    {
+        option_.local_index = value;
+    }
+
+    /**
+     * Get the value of the snapshot option.
+     */
+    virtual boost::filesystem::path& get_snapshot_option()
+    {
+        return option_.snapshot;
+    }
+
+    /**
+     * Set the value of the snapshot option.
+     */
+    virtual void set_snapshot_option(
+        const boost::filesystem::path& value)
+    {
+        option_.snapshot = value;
+    }
+
 private:
 
     /**
@@ -237,11 +296,15 @@ private:
     struct option
     {
         option()
-          : format()
+          : format(),
+            local_index(),
+            snapshot()
         {
         }
 
         primitives::encoding format;
+        boost::filesystem::path local_index;
+        boost::filesystem::path snapshot;
     } option_;
 };
 
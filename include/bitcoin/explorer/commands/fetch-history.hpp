@@ -31,6 +31,7 @@
 #include <bitcoin/explorer/generated.hpp>
 #include <bitcoin/explorer/primitives/address.hpp>
 #include <bitcoin/explorer/primitives/base16.hpp>
+#include <bitcoin/explorer/primitives/base16_stream.hpp>
 #include <bitcoin/explorer/primitives/base2.hpp>
 #include <bitcoin/explorer/primitives/base58.hpp>
 #include <bitcoin/explorer/primitives/base64.hpp>
@@ -38,13 +39,16 @@
 #include <bitcoin/explorer/primitives/btc.hpp>
 #include <bitcoin/explorer/primitives/btc160.hpp>
 #include <bitcoin/explorer/primitives/byte.hpp>
+#include <bitcoin/explorer/primitives/byte_stream.hpp>
 #include <bitcoin/explorer/primitives/cert_key.hpp>
 #include <bitcoin/explorer/primitives/ec_private.hpp>
 #include <bitcoin/explorer/primitives/encoding.hpp>
 #include <bitcoin/explorer/primitives/endorsement.hpp>
 #include <bitcoin/explorer/primitives/hashtype.hpp>
 #include <bitcoin/explorer/primitives/hd_key.hpp>
+#include <bitcoin/explorer/primitives/hd_path.hpp>
 #include <bitcoin/explorer/primitives/header.hpp>
+#include <bitcoin/explorer/primitives/index_range.hpp>
 #include <bitcoin/explorer/primitives/input.hpp>
 #include <bitcoin/explorer/primitives/language.hpp>
 #include <bitcoin/explorer/primitives/output.hpp>
@@ -52,6 +56,7 @@
 #include <bitcoin/explorer/primitives/script.hpp>
 #include <bitcoin/explorer/primitives/signature.hpp>
 #include <bitcoin/explorer/primitives/transaction.hpp>
+#include <bitcoin/explorer/primitives/transaction_stream.hpp>
 #include <bitcoin/explorer/primitives/wrapper.hpp>
 #include <bitcoin/explorer/utility.hpp>
 
@@ -61,6 +66,12 @@ namespace libbitcoin {
 namespace explorer {
 namespace commands {
 
+/**
+ * Various localizable strings.
+ */
+#define BX_FETCH_HISTORY_INDEX_INVALID \
+    "The index could not be read: %1%."
+
 /**
  * Class to implement the fetch-history command.
  */
@@ -148,7 +159,12 @@ public:
         (
             "format,f",
             value<primitives::encoding>(&option_.format),
-            "The output format. Options are 'info', 'json' and 'xml', defaults to 'info'."
+            "The output format. Options are 'info', 'json', 'ndjson', 'xml', 'cbor', 'msgpack', 'csv' and 'tsv', defaults to 'info'."
+        )
+        (
+            "local_index,l",
+            value<boost::filesystem::path>(&option_.local_index),
+            "The path of a local address index to query in place of the server. See index-blocks."
         )
         (
             "PAYMENT_ADDRESS",
@@ -212,6 +228,23 @@ public:
         option_.format = value;
     }
 
+    /**
+     * Get the value of the local_index option.
+     */
+    virtual boost::filesystem::path& get_local_index_option()
+    {
+        return option_.local_index;
+    }
+
+    /**
+     * Set the value of the local_index option.
+     */
+    virtual void set_local_index_option(
+        const boost::filesystem::path& value)
+    {
+        option_.local_index = value;
+    }
+
 private:
 
     /**
@@ -237,11 +270,13 @@ private:
     struct option
     {
         option()
-          : format()
+          : format(),
+            local_index()
         {
         }
 
         primitives::encoding format;
+        boost::filesystem::path local_index;
     } option_;
 };
 
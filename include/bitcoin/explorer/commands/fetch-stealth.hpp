@@ -31,6 +31,7 @@
 #include <bitcoin/explorer/generated.hpp>
 #include <bitcoin/explorer/primitives/address.hpp>
 #include <bitcoin/explorer/primitives/base16.hpp>
+#include <bitcoin/explorer/primitives/base16_stream.hpp>
 #include <bitcoin/explorer/primitives/base2.hpp>
 #include <bitcoin/explorer/primitives/base58.hpp>
 #include <bitcoin/explorer/primitives/base64.hpp>
@@ -38,13 +39,16 @@
 #include <bitcoin/explorer/primitives/btc.hpp>
 #include <bitcoin/explorer/primitives/btc160.hpp>
 #include <bitcoin/explorer/primitives/byte.hpp>
+#include <bitcoin/explorer/primitives/byte_stream.hpp>
 #include <bitcoin/explorer/primitives/cert_key.hpp>
 #include <bitcoin/explorer/primitives/ec_private.hpp>
 #include <bitcoin/explorer/primitives/encoding.hpp>
 #include <bitcoin/explorer/primitives/endorsement.hpp>
 #include <bitcoin/explorer/primitives/hashtype.hpp>
 #include <bitcoin/explorer/primitives/hd_key.hpp>
+#include <bitcoin/explorer/primitives/hd_path.hpp>
 #include <bitcoin/explorer/primitives/header.hpp>
+#include <bitcoin/explorer/primitives/index_range.hpp>
 #include <bitcoin/explorer/primitives/input.hpp>
 #include <bitcoin/explorer/primitives/language.hpp>
 #include <bitcoin/explorer/primitives/output.hpp>
@@ -52,6 +56,7 @@
 #include <bitcoin/explorer/primitives/script.hpp>
 #include <bitcoin/explorer/primitives/signature.hpp>
 #include <bitcoin/explorer/primitives/transaction.hpp>
+#include <bitcoin/explorer/primitives/transaction_stream.hpp>
 #include <bitcoin/explorer/primitives/wrapper.hpp>
 #include <bitcoin/explorer/utility.hpp>
 
@@ -66,6 +71,8 @@ namespace commands {
  */
 #define BX_FETCH_STEALTH_FILTER_TOO_LONG \
     "Stealth prefix filter is limited to 32 bits."
+#define BX_FETCH_STEALTH_CONFIRMATION_KEYS \
+    "The scan_secret and spend_pubkey options must be specified together."
 
 /**
  * Class to implement the fetch-stealth command.
@@ -152,13 +159,23 @@ public:
         (
             "format,f",
             value<primitives::encoding>(&option_.format),
-            "The output format. Options are 'info', 'json' and 'xml', defaults to 'info'."
+            "The output format. Options are 'info', 'json', 'ndjson', 'xml', 'cbor', 'msgpack', 'csv' and 'tsv', defaults to 'info'."
         )
         (
             "height,t",
             value<uint32_t>(&option_.height),
             "The minimum block height of transactions to include."
         )
+        (
+            "scan_secret,s",
+            value<primitives::ec_private>(&option_.scan_secret),
+            "The Base16 EC private key to use locally in confirming stealth transactions. Requires the spend_pubkey option."
+        )
+        (
+            "spend_pubkey,p",
+            value<bc::wallet::ec_public>(&option_.spend_pubkey),
+            "The Base16 EC spend public key of the stealth address to use locally in confirming stealth transactions. Requires the scan_secret option."
+        )
         (
             "FILTER",
             value<primitives::base2>(&argument_.filter),
@@ -238,6 +255,40 @@ public:
         option_.height = value;
     }
 
+    /**
+     * Get the value of the scan_secret option.
+     */
+    virtual primitives::ec_private& get_scan_secret_option()
+    {
+        return option_.scan_secret;
+    }
+
+    /**
+     * Set the value of the scan_secret option.
+     */
+    virtual void set_scan_secret_option(
+        const primitives::ec_private& value)
+    {
+        option_.scan_secret = value;
+    }
+
+    /**
+     * Get the value of the spend_pubkey option.
+     */
+    virtual bc::wallet::ec_public& get_spend_pubkey_option()
+    {
+        return option_.spend_pubkey;
+    }
+
+    /**
+     * Set the value of the spend_pubkey option.
+     */
+    virtual void set_spend_pubkey_option(
+        const bc::wallet::ec_public& value)
+    {
+        option_.spend_pubkey = value;
+    }
+
 private:
 
     /**
@@ -264,12 +315,16 @@ private:
     {
         option()
           : format(),
-            height()
+            height(),
+            scan_secret(),
+            spend_pubkey()
         {
         }
 
         primitives::encoding format;
         uint32_t height;
+        primitives::ec_private scan_secret;
+        bc::wallet::ec_public spend_pubkey;
     } option_;
 };
 
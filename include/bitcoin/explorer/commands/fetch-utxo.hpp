@@ -31,6 +31,7 @@
 #include <bitcoin/explorer/generated.hpp>
 #include <bitcoin/explorer/primitives/address.hpp>
 #include <bitcoin/explorer/primitives/base16.hpp>
+#include <bitcoin/explorer/primitives/base16_stream.hpp>
 #include <bitcoin/explorer/primitives/base2.hpp>
 #include <bitcoin/explorer/primitives/base58.hpp>
 #include <bitcoin/explorer/primitives/base64.hpp>
@@ -38,13 +39,16 @@
 #include <bitcoin/explorer/primitives/btc.hpp>
 #include <bitcoin/explorer/primitives/btc160.hpp>
 #include <bitcoin/explorer/primitives/byte.hpp>
+#include <bitcoin/explorer/primitives/byte_stream.hpp>
 #include <bitcoin/explorer/primitives/cert_key.hpp>
 #include <bitcoin/explorer/primitives/ec_private.hpp>
 #include <bitcoin/explorer/primitives/encoding.hpp>
 #include <bitcoin/explorer/primitives/endorsement.hpp>
 #include <bitcoin/explorer/primitives/hashtype.hpp>
 #include <bitcoin/explorer/primitives/hd_key.hpp>
+#include <bitcoin/explorer/primitives/hd_path.hpp>
 #include <bitcoin/explorer/primitives/header.hpp>
+#include <bitcoin/explorer/primitives/index_range.hpp>
 #include <bitcoin/explorer/primitives/input.hpp>
 #include <bitcoin/explorer/primitives/language.hpp>
 #include <bitcoin/explorer/primitives/output.hpp>
@@ -52,6 +56,7 @@
 #include <bitcoin/explorer/primitives/script.hpp>
 #include <bitcoin/explorer/primitives/signature.hpp>
 #include <bitcoin/explorer/primitives/transaction.hpp>
+#include <bitcoin/explorer/primitives/transaction_stream.hpp>
 #include <bitcoin/explorer/primitives/wrapper.hpp>
 #include <bitcoin/explorer/utility.hpp>
 
@@ -64,8 +69,12 @@ namespace commands {
 /**
  * Various localizable strings.
  */
-#define BX_FETCH_UTXO_NOT_IMPLEMENTED \
-    "This command is not yet implemented."
+#define BX_FETCH_UTXO_INVALID_ALGORITHM \
+    "The algorithm option is not valid."
+#define BX_FETCH_UTXO_SNAPSHOT_INVALID \
+    "The snapshot could not be read: %1%."
+#define BX_FETCH_UTXO_INSUFFICIENT_FUNDS \
+    "Insufficient unspent outputs to pay %1% satoshi, only %2% available."
 
 /**
  * Class to implement the fetch-utxo command.
@@ -112,7 +121,7 @@ public:
      */
     virtual const char* description()
     {
-        return "Get enough unspent transaction outputs from a payment addresses to pay a number of satoshi. Requires a Libbitcoin/Obelisk server connection.";
+        return "Get enough unspent transaction outputs from a set of payment addresses to pay a number of satoshi. Requires a Libbitcoin/Obelisk server connection.";
     }
 
     /**
@@ -124,7 +133,7 @@ public:
     {
         return get_argument_metadata()
             .add("SATOSHI", 1)
-            .add("PAYMENT_ADDRESS", 1);
+            .add("PAYMENT_ADDRESS", -1);
     }
 
 	/**
@@ -136,7 +145,7 @@ public:
         po::variables_map& variables)
     {
         const auto raw = requires_raw_input();
-        load_input(get_payment_address_argument(), "PAYMENT_ADDRESS", variables, input, raw);
+        load_input(get_payment_addresss_argument(), "PAYMENT_ADDRESS", variables, input, raw);
     }
 
     /**
@@ -160,9 +169,24 @@ public:
             "The path to the configuration settings file."
         )
         (
-            "format,f",
-            value<primitives::encoding>(&option_.format),
-            "The output format. Options are 'info', 'json' and 'xml', defaults to 'info'."
+            "algorithm,a",
+            value<std::string>(&option_.algorithm)->default_value("largest"),
+            "The coin selection algorithm. Options are 'exact', 'fee' and 'largest', defaults to 'largest'."
+        )
+        (
+            "fee,f",
+            value<uint64_t>(&option_.fee),
+            "The fee in satoshi to spend each output, used by the 'fee' algorithm, defaults to zero."
+        )
+        (
+            "snapshot,s",
+            value<boost::filesystem::path>(&option_.snapshot),
+            "The path of a UTXO snapshot to query in place of the server. See utxo-snapshot."
+        )
+        (
+            "tolerance,t",
+            value<uint64_t>(&option_.tolerance),
+            "The number of satoshi by which an 'exact' or 'fee' selection may exceed SATOSHI, defaults to zero."
         )
         (
             "SATOSHI",
@@ -171,8 +195,8 @@ public:
         )
         (
             "PAYMENT_ADDRESS",
-            value<bc::wallet::payment_address>(&argument_.payment_address),
-            "The payment address. If not specified the address is read from STDIN."
+            value<std::vector<bc::wallet::payment_address>>(&argument_.payment_addresss),
+            "The set of payment addresses. If not specified the addresses are read from STDIN."
         );
 
         return options;
@@ -215,37 +239,88 @@ public:
     }
 
     /**
-     * Get the value of the PAYMENT_ADDRESS argument.
+     * Get the value of the PAYMENT_ADDRESS arguments.
+     */
+    virtual std::vector<bc::wallet::payment_address>& get_payment_addresss_argument()
+    {
+        return argument_.payment_addresss;
+    }
+
+    /**
+     * Set the value of the PAYMENT_ADDRESS arguments.
+     */
+    virtual void set_payment_addresss_argument(
+        const std::vector<bc::wallet::payment_address>& value)
+    {
+        argument_.payment_addresss = value;
+    }
+
+    /**
+     * Get the value of the algorithm option.
+     */
+    virtual std::string& get_algorithm_option()
+    {
+        return option_.algorithm;
+    }
+
+    /**
+     * Set the value of the algorithm option.
+     */
+    virtual void set_algorithm_option(
+        const std::string& value)
+    {
+        option_.algorithm = value;
+    }
+
+    /**
+     * Get the value of the fee option.
      */
-    virtual bc::wallet::payment_address& get_payment_address_argument()
+    virtual uint64_t& get_fee_option()
     {
-        return argument_.payment_address;
+        return option_.fee;
     }
 
     /**
-     * Set the value of the PAYMENT_ADDRESS argument.
+     * Set the value of the fee option.
      */
-    virtual void set_payment_address_argument(
-        const bc::wallet::payment_address& value)
+    virtual void set_fee_option(
+        const uint64_t& value)
     {
-        argument_.payment_address = value;
+        option_.fee = value;
     }
 
     /**
-     * Get the value of the format option.
+     * Get the value of the snapshot option.
      */
-    virtual primitives::encoding& get_format_option()
+    virtual boost::filesystem::path& get_snapshot_option()
     {
-        return option_.format;
+        return option_.snapshot;
     }
 
     /**
-     * Set the value of the format option.
+     * Set the value of the snapshot option.
      */
-    virtual void set_format_option(
-        const primitives::encoding& value)
+    virtual void set_snapshot_option(
+        const boost::filesystem::path& value)
+    {
+        option_.snapshot = value;
+    }
+
+    /**
+     * Get the value of the tolerance option.
+     */
+    virtual uint64_t& get_tolerance_option()
+    {
+        return option_.tolerance;
+    }
+
+    /**
+     * Set the value of the tolerance option.
+     */
+    virtual void set_tolerance_option(
+        const uint64_t& value)
     {
-        option_.format = value;
+        option_.tolerance = value;
     }
 
 private:
@@ -259,12 +334,12 @@ private:
     {
         argument()
           : satoshi(),
-            payment_address()
+            payment_addresss()
         {
         }
 
         uint64_t satoshi;
-        bc::wallet::payment_address payment_address;
+        std::vector<bc::wallet::payment_address> payment_addresss;
     } argument_;
 
     /**
@@ -275,11 +350,17 @@ private:
     struct option
     {
         option()
-          : format()
+          : algorithm(),
+            fee(),
+            snapshot(),
+            tolerance()
         {
         }
 
-        primitives::encoding format;
+        std::string algorithm;
+        uint64_t fee;
+        boost::filesystem::path snapshot;
+        uint64_t tolerance;
     } option_;
 };
 
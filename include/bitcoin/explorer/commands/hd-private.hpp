@@ -31,6 +31,7 @@
 #include <bitcoin/explorer/generated.hpp>
 #include <bitcoin/explorer/primitives/address.hpp>
 #include <bitcoin/explorer/primitives/base16.hpp>
+#include <bitcoin/explorer/primitives/base16_stream.hpp>
 #include <bitcoin/explorer/primitives/base2.hpp>
 #include <bitcoin/explorer/primitives/base58.hpp>
 #include <bitcoin/explorer/primitives/base64.hpp>
@@ -38,13 +39,16 @@
 #include <bitcoin/explorer/primitives/btc.hpp>
 #include <bitcoin/explorer/primitives/btc160.hpp>
 #include <bitcoin/explorer/primitives/byte.hpp>
+#include <bitcoin/explorer/primitives/byte_stream.hpp>
 #include <bitcoin/explorer/primitives/cert_key.hpp>
 #include <bitcoin/explorer/primitives/ec_private.hpp>
 #include <bitcoin/explorer/primitives/encoding.hpp>
 #include <bitcoin/explorer/primitives/endorsement.hpp>
 #include <bitcoin/explorer/primitives/hashtype.hpp>
 #include <bitcoin/explorer/primitives/hd_key.hpp>
+#include <bitcoin/explorer/primitives/hd_path.hpp>
 #include <bitcoin/explorer/primitives/header.hpp>
+#include <bitcoin/explorer/primitives/index_range.hpp>
 #include <bitcoin/explorer/primitives/input.hpp>
 #include <bitcoin/explorer/primitives/language.hpp>
 #include <bitcoin/explorer/primitives/output.hpp>
@@ -52,6 +56,7 @@
 #include <bitcoin/explorer/primitives/script.hpp>
 #include <bitcoin/explorer/primitives/signature.hpp>
 #include <bitcoin/explorer/primitives/transaction.hpp>
+#include <bitcoin/explorer/primitives/transaction_stream.hpp>
 #include <bitcoin/explorer/primitives/wrapper.hpp>
 #include <bitcoin/explorer/utility.hpp>
 
@@ -61,6 +66,12 @@ namespace libbitcoin {
 namespace explorer {
 namespace commands {
 
+/**
+ * Various localizable strings.
+ */
+#define BX_HD_PRIVATE_INVALID_CHILD \
+    "The child key at index %1% is not valid."
+
 /**
  * Class to implement the hd-private command.
  */
@@ -99,7 +110,7 @@ public:
      */
     virtual const char* description()
     {
-        return "Derive a child HD (BIP32) private key from another HD private key.";
+        return "Derive a child HD (BIP32) private key, or a range of them, from another HD private key.";
     }
 
     /**
@@ -155,6 +166,11 @@ public:
             value<uint32_t>(&option_.index),
             "The HD index, defaults to zero."
         )
+        (
+            "range,r",
+            value<primitives::index_range>(&option_.range),
+            "The range of HD indexes to derive, as START:COUNT with START suffixed by 'h' for hardened indexes. Keys are written in index order, one per line. Overrides the index and hard options."
+        )
         (
             "HD_PRIVATE_KEY",
             value<bc::wallet::hd_private>(&argument_.hd_private_key),
@@ -234,6 +250,23 @@ public:
         option_.index = value;
     }
 
+    /**
+     * Get the value of the range option.
+     */
+    virtual primitives::index_range& get_range_option()
+    {
+        return option_.range;
+    }
+
+    /**
+     * Set the value of the range option.
+     */
+    virtual void set_range_option(
+        const primitives::index_range& value)
+    {
+        option_.range = value;
+    }
+
 private:
 
     /**
@@ -260,12 +293,14 @@ private:
     {
         option()
           : hard(),
-            index()
+            index(),
+            range()
         {
         }
 
         bool hard;
         uint32_t index;
+        primitives::index_range range;
     } option_;
 };
 
@@ -0,0 +1,433 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_HD_SCAN_HPP
+#define BX_HD_SCAN_HPP
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/program_options.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/command.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/generated.hpp>
+#include <bitcoin/explorer/primitives/address.hpp>
+#include <bitcoin/explorer/primitives/base16.hpp>
+#include <bitcoin/explorer/primitives/base16_stream.hpp>
+#include <bitcoin/explorer/primitives/base2.hpp>
+#include <bitcoin/explorer/primitives/base58.hpp>
+#include <bitcoin/explorer/primitives/base64.hpp>
+#include <bitcoin/explorer/primitives/base85.hpp>
+#include <bitcoin/explorer/primitives/btc.hpp>
+#include <bitcoin/explorer/primitives/btc160.hpp>
+#include <bitcoin/explorer/primitives/byte.hpp>
+#include <bitcoin/explorer/primitives/byte_stream.hpp>
+#include <bitcoin/explorer/primitives/cert_key.hpp>
+#include <bitcoin/explorer/primitives/ec_private.hpp>
+#include <bitcoin/explorer/primitives/encoding.hpp>
+#include <bitcoin/explorer/primitives/endorsement.hpp>
+#include <bitcoin/explorer/primitives/hashtype.hpp>
+#include <bitcoin/explorer/primitives/hd_key.hpp>
+#include <bitcoin/explorer/primitives/hd_path.hpp>
+#include <bitcoin/explorer/primitives/header.hpp>
+#include <bitcoin/explorer/primitives/index_range.hpp>
+#include <bitcoin/explorer/primitives/input.hpp>
+#include <bitcoin/explorer/primitives/language.hpp>
+#include <bitcoin/explorer/primitives/output.hpp>
+#include <bitcoin/explorer/primitives/raw.hpp>
+#include <bitcoin/explorer/primitives/script.hpp>
+#include <bitcoin/explorer/primitives/signature.hpp>
+#include <bitcoin/explorer/primitives/transaction.hpp>
+#include <bitcoin/explorer/primitives/transaction_stream.hpp>
+#include <bitcoin/explorer/primitives/wrapper.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+/********* GENERATED SOURCE CODE, DO NOT EDIT EXCEPT EXPERIMENTALLY **********/
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+
+/**
+ * Various localizable strings.
+ */
+#define BX_HD_SCAN_INVALID_VERSION \
+    "The HD key version is not valid."
+#define BX_HD_SCAN_INVALID_KEY \
+    "The HD key is not valid."
+#define BX_HD_SCAN_HARDENED_BRANCH \
+    "The branch index must be less than 2147483648."
+#define BX_HD_SCAN_ZERO_WINDOW \
+    "The window must be at least one."
+
+/**
+ * Class to implement the hd-scan command.
+ */
+class BCX_API hd_scan 
+  : public command
+{
+public:
+
+    /**
+     * The symbolic (not localizable) command name, lower case.
+     */
+    static const char* symbol()
+    {
+        return "hd-scan";
+    }
+
+
+    /**
+     * The member symbolic (not localizable) command name, lower case.
+     */
+    virtual const char* name()
+    {
+        return hd_scan::symbol();
+    }
+
+    /**
+     * The localizable command category name, upper case.
+     */
+    virtual const char* category()
+    {
+        return "ONLINE";
+    }
+
+    /**
+     * The localizable command description.
+     */
+    virtual const char* description()
+    {
+        return "Find the used addresses, histories and balance of an HD (BIP32) account by scanning its branches to the gap limit. Requires a Libbitcoin/Obelisk server connection.";
+    }
+
+    /**
+     * Load program argument definitions.
+     * A value of -1 indicates that the number of instances is unlimited.
+     * @return  The loaded program argument definitions.
+     */
+    virtual arguments_metadata& load_arguments()
+    {
+        return get_argument_metadata()
+            .add("HD_KEY", 1);
+    }
+
+	/**
+     * Load parameter fallbacks from file or input as appropriate.
+     * @param[in]  input  The input stream for loading the parameters.
+     * @param[in]         The loaded variables.
+     */
+    virtual void load_fallbacks(std::istream& input, 
+        po::variables_map& variables)
+    {
+        const auto raw = requires_raw_input();
+        load_input(get_hd_key_argument(), "HD_KEY", variables, input, raw);
+    }
+
+    /**
+     * Load program option definitions.
+     * BUGBUG: see boost bug/fix: svn.boost.org/trac/boost/ticket/8009
+     * @return  The loaded program option definitions.
+     */
+    virtual options_metadata& load_options()
+    {
+        using namespace po;
+        options_description& options = get_option_metadata();
+        options.add_options()
+        (
+            BX_HELP_VARIABLE ",h",
+            value<bool>()->zero_tokens(),
+            "Get a description and instructions for this command."
+        )
+        (
+            BX_CONFIG_VARIABLE ",c",
+            value<boost::filesystem::path>(),
+            "The path to the configuration settings file."
+        )
+        (
+            "branch,b",
+            value<std::vector<uint32_t>>(&option_.branchs),
+            "The set of non-hardened branch indices to scan, multiple entries allowed, defaults to 0 (receive) and 1 (change)."
+        )
+        (
+            "format,f",
+            value<primitives::encoding>(&option_.format),
+            "The output format. Options are 'info', 'json', 'ndjson', 'xml', 'cbor', 'msgpack', 'csv' and 'tsv', defaults to 'info'."
+        )
+        (
+            "gap,g",
+            value<uint32_t>(&option_.gap)->default_value(20),
+            "The number of consecutive unused addresses that ends the scan of a branch, defaults to 20."
+        )
+        (
+            "window,w",
+            value<uint32_t>(&option_.window)->default_value(100),
+            "The maximum number of history requests outstanding at one time, defaults to 100."
+        )
+        (
+            "version,v",
+            value<primitives::byte>(&option_.version)->default_value(0),
+            "The desired payment address version."
+        )
+        (
+            "secret_version,s",
+            value<uint32_t>(&option_.secret_version)->default_value(76066276),
+            "The expected version for an HD private key, defaults to 76066276."
+        )
+        (
+            "public_version,p",
+            value<uint32_t>(&option_.public_version)->default_value(76067358),
+            "The expected version for an HD public key, defaults to 76067358."
+        )
+        (
+            "HD_KEY",
+            value<primitives::hd_key>(&argument_.hd_key),
+            "The HD public or private account key. If not specified the key is read from STDIN."
+        );
+
+        return options;
+    }
+
+    /**
+     * Set variable defaults from configuration variable values.
+     * @param[in]  variables  The loaded variables.
+     */
+    virtual void set_defaults_from_config(po::variables_map& variables)
+    {
+        const auto& option_version = variables["version"];
+        const auto& option_version_config = variables["wallet.pay_to_public_key_hash_version"];
+        if (option_version.defaulted() && !option_version_config.defaulted())
+        {
+            option_.version = option_version_config.as<primitives::byte>();
+        }
+
+        const auto& option_secret_version = variables["secret_version"];
+        const auto& option_secret_version_config = variables["wallet.hd_secret_version"];
+        if (option_secret_version.defaulted() && !option_secret_version_config.defaulted())
+        {
+            option_.secret_version = option_secret_version_config.as<uint32_t>();
+        }
+
+        const auto& option_public_version = variables["public_version"];
+        const auto& option_public_version_config = variables["wallet.hd_public_version"];
+        if (option_public_version.defaulted() && !option_public_version_config.defaulted())
+        {
+            option_.public_version = option_public_version_config.as<uint32_t>();
+        }
+    }
+
+    /**
+     * Invoke the command.
+     * @param[out]  output  The input stream for the command execution.
+     * @param[out]  error   The input stream for the command execution.
+     * @return              The appropriate console return code { -1, 0, 1 }.
+     */
+    virtual console_result invoke(std::ostream& output,
+        std::ostream& cerr);
+
+    /* Properties */
+
+    /**
+     * Get the value of the HD_KEY argument.
+     */
+    virtual primitives::hd_key& get_hd_key_argument()
+    {
+        return argument_.hd_key;
+    }
+
+    /**
+     * Set the value of the HD_KEY argument.
+     */
+    virtual void set_hd_key_argument(
+        const primitives::hd_key& value)
+    {
+        argument_.hd_key = value;
+    }
+
+    /**
+     * Get the value of the branch options.
+     */
+    virtual std::vector<uint32_t>& get_branchs_option()
+    {
+        return option_.branchs;
+    }
+
+    /**
+     * Set the value of the branch options.
+     */
+    virtual void set_branchs_option(
+        const std::vector<uint32_t>& value)
+    {
+        option_.branchs = value;
+    }
+
+    /**
+     * Get the value of the format option.
+     */
+    virtual primitives::encoding& get_format_option()
+    {
+        return option_.format;
+    }
+
+    /**
+     * Set the value of the format option.
+     */
+    virtual void set_format_option(
+        const primitives::encoding& value)
+    {
+        option_.format = value;
+    }
+
+    /**
+     * Get the value of the gap option.
+     */
+    virtual uint32_t& get_gap_option()
+    {
+        return option_.gap;
+    }
+
+    /**
+     * Set the value of the gap option.
+     */
+    virtual void set_gap_option(
+        const uint32_t& value)
+    {
+        option_.gap = value;
+    }
+
+    /**
+     * Get the value of the window option.
+     */
+    virtual uint32_t& get_window_option()
+    {
+        return option_.window;
+    }
+
+    /**
+     * Set the value of the window option.
+     */
+    virtual void set_window_option(
+        const uint32_t& value)
+    {
+        option_.window = value;
+    }
+
+    /**
+     * Get the value of the version option.
+     */
+    virtual primitives::byte& get_version_option()
+    {
+        return option_.version;
+    }
+
+    /**
+     * Set the value of the version option.
+     */
+    virtual void set_version_option(
+        const primitives::byte& value)
+    {
+        option_.version = value;
+    }
+
+    /**
+     * Get the value of the secret_version option.
+     */
+    virtual uint32_t& get_secret_version_option()
+    {
+        return option_.secret_version;
+    }
+
+    /**
+     * Set the value of the secret_version option.
+     */
+    virtual void set_secret_version_option(
+        const uint32_t& value)
+    {
+        option_.secret_version = value;
+    }
+
+    /**
+     * Get the value of the public_version option.
+     */
+    virtual uint32_t& get_public_version_option()
+    {
+        return option_.public_version;
+    }
+
+    /**
+     * Set the value of the public_version option.
+     */
+    virtual void set_public_version_option(
+        const uint32_t& value)
+    {
+        option_.public_version = value;
+    }
+
+private:
+
+    /**
+     * Command line argument bound variables.
+     * Uses cross-compiler safe constructor-based zeroize.
+     * Zeroize for unit test consistency with program_options initialization.
+     */
+    struct argument
+    {
+        argument()
+          : hd_key()
+        {
+        }
+
+        primitives::hd_key hd_key;
+    } argument_;
+
+    /**
+     * Command line option bound variables.
+     * Uses cross-compiler safe constructor-based zeroize.
+     * Zeroize for unit test consistency with program_options initialization.
+     */
+    struct option
+    {
+        option()
+          : branchs(),
+            format(),
+            gap(),
+            window(),
+            version(),
+            secret_version(),
+            public_version()
+        {
+        }
+
+        std::vector<uint32_t> branchs;
+        primitives::encoding format;
+        uint32_t gap;
+        uint32_t window;
+        primitives::byte version;
+        uint32_t secret_version;
+        uint32_t public_version;
+    } option_;
+};
+
+} // namespace commands
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
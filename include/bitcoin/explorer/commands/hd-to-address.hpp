@@ -31,6 +31,7 @@
 #include <bitcoin/explorer/generated.hpp>
 #include <bitcoin/explorer/primitives/address.hpp>
 #include <bitcoin/explorer/primitives/base16.hpp>
+#include <bitcoin/explorer/primitives/base16_stream.hpp>
 #include <bitcoin/explorer/primitives/base2.hpp>
 #include <bitcoin/explorer/primitives/base58.hpp>
 #include <bitcoin/explorer/primitives/base64.hpp>
@@ -38,13 +39,16 @@
 #include <bitcoin/explorer/primitives/btc.hpp>
 #include <bitcoin/explorer/primitives/btc160.hpp>
 #include <bitcoin/explorer/primitives/byte.hpp>
+#include <bitcoin/explorer/primitives/byte_stream.hpp>
 #include <bitcoin/explorer/primitives/cert_key.hpp>
 #include <bitcoin/explorer/primitives/ec_private.hpp>
 #include <bitcoin/explorer/primitives/encoding.hpp>
 #include <bitcoin/explorer/primitives/endorsement.hpp>
 #include <bitcoin/explorer/primitives/hashtype.hpp>
 #include <bitcoin/explorer/primitives/hd_key.hpp>
+#include <bitcoin/explorer/primitives/hd_path.hpp>
 #include <bitcoin/explorer/primitives/header.hpp>
+#include <bitcoin/explorer/primitives/index_range.hpp>
 #include <bitcoin/explorer/primitives/input.hpp>
 #include <bitcoin/explorer/primitives/language.hpp>
 #include <bitcoin/explorer/primitives/output.hpp>
@@ -52,6 +56,7 @@
 #include <bitcoin/explorer/primitives/script.hpp>
 #include <bitcoin/explorer/primitives/signature.hpp>
 #include <bitcoin/explorer/primitives/transaction.hpp>
+#include <bitcoin/explorer/primitives/transaction_stream.hpp>
 #include <bitcoin/explorer/primitives/wrapper.hpp>
 #include <bitcoin/explorer/utility.hpp>
 
@@ -64,8 +69,12 @@ namespace commands {
 /**
  * Various localizable strings.
  */
-#define BX_HD_TO_ADDRESS_OBSOLETE \
-    "This command is obsolete. Use combination of hd-to-ec and ec-to-address instead."
+#define BX_HD_TO_ADDRESS_HARD_RANGE_CONFLICT \
+    "A hardened range requires a private key."
+#define BX_HD_TO_ADDRESS_INVALID_CHILD \
+    "The child key at index %1% is not valid."
+#define BX_HD_TO_ADDRESS_INVALID_KEY \
+    "The HD key is not valid."
 
 /**
  * Class to implement the hd-to-address command.
@@ -105,16 +114,7 @@ public:
      */
     virtual const char* description()
     {
-        return "Convert a HD (BIP32) public or private key to a payment address.";
-    }
-
-    /**
-     * Declare whether the command has been obsoleted.
-     * @return  True if the command is obsolete
-     */
-    virtual bool obsolete()
-    {
-        return true;
+        return "Convert a HD (BIP32) public or private key, or a range of its children, to payment addresses.";
     }
 
     /**
@@ -124,7 +124,8 @@ public:
      */
     virtual arguments_metadata& load_arguments()
     {
-        return get_argument_metadata();
+        return get_argument_metadata()
+            .add("HD_KEY", 1);
     }
 
 	/**
@@ -135,6 +136,8 @@ public:
     virtual void load_fallbacks(std::istream& input, 
         po::variables_map& variables)
     {
+        const auto raw = requires_raw_input();
+        load_input(get_hd_key_argument(), "HD_KEY", variables, input, raw);
     }
 
     /**
@@ -156,6 +159,31 @@ public:
             BX_CONFIG_VARIABLE ",c",
             value<boost::filesystem::path>(),
             "The path to the configuration settings file."
+        )
+        (
+            "version,v",
+            value<primitives::byte>(&option_.version)->default_value(0),
+            "The desired payment address version."
+        )
+        (
+            "secret_version,s",
+            value<uint32_t>(&option_.secret_version)->default_value(76066276),
+            "The expected version for an HD private key, defaults to 76066276."
+        )
+        (
+            "public_version,p",
+            value<uint32_t>(&option_.public_version)->default_value(76067358),
+            "The expected version for an HD public key, defaults to 76067358."
+        )
+        (
+            "range,r",
+            value<primitives::index_range>(&option_.range),
+            "The range of child indexes of HD_KEY to convert, as START:COUNT with START suffixed by 'h' for hardened indexes. Addresses are written in index order, one per line."
+        )
+        (
+            "HD_KEY",
+            value<primitives::hd_key>(&argument_.hd_key),
+            "The HD public or private key to convert. If not specified the key is read from STDIN."
         );
 
         return options;
@@ -167,6 +195,26 @@ public:
      */
     virtual void set_defaults_from_config(po::variables_map& variables)
     {
+        const auto& option_version = variables["version"];
+        const auto& option_version_config = variables["wallet.pay_to_public_key_hash_version"];
+        if (option_version.defaulted() && !option_version_config.defaulted())
+        {
+            option_.version = option_version_config.as<primitives::byte>();
+        }
+
+        const auto& option_secret_version = variables["secret_version"];
+        const auto& option_secret_version_config = variables["wallet.hd_secret_version"];
+        if (option_secret_version.defaulted() && !option_secret_version_config.defaulted())
+        {
+            option_.secret_version = option_secret_version_config.as<uint32_t>();
+        }
+
+        const auto& option_public_version = variables["public_version"];
+        const auto& option_public_version_config = variables["wallet.hd_public_version"];
+        if (option_public_version.defaulted() && !option_public_version_config.defaulted())
+        {
+            option_.public_version = option_public_version_config.as<uint32_t>();
+        }
     }
 
     /**
@@ -180,6 +228,91 @@ public:
 
     /* Properties */
 
+    /**
+     * Get the value of the HD_KEY argument.
+     */
+    virtual primitives::hd_key& get_hd_key_argument()
+    {
+        return argument_.hd_key;
+    }
+
+    /**
+     * Set the value of the HD_KEY argument.
+     */
+    virtual void set_hd_key_argument(
+        const primitives::hd_key& value)
+    {
+        argument_.hd_key = value;
+    }
+
+    /**
+     * Get the value of the version option.
+     */
+    virtual primitives::byte& get_version_option()
+    {
+        return option_.version;
+    }
+
+    /**
+     * Set the value of the version option.
+     */
+    virtual void set_version_option(
+        const primitives::byte& value)
+    {
+        option_.version = value;
+    }
+
+    /**
+     * Get the value of the secret_version option.
+     */
+    virtual uint32_t& get_secret_version_option()
+    {
+        return option_.secret_version;
+    }
+
+    /**
+     * Set the value of the secret_version option.
+     */
+    virtual void set_secret_version_option(
+        const uint32_t& value)
+    {
+        option_.secret_version = value;
+    }
+
+    /**
+     * Get the value of the public_version option.
+     */
+    virtual uint32_t& get_public_version_option()
+    {
+        return option_.public_version;
+    }
+
+    /**
+     * Set the value of the public_version option.
+     */
+    virtual void set_public_version_option(
+        const uint32_t& value)
+    {
+        option_.public_version = value;
+    }
+
+    /**
+     * Get the value of the range option.
+     */
+    virtual primitives::index_range& get_range_option()
+    {
+        return option_.range;
+    }
+
+    /**
+     * Set the value of the range option.
+     */
+    virtual void set_range_option(
+        const primitives::index_range& value)
+    {
+        option_.range = value;
+    }
+
 private:
 
     /**
@@ -190,9 +323,11 @@ private:
     struct argument
     {
         argument()
+          : hd_key()
         {
         }
 
+        primitives::hd_key hd_key;
     } argument_;
 
     /**
@@ -203,9 +338,17 @@ private:
     struct option
     {
         option()
+          : version(),
+            secret_version(),
+            public_version(),
+            range()
         {
         }
 
+        primitives::byte version;
+        uint32_t secret_version;
+        uint32_t public_version;
+        primitives::index_range range;
     } option_;
 };
 
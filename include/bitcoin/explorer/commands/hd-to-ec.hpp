@@ -31,6 +31,7 @@
 #include <bitcoin/explorer/generated.hpp>
 #include <bitcoin/explorer/primitives/address.hpp>
 #include <bitcoin/explorer/primitives/base16.hpp>
+#include <bitcoin/explorer/primitives/base16_stream.hpp>
 #include <bitcoin/explorer/primitives/base2.hpp>
 #include <bitcoin/explorer/primitives/base58.hpp>
 #include <bitcoin/explorer/primitives/base64.hpp>
@@ -38,13 +39,16 @@
 #include <bitcoin/explorer/primitives/btc.hpp>
 #include <bitcoin/explorer/primitives/btc160.hpp>
 #include <bitcoin/explorer/primitives/byte.hpp>
+#include <bitcoin/explorer/primitives/byte_stream.hpp>
 #include <bitcoin/explorer/primitives/cert_key.hpp>
 #include <bitcoin/explorer/primitives/ec_private.hpp>
 #include <bitcoin/explorer/primitives/encoding.hpp>
 #include <bitcoin/explorer/primitives/endorsement.hpp>
 #include <bitcoin/explorer/primitives/hashtype.hpp>
 #include <bitcoin/explorer/primitives/hd_key.hpp>
+#include <bitcoin/explorer/primitives/hd_path.hpp>
 #include <bitcoin/explorer/primitives/header.hpp>
+#include <bitcoin/explorer/primitives/index_range.hpp>
 #include <bitcoin/explorer/primitives/input.hpp>
 #include <bitcoin/explorer/primitives/language.hpp>
 #include <bitcoin/explorer/primitives/output.hpp>
@@ -52,6 +56,7 @@
 #include <bitcoin/explorer/primitives/script.hpp>
 #include <bitcoin/explorer/primitives/signature.hpp>
 #include <bitcoin/explorer/primitives/transaction.hpp>
+#include <bitcoin/explorer/primitives/transaction_stream.hpp>
 #include <bitcoin/explorer/primitives/wrapper.hpp>
 #include <bitcoin/explorer/utility.hpp>
 
@@ -61,6 +66,14 @@ namespace libbitcoin {
 namespace explorer {
 namespace commands {
 
+/**
+ * Various localizable strings.
+ */
+#define BX_HD_TO_EC_HARD_RANGE_CONFLICT \
+    "A hardened range requires a private key."
+#define BX_HD_TO_EC_INVALID_CHILD \
+    "The child key at index %1% is not valid."
+
 /**
  * Class to implement the hd-to-ec command.
  */
@@ -99,7 +112,7 @@ public:
      */
     virtual const char* description()
     {
-        return "Convert a HD (BIP32) public or private key to the equivalent EC public or private key.";
+        return "Convert a HD (BIP32) public or private key, or a range of its children, to the equivalent EC public or private keys.";
     }
 
     /**
@@ -155,6 +168,11 @@ public:
             value<uint32_t>(&option_.public_version)->default_value(76067358),
             "The expected version for an HD public key, defaults to 76067358."
         )
+        (
+            "range,r",
+            value<primitives::index_range>(&option_.range),
+            "The range of child indexes of HD_KEY to convert, as START:COUNT with START suffixed by 'h' for hardened indexes. Keys are written in index order, one per line."
+        )
         (
             "HD_KEY",
             value<primitives::hd_key>(&argument_.hd_key),
@@ -247,6 +265,23 @@ public:
         option_.public_version = value;
     }
 
+    /**
+     * Get the value of the range option.
+     */
+    virtual primitives::index_range& get_range_option()
+    {
+        return option_.range;
+    }
+
+    /**
+     * Set the value of the range option.
+     */
+    virtual void set_range_option(
+        const primitives::index_range& value)
+    {
+        option_.range = value;
+    }
+
 private:
 
     /**
@@ -273,12 +308,14 @@ private:
     {
         option()
           : secret_version(),
-            public_version()
+            public_version(),
+            range()
         {
         }
 
         uint32_t secret_version;
         uint32_t public_version;
+        primitives::index_range range;
     } option_;
 };
 
@@ -31,6 +31,7 @@
 #include <bitcoin/explorer/generated.hpp>
 #include <bitcoin/explorer/primitives/address.hpp>
 #include <bitcoin/explorer/primitives/base16.hpp>
+#include <bitcoin/explorer/primitives/base16_stream.hpp>
 #include <bitcoin/explorer/primitives/base2.hpp>
 #include <bitcoin/explorer/primitives/base58.hpp>
 #include <bitcoin/explorer/primitives/base64.hpp>
@@ -38,13 +39,16 @@
 #include <bitcoin/explorer/primitives/btc.hpp>
 #include <bitcoin/explorer/primitives/btc160.hpp>
 #include <bitcoin/explorer/primitives/byte.hpp>
+#include <bitcoin/explorer/primitives/byte_stream.hpp>
 #include <bitcoin/explorer/primitives/cert_key.hpp>
 #include <bitcoin/explorer/primitives/ec_private.hpp>
 #include <bitcoin/explorer/primitives/encoding.hpp>
 #include <bitcoin/explorer/primitives/endorsement.hpp>
 #include <bitcoin/explorer/primitives/hashtype.hpp>
 #include <bitcoin/explorer/primitives/hd_key.hpp>
+#include <bitcoin/explorer/primitives/hd_path.hpp>
 #include <bitcoin/explorer/primitives/header.hpp>
+#include <bitcoin/explorer/primitives/index_range.hpp>
 #include <bitcoin/explorer/primitives/input.hpp>
 #include <bitcoin/explorer/primitives/language.hpp>
 #include <bitcoin/explorer/primitives/output.hpp>
@@ -52,6 +56,7 @@
 #include <bitcoin/explorer/primitives/script.hpp>
 #include <bitcoin/explorer/primitives/signature.hpp>
 #include <bitcoin/explorer/primitives/transaction.hpp>
+#include <bitcoin/explorer/primitives/transaction_stream.hpp>
 #include <bitcoin/explorer/primitives/wrapper.hpp>
 #include <bitcoin/explorer/utility.hpp>
 
@@ -61,6 +66,14 @@ namespace libbitcoin {
 namespace explorer {
 namespace commands {
 
+/**
+ * Various localizable strings.
+ */
+#define BX_RIPEMD160_FILE_INVALID \
+    "The file could not be read: %1%."
+#define BX_RIPEMD160_INVALID \
+    "The Base16 data is not valid."
+
 /**
  * Class to implement the ripemd160 command.
  */
@@ -109,6 +122,15 @@ public:
         return "Perform a RIPEMD160 hash of Base16 data.";
     }
 
+    /**
+     * Determines if STDIN is required to be raw.
+     * @return  True if the type of the STDIN argument is primitive::raw.
+     */
+    virtual bool requires_raw_input()
+    {
+        return true;
+    }
+
     /**
      * Load program argument definitions.
      * A value of -1 indicates that the number of instances is unlimited.
@@ -152,10 +174,20 @@ public:
             value<boost::filesystem::path>(),
             "The path to the configuration settings file."
         )
+        (
+            "file,f",
+            value<boost::filesystem::path>(&option_.file),
+            "The path of a file to hash in place of BASE16. The file is memory mapped and hashed as binary data."
+        )
+        (
+            "raw,r",
+            value<bool>(&option_.raw)->default_value(false)->zero_tokens(),
+            "Hash STDIN as binary data rather than as Base16 text, defaults to false."
+        )
         (
             "BASE16",
-            value<primitives::base16>(&argument_.base16),
-            "The Base16 data to hash. If not specified the data is read from STDIN."
+            value<primitives::base16_stream>(&argument_.base16),
+            "The Base16 data to hash. If not specified the data is read from STDIN in chunks, ignoring whitespace."
         );
 
         return options;
@@ -183,7 +215,7 @@ public:
     /**
      * Get the value of the BASE16 argument.
      */
-    virtual primitives::base16& get_base16_argument()
+    virtual primitives::base16_stream& get_base16_argument()
     {
         return argument_.base16;
     }
@@ -192,11 +224,45 @@ public:
      * Set the value of the BASE16 argument.
      */
     virtual void set_base16_argument(
-        const primitives::base16& value)
+        const primitives::base16_stream& value)
     {
         argument_.base16 = value;
     }
 
+    /**
+     * Get the value of the file option.
+     */
+    virtual boost::filesystem::path& get_file_option()
+    {
+        return option_.file;
+    }
+
+    /**
+     * Set the value of the file option.
+     */
+    virtual void set_file_option(
+        const boost::filesystem::path& value)
+    {
+        option_.file = value;
+    }
+
+    /**
+     * Get the value of the raw option.
+     */
+    virtual bool& get_raw_option()
+    {
+        return option_.raw;
+    }
+
+    /**
+     * Set the value of the raw option.
+     */
+    virtual void set_raw_option(
+        const bool& value)
+    {
+        option_.raw = value;
+    }
+
 private:
 
     /**
@@ -211,7 +277,7 @@ private:
         {
         }
 
-        primitives::base16 base16;
+        primitives::base16_stream base16;
     } argument_;
 
     /**
@@ -222,9 +288,13 @@ private:
     struct option
     {
         option()
+          : file(),
+            raw()
         {
         }
 
+        boost::filesystem::path file;
+        bool raw;
     } option_;
 };
 
@@ -0,0 +1,367 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_SCAN_BLOCKS_HPP
+#define BX_SCAN_BLOCKS_HPP
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/program_options.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/command.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/generated.hpp>
+#include <bitcoin/explorer/primitives/address.hpp>
+#include <bitcoin/explorer/primitives/base16.hpp>
+#include <bitcoin/explorer/primitives/base16_stream.hpp>
+#include <bitcoin/explorer/primitives/base2.hpp>
+#include <bitcoin/explorer/primitives/base58.hpp>
+#include <bitcoin/explorer/primitives/base64.hpp>
+#include <bitcoin/explorer/primitives/base85.hpp>
+#include <bitcoin/explorer/primitives/btc.hpp>
+#include <bitcoin/explorer/primitives/btc160.hpp>
+#include <bitcoin/explorer/primitives/byte.hpp>
+#include <bitcoin/explorer/primitives/byte_stream.hpp>
+#include <bitcoin/explorer/primitives/cert_key.hpp>
+#include <bitcoin/explorer/primitives/ec_private.hpp>
+#include <bitcoin/explorer/primitives/encoding.hpp>
+#include <bitcoin/explorer/primitives/endorsement.hpp>
+#include <bitcoin/explorer/primitives/hashtype.hpp>
+#include <bitcoin/explorer/primitives/hd_key.hpp>
+#include <bitcoin/explorer/primitives/hd_path.hpp>
+#include <bitcoin/explorer/primitives/header.hpp>
+#include <bitcoin/explorer/primitives/index_range.hpp>
+#include <bitcoin/explorer/primitives/input.hpp>
+#include <bitcoin/explorer/primitives/language.hpp>
+#include <bitcoin/explorer/primitives/output.hpp>
+#include <bitcoin/explorer/primitives/raw.hpp>
+#include <bitcoin/explorer/primitives/script.hpp>
+#include <bitcoin/explorer/primitives/signature.hpp>
+#include <bitcoin/explorer/primitives/transaction.hpp>
+#include <bitcoin/explorer/primitives/transaction_stream.hpp>
+#include <bitcoin/explorer/primitives/wrapper.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+/********* GENERATED SOURCE CODE, DO NOT EDIT EXCEPT EXPERIMENTALLY **********/
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+
+/**
+ * Various localizable strings.
+ */
+#define BX_SCAN_BLOCKS_BLOCK_INVALID \
+    "The block is not valid: %1%."
+#define BX_SCAN_BLOCKS_FILE_INVALID \
+    "The file could not be read: %1%."
+#define BX_SCAN_BLOCKS_FILE_NETWORK \
+    "The file holds blocks of a network other than network.identifier: %1%."
+#define BX_SCAN_BLOCKS_INVALID_FIELD \
+    "The field '%1%' is not a transaction field."
+#define BX_SCAN_BLOCKS_NO_ADDRESSES \
+    "At least one payment address is required."
+#define BX_SCAN_BLOCKS_NO_CHAIN \
+    "The block files do not hold a chain from the genesis block."
+
+/**
+ * Class to implement the scan-blocks command.
+ */
+class BCX_API scan_blocks 
+  : public command
+{
+public:
+
+    /**
+     * The symbolic (not localizable) command name, lower case.
+     */
+    static const char* symbol()
+    {
+        return "scan-blocks";
+    }
+
+
+    /**
+     * The member symbolic (not localizable) command name, lower case.
+     */
+    virtual const char* name()
+    {
+        return scan_blocks::symbol();
+    }
+
+    /**
+     * The localizable command category name, upper case.
+     */
+    virtual const char* category()
+    {
+        return "TRANSACTION";
+    }
+
+    /**
+     * The localizable command description.
+     */
+    virtual const char* description()
+    {
+        return "Scan block files (blk*.dat) for the transfers or transactions of a set of payment addresses, without a server connection.";
+    }
+
+    /**
+     * Load program argument definitions.
+     * A value of -1 indicates that the number of instances is unlimited.
+     * @return  The loaded program argument definitions.
+     */
+    virtual arguments_metadata& load_arguments()
+    {
+        return get_argument_metadata()
+            .add("BLOCK_FILE", -1);
+    }
+
+	/**
+     * Load parameter fallbacks from file or input as appropriate.
+     * @param[in]  input  The input stream for loading the parameters.
+     * @param[in]         The loaded variables.
+     */
+    virtual void load_fallbacks(std::istream& input, 
+        po::variables_map& variables)
+    {
+    }
+
+    /**
+     * Load program option definitions.
+     * BUGBUG: see boost bug/fix: svn.boost.org/trac/boost/ticket/8009
+     * @return  The loaded program option definitions.
+     */
+    virtual options_metadata& load_options()
+    {
+        using namespace po;
+        options_description& options = get_option_metadata();
+        options.add_options()
+        (
+            BX_HELP_VARIABLE ",h",
+            value<bool>()->zero_tokens(),
+            "Get a description and instructions for this command."
+        )
+        (
+            BX_CONFIG_VARIABLE ",c",
+            value<boost::filesystem::path>(),
+            "The path to the configuration settings file."
+        )
+        (
+            "address,a",
+            value<std::vector<bc::wallet::payment_address>>(&option_.addresss),
+            "A payment address to match, multiple entries allowed."
+        )
+        (
+            "address_file",
+            value<boost::filesystem::path>(&option_.address_file),
+            "The path of a file of whitespace separated payment addresses to match, in addition to any address option."
+        )
+        (
+            "fields,l",
+            value<std::string>(&option_.fields),
+            "The comma separated transaction fields to output with the transactions option, such as 'hash,outputs.value'. A field includes the fields beneath it, defaults to all fields."
+        )
+        (
+            "format,f",
+            value<primitives::encoding>(&option_.format),
+            "The output format. Options are 'info', 'json', 'ndjson', 'xml', 'cbor', 'msgpack', 'csv' and 'tsv', defaults to 'info'."
+        )
+        (
+            "transactions,x",
+            value<bool>(&option_.transactions)->default_value(false)->zero_tokens(),
+            "Write the transactions that pay or spend from the addresses in chain order, in place of transfers, defaults to false."
+        )
+        (
+            "BLOCK_FILE",
+            value<std::vector<boost::filesystem::path>>(&argument_.block_files)->required(),
+            "The set of block files to scan, in any order. Blocks not in the longest chain of the files are ignored."
+        );
+
+        return options;
+    }
+
+    /**
+     * Set variable defaults from configuration variable values.
+     * @param[in]  variables  The loaded variables.
+     */
+    virtual void set_defaults_from_config(po::variables_map& variables)
+    {
+    }
+
+    /**
+     * Invoke the command.
+     * @param[out]  output  The input stream for the command execution.
+     * @param[out]  error   The input stream for the command execution.
+     * @return              The appropriate console return code { -1, 0, 1 }.
+     */
+    virtual console_result invoke(std::ostream& output,
+        std::ostream& cerr);
+
+    /* Properties */
+
+    /**
+     * Get the value of the BLOCK_FILE arguments.
+     */
+    virtual std::vector<boost::filesystem::path>& get_block_files_argument()
+    {
+        return argument_.block_files;
+    }
+
+    /**
+     * Set the value of the BLOCK_FILE arguments.
+     */
+    virtual void set_block_files_argument(
+        const std::vector<boost::filesystem::path>& value)
+    {
+        argument_.block_files = value;
+    }
+
+    /**
+     * Get the value of the address options.
+     */
+    virtual std::vector<bc::wallet::payment_address>& get_addresss_option()
+    {
+        return option_.addresss;
+    }
+
+    /**
+     * Set the value of the address options.
+     */
+    virtual void set_addresss_option(
+        const std::vector<bc::wallet::payment_address>& value)
+    {
+        option_.addresss = value;
+    }
+
+    /**
+     * Get the value of the address_file option.
+     */
+    virtual boost::filesystem::path& get_address_file_option()
+    {
+        return option_.address_file;
+    }
+
+    /**
+     * Set the value of the address_file option.
+     */
+    virtual void set_address_file_option(
+        const boost::filesystem::path& value)
+    {
+        option_.address_file = value;
+    }
+
+    /**
+     * Get the value of the fields option.
+     */
+    virtual std::string& get_fields_option()
+    {
+        return option_.fields;
+    }
+
+    /**
+     * Set the value of the fields option.
+     */
+    virtual void set_fields_option(
+        const std::string& value)
+    {
+        option_.fields = value;
+    }
+
+    /**
+     * Get the value of the format option.
+     */
+    virtual primitives::encoding& get_format_option()
+    {
+        return option_.format;
+    }
+
+    /**
+     * Set the value of the format option.
+     */
+    virtual void set_format_option(
+        const primitives::encoding& value)
+    {
+        option_.format = value;
+    }
+
+    /**
+     * Get the value of the transactions option.
+     */
+    virtual bool& get_transactions_option()
+    {
+        return option_.transactions;
+    }
+
+    /**
+     * Set the value of the transactions option.
+     */
+    virtual void set_transactions_option(
+        const bool& value)
+    {
+        option_.transactions = value;
+    }
+
+private:
+
+    /**
+     * Command line argument bound variables.
+     * Uses cross-compiler safe constructor-based zeroize.
+     * Zeroize for unit test consistency with program_options initialization.
+     */
+    struct argument
+    {
+        argument()
+          : block_files()
+        {
+        }
+
+        std::vector<boost::filesystem::path> block_files;
+    } argument_;
+
+    /**
+     * Command line option bound variables.
+     * Uses cross-compiler safe constructor-based zeroize.
+     * Zeroize for unit test consistency with program_options initialization.
+     */
+    struct option
+    {
+        option()
+          : addresss(),
+            address_file(),
+            fields(),
+            format(),
+            transactions()
+        {
+        }
+
+        std::vector<bc::wallet::payment_address> addresss;
+        boost::filesystem::path address_file;
+        std::string fields;
+        primitives::encoding format;
+        bool transactions;
+    } option_;
+};
+
+} // namespace commands
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
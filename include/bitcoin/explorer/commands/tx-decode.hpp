@@ -31,6 +31,7 @@
 #include <bitcoin/explorer/generated.hpp>
 #include <bitcoin/explorer/primitives/address.hpp>
 #include <bitcoin/explorer/primitives/base16.hpp>
+#include <bitcoin/explorer/primitives/base16_stream.hpp>
 #include <bitcoin/explorer/primitives/base2.hpp>
 #include <bitcoin/explorer/primitives/base58.hpp>
 #include <bitcoin/explorer/primitives/base64.hpp>
@@ -38,13 +39,16 @@
 #include <bitcoin/explorer/primitives/btc.hpp>
 #include <bitcoin/explorer/primitives/btc160.hpp>
 #include <bitcoin/explorer/primitives/byte.hpp>
+#include <bitcoin/explorer/primitives/byte_stream.hpp>
 #include <bitcoin/explorer/primitives/cert_key.hpp>
 #include <bitcoin/explorer/primitives/ec_private.hpp>
 #include <bitcoin/explorer/primitives/encoding.hpp>
 #include <bitcoin/explorer/primitives/endorsement.hpp>
 #include <bitcoin/explorer/primitives/hashtype.hpp>
 #include <bitcoin/explorer/primitives/hd_key.hpp>
+#include <bitcoin/explorer/primitives/hd_path.hpp>
 #include <bitcoin/explorer/primitives/header.hpp>
+#include <bitcoin/explorer/primitives/index_range.hpp>
 #include <bitcoin/explorer/primitives/input.hpp>
 #include <bitcoin/explorer/primitives/language.hpp>
 #include <bitcoin/explorer/primitives/output.hpp>
@@ -52,6 +56,7 @@
 #include <bitcoin/explorer/primitives/script.hpp>
 #include <bitcoin/explorer/primitives/signature.hpp>
 #include <bitcoin/explorer/primitives/transaction.hpp>
+#include <bitcoin/explorer/primitives/transaction_stream.hpp>
 #include <bitcoin/explorer/primitives/wrapper.hpp>
 #include <bitcoin/explorer/utility.hpp>
 
@@ -61,6 +66,16 @@ namespace libbitcoin {
 namespace explorer {
 namespace commands {
 
+/**
+ * Various localizable strings.
+ */
+#define BX_TX_DECODE_FILE_INVALID \
+    "The file could not be read: %1%."
+#define BX_TX_DECODE_INVALID \
+    "The transaction is not valid."
+#define BX_TX_DECODE_INVALID_FIELD \
+    "The field '%1%' is not a transaction field."
+
 /**
  * Class to implement the tx-decode command.
  */
@@ -102,6 +117,15 @@ public:
         return "Decode a Base16 transaction.";
     }
 
+    /**
+     * Determines if STDIN is required to be raw.
+     * @return  True if the type of the STDIN argument is primitive::raw.
+     */
+    virtual bool requires_raw_input()
+    {
+        return true;
+    }
+
     /**
      * Load program argument definitions.
      * A value of -1 indicates that the number of instances is unlimited.
@@ -148,12 +172,27 @@ public:
         (
             "format,f",
             value<primitives::encoding>(&option_.format),
-            "The output format. Options are 'info', 'json' and 'xml', defaults to 'info'."
+            "The output format. Options are 'info', 'json', 'ndjson', 'xml', 'cbor', 'msgpack', 'csv' and 'tsv', defaults to 'info'."
+        )
+        (
+            "fields,l",
+            value<std::string>(&option_.fields),
+            "The comma separated transaction fields to output, such as 'hash,outputs.value'. A field includes the fields beneath it, defaults to all fields."
+        )
+        (
+            "file",
+            value<boost::filesystem::path>(&option_.file),
+            "The path of a file of transactions to decode in place of TRANSACTION. The file is memory mapped and holds whitespace separated Base16 transactions or concatenated binary transactions."
+        )
+        (
+            "raw,r",
+            value<bool>(&option_.raw)->default_value(false)->zero_tokens(),
+            "Read STDIN or the file as concatenated binary transactions, defaults to false. Binary is otherwise detected by the first byte."
         )
         (
             "TRANSACTION",
-            value<primitives::transaction>(&argument_.transaction),
-            "The Base16 transaction. If not specified the transaction is read from STDIN."
+            value<primitives::transaction_stream>(&argument_.transaction),
+            "The Base16 transaction. If not specified the transactions are read from STDIN and each is decoded as it is read."
         );
 
         return options;
@@ -181,7 +220,7 @@ public:
     /**
      * Get the value of the TRANSACTION argument.
      */
-    virtual primitives::transaction& get_transaction_argument()
+    virtual primitives::transaction_stream& get_transaction_argument()
     {
         return argument_.transaction;
     }
@@ -190,7 +229,7 @@ public:
      * Set the value of the TRANSACTION argument.
      */
     virtual void set_transaction_argument(
-        const primitives::transaction& value)
+        const primitives::transaction_stream& value)
     {
         argument_.transaction = value;
     }
@@ -212,6 +251,57 @@ public:
         option_.format = value;
     }
 
+    /**
+     * Get the value of the fields option.
+     */
+    virtual std::string& get_fields_option()
+    {
+        return option_.fields;
+    }
+
+    /**
+     * Set the value of the fields option.
+     */
+    virtual void set_fields_option(
+        const std::string& value)
+    {
+        option_.fields = value;
+    }
+
+    /**
+     * Get the value of the file option.
+     */
+    virtual boost::filesystem::path& get_file_option()
+    {
+        return option_.file;
+    }
+
+    /**
+     * Set the value of the file option.
+     */
+    virtual void set_file_option(
+        const boost::filesystem::path& value)
+    {
+        option_.file = value;
+    }
+
+    /**
+     * Get the value of the raw option.
+     */
+    virtual bool& get_raw_option()
+    {
+        return option_.raw;
+    }
+
+    /**
+     * Set the value of the raw option.
+     */
+    virtual void set_raw_option(
+        const bool& value)
+    {
+        option_.raw = value;
+    }
+
 private:
 
     /**
@@ -226,7 +316,7 @@ private:
         {
         }
 
-        primitives::transaction transaction;
+        primitives::transaction_stream transaction;
     } argument_;
 
     /**
@@ -237,11 +327,17 @@ private:
     struct option
     {
         option()
-          : format()
+          : format(),
+            fields(),
+            file(),
+            raw()
         {
         }
 
         primitives::encoding format;
+        std::string fields;
+        boost::filesystem::path file;
+        bool raw;
     } option_;
 };
 
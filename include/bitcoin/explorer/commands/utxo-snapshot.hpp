@@ -0,0 +1,296 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_UTXO_SNAPSHOT_HPP
+#define BX_UTXO_SNAPSHOT_HPP
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/program_options.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/command.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/generated.hpp>
+#include <bitcoin/explorer/primitives/address.hpp>
+#include <bitcoin/explorer/primitives/base16.hpp>
+#include <bitcoin/explorer/primitives/base16_stream.hpp>
+#include <bitcoin/explorer/primitives/base2.hpp>
+#include <bitcoin/explorer/primitives/base58.hpp>
+#include <bitcoin/explorer/primitives/base64.hpp>
+#include <bitcoin/explorer/primitives/base85.hpp>
+#include <bitcoin/explorer/primitives/btc.hpp>
+#include <bitcoin/explorer/primitives/btc160.hpp>
+#include <bitcoin/explorer/primitives/byte.hpp>
+#include <bitcoin/explorer/primitives/byte_stream.hpp>
+#include <bitcoin/explorer/primitives/cert_key.hpp>
+#include <bitcoin/explorer/primitives/ec_private.hpp>
+#include <bitcoin/explorer/primitives/encoding.hpp>
+#include <bitcoin/explorer/primitives/endorsement.hpp>
+#include <bitcoin/explorer/primitives/hashtype.hpp>
+#include <bitcoin/explorer/primitives/hd_key.hpp>
+#include <bitcoin/explorer/primitives/hd_path.hpp>
+#include <bitcoin/explorer/primitives/header.hpp>
+#include <bitcoin/explorer/primitives/index_range.hpp>
+#include <bitcoin/explorer/primitives/input.hpp>
+#include <bitcoin/explorer/primitives/language.hpp>
+#include <bitcoin/explorer/primitives/output.hpp>
+#include <bitcoin/explorer/primitives/raw.hpp>
+#include <bitcoin/explorer/primitives/script.hpp>
+#include <bitcoin/explorer/primitives/signature.hpp>
+#include <bitcoin/explorer/primitives/transaction.hpp>
+#include <bitcoin/explorer/primitives/transaction_stream.hpp>
+#include <bitcoin/explorer/primitives/wrapper.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+/********* GENERATED SOURCE CODE, DO NOT EDIT EXCEPT EXPERIMENTALLY **********/
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+
+/**
+ * Various localizable strings.
+ */
+#define BX_UTXO_SNAPSHOT_BLOCK_INVALID \
+    "A block of the chain is not valid."
+#define BX_UTXO_SNAPSHOT_FILE_INVALID \
+    "The file could not be read: %1%."
+#define BX_UTXO_SNAPSHOT_FILE_NETWORK \
+    "The file holds blocks of a network other than network.identifier: %1%."
+#define BX_UTXO_SNAPSHOT_NO_CHAIN \
+    "The block files do not hold a chain from the genesis block."
+#define BX_UTXO_SNAPSHOT_OKAY \
+    "Replayed %1% blocks, with %2% unspent outputs."
+#define BX_UTXO_SNAPSHOT_WRITE_FAILED \
+    "The snapshot could not be written: %1%."
+
+/**
+ * Class to implement the utxo-snapshot command.
+ */
+class BCX_API utxo_snapshot 
+  : public command
+{
+public:
+
+    /**
+     * The symbolic (not localizable) command name, lower case.
+     */
+    static const char* symbol()
+    {
+        return "utxo-snapshot";
+    }
+
+
+    /**
+     * The member symbolic (not localizable) command name, lower case.
+     */
+    virtual const char* name()
+    {
+        return utxo_snapshot::symbol();
+    }
+
+    /**
+     * The localizable command category name, upper case.
+     */
+    virtual const char* category()
+    {
+        return "TRANSACTION";
+    }
+
+    /**
+     * The localizable command description.
+     */
+    virtual const char* description()
+    {
+        return "Build a snapshot of the unspent outputs of block files (blk*.dat), for the snapshot option of fetch-balance and fetch-utxo.";
+    }
+
+    /**
+     * Load program argument definitions.
+     * A value of -1 indicates that the number of instances is unlimited.
+     * @return  The loaded program argument definitions.
+     */
+    virtual arguments_metadata& load_arguments()
+    {
+        return get_argument_metadata()
+            .add("SNAPSHOT_FILE", 1)
+            .add("BLOCK_FILE", -1);
+    }
+
+	/**
+     * Load parameter fallbacks from file or input as appropriate.
+     * @param[in]  input  The input stream for loading the parameters.
+     * @param[in]         The loaded variables.
+     */
+    virtual void load_fallbacks(std::istream& input, 
+        po::variables_map& variables)
+    {
+    }
+
+    /**
+     * Load program option definitions.
+     * BUGBUG: see boost bug/fix: svn.boost.org/trac/boost/ticket/8009
+     * @return  The loaded program option definitions.
+     */
+    virtual options_metadata& load_options()
+    {
+        using namespace po;
+        options_description& options = get_option_metadata();
+        options.add_options()
+        (
+            BX_HELP_VARIABLE ",h",
+            value<bool>()->zero_tokens(),
+            "Get a description and instructions for this command."
+        )
+        (
+            BX_CONFIG_VARIABLE ",c",
+            value<boost::filesystem::path>(),
+            "The path to the configuration settings file."
+        )
+        (
+            "height,t",
+            value<uint32_t>(&option_.height)->default_value(4294967295),
+            "The height of the last block of the snapshot, defaults to the top of the chain."
+        )
+        (
+            "SNAPSHOT_FILE",
+            value<boost::filesystem::path>(&argument_.snapshot_file)->required(),
+            "The path of the snapshot file. An existing snapshot is replaced."
+        )
+        (
+            "BLOCK_FILE",
+            value<std::vector<boost::filesystem::path>>(&argument_.block_files)->required(),
+            "The set of block files to replay, in any order. Blocks not in the longest chain of the files are ignored."
+        );
+
+        return options;
+    }
+
+    /**
+     * Set variable defaults from configuration variable values.
+     * @param[in]  variables  The loaded variables.
+     */
+    virtual void set_defaults_from_config(po::variables_map& variables)
+    {
+    }
+
+    /**
+     * Invoke the command.
+     * @param[out]  output  The input stream for the command execution.
+     * @param[out]  error   The input stream for the command execution.
+     * @return              The appropriate console return code { -1, 0, 1 }.
+     */
+    virtual console_result invoke(std::ostream& output,
+        std::ostream& cerr);
+
+    /* Properties */
+
+    /**
+     * Get the value of the SNAPSHOT_FILE argument.
+     */
+    virtual boost::filesystem::path& get_snapshot_file_argument()
+    {
+        return argument_.snapshot_file;
+    }
+
+    /**
+     * Set the value of the SNAPSHOT_FILE argument.
+     */
+    virtual void set_snapshot_file_argument(
+        const boost::filesystem::path& value)
+    {
+        argument_.snapshot_file = value;
+    }
+
+    /**
+     * Get the value of the BLOCK_FILE arguments.
+     */
+    virtual std::vector<boost::filesystem::path>& get_block_files_argument()
+    {
+        return argument_.block_files;
+    }
+
+    /**
+     * Set the value of the BLOCK_FILE arguments.
+     */
+    virtual void set_block_files_argument(
+        const std::vector<boost::filesystem::path>& value)
+    {
+        argument_.block_files = value;
+    }
+
+    /**
+     * Get the value of the height option.
+     */
+    virtual uint32_t& get_height_option()
+    {
+        return option_.height;
+    }
+
+    /**
+     * Set the value of the height option.
+     */
+    virtual void set_height_option(
+        const uint32_t& value)
+    {
+        option_.height = value;
+    }
+
+private:
+
+    /**
+     * Command line argument bound variables.
+     * Uses cross-compiler safe constructor-based zeroize.
+     * Zeroize for unit test consistency with program_options initialization.
+     */
+    struct argument
+    {
+        argument()
+          : snapshot_file(),
+            block_files()
+        {
+        }
+
+        boost::filesystem::path snapshot_file;
+        std::vector<boost::filesystem::path> block_files;
+    } argument_;
+
+    /**
+     * Command line option bound variables.
+     * Uses cross-compiler safe constructor-based zeroize.
+     * Zeroize for unit test consistency with program_options initialization.
+     */
+    struct option
+    {
+        option()
+          : height()
+        {
+        }
+
+        uint32_t height;
+    } option_;
+};
+
+} // namespace commands
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
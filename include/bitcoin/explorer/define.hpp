@@ -96,6 +96,11 @@ BC_CONSTEXPR size_t minimum_seed_bits = 128;
  */
 BC_CONSTEXPR size_t minimum_seed_size = minimum_seed_bits / bc::byte_bits;
 
+/**
+ * The size of each chunk read from a streamed input (1MiB).
+ */
+BC_CONSTEXPR size_t stream_chunk_size = 1024 * 1024;
+
 /**
  * Suppported output encoding engines.
  */
@@ -103,7 +108,12 @@ enum class encoding_engine
 {
     info,
     json,
-    xml
+    ndjson,
+    xml,
+    cbor,
+    msgpack,
+    csv,
+    tsv
 };
 
 /**
@@ -0,0 +1,126 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_EC_BATCH_HPP
+#define BX_EC_BATCH_HPP
+
+#include <cstdint>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * Point arithmetic on secp256k1 for deriving many public keys at once. The
+ * arithmetic is not constant time, so it must only be applied to public
+ * values, such as the tweaks of public derivation.
+ */
+
+/**
+ * An element of the secp256k1 field, as little endian 64 bit limbs, fully
+ * reduced.
+ */
+struct BCX_API ec_field
+{
+    uint64_t limbs[4];
+};
+
+/**
+ * A point in affine coordinates.
+ */
+struct BCX_API ec_affine
+{
+    ec_field x;
+    ec_field y;
+};
+
+/**
+ * A point in jacobian coordinates, (x / z^2, y / z^3) in affine terms.
+ */
+struct BCX_API ec_jacobian
+{
+    ec_field x;
+    ec_field y;
+    ec_field z;
+    bool infinity;
+};
+
+/**
+ * The generator of secp256k1.
+ */
+BC_CONSTEXPR ec_affine ec_generator =
+{
+    { {
+        0x59f2815b16f81798, 0x029bfcdb2dce28d9,
+        0x55a06295ce870b07, 0x79be667ef9dcbbac
+    } },
+    { {
+        0x9c47d08ffb10d4b8, 0xfd17b448a6855419,
+        0x5da4fbfc0e1108a8, 0x483ada7726a3c465
+    } }
+};
+
+/**
+ * Parse a compressed point.
+ * @param[out] out    The affine point.
+ * @param[in]  point  The compressed point.
+ * @return            True if the point is on the curve.
+ */
+BCX_API bool ec_decompress_point(ec_affine& out, const ec_compressed& point);
+
+/**
+ * Serialize an affine point.
+ * @param[in]  point  The point.
+ * @return            The compressed point.
+ */
+BCX_API ec_compressed ec_compress_point(const ec_affine& point);
+
+/**
+ * Multiply the generator by a scalar, from a precomputed table of the
+ * multiples of each byte position, so no doubling is required.
+ * @param[out] out     The product.
+ * @param[in]  scalar  The scalar.
+ * @return             False if the scalar is zero or not below the order.
+ */
+BCX_API bool ec_multiply_generator(ec_jacobian& out, const ec_secret& scalar);
+
+/**
+ * Add an affine point to a jacobian point.
+ * @param[in,out] sum     The jacobian point, replaced by the sum.
+ * @param[in]     addend  The affine point.
+ */
+BCX_API void ec_add_point(ec_jacobian& sum, const ec_affine& addend);
+
+/**
+ * Convert jacobian points to affine with a single field inversion, by
+ * Montgomery's simultaneous inversion of the z coordinates.
+ * @param[out] out     The affine points, unspecified where infinite.
+ * @param[in]  points  The jacobian points.
+ */
+BCX_API void ec_normalize_batch(std::vector<ec_affine>& out,
+    const std::vector<ec_jacobian>& points);
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
@@ -37,6 +37,7 @@
 #include <bitcoin/explorer/commands/base64-encode.hpp>
 #include <bitcoin/explorer/commands/bitcoin160.hpp>
 #include <bitcoin/explorer/commands/bitcoin256.hpp>
+#include <bitcoin/explorer/commands/block-decode.hpp>
 #include <bitcoin/explorer/commands/btc-to-satoshi.hpp>
 #include <bitcoin/explorer/commands/cert-new.hpp>
 #include <bitcoin/explorer/commands/cert-public.hpp>
@@ -49,6 +50,7 @@
 #include <bitcoin/explorer/commands/ec-to-ek.hpp>
 #include <bitcoin/explorer/commands/ec-to-public.hpp>
 #include <bitcoin/explorer/commands/ec-to-wif.hpp>
+#include <bitcoin/explorer/commands/ec-vanity.hpp>
 #include <bitcoin/explorer/commands/ek-address.hpp>
 #include <bitcoin/explorer/commands/ek-new.hpp>
 #include <bitcoin/explorer/commands/ek-public.hpp>
@@ -65,14 +67,17 @@
 #include <bitcoin/explorer/commands/fetch-tx.hpp>
 #include <bitcoin/explorer/commands/fetch-tx-index.hpp>
 #include <bitcoin/explorer/commands/fetch-utxo.hpp>
+#include <bitcoin/explorer/commands/hd-derive.hpp>
 #include <bitcoin/explorer/commands/hd-new.hpp>
 #include <bitcoin/explorer/commands/hd-private.hpp>
 #include <bitcoin/explorer/commands/hd-public.hpp>
+#include <bitcoin/explorer/commands/hd-scan.hpp>
 #include <bitcoin/explorer/commands/hd-to-address.hpp>
 #include <bitcoin/explorer/commands/hd-to-ec.hpp>
 #include <bitcoin/explorer/commands/hd-to-public.hpp>
 #include <bitcoin/explorer/commands/hd-to-wif.hpp>
 #include <bitcoin/explorer/commands/help.hpp>
+#include <bitcoin/explorer/commands/index-blocks.hpp>
 #include <bitcoin/explorer/commands/input-set.hpp>
 #include <bitcoin/explorer/commands/input-sign.hpp>
 #include <bitcoin/explorer/commands/input-validate.hpp>
@@ -85,6 +90,7 @@
 #include <bitcoin/explorer/commands/qrcode.hpp>
 #include <bitcoin/explorer/commands/ripemd160.hpp>
 #include <bitcoin/explorer/commands/satoshi-to-btc.hpp>
+#include <bitcoin/explorer/commands/scan-blocks.hpp>
 #include <bitcoin/explorer/commands/script-decode.hpp>
 #include <bitcoin/explorer/commands/script-encode.hpp>
 #include <bitcoin/explorer/commands/script-to-address.hpp>
@@ -107,6 +113,7 @@
 #include <bitcoin/explorer/commands/tx-sign.hpp>
 #include <bitcoin/explorer/commands/uri-decode.hpp>
 #include <bitcoin/explorer/commands/uri-encode.hpp>
+#include <bitcoin/explorer/commands/utxo-snapshot.hpp>
 #include <bitcoin/explorer/commands/validate-tx.hpp>
 #include <bitcoin/explorer/commands/watch-address.hpp>
 #include <bitcoin/explorer/commands/watch-tx.hpp>
@@ -0,0 +1,232 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_HASH_STREAM_HPP
+#define BX_HASH_STREAM_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/filesystem.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/primitives/base16_stream.hpp>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * The SHA256 compression kernels, in order of preference.
+ */
+enum class sha256_kernel
+{
+    generic,
+    shani
+};
+
+/**
+ * The fastest SHA256 kernel supported by the CPU.
+ */
+BCX_API sha256_kernel sha256_default_kernel();
+
+/**
+ * All SHA256 kernels supported by the CPU.
+ */
+BCX_API std::vector<sha256_kernel> sha256_kernels();
+
+/**
+ * Incremental SHA256 hash, equivalent to bc::sha256_hash of the
+ * concatenation of the data written. Whole blocks are compressed directly
+ * from the written data, so the data may be of any size.
+ */
+class BCX_API sha256_hasher
+{
+public:
+
+    /**
+     * Construct a hasher.
+     * @param[in]  kernel  The kernel to use, which must be supported.
+     */
+    sha256_hasher(sha256_kernel kernel=sha256_default_kernel());
+
+    /**
+     * Hash the next part of the data.
+     * @param[in]  data  The data.
+     */
+    void write(data_slice data);
+
+    /**
+     * Complete the hash, after which the hasher should not be written.
+     * @return  The hash of the data.
+     */
+    hash_digest finish();
+
+private:
+    const sha256_kernel kernel_;
+    std::array<uint32_t, 8> state_;
+    std::array<uint8_t, 64> block_;
+    uint64_t size_;
+};
+
+/**
+ * Incremental SHA512 hash, equivalent to bc::sha512_hash.
+ */
+class BCX_API sha512_hasher
+{
+public:
+
+    /**
+     * Construct a hasher.
+     */
+    sha512_hasher();
+
+    /**
+     * Hash the next part of the data.
+     * @param[in]  data  The data.
+     */
+    void write(data_slice data);
+
+    /**
+     * Complete the hash, after which the hasher should not be written.
+     * @return  The hash of the data.
+     */
+    long_hash finish();
+
+private:
+    std::array<uint64_t, 8> state_;
+    std::array<uint8_t, 128> block_;
+    uint64_t size_;
+};
+
+/**
+ * Incremental RIPEMD160 hash, equivalent to bc::ripemd160_hash.
+ */
+class BCX_API ripemd160_hasher
+{
+public:
+
+    /**
+     * Construct a hasher.
+     */
+    ripemd160_hasher();
+
+    /**
+     * Hash the next part of the data.
+     * @param[in]  data  The data.
+     */
+    void write(data_slice data);
+
+    /**
+     * Complete the hash, after which the hasher should not be written.
+     * @return  The hash of the data.
+     */
+    short_hash finish();
+
+private:
+    std::array<uint32_t, 5> state_;
+    std::array<uint8_t, 64> block_;
+    uint64_t size_;
+};
+
+/**
+ * The multi-buffer SHA256 kernels, in order of preference. The single
+ * kernel hashes one message at a time with sha256_hasher, and the vector
+ * kernels hash 8 (AVX2) or 16 (AVX-512) messages at a time.
+ */
+enum class sha256_batch_kernel
+{
+    single,
+    avx2,
+    avx512
+};
+
+/**
+ * The fastest multi-buffer SHA256 kernel supported by the CPU.
+ */
+BCX_API sha256_batch_kernel sha256_batch_default_kernel();
+
+/**
+ * All multi-buffer SHA256 kernels supported by the CPU.
+ */
+BCX_API std::vector<sha256_batch_kernel> sha256_batch_kernels();
+
+/**
+ * Hash many independent messages, equivalent to bc::sha256_hash of each.
+ * Messages of a similar number of blocks are hashed together, so the
+ * messages may be of any sizes.
+ * @param[in]  messages  The messages to hash.
+ * @param[in]  kernel    The kernel to use, which must be supported.
+ * @return               The hash of each message, in order.
+ */
+BCX_API std::vector<hash_digest> sha256_batch(
+    const std::vector<data_slice>& messages,
+    sha256_batch_kernel kernel=sha256_batch_default_kernel());
+
+/**
+ * Hash many independent messages, equivalent to bc::bitcoin_hash of each.
+ * @param[in]  messages  The messages to hash.
+ * @param[in]  kernel    The kernel to use, which must be supported.
+ * @return               The double SHA256 of each message, in order.
+ */
+BCX_API std::vector<hash_digest> bitcoin256_batch(
+    const std::vector<data_slice>& messages,
+    sha256_batch_kernel kernel=sha256_batch_default_kernel());
+
+/**
+ * Validate many base58check payloads, equivalent to bc::verify_checksum
+ * of each.
+ * @param[in]  payloads  The payloads, each ending with its checksum.
+ * @param[in]  kernel    The kernel to use, which must be supported.
+ * @return               For each payload, true if the checksum is valid.
+ */
+BCX_API std::vector<bool> verify_checksum_batch(
+    const std::vector<data_slice>& payloads,
+    sha256_batch_kernel kernel=sha256_batch_default_kernel());
+
+/**
+ * Hash the input of a hash command, the mapped file if one is named, or
+ * else the data as it is read, so that memory use is bounded by the chunk
+ * size rather than the size of the input.
+ * @param      <Hasher>      The type of the hasher, see sha256_hasher.
+ * @param[in]  hasher        The hasher to write the input to.
+ * @param[in]  data          The data to hash if no file is named.
+ * @param[in]  file          The path of the file to hash, or empty.
+ * @param[in]  raw           True if the data is binary rather than base16.
+ * @param[in]  error         The stream to write an error to.
+ * @param[in]  file_invalid  The format of the error for a file, given the
+ *                           path of the file.
+ * @param[in]  invalid       The error for data that is not valid.
+ * @return                   False if the input was not valid.
+ */
+template <typename Hasher>
+bool hash_input(Hasher& hasher, const primitives::base16_stream& data,
+    const boost::filesystem::path& file, bool raw, std::ostream& error,
+    const std::string& file_invalid, const std::string& invalid);
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#include <bitcoin/explorer/impl/hash_stream.ipp>
+
+#endif
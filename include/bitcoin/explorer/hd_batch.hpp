@@ -0,0 +1,134 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_HD_BATCH_HPP
+#define BX_HD_BATCH_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/ec_batch.hpp>
+#include <bitcoin/explorer/hash_stream.hpp>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * A child key derived by hd_public_batch.
+ */
+struct BCX_API hd_public_child
+{
+    /**
+     * False if the index is hardened or the child is not a valid key.
+     */
+    bool valid;
+
+    uint32_t index;
+    ec_compressed point;
+    wallet::hd_chain_code chain_code;
+};
+
+/**
+ * Public derivation of many consecutive children of one parent, equivalent
+ * to hd_public::derive_public of each index. The HMAC-SHA512 midstates of
+ * the parent chain code and the parent point are computed once. Each tweak
+ * is multiplied from a precomputed generator table, and the points of a
+ * batch are converted to affine with a single field inversion.
+ */
+class BCX_API hd_public_batch
+{
+public:
+
+    /**
+     * The encoding of a child to a line of text.
+     */
+    typedef std::function<std::string(const hd_public_child&)> encoder;
+
+    /**
+     * Construct a deriver.
+     * @param[in]  parent  The parent key.
+     */
+    hd_public_batch(const wallet::hd_public& parent);
+
+    /**
+     * True if the parent is valid.
+     */
+    bool valid() const;
+
+    /**
+     * Derive consecutive children.
+     * @param[out] out    The children, in index order.
+     * @param[in]  first  The index of the first child.
+     * @param[in]  count  The number of children.
+     */
+    void derive(std::vector<hd_public_child>& out, uint32_t first,
+        size_t count) const;
+
+    /**
+     * Encode a child as an extended public key, equivalent to
+     * hd_public::encoded.
+     * @param[in]  child  The valid child.
+     * @return            The base58check key.
+     */
+    std::string encoded(const hd_public_child& child) const;
+
+    /**
+     * Encode a child as a payment address, equivalent to
+     * payment_address(ec_public(point), version).encoded.
+     * @param[in]  child    The valid child.
+     * @param[in]  version  The address version.
+     * @return              The base58check address.
+     */
+    std::string address(const hd_public_child& child, uint8_t version) const;
+
+    /**
+     * Derive consecutive children across threads and write a line for each
+     * in index order, stopping before the first invalid child.
+     * @param[in]  output  The stream to write to.
+     * @param[in]  first   The index of the first child.
+     * @param[in]  count   The number of children.
+     * @param[in]  encode  The encoding of each line.
+     * @return             The offset of the invalid child, otherwise count.
+     */
+    size_t write(std::ostream& output, uint32_t first, size_t count,
+        encoder encode) const;
+
+private:
+    bool valid_;
+    ec_affine point_;
+    ec_compressed compressed_;
+    sha512_hasher inner_;
+    sha512_hasher outer_;
+
+    // The child prefix, depth and parent fingerprint.
+    std::array<uint8_t, 9> lineage_;
+};
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,72 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_BLOCK_FILE_IPP
+#define BX_BLOCK_FILE_IPP
+
+#include <cstddef>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+
+template <typename Block, typename Parse, typename Apply>
+bool replay_blocks(const std::vector<data_slice>& files,
+    const std::vector<block_record>& records,
+    const std::vector<size_t>& chain, size_t first, size_t last,
+    Parse parse, Apply apply)
+{
+    while (first < last)
+    {
+        auto end = first;
+        size_t bytes = 0;
+        do
+        {
+            bytes += records[chain[end++]].size;
+        } while (end < last && bytes < replay_window_size);
+
+        std::vector<Block> window(end - first);
+        const auto parse_window = [&](size_t position)
+        {
+            const auto& record = records[chain[first + position]];
+            const auto begin = files[record.file].data() + record.offset;
+            parse(window[position], first + position,
+                data_slice(begin, begin + record.size));
+        };
+
+        parallel_for(window.size(), parse_window);
+
+        if (!apply(window, first))
+            return false;
+
+        first = end;
+    }
+
+    return true;
+}
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,72 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_HASH_STREAM_IPP
+#define BX_HASH_STREAM_IPP
+
+#include <iostream>
+#include <string>
+#include <boost/filesystem.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/mapped_file.hpp>
+#include <bitcoin/explorer/primitives/base16_stream.hpp>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+
+template <typename Hasher>
+bool hash_input(Hasher& hasher, const primitives::base16_stream& data,
+    const boost::filesystem::path& file, bool raw, std::ostream& error,
+    const std::string& file_invalid, const std::string& invalid)
+{
+    if (!file.empty())
+    {
+        const mapped_file mapped(file);
+        if (!mapped.valid())
+        {
+            error << format(file_invalid) % file << std::endl;
+            return false;
+        }
+
+        hasher.write(mapped.data());
+        return true;
+    }
+
+    const auto hash_chunk = [&hasher](data_slice chunk)
+    {
+        hasher.write(chunk);
+        return true;
+    };
+
+    if (!data.read(stream_chunk_size, raw, hash_chunk))
+    {
+        error << invalid << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
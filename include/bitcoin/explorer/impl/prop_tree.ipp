@@ -23,6 +23,8 @@
 #include <string>
 #include <boost/property_tree/ptree.hpp>
 #include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/prop_fields.hpp>
+#include <bitcoin/explorer/prop_writer.hpp>
 
 /* NOTE: don't declare 'using namespace foo' in headers. */
 
@@ -40,6 +42,17 @@ pt::ptree prop_tree_list(const std::string& name, const Values& values)
     return list;
 }
 
+template <typename Values>
+pt::ptree prop_tree_list(const std::string& name, const Values& values,
+    const prop_fields& fields)
+{
+    pt::ptree list;
+    for (const auto& value: values)
+        list.add_child(name, prop_list(value, fields));
+
+    return list;
+}
+
 template <typename Values>
 pt::ptree prop_value_list(const std::string& name, const Values& values)
 {
@@ -54,6 +67,14 @@ pt::ptree prop_value_list(const std::string& name, const Values& values)
     return list;
 }
 
+template <typename Values>
+void prop_write_list(prop_writer& writer, const std::string& name,
+    const Values& values)
+{
+    for (const auto& value: values)
+        writer.write(name, prop_list(value));
+}
+
 } // namespace primitives
 } // namespace explorer
 } // namespace libbitcoin
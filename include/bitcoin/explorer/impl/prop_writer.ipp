@@ -0,0 +1,43 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_PROP_WRITER_IPP
+#define BX_PROP_WRITER_IPP
+
+#include <sstream>
+#include <string>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+
+// Values are serialized as property_tree serializes them (booleans as words).
+template <typename Value>
+void prop_writer::put(const std::string& name, const Value& value)
+{
+    std::ostringstream text;
+    text << std::boolalpha << value;
+    put(name, text.str());
+}
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
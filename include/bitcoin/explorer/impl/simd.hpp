@@ -0,0 +1,33 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_SIMD_HPP
+#define BX_SIMD_HPP
+
+// Vector kernels are compiled with per-function target attributes and are
+// selected by a run time test of the processor, so the library itself does
+// not require any instruction set extension. BX_X86 is defined where such
+// kernels are compiled.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #define BX_X86
+    #include <cpuid.h>
+    #include <immintrin.h>
+#endif
+
+#endif
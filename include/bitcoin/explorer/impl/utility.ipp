@@ -27,11 +27,14 @@
 #pragma warning(push)
 #pragma warning(disable : 4996)
 #endif
+#include <algorithm>
 #include <cstddef>
 #include <iostream>
 #include <cstdint>
+#include <cstring>
 #include <string>
 #include <system_error>
+#include <thread>
 #include <tuple>
 #include <vector>
 #include <boost/algorithm/string.hpp>
@@ -53,6 +56,16 @@
 namespace libbitcoin {
 namespace explorer {
 
+template <size_t Size>
+size_t digest_hasher<Size>::operator()(const byte_array<Size>& digest) const
+{
+    static_assert(Size >= sizeof(size_t), "The digest is too short.");
+
+    size_t value;
+    std::memcpy(&value, digest.data(), sizeof(value));
+    return value;
+}
+
 template <typename Value>
 void deserialize(Value& value, const std::string& text, bool trim)
 {
@@ -125,6 +138,76 @@ void load_path(Value& parameter, const std::string& name,
     deserialize(parameter, file, !raw);
 }
 
+template <typename Function>
+void parallel_for(size_t count, Function function, size_t threads)
+{
+    if (threads == 0)
+        threads = std::max(std::thread::hardware_concurrency(), 1u);
+
+    threads = std::min(threads, count);
+    if (threads <= 1)
+    {
+        for (size_t index = 0; index < count; ++index)
+            function(index);
+
+        return;
+    }
+
+    // Each thread processes one contiguous batch of the range.
+    const auto batch = (count + threads - 1) / threads;
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+
+    for (size_t first = 0; first < count; first += batch)
+    {
+        const auto last = std::min(first + batch, count);
+        workers.emplace_back([first, last, &function]()
+        {
+            for (auto index = first; index < last; ++index)
+                function(index);
+        });
+    }
+
+    for (auto& worker: workers)
+        worker.join();
+}
+
+template <typename Function>
+size_t parallel_write(std::ostream& output, size_t count, Function function,
+    size_t block)
+{
+    std::vector<std::string> lines;
+    std::vector<uint8_t> valid;
+    for (size_t first = 0; first < count; first += block)
+    {
+        const auto size = std::min(block, count - first);
+        lines.assign(size, std::string());
+        valid.assign(size, 0);
+
+        const auto evaluate = [&](size_t offset)
+        {
+            valid[offset] = function(first + offset, lines[offset]) ? 1 : 0;
+        };
+
+        parallel_for(size, evaluate);
+
+        // Lines are not flushed individually, since a range may be large.
+        for (size_t offset = 0; offset < size; ++offset)
+        {
+            if (valid[offset] == 0)
+            {
+                output.flush();
+                return first + offset;
+            }
+
+            output << lines[offset] << "\n";
+        }
+    }
+
+    output.flush();
+    return count;
+}
+
 template <typename Value>
 std::string serialize(const Value& value, const std::string& fallback)
 {
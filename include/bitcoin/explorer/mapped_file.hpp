@@ -0,0 +1,70 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_MAPPED_FILE_HPP
+#define BX_MAPPED_FILE_HPP
+
+#include <boost/filesystem.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * A read-only memory mapping of a file, for reading a large file without
+ * copying it into memory. The pages of the file are read by the system as
+ * they are accessed, and the mapping is advised for sequential access.
+ */
+class BCX_API mapped_file
+{
+public:
+
+    /**
+     * Map the file. Check valid() for success.
+     * @param[in]  path  The path of the file to map.
+     */
+    mapped_file(const boost::filesystem::path& path);
+
+    /**
+     * Determine whether the file was mapped.
+     * @return  True if the file was mapped (an empty file is valid).
+     */
+    bool valid() const;
+
+    /**
+     * The content of the file.
+     * @return  The mapped content, empty if not valid.
+     */
+    data_slice data() const;
+
+private:
+    bool valid_;
+    boost::interprocess::file_mapping mapping_;
+    boost::interprocess::mapped_region region_;
+};
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
@@ -20,6 +20,7 @@
 #ifndef BX_OBELISK_CLIENT_HPP
 #define BX_OBELISK_CLIENT_HPP
 
+#include <functional>
 #include <boost/filesystem.hpp>
 #include <czmq++/czmqpp.hpp>
 #include <bitcoin/client.hpp>
@@ -37,6 +38,11 @@ namespace explorer {
  */
 BC_CONSTEXPR int zmq_success = 0;
 
+/**
+ * The longest poll wait between tests of a stop predicate (100 ms).
+ */
+BC_CONSTEXPR client::period_ms stop_poll_interval(100);
+
 /**
  * Class to simplify obelisk/libbitcoin-server usage. 
  * This class hides *all* use of czmqpp/czmq/zmq/libsodium.
@@ -105,6 +111,15 @@ public:
      */
     BCX_API virtual bool resolve_callbacks();
 
+    /**
+     * Resolve callback functions until the predicate is satisfied. Calls
+     * that remain outstanding at that point are abandoned, so their handlers
+     * are not invoked by this method.
+     * @param[in]  done  Returns true once no further responses are required.
+     * @return           True if not terminated before completion.
+     */
+    BCX_API virtual bool resolve_callbacks(const std::function<bool()>& done);
+
     /**
      * Poll the connection until the request terminates.
      * @param[in]  timeout  The poll timeout, defaults to zero.
@@ -119,6 +134,16 @@ public:
     BCX_API virtual void poll_until_timeout_cumulative(
         const client::period_ms& timeout=client::period_ms(0));
 
+    /**
+     * Poll the connection until the request times out or terminates, or
+     * until the predicate is satisfied. The predicate is tested at least
+     * once per stop_poll_interval.
+     * @param[in]  timeout  The poll timeout.
+     * @param[in]  done     Returns true once polling should stop.
+     */
+    BCX_API virtual void poll_until_timeout_cumulative(
+        const client::period_ms& timeout, const std::function<bool()>& done);
+
 private:
 
     czmqpp::context context_;
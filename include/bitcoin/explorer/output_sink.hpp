@@ -0,0 +1,125 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_OUTPUT_SINK_HPP
+#define BX_OUTPUT_SINK_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <bitcoin/explorer/define.hpp>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * The default size at which a buffered sink writes to its stream (64 KiB).
+ */
+BC_CONSTEXPR size_t sink_buffer_size = 65536;
+
+/**
+ * The default interval at which a timed sink writes to its stream (100 ms).
+ */
+BC_CONSTEXPR uint32_t sink_flush_milliseconds = 100;
+
+/**
+ * When a sink writes its buffered text to the underlying stream.
+ */
+enum class flush_policy
+{
+    /**
+     * Write through and flush on every stream flush, as for interactive use.
+     */
+    immediate,
+
+    /**
+     * Write when the buffer reaches its size limit, and on destruction.
+     */
+    size,
+
+    /**
+     * Write when the buffer reaches its size limit, at each interval in
+     * which text was buffered, and on destruction.
+     */
+    interval
+};
+
+/**
+ * A stream buffer that collects output into blocks for an underlying stream,
+ * so that each record written (and each std::endl) does not cost a write to
+ * the device. Buffered text is always written on destruction.
+ */
+class BCX_API output_sink
+  : public std::streambuf
+{
+public:
+
+    /**
+     * Construct a sink.
+     * @param[in]  stream        The stream to write to.
+     * @param[in]  policy        The flush policy.
+     * @param[in]  size          The buffer size at which text is written.
+     * @param[in]  milliseconds  The flush interval of the interval policy.
+     */
+    output_sink(std::ostream& stream,
+        flush_policy policy=flush_policy::immediate,
+        size_t size=sink_buffer_size,
+        uint32_t milliseconds=sink_flush_milliseconds);
+
+    /**
+     * Stop the interval timer and write any buffered text.
+     */
+    ~output_sink();
+
+    /**
+     * Write any buffered text to the stream and flush the stream.
+     */
+    void flush();
+
+protected:
+    virtual int_type overflow(int_type character);
+    virtual std::streamsize xsputn(const char* data, std::streamsize size);
+    virtual int sync();
+
+private:
+    void write(const char* data, size_t size);
+    void drain();
+    void run();
+
+    std::ostream& stream_;
+    const flush_policy policy_;
+    const size_t size_;
+    const uint32_t milliseconds_;
+    std::string buffer_;
+    bool stopped_;
+    std::mutex mutex_;
+    std::condition_variable stopping_;
+    std::thread timer_;
+};
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,146 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_BASE16_STREAM_HPP
+#define BX_BASE16_STREAM_HPP
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <boost/program_options.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/primitives/base16.hpp>
+#include <bitcoin/explorer/primitives/byte_stream.hpp>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+namespace primitives {
+
+/**
+ * Serialization helper for Base16 data that may be larger than memory.
+ * A value given as an argument is decoded as it is parsed (as with base16),
+ * while a value that falls back to STDIN is decoded from the stream as it
+ * is consumed, or is consumed as binary data.
+ */
+class BCX_API base16_stream
+{
+public:
+
+    /**
+     * The handler for each chunk of the value, returns false to stop.
+     */
+    typedef byte_stream::chunk_handler chunk_handler;
+
+    /**
+     * Default constructor.
+     */
+    base16_stream();
+
+    /**
+     * Initialization constructor.
+     * @param[in]  hexcode  The value to initialize with.
+     */
+    base16_stream(const std::string& hexcode);
+
+    /**
+     * Initialization constructor.
+     * @param[in]  value  The value to initialize with.
+     */
+    base16_stream(const data_chunk& value);
+
+    /**
+     * Initialization constructor.
+     * @param[in]  value  The value to initialize with.
+     */
+    base16_stream(const base16& value);
+
+    /**
+     * Initialization constructor, the value is read from the stream.
+     * @param[in]  input  The stream to read the value from.
+     */
+    base16_stream(std::istream& input);
+
+    /**
+     * Copy constructor.
+     * @param[in]  other  The object to copy into self on construct.
+     */
+    base16_stream(const base16_stream& other);
+
+    /**
+     * Read the value in chunks of data. A streamed value is decoded from
+     * Base16 text as it is read, ignoring whitespace, unless it is raw.
+     * Memory use is bounded by the chunk size.
+     * @param[in]  size     The maximum size of each chunk of the stream.
+     * @param[in]  raw      Read a streamed value as binary data.
+     * @param[in]  handler  The handler to invoke with each chunk.
+     * @return              False if the handler stopped the read or the
+     *                      streamed text is not valid Base16.
+     */
+    bool read(size_t size, bool raw, chunk_handler handler) const;
+
+    /**
+     * Overload stream in. Throws if input is invalid.
+     * @param[in]   input     The input stream to read the value from.
+     * @param[out]  argument  The object to receive the read value.
+     * @return                The input stream reference.
+     */
+    friend std::istream& operator>>(std::istream& input,
+        base16_stream& argument);
+
+    /**
+     * Overload stream out.
+     * @param[in]   output    The output stream to write the value to.
+     * @param[out]  argument  The object from which to obtain the value.
+     * @return                The output stream reference.
+     */
+    friend std::ostream& operator<<(std::ostream& output,
+        const base16_stream& argument);
+
+private:
+
+    /**
+     * The state of this object's data, if not streamed.
+     */
+    data_chunk value_;
+
+    /**
+     * The stream from which the text is read, or nullptr.
+     */
+    std::istream* input_;
+};
+
+/**
+ * Fall back to the input stream for a Base16 stream parameter without
+ * reading it into memory. This is found by argument dependent lookup from
+ * load_input, in place of deserializing the whole stream.
+ * @param[out] value  The parameter to receive the stream.
+ * @param[in]  input  The input stream.
+ * @param[in]  trim   Unused, whitespace is ignored as the stream is read.
+ */
+BCX_API void deserialize(base16_stream& value, std::istream& input,
+    bool trim);
+
+} // namespace explorer
+} // namespace primitives
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,134 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_BYTE_STREAM_HPP
+#define BX_BYTE_STREAM_HPP
+
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <boost/program_options.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+namespace primitives {
+
+/**
+ * Serialization helper for a byte stream that may be larger than memory.
+ * A value given as an argument is held as data_chunk (as with raw), while a
+ * value that falls back to STDIN is read from the stream as it is consumed.
+ */
+class BCX_API byte_stream
+{
+public:
+
+    /**
+     * The handler for each chunk of the value, returns false to stop.
+     */
+    typedef std::function<bool(data_slice)> chunk_handler;
+
+    /**
+     * Default constructor.
+     */
+    byte_stream();
+
+    /**
+     * Initialization constructor.
+     * @param[in]  text  The value to initialize with.
+     */
+    byte_stream(const std::string& text);
+
+    /**
+     * Initialization constructor.
+     * @param[in]  value  The value to initialize with.
+     */
+    byte_stream(const data_chunk& value);
+
+    /**
+     * Initialization constructor, the value is read from the stream.
+     * @param[in]  input  The stream to read the value from.
+     */
+    byte_stream(std::istream& input);
+
+    /**
+     * Copy constructor.
+     * @param[in]  other  The object to copy into self on construct.
+     */
+    byte_stream(const byte_stream& other);
+
+    /**
+     * Read the value in chunks, from the stream if the value is streamed.
+     * Memory use is bounded by the chunk size.
+     * @param[in]  size     The maximum size of each chunk.
+     * @param[in]  handler  The handler to invoke with each chunk.
+     * @return              False if the handler stopped the read.
+     */
+    bool read(size_t size, chunk_handler handler) const;
+
+    /**
+     * Overload stream in. Reads the remainder of the stream into memory.
+     * @param[in]   input     The input stream to read the value from.
+     * @param[out]  argument  The object to receive the read value.
+     * @return                The input stream reference.
+     */
+    friend std::istream& operator>>(std::istream& input,
+        byte_stream& argument);
+
+    /**
+     * Overload stream out.
+     * @param[in]   output    The output stream to write the value to.
+     * @param[out]  argument  The object from which to obtain the value.
+     * @return                The output stream reference.
+     */
+    friend std::ostream& operator<<(std::ostream& output,
+        const byte_stream& argument);
+
+private:
+
+    /**
+     * The state of this object's data, if not streamed.
+     */
+    data_chunk value_;
+
+    /**
+     * The stream from which the data is read, or nullptr.
+     */
+    std::istream* input_;
+};
+
+/**
+ * Fall back to the input stream for a byte stream parameter without reading
+ * it into memory. This is found by argument dependent lookup from
+ * load_input, in place of deserializing the whole stream.
+ * @param[out] value  The parameter to receive the stream.
+ * @param[in]  input  The input stream.
+ * @param[in]  trim   Unused, the stream is not text.
+ */
+BCX_API void deserialize(byte_stream& value, std::istream& input, bool trim);
+
+} // namespace explorer
+} // namespace primitives
+} // namespace libbitcoin
+
+#endif
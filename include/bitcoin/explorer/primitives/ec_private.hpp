@@ -42,6 +42,7 @@ public:
      * Default constructor.
      */
     ec_private()
+      : value_()
     {
     }
 
@@ -0,0 +1,122 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_HD_PATH_HPP
+#define BX_HD_PATH_HPP
+
+#include <iostream>
+#include <string>
+#include <cstdint>
+#include <vector>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/primitives/index_range.hpp>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+namespace primitives {
+
+/**
+ * Serialization helper to convert between text and an HD (BIP32) derivation
+ * path of index ranges, such as m/44'/0'/0'/{0,1}/0-999. Each level is an
+ * index, an inclusive range of indexes or a braced list of either, and an
+ * index suffixed with 'h' or an apostrophe is hardened. The leading 'm' is
+ * optional.
+ */
+class BCX_API hd_path
+{
+public:
+
+    /**
+     * The ranges of a level, in path order.
+     */
+    typedef std::vector<index_range> level;
+
+    /**
+     * Default constructor, the empty path.
+     */
+    hd_path();
+
+    /**
+     * Initialization constructor.
+     * @param[in]  text  The value to initialize with.
+     */
+    hd_path(const std::string& text);
+
+    /**
+     * Initialization constructor.
+     * @param[in]  levels  The levels to initialize with.
+     */
+    hd_path(const std::vector<level>& levels);
+
+    /**
+     * Copy constructor.
+     * @param[in]  other  The object to copy into self on construct.
+     */
+    hd_path(const hd_path& other);
+
+    /**
+     * The levels of the path, from the root.
+     * @return  The levels.
+     */
+    const std::vector<level>& levels() const;
+
+    /**
+     * The number of keys at the last level, one for the empty path.
+     * @return  The number of keys.
+     */
+    uint32_t count() const;
+
+    /**
+     * Determine whether any index of the path is hardened.
+     * @return  True if any index is hardened.
+     */
+    bool hard() const;
+
+    /**
+     * Overload stream in. Throws if input is invalid.
+     * @param[in]   input     The input stream to read the value from.
+     * @param[out]  argument  The object to receive the read value.
+     * @return                The input stream reference.
+     */
+    friend std::istream& operator>>(std::istream& input, hd_path& argument);
+
+    /**
+     * Overload stream out.
+     * @param[in]   output    The output stream to write the value to.
+     * @param[out]  argument  The object from which to obtain the value.
+     * @return                The output stream reference.
+     */
+    friend std::ostream& operator<<(std::ostream& output,
+        const hd_path& argument);
+
+private:
+
+    /**
+     * The state of this object.
+     */
+    std::vector<level> levels_;
+};
+
+} // namespace explorer
+} // namespace primitives
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,119 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_INDEX_RANGE_HPP
+#define BX_INDEX_RANGE_HPP
+
+#include <iostream>
+#include <string>
+#include <cstdint>
+#include <bitcoin/explorer/define.hpp>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+namespace primitives {
+
+/**
+ * Serialization helper to convert between text and a range of HD (BIP32)
+ * child indexes. The text is START:COUNT, where START may be suffixed with
+ * 'h' or an apostrophe for a range of hardened indexes. The range must not
+ * cross into or beyond the hardened indexes.
+ */
+class BCX_API index_range
+{
+public:
+
+    /**
+     * Default constructor, an empty range.
+     */
+    index_range();
+
+    /**
+     * Initialization constructor.
+     * @param[in]  tuple  The value to initialize with.
+     */
+    index_range(const std::string& tuple);
+
+    /**
+     * Initialization constructor.
+     * @param[in]  start   The first index, excluding the hardened offset.
+     * @param[in]  count   The number of indexes.
+     * @param[in]  hard    True if the indexes are hardened.
+     */
+    index_range(uint32_t start, uint32_t count, bool hard);
+
+    /**
+     * Copy constructor.
+     * @param[in]  other  The object to copy into self on construct.
+     */
+    index_range(const index_range& other);
+
+    /**
+     * The first index, including the hardened offset.
+     * @return  The first index.
+     */
+    uint32_t first() const;
+
+    /**
+     * The number of indexes, zero if the range is empty.
+     * @return  The number of indexes.
+     */
+    uint32_t count() const;
+
+    /**
+     * Determine whether the indexes are hardened.
+     * @return  True if the indexes are hardened.
+     */
+    bool hard() const;
+
+    /**
+     * Overload stream in. Throws if input is invalid.
+     * @param[in]   input     The input stream to read the value from.
+     * @param[out]  argument  The object to receive the read value.
+     * @return                The input stream reference.
+     */
+    friend std::istream& operator>>(std::istream& input,
+        index_range& argument);
+
+    /**
+     * Overload stream out.
+     * @param[in]   output    The output stream to write the value to.
+     * @param[out]  argument  The object from which to obtain the value.
+     * @return                The output stream reference.
+     */
+    friend std::ostream& operator<<(std::ostream& output,
+        const index_range& argument);
+
+private:
+
+    /**
+     * The state of this object.
+     */
+    uint32_t start_;
+    uint32_t count_;
+    bool hard_;
+};
+
+} // namespace explorer
+} // namespace primitives
+} // namespace libbitcoin
+
+#endif
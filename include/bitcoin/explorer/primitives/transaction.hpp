@@ -101,6 +101,26 @@ private:
     tx_type value_;
 };
 
+/**
+ * Determine whether a stream holds a binary transaction, in that it does not
+ * begin with whitespace or a Base16 digit. A binary transaction begins with
+ * its version, so this holds for any version below 0x09. Nothing is read.
+ * @param[in]  input  The input stream.
+ * @return            True if the stream holds a binary transaction.
+ */
+BCX_API bool is_binary_transaction(std::istream& input);
+
+/**
+ * Fall back to the input stream for a transaction parameter. A binary
+ * transaction is parsed directly from the stream, otherwise the stream is
+ * read as a Base16 transaction. Throws if the stream holds anything else.
+ * This is found by argument dependent lookup from load_input.
+ * @param[out] value  The parameter to receive the transaction.
+ * @param[in]  input  The input stream.
+ * @param[in]  trim   Unused, surrounding whitespace is always ignored.
+ */
+BCX_API void deserialize(transaction& value, std::istream& input, bool trim);
+
 } // namespace explorer
 } // namespace primitives
 } // namespace libbitcoin
@@ -0,0 +1,152 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_TRANSACTION_STREAM_HPP
+#define BX_TRANSACTION_STREAM_HPP
+
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/program_options.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/primitives/transaction.hpp>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+namespace primitives {
+
+/**
+ * Serialization helper for a sequence of transactions that may be larger
+ * than memory. A value given as an argument is a Base16 transaction (as
+ * with transaction), while a value that falls back to STDIN is parsed from
+ * the stream one transaction at a time. A stream holds either whitespace
+ * separated Base16 transactions or concatenated binary transactions.
+ */
+class BCX_API transaction_stream
+{
+public:
+
+    /**
+     * The handler for each transaction, returns false to stop.
+     */
+    typedef std::function<bool(const transaction&)> transaction_handler;
+
+    /**
+     * Default constructor.
+     */
+    transaction_stream();
+
+    /**
+     * Initialization constructor.
+     * @param[in]  hexcode  The value to initialize with.
+     */
+    transaction_stream(const std::string& hexcode);
+
+    /**
+     * Initialization constructor.
+     * @param[in]  value  The value to initialize with.
+     */
+    transaction_stream(const transaction& value);
+
+    /**
+     * Initialization constructor, the value is read from the stream.
+     * @param[in]  input  The stream to read the value from.
+     */
+    transaction_stream(std::istream& input);
+
+    /**
+     * Copy constructor.
+     * @param[in]  other  The object to copy into self on construct.
+     */
+    transaction_stream(const transaction_stream& other);
+
+    /**
+     * Read each transaction of the value, parsing a streamed value as it is
+     * read. Memory use is bounded by the size of a transaction.
+     * @param[in]  raw      Read a streamed value as binary, otherwise binary
+     *                      is detected as with is_binary_transaction.
+     * @param[in]  handler  The handler to invoke with each transaction.
+     * @return              False if the handler stopped the read or a
+     *                      streamed transaction is not valid.
+     */
+    bool read(bool raw, transaction_handler handler) const;
+
+    /**
+     * Read each transaction of the data, such as a mapped file, parsing the
+     * transactions in place without copying the data.
+     * @param[in]  data     The transactions, as read from a stream.
+     * @param[in]  raw      Read the data as binary, otherwise binary is
+     *                      detected as with is_binary_transaction.
+     * @param[in]  handler  The handler to invoke with each transaction.
+     * @return              False if the handler stopped the read or a
+     *                      transaction is not valid.
+     */
+    static bool read(data_slice data, bool raw, transaction_handler handler);
+
+    /**
+     * Overload stream in. Throws if input is invalid.
+     * @param[in]   input     The input stream to read the value from.
+     * @param[out]  argument  The object to receive the read value.
+     * @return                The input stream reference.
+     */
+    friend std::istream& operator>>(std::istream& input,
+        transaction_stream& argument);
+
+    /**
+     * Overload stream out, one Base16 transaction per line.
+     * @param[in]   output    The output stream to write the value to.
+     * @param[out]  argument  The object from which to obtain the value.
+     * @return                The output stream reference.
+     */
+    friend std::ostream& operator<<(std::ostream& output,
+        const transaction_stream& argument);
+
+private:
+
+    /**
+     * The state of this object's transactions, if not streamed.
+     */
+    std::vector<transaction> values_;
+
+    /**
+     * The stream from which the transactions are read, or nullptr.
+     */
+    std::istream* input_;
+};
+
+/**
+ * Fall back to the input stream for a transaction stream parameter without
+ * reading it into memory. This is found by argument dependent lookup from
+ * load_input, in place of deserializing the whole stream.
+ * @param[out] value  The parameter to receive the stream.
+ * @param[in]  input  The input stream.
+ * @param[in]  trim   Unused, whitespace is ignored as the stream is read.
+ */
+BCX_API void deserialize(transaction_stream& value, std::istream& input,
+    bool trim);
+
+} // namespace explorer
+} // namespace primitives
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,83 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_PROP_FIELDS_HPP
+#define BX_PROP_FIELDS_HPP
+
+#include <string>
+#include <vector>
+#include <bitcoin/explorer/define.hpp>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * A projection of property tree fields, as a set of dot separated paths.
+ * A path selects its field and all fields beneath it, and an empty
+ * projection selects all fields. Property tree construction consults the
+ * projection so that fields which are not selected are never computed.
+ */
+class BCX_API prop_fields
+{
+public:
+
+    /**
+     * Construct a projection of all fields.
+     */
+    prop_fields();
+
+    /**
+     * Construct a projection from a comma separated list of paths.
+     * @param[in]  list  The list of paths, such as "hash,outputs.value".
+     */
+    prop_fields(const std::string& list);
+
+    /**
+     * Whether all fields are selected.
+     */
+    bool all() const;
+
+    /**
+     * Whether the named field, or any field beneath it, is selected.
+     * @param[in]  name  The field name at the current level.
+     */
+    bool includes(const std::string& name) const;
+
+    /**
+     * The projection of the fields beneath the named field.
+     * @param[in]  name  The field name at the current level.
+     */
+    prop_fields child(const std::string& name) const;
+
+    /**
+     * The selected paths, empty if all fields are selected.
+     */
+    const std::vector<std::string>& paths() const;
+
+private:
+    bool all_;
+    std::vector<std::string> paths_;
+};
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
@@ -20,6 +20,7 @@
 #ifndef BX_PROPERTY_TREE_HPP
 #define BX_PROPERTY_TREE_HPP
 
+#include <cstdint>
 #include <map>
 #include <string>
 #include <vector>
@@ -33,6 +34,8 @@
 #include <bitcoin/explorer/primitives/point.hpp>
 #include <bitcoin/explorer/primitives/transaction.hpp>
 #include <bitcoin/explorer/primitives/wrapper.hpp>
+#include <bitcoin/explorer/prop_fields.hpp>
+#include <bitcoin/explorer/prop_writer.hpp>
 
 /* NOTE: don't declare 'using namespace foo' in headers. */
 
@@ -52,6 +55,17 @@ class wrapper;
  */
 typedef std::map<std::string, std::string> settings_list;
 
+/**
+ * A used address of an HD wallet, its derivation and its history.
+ */
+struct BCX_API wallet_address
+{
+    uint32_t branch;
+    uint32_t index;
+    wallet::payment_address address;
+    std::vector<client::history_row> history;
+};
+
 /**
  * Create a property tree array of property tree elements.
  * @param      <Values>  The array element type.
@@ -62,6 +76,18 @@ typedef std::map<std::string, std::string> settings_list;
 template <typename Values>
 pt::ptree prop_tree_list(const std::string& name, const Values& values);
 
+/**
+ * Create a property tree array of projected property tree elements.
+ * @param      <Values>  The array element type.
+ * @param[in]  name      The name of the list elements.
+ * @param[in]  values    The enumerable with elements of type Values.
+ * @param[in]  fields    The fields of each element to include.
+ * @returns              A new property tree containing the list.
+ */
+template <typename Values>
+pt::ptree prop_tree_list(const std::string& name, const Values& values,
+    const prop_fields& fields);
+
 /**
  * Create a property tree array of value elements.
  * @param      <Values>  The array element type.
@@ -72,6 +98,18 @@ pt::ptree prop_tree_list(const std::string& name, const Values& values);
 template <typename Values>
 pt::ptree prop_value_list(const std::string& name, const Values& values);
 
+/**
+ * Stream a property tree array of property tree elements, one element at a
+ * time, so that the size of the array does not affect memory use.
+ * @param      <Values>  The array element type.
+ * @param[in]  writer    The writer to stream the elements to.
+ * @param[in]  name      The name of the list elements.
+ * @param[in]  values    The enumerable with elements of type Values.
+ */
+template <typename Values>
+void prop_write_list(prop_writer& writer, const std::string& name,
+    const Values& values);
+
 /**
  * Generate a property list for a block header.
  * @param[in]  header  The header.
@@ -94,11 +132,23 @@ BCX_API pt::ptree prop_tree(const header& header);
 BCX_API pt::ptree prop_tree(const std::vector<header>& headers);
 
 /**
-* Generate a property list for a history row.
-* @param[in]  row  The history row.
-* @return          A property list.
-*/
-BCX_API pt::ptree prop_list(const client::history_row& row);
+ * Stream the property tree for a set of headers.
+ * @param[in]  writer   The writer to stream the tree to.
+ * @param[in]  headers  The set of headers.
+ */
+BCX_API void prop_write(prop_writer& writer,
+    const std::vector<header>& headers);
+
+/**
+ * Generate a property list for a history row. A server reports a height of
+ * zero for a pending transfer, so the height is omitted unless the row is
+ * confirmed, in which case a height of zero is the genesis block.
+ * @param[in]  row        The history row.
+ * @param[in]  confirmed  True if the row is of a local chain.
+ * @return                A property list.
+ */
+BCX_API pt::ptree prop_list(const client::history_row& row,
+    bool confirmed=false);
 
 /**
  * Generate a property tree for a history row.
@@ -110,28 +160,64 @@ BCX_API pt::ptree prop_tree(const client::history_row& row);
 /**
  * Generate a property tree for a set of history rows.
  *
- * @param[in]  rows  The set of history rows.
- * @return           A property tree.
+ * @param[in]  rows       The set of history rows.
+ * @param[in]  confirmed  True if the rows are of a local chain.
+ * @return                A property tree.
+ */
+BCX_API pt::ptree prop_tree(const std::vector<client::history_row>& rows,
+    bool confirmed=false);
+
+/**
+ * Stream the property tree for a set of history rows.
+ * @param[in]  writer     The writer to stream the tree to.
+ * @param[in]  rows       The set of history rows.
+ * @param[in]  confirmed  True if the rows are of a local chain.
  */
-BCX_API pt::ptree prop_tree(const std::vector<client::history_row>& rows);
+BCX_API void prop_write(prop_writer& writer,
+    const std::vector<client::history_row>& rows, bool confirmed=false);
 
 /**
  * Generate a property list from balance rows for an address.
  * @param[in]  rows             The set of balance rows.
  * @param[in]  balance_address  The payment address for the balance rows.
+ * @param[in]  confirmed        True if the rows are of a local chain.
  * @return                      A property list.
  */
 BCX_API pt::ptree prop_list(const std::vector<balance_row>& rows,
-    const wallet::payment_address& balance_address);
+    const wallet::payment_address& balance_address, bool confirmed=false);
 
 /**
  * Generate a property tree from balance rows for an address.
  * @param[in]  rows             The set of balance rows.
  * @param[in]  balance_address  The payment address for the balance rows.
+ * @param[in]  confirmed        True if the rows are of a local chain.
  * @return                      A property tree.
  */
 BCX_API pt::ptree prop_tree(const std::vector<balance_row>& rows,
-    const wallet::payment_address& balance_address);
+    const wallet::payment_address& balance_address, bool confirmed=false);
+
+/**
+ * Generate a property list for a used HD wallet address.
+ * @param[in]  address  The wallet address.
+ * @return              A property list.
+ */
+BCX_API pt::ptree prop_list(const wallet_address& address);
+
+/**
+ * Generate a property tree for the used addresses of an HD wallet, including
+ * the balance of the wallet.
+ * @param[in]  addresses  The set of used wallet addresses.
+ * @return                A property tree.
+ */
+BCX_API pt::ptree prop_tree(const std::vector<wallet_address>& addresses);
+
+/**
+ * Stream the property tree for a set of used wallet addresses.
+ * @param[in]  writer     The writer to stream the tree to.
+ * @param[in]  addresses  The set of used wallet addresses.
+ */
+BCX_API void prop_write(prop_writer& writer,
+    const std::vector<wallet_address>& addresses);
 
 /**
  * Generate a property list for a transaction input.
@@ -140,6 +226,15 @@ BCX_API pt::ptree prop_tree(const std::vector<balance_row>& rows,
  */
 BCX_API pt::ptree prop_list(const tx_input_type& tx_input);
 
+/**
+ * Generate a projected property list for a transaction input.
+ * @param[in]  tx_input  The input.
+ * @param[in]  fields    The fields to include.
+ * @return               A property list.
+ */
+BCX_API pt::ptree prop_list(const tx_input_type& tx_input,
+    const prop_fields& fields);
+
 /**
  * Generate a property tree for a transaction input.
  * @param[in]  tx_input  The input.
@@ -183,6 +278,15 @@ BCX_API pt::ptree prop_tree(
  */
 BCX_API pt::ptree prop_list(const tx_output_type& tx_output);
 
+/**
+ * Generate a projected property list for a transaction output.
+ * @param[in]  tx_output  The transaction output.
+ * @param[in]  fields     The fields to include.
+ * @return                A property list.
+ */
+BCX_API pt::ptree prop_list(const tx_output_type& tx_output,
+    const prop_fields& fields);
+
 /**
  * Generate a property tree for a transaction output.
  * @param[in]  tx_output  The transaction output.
@@ -204,6 +308,26 @@ BCX_API pt::ptree prop_tree(const std::vector<tx_output_type>& tx_outputs);
  */
 BCX_API pt::ptree prop_list(const transaction& transaction);
 
+/**
+ * Generate a projected property list for a transaction.
+ * @param[in]  transaction  The transaction.
+ * @param[in]  fields       The fields to include.
+ * @return                  A property list.
+ */
+BCX_API pt::ptree prop_list(const transaction& transaction,
+    const prop_fields& fields);
+
+/**
+ * Generate a projected property list for a transaction of known hash, such
+ * as a transaction of a block, so that the hash is not computed again.
+ * @param[in]  tx      The transaction.
+ * @param[in]  hash    The hash of the transaction.
+ * @param[in]  fields  The fields to include.
+ * @return             A property list.
+ */
+BCX_API pt::ptree prop_list(const tx_type& tx, const hash_digest& hash,
+    const prop_fields& fields);
+
 /**
  * Generate a property tree for a transaction.
  * @param[in]  transaction  The transaction.
@@ -211,6 +335,22 @@ BCX_API pt::ptree prop_list(const transaction& transaction);
  */
 BCX_API pt::ptree prop_tree(const transaction& transaction);
 
+/**
+ * Generate a projected property tree for a transaction.
+ * @param[in]  transaction  The transaction.
+ * @param[in]  fields       The fields to include.
+ * @return                  A property tree.
+ */
+BCX_API pt::ptree prop_tree(const transaction& transaction,
+    const prop_fields& fields);
+
+/**
+ * Determine whether a path names a field of the transaction property list.
+ * @param[in]  path  The dot separated path, such as "outputs.value".
+ * @return           True if the path names a transaction field.
+ */
+BCX_API bool is_transaction_field(const std::string& path);
+
 /**
  * Generate a property tree for a set of transactions.
  * @param[in]  transactions  The set of transactions.
@@ -218,6 +358,14 @@ BCX_API pt::ptree prop_tree(const transaction& transaction);
  */
 BCX_API pt::ptree prop_tree(const std::vector<transaction>& transactions);
 
+/**
+ * Stream the property tree for a set of transactions.
+ * @param[in]  writer        The writer to stream the tree to.
+ * @param[in]  transactions  The set of transactions.
+ */
+BCX_API void prop_write(prop_writer& writer,
+    const std::vector<transaction>& transactions);
+
 /**
  * Generate a property list for a wrapper.
  * @param[in]  wrapper  The wrapper instance.
@@ -307,6 +455,14 @@ BCX_API pt::ptree prop_tree(const client::stealth_row& row);
  */
 BCX_API pt::ptree prop_tree(const std::vector<client::stealth_row>& rows);
 
+/**
+ * Stream the property tree for a set of stealth rows.
+ * @param[in]  writer  The writer to stream the tree to.
+ * @param[in]  rows    The set of stealth rows.
+ */
+BCX_API void prop_write(prop_writer& writer,
+    const std::vector<client::stealth_row>& rows);
+
 /**
  * Create a property list for the fetch-tx-index command.
  * @param[in]  hash    The block hash.
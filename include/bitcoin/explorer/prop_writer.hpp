@@ -0,0 +1,170 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_PROP_WRITER_HPP
+#define BX_PROP_WRITER_HPP
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/property_tree/ptree.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/table_writer.hpp>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * Streaming writer for property documents. The output is identical to that
+ * of serializing the equivalent property tree with write_stream, but each
+ * element is written as it is visited, so memory use and the latency of the
+ * first byte do not depend on the size of the document. An empty container
+ * is written as an empty value, as it is by property_tree.
+ *
+ * The ndjson engine writes one compact json object per line. Each element
+ * of a list (a container of like-named containers) is a line, as is each
+ * container that holds values. Lines are flushed as they are completed.
+ *
+ * The binary (cbor and msgpack) engines prefix each container with its size,
+ * so the document is collected and written when it is finished.
+ *
+ * The table (csv and tsv) engines write each record as a row of its element
+ * type, and the rows of any lists within the record as rows of their own, in
+ * a single table (see table_writer). Rows are not flushed individually.
+ */
+class BCX_API prop_writer
+{
+public:
+
+    /**
+     * Construct a writer and begin the document.
+     * @param[in]  output  The output stream to write to.
+     * @param[in]  engine  The output format.
+     */
+    prop_writer(std::ostream& output, encoding_engine engine);
+
+    /**
+     * Finish the document if it has not been finished or abandoned.
+     */
+    ~prop_writer();
+
+    /**
+     * Open a named container at the current level. Nothing is written until
+     * the container's first element is written or the container is closed.
+     * @param[in]  name  The container name.
+     */
+    void begin(const std::string& name);
+
+    /**
+     * Close the innermost open container.
+     */
+    void end();
+
+    /**
+     * Write a named text value at the current level.
+     * @param[in]  name   The value name.
+     * @param[in]  value  The value text.
+     */
+    void put(const std::string& name, const std::string& value);
+
+    /**
+     * Write a named value at the current level, as serialized to a stream.
+     * @param      <Value>  The value type.
+     * @param[in]  name     The value name.
+     * @param[in]  value    The value.
+     */
+    template <typename Value>
+    void put(const std::string& name, const Value& value);
+
+    /**
+     * Write a property tree as a named element at the current level.
+     * @param[in]  name  The element name.
+     * @param[in]  tree  The property tree.
+     */
+    void write(const std::string& name, const pt::ptree& tree);
+
+    /**
+     * Write the elements of a property tree at the current level.
+     * @param[in]  tree  The property tree.
+     */
+    void write(const pt::ptree& tree);
+
+    /**
+     * Close any open containers, finish the document and flush the stream.
+     */
+    void finish();
+
+    /**
+     * Leave the document unfinished and flush the stream, as when the
+     * content of the document is not complete, so that the output is not
+     * mistaken for a complete document. A collected document is discarded.
+     */
+    void abandon();
+
+    /**
+     * The row writer of a table (csv or tsv) engine, for writing typed rows
+     * directly in place of elements.
+     * @return  The row writer, or nullptr if the engine is not a table.
+     */
+    table_writer* table();
+
+private:
+
+    struct level
+    {
+        std::string name;
+        bool opened;
+        size_t elements;
+    };
+
+    void open_pending();
+    void start_element(size_t depth);
+    void open(size_t depth);
+    void close(size_t depth);
+    void write_key(const std::string& name);
+    void write_value(const std::string& name, const std::string& value);
+    void write_indent(size_t count);
+
+    bool buffered() const;
+    void write_records(const std::string& name, const pt::ptree& tree);
+    void write_record(const std::string& name, const pt::ptree& tree);
+    void write_compact(const pt::ptree& tree, bool root);
+
+    std::ostream& output_;
+    const encoding_engine engine_;
+    std::vector<level> levels_;
+    bool finished_;
+
+    // The record being collected, and the path to its open container.
+    pt::ptree record_;
+    std::vector<pt::ptree*> record_path_;
+    size_t record_depth_;
+
+    table_writer table_;
+};
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#include <bitcoin/explorer/impl/prop_writer.ipp>
+
+#endif
@@ -0,0 +1,152 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_TABLE_WRITER_HPP
+#define BX_TABLE_WRITER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/property_tree/ptree.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * The fixed columns of a known row type, by dot separated path, such as
+ * "received.hash" for a transfer. Empty if the row type is not known.
+ * @param[in]  type  The row type (property tree element name).
+ * @return           The columns of the row type.
+ */
+BCX_API const std::vector<std::string>& table_columns(const std::string& type);
+
+/**
+ * The row types of the table that begins with a row of the given type, such
+ * as a transaction with its inputs and outputs. Empty if the type is always
+ * alone in its table.
+ * @param[in]  type  The row type (property tree element name).
+ * @return           The row types of the table.
+ */
+BCX_API const std::vector<std::string>& table_types(const std::string& type);
+
+/**
+ * Writer for delimited (csv or tsv) rows. Each row is formatted into a
+ * reusable line buffer and written as a single line. The output is a single
+ * table, with a header line of the column names before the first row. The
+ * type of the first row determines the table. A table of several row types
+ * has a leading type column and the union of their columns, and each row
+ * fills its own. A row of a type outside of the table is not written. Hashes
+ * are written in base16 and numbers as decimal integers, with an empty cell
+ * for a missing value.
+ */
+class BCX_API table_writer
+{
+public:
+
+    /**
+     * Construct a table writer.
+     * @param[in]  output  The output stream to write to.
+     * @param[in]  engine  The table format, csv or tsv.
+     */
+    table_writer(std::ostream& output, encoding_engine engine);
+
+    /**
+     * Start a row of the given type, with the fixed columns of the type.
+     * The cells that follow are those of the type, in column order.
+     * @param[in]  type  The row type.
+     */
+    void begin(const std::string& type);
+
+    /**
+     * Write a text cell.
+     * @param[in]  value  The text.
+     */
+    void cell(const std::string& value);
+
+    /**
+     * Write a numeric cell.
+     * @param[in]  value  The number.
+     */
+    void cell(uint64_t value);
+
+    /**
+     * Write a hash cell, in the display (reversed) byte order.
+     * @param[in]  value  The hash.
+     */
+    void cell(const hash_digest& value);
+
+    /**
+     * Write a base16 cell, in the byte order of the data.
+     * @param[in]  value  The data.
+     */
+    void cell_base16(data_slice value);
+
+    /**
+     * Write an empty cell, for a missing value.
+     */
+    void skip();
+
+    /**
+     * Finish the row and write its line.
+     */
+    void end();
+
+    /**
+     * Write a property tree element as a row, followed by the rows of any
+     * lists that it contains. A type without fixed columns uses the value
+     * paths of its first row as its columns.
+     * @param[in]  type  The row type (property tree element name).
+     * @param[in]  row   The property tree element.
+     */
+    void write(const std::string& type, const pt::ptree& row);
+
+private:
+    bool start(const std::string& type, const pt::ptree* row);
+    void separate();
+    void escape(const char* begin, const char* end);
+
+    std::ostream& output_;
+    const char separator_;
+    std::string line_;
+    std::string* cell_text_;
+    bool first_;
+
+    // The table, set by its first row.
+    bool started_;
+    std::vector<std::string> types_;
+    std::vector<std::string> columns_;
+
+    // The row in progress, and for a table of several types the position
+    // of each cell of the row's own columns in the table's columns.
+    bool skipped_;
+    std::vector<size_t> positions_;
+    std::vector<std::string> cells_;
+    size_t cell_;
+};
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
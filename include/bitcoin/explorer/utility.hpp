@@ -65,6 +65,28 @@ struct BCX_API connection_type
     primitives::cert_key key;
 };
 
+/**
+ * Hash function for unordered containers keyed by a bitcoin hash, such as a
+ * hash_digest or short_hash. The leading bytes of a bitcoin hash are
+ * uniformly distributed, so they are used as the hash value.
+ */
+template <size_t Size>
+struct digest_hasher
+{
+    size_t operator()(const byte_array<Size>& digest) const;
+};
+
+/**
+ * Hash function for unordered containers keyed by an output point, which
+ * combines the hash of the transaction with the index of the output. The
+ * low bits of the value do not depend on the platform, so it can also place
+ * the entries of a file.
+ */
+struct BCX_API point_hasher
+{
+    size_t operator()(const chain::output_point& point) const;
+};
+
 /**
  * Forward declaration to break header cycle.
  */
@@ -135,6 +157,35 @@ template <typename Value>
 void load_path(Value& parameter, const std::string& name,
     po::variables_map& variables, bool raw);
 
+/**
+ * Invoke a function on each index of a range. The range is partitioned into
+ * contiguous batches, one per thread, and the call returns once all batches
+ * are complete. The function must be safe to call concurrently.
+ * @param      <Function>  The type of the function to invoke.
+ * @param[in]  count       The number of elements in the range.
+ * @param[in]  function    The function to invoke with each element index.
+ * @param[in]  threads     The number of threads, zero for hardware threads.
+ */
+template <typename Function>
+void parallel_for(size_t count, Function function, size_t threads=0);
+
+/**
+ * Write a line of text for each index of a range, in index order. The range
+ * is evaluated across threads in blocks, which bounds the text held for
+ * output. The function must be safe to call concurrently.
+ * @param      <Function>  The type of the function, which is called with an
+ *                         index and a string to populate and returns false
+ *                         if the index has no text.
+ * @param[in]  output      The stream to write to.
+ * @param[in]  count       The number of elements in the range.
+ * @param[in]  function    The function to invoke with each element index.
+ * @param[in]  block       The number of elements evaluated together.
+ * @return                 The index that has no text, otherwise count.
+ */
+template <typename Function>
+size_t parallel_write(std::ostream& output, size_t count, Function function,
+    size_t block=4096);
+
 /**
  * Conveniently convert an instance of the specified type to string.
  * @param      <Value>   The type to serialize.
@@ -168,6 +219,20 @@ template <typename Instance>
 void write_file(std::ostream& output, const std::string& path,
     const Instance& instance, bool terminate=true);
 
+/**
+ * Confirm that a stealth row of the server pays to the stealth address of
+ * the keys, as stealth-shared, stealth-public and ec-to-address, so that a
+ * row is a match if the hash of (SPEND_PUBKEY + sha256(SCAN_SECRET *
+ * EPHEM_PUBKEY) * G) is the public key hash of the row. The ephemeral key
+ * may be without its sign byte, in which case it is even.
+ * @param[in]  row           The stealth row.
+ * @param[in]  scan_secret   The scan secret of the stealth address.
+ * @param[in]  spend_pubkey  The spend public key of the stealth address.
+ * @return                   True if the row pays to the stealth address.
+ */
+BCX_API bool confirm_stealth(const client::stealth_row& row,
+    const ec_secret& scan_secret, const ec_compressed& spend_pubkey);
+
 /**
  * Get the connection settings for the configured network.
  * @param    cmd  The command.
@@ -218,6 +283,14 @@ BCX_API boost::posix_time::ptime now();
  */
 BCX_API void random_fill(data_chunk& chunk);
 
+/**
+ * Read an unsigned little-endian integer, as stored in an index file.
+ * @param[in]  data  The bytes of the integer.
+ * @param[in]  size  The number of bytes, at most eight.
+ * @return           The integer.
+ */
+BCX_API uint64_t read_little(const uint8_t* data, size_t size);
+
 /**
  * Get a message from the specified input stream.
  * @param[in]  stream The input stream to read.
@@ -270,6 +343,15 @@ BCX_API bool unwrap(wrapped_data& data, data_slice wrapped);
  */
 BCX_API data_chunk wrap(const wrapped_data& data);
 
+/**
+ * Write an unsigned little-endian integer, as stored in an index file.
+ * @param[out] data   The buffer to write to.
+ * @param[in]  value  The integer.
+ * @param[in]  size   The number of bytes, at most eight.
+ * @return            The position in the buffer after the integer.
+ */
+BCX_API uint8_t* write_little(uint8_t* data, uint64_t value, size_t size);
+
 /**
  * Serialize a property tree using a specified encoding.
  * @param[out] output  The output stream to write to.
@@ -0,0 +1,177 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_UTXO_SET_HPP
+#define BX_UTXO_SET_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <boost/filesystem.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/block_file.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/mapped_file.hpp>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * An unspent output of a snapshot. The script is reduced to the hash of its
+ * payment address, if it has one.
+ */
+struct BCX_API utxo_entry
+{
+    chain::output_point point;
+    uint64_t value;
+    uint32_t height;
+    bool addressed;
+    short_hash address;
+};
+
+/**
+ * A snapshot of the unspent outputs of a block chain at a height, for
+ * answering balance queries without a server. The file holds a header, an
+ * open addressing table of the outputs keyed by outpoint, an open addressing
+ * table of the addresses, and the positions of the outputs of each address.
+ * A query is a few probes of the mapped file.
+ */
+class BCX_API utxo_set
+{
+public:
+
+    /**
+     * Map a snapshot file. Check valid() for success.
+     * @param[in]  path  The path of the snapshot file.
+     */
+    utxo_set(const boost::filesystem::path& path);
+
+    /**
+     * Determine whether the file was mapped and is a snapshot.
+     * @return  True if the snapshot is valid.
+     */
+    bool valid() const;
+
+    /**
+     * The number of blocks of the snapshot, which is the height of the next
+     * block.
+     * @return  The number of blocks.
+     */
+    size_t blocks() const;
+
+    /**
+     * The number of unspent outputs.
+     * @return  The number of outputs.
+     */
+    size_t size() const;
+
+    /**
+     * Find an unspent output.
+     * @param[out] out    The unspent output.
+     * @param[in]  point  The outpoint.
+     * @return            True if the output is unspent at the snapshot.
+     */
+    bool find(utxo_entry& out, const chain::output_point& point) const;
+
+    /**
+     * The unspent outputs of an address. Addresses are matched by hash, so
+     * the version of the address is not considered.
+     * @param[in]  address  The address hash.
+     * @return              The unspent outputs, in outpoint table order.
+     */
+    std::vector<utxo_entry> unspent(const short_hash& address) const;
+
+private:
+    const uint8_t* outputs_begin() const;
+    const uint8_t* addresses_begin() const;
+    const uint8_t* positions_begin() const;
+
+    mapped_file file_;
+    bool valid_;
+    size_t blocks_;
+    size_t outputs_;
+    size_t output_capacity_;
+    size_t address_capacity_;
+    size_t positions_;
+};
+
+/**
+ * Builds a snapshot by replaying the blocks of block files into an in
+ * memory open addressing table of the unspent outputs.
+ */
+class BCX_API utxo_set_writer
+{
+public:
+
+    /**
+     * Construct an empty snapshot.
+     * @param[in]  path  The path of the snapshot file.
+     */
+    utxo_set_writer(const boost::filesystem::path& path);
+
+    /**
+     * The number of replayed blocks.
+     * @return  The number of blocks.
+     */
+    size_t blocks() const;
+
+    /**
+     * The number of unspent outputs.
+     * @return  The number of outputs.
+     */
+    size_t size() const;
+
+    /**
+     * Replay the blocks of a chain that follow the replayed blocks.
+     * @param[in]  files    The content of the block files.
+     * @param[in]  records  The block records of the files.
+     * @param[in]  chain    The chain of the records, see block_chain.
+     * @param[in]  blocks   The number of blocks of the chain to replay.
+     * @return              False if a block is not valid.
+     */
+    bool add(const std::vector<data_slice>& files,
+        const std::vector<block_record>& records,
+        const std::vector<size_t>& chain, size_t blocks);
+
+    /**
+     * Write the snapshot to a temporary file and then replace the snapshot
+     * file.
+     * @return  False if the snapshot could not be written.
+     */
+    bool write() const;
+
+private:
+    size_t find(const chain::output_point& point) const;
+    void insert(const utxo_entry& entry);
+    void erase(const chain::output_point& point);
+    void grow();
+
+    const boost::filesystem::path path_;
+    size_t blocks_;
+    size_t size_;
+    std::vector<uint8_t> used_;
+    std::vector<utxo_entry> slots_;
+};
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,115 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_VANITY_SEARCH_HPP
+#define BX_VANITY_SEARCH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * The set of payment address hashes whose addresses begin with a Base58
+ * prefix. A hash outside of the precomputed ranges cannot match, so only
+ * the hashes within a range are encoded to compare the prefix, since the
+ * checksum that follows the hash may still change a digit of the prefix.
+ */
+class BCX_API vanity_prefix
+{
+public:
+
+    /**
+     * An inclusive range of hashes, in big endian order.
+     */
+    typedef std::pair<short_hash, short_hash> range;
+
+    /**
+     * Construct a prefix.
+     * @param[in]  prefix   The Base58 address prefix.
+     * @param[in]  version  The payment address version.
+     */
+    vanity_prefix(const std::string& prefix, uint8_t version);
+
+    /**
+     * The hash ranges in ascending order, empty if the prefix is not
+     * Base58 or if no address of the version begins with it.
+     */
+    const std::vector<range>& ranges() const;
+
+    /**
+     * The expected number of keys to search for a match, zero if there is
+     * no match.
+     */
+    double difficulty() const;
+
+    /**
+     * Determine whether the address of a hash begins with the prefix.
+     * @param[in]  hash  The payment address hash.
+     * @return           True if the address begins with the prefix.
+     */
+    bool matches(const short_hash& hash) const;
+
+private:
+    std::string prefix_;
+    uint8_t version_;
+    std::vector<range> ranges_;
+    double difficulty_;
+};
+
+/**
+ * The handler of the progress of a search, called with the number of keys
+ * searched by all threads.
+ */
+typedef std::function<void(uint64_t)> vanity_progress_handler;
+
+/**
+ * Search for a private key whose payment address begins with a prefix.
+ * Each thread starts from a key derived from the seed and its thread index
+ * and walks consecutive keys by adding the generator to the public key,
+ * converting each batch of points to affine with a single inversion. The
+ * secret is only used to derive the start point and the result, with
+ * libbitcoin, so the variable time point arithmetic sees public values.
+ * @param[out] out       The private key of the first match.
+ * @param[out] keys      The number of keys searched.
+ * @param[in]  prefix    The prefix to match.
+ * @param[in]  seed      The entropy from which each thread starts.
+ * @param[in]  threads   The number of threads, or zero for one per core.
+ * @param[in]  limit     The number of keys after which to stop, or zero.
+ * @param[in]  progress  The handler called by the first thread after each
+ *                       of its batches, which must not block the search.
+ * @return               True if a key is found.
+ */
+BCX_API bool vanity_search(ec_secret& out, uint64_t& keys,
+    const vanity_prefix& prefix, const data_chunk& seed, size_t threads=0,
+    uint64_t limit=0, vanity_progress_handler progress=nullptr);
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
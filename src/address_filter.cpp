@@ -0,0 +1,99 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/address_filter.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+
+// The bloom filter is kept at no less than this many bits per hash, which
+// with two probes yields a false positive rate of about one percent.
+static const size_t bits_per_hash = 16;
+static const size_t minimum_bits = 1024;
+
+// The probes are taken from bytes of the hash that are not used to place it
+// in the set, since each byte of the hash is uniformly distributed.
+static void probes(const short_hash& hash, uint32_t& first, uint32_t& second)
+{
+    std::memcpy(&first, hash.data() + 8, sizeof(first));
+    std::memcpy(&second, hash.data() + 12, sizeof(second));
+}
+
+address_filter::address_filter()
+  : mask_(minimum_bits - 1), bits_(minimum_bits / 64, 0)
+{
+}
+
+void address_filter::insert(const short_hash& hash)
+{
+    if (!hashes_.insert(hash).second)
+        return;
+
+    // The filter is rebuilt at twice the size when it becomes too full.
+    if (hashes_.size() * bits_per_hash > bits_.size() * 64)
+    {
+        bits_.assign(bits_.size() * 2, 0);
+        mask_ = bits_.size() * 64 - 1;
+        for (const auto& existing: hashes_)
+            set_bits(existing);
+
+        return;
+    }
+
+    set_bits(hash);
+}
+
+bool address_filter::contains(const short_hash& hash) const
+{
+    return test_bits(hash) && hashes_.find(hash) != hashes_.end();
+}
+
+size_t address_filter::size() const
+{
+    return hashes_.size();
+}
+
+void address_filter::set_bits(const short_hash& hash)
+{
+    uint32_t first, second;
+    probes(hash, first, second);
+    const size_t bit1 = first & mask_;
+    const size_t bit2 = second & mask_;
+    bits_[bit1 / 64] |= uint64_t(1) << (bit1 % 64);
+    bits_[bit2 / 64] |= uint64_t(1) << (bit2 % 64);
+}
+
+bool address_filter::test_bits(const short_hash& hash) const
+{
+    uint32_t first, second;
+    probes(hash, first, second);
+    const size_t bit1 = first & mask_;
+    const size_t bit2 = second & mask_;
+    return ((bits_[bit1 / 64] >> (bit1 % 64)) & 1) != 0 &&
+        ((bits_[bit2 / 64] >> (bit2 % 64)) & 1) != 0;
+}
+
+} // namespace explorer
+} // namespace libbitcoin
@@ -0,0 +1,766 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/address_index.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <queue>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/client.hpp>
+#include <bitcoin/explorer/block_file.hpp>
+#include <bitcoin/explorer/block_parser.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/hash_stream.hpp>
+#include <bitcoin/explorer/mapped_file.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+using namespace bc::client;
+using namespace bc::wallet;
+using namespace boost::filesystem;
+
+namespace libbitcoin {
+namespace explorer {
+
+// The file is a header, the runs and a trailer, all little-endian:
+// header:  magic[4] version[4] blocks[8] runs[8]
+// run:     output[outputs] spend[spends]
+// output:  address[20] output.hash[32] output.index[4] output_height[4]
+//          value[8]
+// spend:   point.hash[32] point.index[4] spend.hash[32] spend.index[4]
+//          spend_height[4]
+// trailer: hash[32][blocks] outputs[8][runs] spends[8][runs]
+static const uint32_t index_magic = 0x69617862;
+static const uint32_t index_version = 2;
+static const size_t header_size = 24;
+static const size_t output_size = 68;
+static const size_t spend_size = 76;
+static const size_t point_size = hash_size + 4;
+static const size_t run_size = 16;
+
+// The number of rows written to the file at a time.
+static const size_t write_rows = 4096;
+
+template <size_t Size>
+static uint8_t* write_array(uint8_t* data, const byte_array<Size>& value)
+{
+    return std::copy(value.begin(), value.end(), data);
+}
+
+template <size_t Size>
+static const uint8_t* read_array(const uint8_t* data, byte_array<Size>& value)
+{
+    std::copy(data, data + Size, value.begin());
+    return data + Size;
+}
+
+static history_row read_output(const uint8_t* data)
+{
+    history_row row;
+    data = read_array(data + short_hash_size, row.output.hash);
+    row.output.index = static_cast<uint32_t>(read_little(data, 4));
+    row.output_height = static_cast<uint32_t>(read_little(data + 4, 4));
+    row.value = read_little(data + 8, 8);
+    row.spend.hash = null_hash;
+    row.spend.index = max_uint32;
+    row.spend_height = 0;
+    return row;
+}
+
+static void write_output(uint8_t* data, const address_row& row)
+{
+    const auto& transfer = row.transfer;
+    data = write_array(data, row.address);
+    data = write_array(data, transfer.output.hash);
+    data = write_little(data, transfer.output.index, 4);
+    data = write_little(data, transfer.output_height, 4);
+    write_little(data, transfer.value, 8);
+}
+
+static void read_spend(const uint8_t* data, history_row& row)
+{
+    data = read_array(data + point_size, row.spend.hash);
+    row.spend.index = static_cast<uint32_t>(read_little(data, 4));
+    row.spend_height = static_cast<uint32_t>(read_little(data + 4, 4));
+}
+
+static uint8_t* write_point(uint8_t* data, const chain::output_point& point)
+{
+    data = write_array(data, point.hash);
+    return write_little(data, point.index, 4);
+}
+
+// Outputs are ordered by address, and spends by the hash and then the index
+// of the point spent.
+static int address_compare(const uint8_t* left, const uint8_t* right)
+{
+    return std::memcmp(left, right, short_hash_size);
+}
+
+static int point_compare(const uint8_t* left, const uint8_t* right)
+{
+    const auto hash = std::memcmp(left, right, hash_size);
+    if (hash != 0)
+        return hash;
+
+    const auto first = read_little(left + hash_size, 4);
+    const auto second = read_little(right + hash_size, 4);
+    return first < second ? -1 : (first > second ? 1 : 0);
+}
+
+// The position of the first of a set of sorted rows that is not less than
+// a key, where compare is the order of a row relative to the key.
+template <typename Compare>
+static size_t lower_bound(const uint8_t* rows, size_t count, size_t size,
+    Compare compare)
+{
+    size_t first = 0;
+    size_t last = count;
+    while (first < last)
+    {
+        const auto middle = first + (last - first) / 2;
+        if (compare(rows + middle * size) < 0)
+            first = middle + 1;
+        else
+            last = middle;
+    }
+
+    return first;
+}
+
+// address_index
+// ----------------------------------------------------------------------------
+
+address_index::address_index(const path& path)
+  : file_(path), valid_(false), blocks_(0), rows_(0)
+{
+    const auto data = file_.data();
+    if (!file_.valid() || data.size() < header_size)
+        return;
+
+    const auto begin = data.data();
+    if (read_little(begin, 4) != index_magic ||
+        read_little(begin + 4, 4) != index_version)
+        return;
+
+    // The counts are bounded before the sizes are multiplied.
+    const auto blocks = read_little(begin + 8, 8);
+    const auto runs = read_little(begin + 16, 8);
+    auto available = data.size() - header_size;
+    if (blocks > available / hash_size)
+        return;
+
+    available -= blocks * hash_size;
+    if (runs > available / run_size)
+        return;
+
+    available -= runs * run_size;
+    const auto table = begin + header_size + available + blocks * hash_size;
+
+    size_t rows = 0;
+    size_t offset = header_size;
+    std::vector<address_run> sizes;
+    std::vector<size_t> offsets;
+    for (size_t run = 0; run < runs; ++run)
+    {
+        const auto outputs = read_little(table + run * 8, 8);
+        const auto spends = read_little(table + (runs + run) * 8, 8);
+        if (outputs > available / output_size)
+            return;
+
+        available -= outputs * output_size;
+        if (spends > available / spend_size)
+            return;
+
+        available -= spends * spend_size;
+        sizes.push_back({ static_cast<size_t>(outputs),
+            static_cast<size_t>(spends) });
+        offsets.push_back(offset);
+        offset += outputs * output_size + spends * spend_size;
+        rows += outputs;
+    }
+
+    if (available != 0)
+        return;
+
+    blocks_ = static_cast<size_t>(blocks);
+    rows_ = rows;
+    runs_.swap(sizes);
+    offsets_.swap(offsets);
+    valid_ = true;
+}
+
+bool address_index::valid() const
+{
+    return valid_;
+}
+
+size_t address_index::blocks() const
+{
+    return blocks_;
+}
+
+size_t address_index::rows() const
+{
+    return rows_;
+}
+
+const std::vector<address_run>& address_index::runs() const
+{
+    return runs_;
+}
+
+hash_digest address_index::block_hash(size_t height) const
+{
+    const auto data = file_.data();
+    const auto hashes = data.data() + data.size() - runs_.size() * run_size -
+        blocks_ * hash_size;
+
+    hash_digest hash;
+    read_array(hashes + height * hash_size, hash);
+    return hash;
+}
+
+history_list address_index::history(const short_hash& address) const
+{
+    // Runs are in chain order, so the rows of an address are in order of
+    // height once the runs are concatenated.
+    history_list history;
+    std::vector<size_t> row_runs;
+    for (size_t run = 0; run < runs_.size(); ++run)
+    {
+        const auto rows = file_.data().data() + offsets_[run];
+        const auto count = runs_[run].outputs;
+        const auto compare = [&address](const uint8_t* row)
+        {
+            return address_compare(row, address.data());
+        };
+
+        auto position = lower_bound(rows, count, output_size, compare);
+        for (; position < count && compare(rows + position * output_size) == 0;
+            ++position)
+        {
+            history.push_back(read_output(rows + position * output_size));
+            row_runs.push_back(run);
+        }
+    }
+
+    for (size_t index = 0; index < history.size(); ++index)
+        find_spend(history[index], row_runs[index]);
+
+    return history;
+}
+
+// The spend of an output follows it in the chain, so it is in the run of
+// the output or in a later run.
+bool address_index::find_spend(history_row& row, size_t run) const
+{
+    uint8_t key[point_size];
+    write_point(key, row.output);
+    const auto compare = [&key](const uint8_t* spend)
+    {
+        return point_compare(spend, key);
+    };
+
+    for (; run < runs_.size(); ++run)
+    {
+        const auto spends = file_.data().data() + offsets_[run] +
+            runs_[run].outputs * output_size;
+
+        const auto count = runs_[run].spends;
+        const auto position = lower_bound(spends, count, spend_size, compare);
+        if (position < count && compare(spends + position * spend_size) == 0)
+        {
+            read_spend(spends + position * spend_size, row);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// address_index_writer
+// ----------------------------------------------------------------------------
+
+// A spend of an output, which is indexed whether or not the output has an
+// address, since the output may be in an earlier run.
+struct indexed_spend
+{
+    chain::output_point point;
+    hash_digest hash;
+    uint32_t index;
+    uint32_t height;
+};
+
+struct indexed_block
+{
+    bool valid;
+    chain::block block;
+    std::vector<data_slice> transactions;
+    std::vector<address_row> rows;
+    std::vector<indexed_spend> spends;
+};
+
+// Rows are ordered by address and then by the position of the output in the
+// chain, which is the order of the history of an address.
+static bool row_less(const address_row& left, const address_row& right)
+{
+    const auto& first = left.transfer;
+    const auto& second = right.transfer;
+    return std::tie(left.address, first.output_height, first.output.hash,
+        first.output.index) < std::tie(right.address, second.output_height,
+        second.output.hash, second.output.index);
+}
+
+static bool spend_less(const indexed_spend& left, const indexed_spend& right)
+{
+    return std::tie(left.point.hash, left.point.index) <
+        std::tie(right.point.hash, right.point.index);
+}
+
+static void find_rows(indexed_block& indexed,
+    const std::vector<hash_digest>& hashes, size_t height)
+{
+    const auto& transactions = indexed.block.transactions;
+    for (size_t index = 0; index < transactions.size(); ++index)
+    {
+        const auto& outputs = transactions[index].outputs;
+        for (uint32_t output = 0; output < outputs.size(); ++output)
+        {
+            const auto address = payment_address::extract(
+                outputs[output].script);
+
+            if (!address)
+                continue;
+
+            address_row row;
+            auto& transfer = row.transfer;
+            row.address = address.hash();
+            transfer.output.hash = hashes[index];
+            transfer.output.index = output;
+            transfer.output_height = height;
+            transfer.value = outputs[output].value;
+            indexed.rows.push_back(row);
+        }
+    }
+}
+
+// The input of a coinbase transaction spends the null point, which is not
+// an output.
+static void find_spends(indexed_block& indexed,
+    const std::vector<hash_digest>& hashes, size_t height)
+{
+    const auto& transactions = indexed.block.transactions;
+    for (size_t index = 0; index < transactions.size(); ++index)
+    {
+        const auto& inputs = transactions[index].inputs;
+        for (uint32_t input = 0; input < inputs.size(); ++input)
+        {
+            const auto& point = inputs[input].previous_output;
+            if (point.hash != null_hash)
+                indexed.spends.push_back({ point, hashes[index], input,
+                    static_cast<uint32_t>(height) });
+        }
+    }
+}
+
+static void write_outputs(std::ostream& file,
+    const std::vector<address_row>& rows)
+{
+    data_chunk buffer(rows.size() * output_size);
+    for (size_t index = 0; index < rows.size(); ++index)
+        write_output(buffer.data() + index * output_size, rows[index]);
+
+    file.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+}
+
+static void write_spends(std::ostream& file,
+    const std::vector<indexed_spend>& spends)
+{
+    data_chunk buffer(spends.size() * spend_size);
+    for (size_t index = 0; index < spends.size(); ++index)
+    {
+        const auto& spend = spends[index];
+        auto data = buffer.data() + index * spend_size;
+        data = write_point(data, spend.point);
+        data = write_array(data, spend.hash);
+        data = write_little(data, spend.index, 4);
+        write_little(data, spend.height, 4);
+    }
+
+    file.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+}
+
+// A sorted range of the rows of a mapped file.
+typedef std::pair<const uint8_t*, const uint8_t*> row_range;
+
+// Merge sorted ranges of rows into a single sorted run. Of equal rows the
+// row of the earlier range is written first, so that rows stay in chain
+// order.
+template <typename Compare>
+static bool merge_ranges(std::ostream& file, std::vector<row_range> ranges,
+    size_t size, Compare compare)
+{
+    const auto later = [&ranges, &compare](size_t left, size_t right)
+    {
+        const auto order = compare(ranges[left].first, ranges[right].first);
+        return order > 0 || (order == 0 && left > right);
+    };
+
+    std::priority_queue<size_t, std::vector<size_t>, decltype(later)>
+        queue(later);
+
+    for (size_t range = 0; range < ranges.size(); ++range)
+        if (ranges[range].first != ranges[range].second)
+            queue.push(range);
+
+    data_chunk buffer;
+    const auto buffer_size = write_rows * size;
+    buffer.reserve(buffer_size);
+    while (!queue.empty())
+    {
+        const auto range = queue.top();
+        queue.pop();
+        auto& next = ranges[range].first;
+        buffer.insert(buffer.end(), next, next + size);
+        next += size;
+        if (next != ranges[range].second)
+            queue.push(range);
+
+        if (buffer.size() == buffer_size || queue.empty())
+        {
+            file.write(reinterpret_cast<const char*>(buffer.data()),
+                buffer.size());
+            buffer.clear();
+        }
+    }
+
+    return file.good();
+}
+
+// The ranges of the windows of a temporary file, which holds the windows in
+// order.
+static bool window_ranges(std::vector<row_range>& out,
+    const mapped_file& windows, const std::vector<size_t>& counts,
+    size_t size)
+{
+    size_t total = 0;
+    for (const auto count: counts)
+        total += count;
+
+    if (total == 0)
+        return true;
+
+    if (!windows.valid() || windows.data().size() != total * size)
+        return false;
+
+    auto position = windows.data().data();
+    for (const auto count: counts)
+    {
+        out.push_back({ position, position + count * size });
+        position += count * size;
+    }
+
+    return true;
+}
+
+static path temporary_path(const path& index, const std::string& extension)
+{
+    auto temporary = index;
+    temporary += extension;
+    return temporary;
+}
+
+static data_chunk index_header(size_t blocks, size_t runs)
+{
+    data_chunk header(header_size);
+    auto data = header.data();
+    data = write_little(data, index_magic, 4);
+    data = write_little(data, index_version, 4);
+    data = write_little(data, blocks, 8);
+    write_little(data, runs, 8);
+    return header;
+}
+
+address_index_writer::address_index_writer(const path& path)
+  : path_(path), outputs_path_(temporary_path(path, ".outputs.tmp")),
+    spends_path_(temporary_path(path, ".spends.tmp")), exists_(false),
+    valid_(true), failed_(false), rows_(0), added_(0)
+{
+    boost::system::error_code ec;
+    remove(outputs_path_, ec);
+    remove(spends_path_, ec);
+
+    exists_ = exists(path_, ec);
+    if (!exists_)
+        return;
+
+    const address_index index(path_);
+    valid_ = index.valid();
+    if (!valid_)
+        return;
+
+    blocks_.reserve(index.blocks());
+    for (size_t height = 0; height < index.blocks(); ++height)
+        blocks_.push_back(index.block_hash(height));
+
+    rows_ = index.rows();
+    runs_ = index.runs();
+}
+
+address_index_writer::~address_index_writer()
+{
+    boost::system::error_code ec;
+    remove(outputs_path_, ec);
+    remove(spends_path_, ec);
+}
+
+bool address_index_writer::valid() const
+{
+    return valid_;
+}
+
+size_t address_index_writer::blocks() const
+{
+    return blocks_.size();
+}
+
+size_t address_index_writer::rows() const
+{
+    return rows_;
+}
+
+size_t address_index_writer::added() const
+{
+    return added_;
+}
+
+bool address_index_writer::extends(const std::vector<block_record>& records,
+    const std::vector<size_t>& chain) const
+{
+    if (!valid_ || blocks_.size() > chain.size())
+        return false;
+
+    for (size_t height = 0; height < blocks_.size(); ++height)
+        if (records[chain[height]].hash != blocks_[height])
+            return false;
+
+    return true;
+}
+
+bool address_index_writer::add(const std::vector<data_slice>& files,
+    const std::vector<block_record>& records,
+    const std::vector<size_t>& chain)
+{
+    if (!extends(records, chain))
+        return false;
+
+    // The sorted rows of each window are appended to the temporary files.
+    const auto mode = std::ios::binary | std::ios::app;
+    bc::ofstream outputs(outputs_path_.string(), mode);
+    bc::ofstream spends(spends_path_.string(), mode);
+
+    const auto parse = [](indexed_block& indexed, size_t height,
+        data_slice block)
+    {
+        indexed.valid = parse_block(indexed.block, indexed.transactions,
+            block) == block.size();
+
+        if (indexed.valid)
+        {
+            const auto hashes = bitcoin256_batch(indexed.transactions);
+            find_rows(indexed, hashes, height);
+            find_spends(indexed, hashes, height);
+        }
+    };
+
+    const auto apply = [&](std::vector<indexed_block>& window, size_t first)
+    {
+        std::vector<address_row> rows;
+        std::vector<indexed_spend> spent;
+        for (size_t position = 0; position < window.size(); ++position)
+        {
+            const auto& indexed = window[position];
+            if (!indexed.valid)
+                return false;
+
+            rows.insert(rows.end(), indexed.rows.begin(), indexed.rows.end());
+            spent.insert(spent.end(), indexed.spends.begin(),
+                indexed.spends.end());
+            blocks_.push_back(records[chain[first + position]].hash);
+            ++added_;
+        }
+
+        std::sort(rows.begin(), rows.end(), row_less);
+        std::sort(spent.begin(), spent.end(), spend_less);
+        write_outputs(outputs, rows);
+        write_spends(spends, spent);
+        windows_.push_back({ rows.size(), spent.size() });
+        rows_ += rows.size();
+        return true;
+    };
+
+    const auto replayed = replay_blocks<indexed_block>(files, records, chain,
+        blocks_.size(), chain.size(), parse, apply);
+
+    failed_ = failed_ || !outputs.good() || !spends.good();
+    return replayed;
+}
+
+bool address_index_writer::write()
+{
+    if (!valid_ || failed_)
+        return false;
+
+    // The index is current.
+    if (exists_ && windows_.empty())
+        return true;
+
+    // The new run absorbs the last runs that are not larger than it, so that
+    // run sizes fall geometrically and the number of runs grows with the
+    // logarithm of the number of updates.
+    address_run run{ 0, 0 };
+    for (const auto& window: windows_)
+    {
+        run.outputs += window.outputs;
+        run.spends += window.spends;
+    }
+
+    auto kept = runs_.size();
+    for (; kept > 0; --kept)
+    {
+        const auto& last = runs_[kept - 1];
+        if (last.outputs + last.spends > run.outputs + run.spends &&
+            kept < maximum_index_runs)
+            break;
+
+        run.outputs += last.outputs;
+        run.spends += last.spends;
+    }
+
+    // The index is replaced only once it is written, so that a failed write
+    // leaves the index unchanged.
+    const auto temporary = temporary_path(path_, ".tmp");
+    boost::system::error_code ec;
+
+    {
+        bc::ofstream file(temporary.string(), std::ios::binary);
+        if (!write_index(file, kept, run))
+        {
+            file.close();
+            remove(temporary, ec);
+            return false;
+        }
+    }
+
+    rename(temporary, path_, ec);
+    if (ec)
+    {
+        remove(temporary, ec);
+        return false;
+    }
+
+    runs_.resize(kept);
+    runs_.push_back(run);
+    windows_.clear();
+    exists_ = true;
+    return true;
+}
+
+bool address_index_writer::write_index(std::ostream& file, size_t kept,
+    const address_run& run) const
+{
+    const mapped_file index(path_);
+    const mapped_file outputs(outputs_path_);
+    const mapped_file spends(spends_path_);
+
+    // The kept runs are copied, and the later runs are merged with the
+    // windows.
+    auto end = header_size;
+    for (size_t copied = 0; copied < kept; ++copied)
+        end += runs_[copied].outputs * output_size +
+            runs_[copied].spends * spend_size;
+
+    auto position = end;
+    std::vector<row_range> output_ranges;
+    std::vector<row_range> spend_ranges;
+    const auto data = index.data().data();
+    for (auto merged = kept; merged < runs_.size(); ++merged)
+    {
+        const auto outputs_end = position +
+            runs_[merged].outputs * output_size;
+        const auto spends_end = outputs_end +
+            runs_[merged].spends * spend_size;
+
+        output_ranges.push_back({ data + position, data + outputs_end });
+        spend_ranges.push_back({ data + outputs_end, data + spends_end });
+        position = spends_end;
+    }
+
+    if (exists_ && (!index.valid() || index.data().size() < position))
+        return false;
+
+    std::vector<size_t> output_counts;
+    std::vector<size_t> spend_counts;
+    for (const auto& window: windows_)
+    {
+        output_counts.push_back(window.outputs);
+        spend_counts.push_back(window.spends);
+    }
+
+    if (!window_ranges(output_ranges, outputs, output_counts, output_size) ||
+        !window_ranges(spend_ranges, spends, spend_counts, spend_size))
+        return false;
+
+    const auto header = index_header(blocks_.size(), kept + 1);
+    file.write(reinterpret_cast<const char*>(header.data()), header.size());
+    if (end > header_size)
+        file.write(reinterpret_cast<const char*>(data + header_size),
+            end - header_size);
+
+    if (!merge_ranges(file, output_ranges, output_size, address_compare) ||
+        !merge_ranges(file, spend_ranges, spend_size, point_compare))
+        return false;
+
+    data_chunk trailer(blocks_.size() * hash_size + (kept + 1) * run_size);
+    auto out = trailer.data();
+    for (const auto& hash: blocks_)
+        out = write_array(out, hash);
+
+    for (size_t copied = 0; copied < kept; ++copied)
+        out = write_little(out, runs_[copied].outputs, 8);
+
+    out = write_little(out, run.outputs, 8);
+    for (size_t copied = 0; copied < kept; ++copied)
+        out = write_little(out, runs_[copied].spends, 8);
+
+    write_little(out, run.spends, 8);
+    file.write(reinterpret_cast<const char*>(trailer.data()), trailer.size());
+    return file.good();
+}
+
+} // namespace explorer
+} // namespace libbitcoin
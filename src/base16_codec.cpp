@@ -0,0 +1,332 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/base16_codec.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/impl/simd.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+
+static const auto base16_digits = "0123456789abcdef";
+
+// scalar
+
+static const std::array<int8_t, 256>& digit_values()
+{
+    static const auto values = []()
+    {
+        std::array<int8_t, 256> table;
+        table.fill(-1);
+        for (int8_t digit = 0; digit < 10; ++digit)
+            table['0' + digit] = digit;
+
+        for (int8_t digit = 0; digit < 6; ++digit)
+        {
+            table['a' + digit] = 10 + digit;
+            table['A' + digit] = 10 + digit;
+        }
+
+        return table;
+    }();
+
+    return values;
+}
+
+static void encode_scalar(char* out, const uint8_t* in, size_t size)
+{
+    for (size_t index = 0; index < size; ++index)
+    {
+        *out++ = base16_digits[in[index] >> 4];
+        *out++ = base16_digits[in[index] & 0x0f];
+    }
+}
+
+// The size is that of the decoded data.
+static bool decode_scalar(uint8_t* out, const char* in, size_t size)
+{
+    const auto& values = digit_values();
+    for (size_t index = 0; index < size; ++index)
+    {
+        const auto high = values[static_cast<uint8_t>(*in++)];
+        const auto low = values[static_cast<uint8_t>(*in++)];
+        if (high < 0 || low < 0)
+            return false;
+
+        out[index] = static_cast<uint8_t>((high << 4) | low);
+    }
+
+    return true;
+}
+
+#ifdef BX_X86
+
+// ssse3
+
+__attribute__((target("ssse3")))
+static void encode_ssse3(char* out, const uint8_t* in, size_t size)
+{
+    const auto digits = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(base16_digits));
+    const auto mask = _mm_set1_epi8(0x0f);
+
+    for (; size >= 16; size -= 16, in += 16, out += 32)
+    {
+        const auto bytes = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(in));
+        const auto high = _mm_shuffle_epi8(digits,
+            _mm_and_si128(_mm_srli_epi16(bytes, 4), mask));
+        const auto low = _mm_shuffle_epi8(digits, _mm_and_si128(bytes, mask));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out),
+            _mm_unpacklo_epi8(high, low));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 16),
+            _mm_unpackhi_epi8(high, low));
+    }
+
+    encode_scalar(out, in, size);
+}
+
+// Convert 16 characters to their digit values, or return false if any
+// character is not a base16 digit.
+__attribute__((target("ssse3")))
+static bool digits_ssse3(__m128i& value, __m128i text)
+{
+    const auto digit = _mm_sub_epi8(text, _mm_set1_epi8('0'));
+    const auto letter = _mm_sub_epi8(_mm_or_si128(text, _mm_set1_epi8(0x20)),
+        _mm_set1_epi8('a'));
+    const auto is_digit = _mm_cmpeq_epi8(
+        _mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+    const auto is_letter = _mm_cmpeq_epi8(
+        _mm_min_epu8(letter, _mm_set1_epi8(5)), letter);
+
+    if (_mm_movemask_epi8(_mm_or_si128(is_digit, is_letter)) != 0xffff)
+        return false;
+
+    value = _mm_or_si128(_mm_and_si128(is_digit, digit),
+        _mm_andnot_si128(is_digit, _mm_add_epi8(letter, _mm_set1_epi8(10))));
+    return true;
+}
+
+__attribute__((target("ssse3")))
+static bool decode_ssse3(uint8_t* out, const char* in, size_t size)
+{
+    // Each pair of digit values combines as (high * 16 + low).
+    const auto weights = _mm_set1_epi16(0x0110);
+
+    for (; size >= 16; size -= 16, in += 32, out += 16)
+    {
+        __m128i first, second;
+        if (!digits_ssse3(first, _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(in))) ||
+            !digits_ssse3(second, _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(in + 16))))
+            return false;
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_packus_epi16(
+            _mm_maddubs_epi16(first, weights),
+            _mm_maddubs_epi16(second, weights)));
+    }
+
+    return decode_scalar(out, in, size);
+}
+
+// avx2
+
+__attribute__((target("avx2")))
+static void encode_avx2(char* out, const uint8_t* in, size_t size)
+{
+    const auto digits = _mm256_broadcastsi128_si256(_mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(base16_digits)));
+    const auto mask = _mm256_set1_epi8(0x0f);
+
+    for (; size >= 32; size -= 32, in += 32, out += 64)
+    {
+        const auto bytes = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(in));
+        const auto high = _mm256_shuffle_epi8(digits,
+            _mm256_and_si256(_mm256_srli_epi16(bytes, 4), mask));
+        const auto low = _mm256_shuffle_epi8(digits,
+            _mm256_and_si256(bytes, mask));
+
+        // Interleaving is within 128 bit lanes, so the lanes are reordered.
+        const auto first = _mm256_unpacklo_epi8(high, low);
+        const auto second = _mm256_unpackhi_epi8(high, low);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out),
+            _mm256_permute2x128_si256(first, second, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 32),
+            _mm256_permute2x128_si256(first, second, 0x31));
+    }
+
+    encode_ssse3(out, in, size);
+}
+
+__attribute__((target("avx2")))
+static bool digits_avx2(__m256i& value, __m256i text)
+{
+    const auto digit = _mm256_sub_epi8(text, _mm256_set1_epi8('0'));
+    const auto letter = _mm256_sub_epi8(
+        _mm256_or_si256(text, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+    const auto is_digit = _mm256_cmpeq_epi8(
+        _mm256_min_epu8(digit, _mm256_set1_epi8(9)), digit);
+    const auto is_letter = _mm256_cmpeq_epi8(
+        _mm256_min_epu8(letter, _mm256_set1_epi8(5)), letter);
+
+    if (_mm256_movemask_epi8(_mm256_or_si256(is_digit, is_letter)) != -1)
+        return false;
+
+    value = _mm256_or_si256(_mm256_and_si256(is_digit, digit),
+        _mm256_andnot_si256(is_digit,
+            _mm256_add_epi8(letter, _mm256_set1_epi8(10))));
+    return true;
+}
+
+__attribute__((target("avx2")))
+static bool decode_avx2(uint8_t* out, const char* in, size_t size)
+{
+    const auto weights = _mm256_set1_epi16(0x0110);
+
+    for (; size >= 32; size -= 32, in += 64, out += 32)
+    {
+        __m256i first, second;
+        if (!digits_avx2(first, _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(in))) ||
+            !digits_avx2(second, _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(in + 32))))
+            return false;
+
+        // Packing is within 128 bit lanes, so the quarters are reordered.
+        const auto bytes = _mm256_packus_epi16(
+            _mm256_maddubs_epi16(first, weights),
+            _mm256_maddubs_epi16(second, weights));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out),
+            _mm256_permute4x64_epi64(bytes, 0xd8));
+    }
+
+    return decode_ssse3(out, in, size);
+}
+
+#endif
+
+base16_kernel base16_default_kernel()
+{
+    static const auto kernel = []()
+    {
+#ifdef BX_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2"))
+            return base16_kernel::avx2;
+
+        if (__builtin_cpu_supports("ssse3"))
+            return base16_kernel::ssse3;
+#endif
+        return base16_kernel::scalar;
+    }();
+
+    return kernel;
+}
+
+std::vector<base16_kernel> base16_kernels()
+{
+    std::vector<base16_kernel> kernels{ base16_kernel::scalar };
+    const auto best = base16_default_kernel();
+
+    if (best == base16_kernel::ssse3 || best == base16_kernel::avx2)
+        kernels.push_back(base16_kernel::ssse3);
+
+    if (best == base16_kernel::avx2)
+        kernels.push_back(base16_kernel::avx2);
+
+    return kernels;
+}
+
+std::string fast_encode_base16(data_slice data)
+{
+    return fast_encode_base16(data, base16_default_kernel());
+}
+
+std::string fast_encode_base16(data_slice data, base16_kernel kernel)
+{
+    std::string out(data.size() * 2, '\0');
+    const auto text = &out[0];
+
+    switch (kernel)
+    {
+#ifdef BX_X86
+        case base16_kernel::avx2:
+            encode_avx2(text, data.data(), data.size());
+            break;
+        case base16_kernel::ssse3:
+            encode_ssse3(text, data.data(), data.size());
+            break;
+#endif
+        default:
+            encode_scalar(text, data.data(), data.size());
+            break;
+    }
+
+    return out;
+}
+
+bool fast_decode_base16(data_chunk& out, const std::string& in)
+{
+    return fast_decode_base16(out, in, base16_default_kernel());
+}
+
+bool fast_decode_base16(data_chunk& out, const std::string& in,
+    base16_kernel kernel)
+{
+    if (in.size() % 2 != 0)
+        return false;
+
+    data_chunk result(in.size() / 2);
+    bool valid;
+
+    switch (kernel)
+    {
+#ifdef BX_X86
+        case base16_kernel::avx2:
+            valid = decode_avx2(result.data(), in.data(), result.size());
+            break;
+        case base16_kernel::ssse3:
+            valid = decode_ssse3(result.data(), in.data(), result.size());
+            break;
+#endif
+        default:
+            valid = decode_scalar(result.data(), in.data(), result.size());
+            break;
+    }
+
+    if (!valid)
+        return false;
+
+    out = std::move(result);
+    return true;
+}
+
+} // namespace explorer
+} // namespace libbitcoin
@@ -0,0 +1,304 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/base58_codec.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/hash_stream.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+
+static const auto base58_digits =
+    "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
+
+// The largest power of 58 that fits a 32 bit limb, and its digit count.
+static const uint64_t limb_power = 656356768;
+static const size_t limb_digits = 5;
+static const size_t limb_bytes = 4;
+
+static const std::array<int8_t, 256>& digit_values()
+{
+    static const auto values = []()
+    {
+        std::array<int8_t, 256> table;
+        table.fill(-1);
+        for (int8_t digit = 0; digit < 58; ++digit)
+            table[static_cast<uint8_t>(base58_digits[digit])] = digit;
+
+        return table;
+    }();
+
+    return values;
+}
+
+// Multiply the limbs (least significant first) of the given base by the
+// multiplier and add the carry, returning the carry out of the top limb.
+template <uint64_t Base>
+static uint64_t multiply_add(uint32_t* begin, uint32_t* end,
+    uint64_t multiplier, uint64_t carry)
+{
+    for (auto limb = begin; limb != end; ++limb)
+    {
+        const auto value = *limb * multiplier + carry;
+        *limb = static_cast<uint32_t>(value % Base);
+        carry = value / Base;
+    }
+
+    return carry;
+}
+
+// Accumulate up to five digits, returning false on an invalid character.
+static bool read_digits(uint32_t& chunk, uint64_t& multiplier,
+    std::string::const_iterator& it, std::string::const_iterator end)
+{
+    const auto& values = digit_values();
+    chunk = 0;
+    multiplier = 1;
+    for (size_t count = 0; count < limb_digits && it != end; ++count, ++it)
+    {
+        const auto digit = values[static_cast<uint8_t>(*it)];
+        if (digit < 0)
+            return false;
+
+        chunk = chunk * 58 + digit;
+        multiplier *= 58;
+    }
+
+    return true;
+}
+
+std::string fast_encode_base58(data_slice data)
+{
+    const auto begin = data.begin();
+    const auto end = data.end();
+    const auto first = std::find_if(begin, end, [](uint8_t byte)
+    {
+        return byte != 0;
+    });
+
+    // Limbs of base 58^5, least significant first.
+    std::vector<uint32_t> limbs;
+    limbs.reserve((end - first) * 138 / 100 / limb_digits + 1);
+
+    for (auto it = first; it != end;)
+    {
+        uint32_t chunk = 0;
+        uint64_t multiplier = 1;
+        for (size_t count = 0; count < limb_bytes && it != end; ++count, ++it)
+        {
+            chunk = (chunk << 8) | *it;
+            multiplier <<= 8;
+        }
+
+        auto carry = multiply_add<limb_power>(limbs.data(),
+            limbs.data() + limbs.size(), multiplier, chunk);
+
+        for (; carry != 0; carry /= limb_power)
+            limbs.push_back(static_cast<uint32_t>(carry % limb_power));
+    }
+
+    // Each zero byte is written as a leading zero digit.
+    std::string out(first - begin, base58_digits[0]);
+    out.reserve(out.size() + limbs.size() * limb_digits);
+
+    char digits[limb_digits];
+    for (auto limb = limbs.rbegin(); limb != limbs.rend(); ++limb)
+    {
+        auto value = *limb;
+        for (auto digit = digits + limb_digits; digit != digits; value /= 58)
+            *--digit = base58_digits[value % 58];
+
+        // The zero digits of the top limb are not significant.
+        auto start = digits;
+        if (limb == limbs.rbegin())
+            while (*start == base58_digits[0])
+                ++start;
+
+        out.append(start, digits + limb_digits);
+    }
+
+    return out;
+}
+
+bool fast_decode_base58(data_chunk& out, const std::string& in)
+{
+    const auto first = std::find_if(in.begin(), in.end(), [](char digit)
+    {
+        return digit != base58_digits[0];
+    });
+
+    // Limbs of base 2^32, least significant first.
+    std::vector<uint32_t> limbs;
+    limbs.reserve((in.end() - first) * 733 / 1000 / limb_bytes + 1);
+
+    for (auto it = first; it != in.end();)
+    {
+        uint32_t chunk;
+        uint64_t multiplier;
+        if (!read_digits(chunk, multiplier, it, in.end()))
+            return false;
+
+        auto carry = multiply_add<max_uint32 + uint64_t(1)>(limbs.data(),
+            limbs.data() + limbs.size(), multiplier, chunk);
+
+        for (; carry != 0; carry >>= 32)
+            limbs.push_back(static_cast<uint32_t>(carry));
+    }
+
+    // Each leading zero digit is decoded as a zero byte.
+    data_chunk result(first - in.begin(), 0x00);
+    result.reserve(result.size() + limbs.size() * limb_bytes);
+
+    for (auto limb = limbs.rbegin(); limb != limbs.rend(); ++limb)
+    {
+        // The zero bytes of the top limb are not significant.
+        auto shift = 8 * limb_bytes;
+        if (limb == limbs.rbegin())
+            while ((*limb >> (shift - 8)) == 0)
+                shift -= 8;
+
+        for (; shift != 0; shift -= 8)
+            result.push_back(static_cast<uint8_t>(*limb >> (shift - 8)));
+    }
+
+    out = std::move(result);
+    return true;
+}
+
+std::vector<bool> decode_base58_batch(data_chunk& out,
+    const std::vector<std::string>& in, size_t size, bool checked)
+{
+    static const uint64_t limb_base = max_uint32 + uint64_t(1);
+
+    // No text of a longer length can decode to a payload of the size.
+    const auto maximum_length = size * 138 / 100 + 1;
+    const auto count = (size + limb_bytes - 1) / limb_bytes;
+
+    std::vector<bool> valid(in.size(), false);
+    std::vector<uint32_t> limbs(count);
+    out.assign(in.size() * size, 0x00);
+
+    for (size_t index = 0; index < in.size(); ++index)
+    {
+        const auto& text = in[index];
+        if (text.size() > maximum_length)
+            continue;
+
+        const auto first = std::find_if(text.begin(), text.end(),
+            [](char digit)
+            {
+                return digit != base58_digits[0];
+            });
+
+        // Only the limbs in use are multiplied, and a carry out of the last
+        // limb overflows the payload.
+        std::fill(limbs.begin(), limbs.end(), 0);
+        size_t used = 0;
+        auto invalid = false;
+        for (auto it = first; it != text.end() && !invalid;)
+        {
+            uint32_t chunk;
+            uint64_t multiplier;
+            if (!read_digits(chunk, multiplier, it, text.end()))
+            {
+                invalid = true;
+                break;
+            }
+
+            auto carry = multiply_add<limb_base>(limbs.data(),
+                limbs.data() + used, multiplier, chunk);
+
+            for (; carry != 0 && !invalid; carry >>= 32)
+            {
+                invalid = (used == count);
+                if (!invalid)
+                    limbs[used++] = static_cast<uint32_t>(carry);
+            }
+        }
+
+        if (invalid)
+            continue;
+
+        // The payload is the value in size bytes (big endian), which must
+        // have exactly one leading zero byte for each leading zero digit.
+        const auto slot = out.data() + index * size;
+        for (size_t byte = 0; byte < count * limb_bytes; ++byte)
+        {
+            const auto value = static_cast<uint8_t>(
+                limbs[byte / limb_bytes] >> (8 * (byte % limb_bytes)));
+
+            if (byte < size)
+                slot[size - 1 - byte] = value;
+            else if (value != 0)
+                invalid = true;
+        }
+
+        const auto zeros = static_cast<size_t>(first - text.begin());
+        const auto leading = static_cast<size_t>(std::find_if(slot,
+            slot + size, [](uint8_t byte) { return byte != 0; }) - slot);
+
+        if (invalid || zeros != leading)
+        {
+            std::fill(slot, slot + size, 0x00);
+            continue;
+        }
+
+        valid[index] = true;
+    }
+
+    if (!checked)
+        return valid;
+
+    // The checksums of the decoded payloads are verified together.
+    std::vector<size_t> decoded;
+    std::vector<data_slice> payloads;
+    for (size_t index = 0; index < in.size(); ++index)
+    {
+        if (!valid[index])
+            continue;
+
+        const auto slot = out.data() + index * size;
+        decoded.push_back(index);
+        payloads.emplace_back(slot, slot + size);
+    }
+
+    const auto verified = verify_checksum_batch(payloads);
+    for (size_t position = 0; position < decoded.size(); ++position)
+    {
+        if (verified[position])
+            continue;
+
+        const auto slot = out.data() + decoded[position] * size;
+        std::fill(slot, slot + size, 0x00);
+        valid[decoded[position]] = false;
+    }
+
+    return valid;
+}
+
+} // namespace explorer
+} // namespace libbitcoin
@@ -0,0 +1,495 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/base64_codec.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/impl/simd.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+
+static const auto base64_digits =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+static const char base64_pad = '=';
+
+// The chunk sizes are whole quanta, 64KiB of text.
+static const size_t encode_chunk_size = 49152;
+static const size_t decode_chunk_size = 65536;
+
+// The vector decoder stores 32 bytes for each 24 that it decodes.
+static const size_t decode_slack = 8;
+
+static const std::array<int8_t, 256>& digit_values()
+{
+    static const auto values = []()
+    {
+        std::array<int8_t, 256> table;
+        table.fill(-1);
+        for (int8_t digit = 0; digit < 64; ++digit)
+            table[static_cast<uint8_t>(base64_digits[digit])] = digit;
+
+        return table;
+    }();
+
+    return values;
+}
+
+static bool is_space(char character)
+{
+    return character == ' ' || character == '\n' || character == '\r' ||
+        character == '\t' || character == '\v' || character == '\f';
+}
+
+// Whitespace is below '!' and every base64 character is above it, so eight
+// characters are tested at a time before the exact (scalar) search.
+static const char* find_space(const char* it, const char* end)
+{
+    static const uint64_t ones = 0x0101010101010101;
+    static const uint64_t highs = 0x8080808080808080;
+
+    for (uint64_t word; end - it >= 8; it += 8)
+    {
+        std::memcpy(&word, it, sizeof(word));
+        if (((word - ones * '!') & ~word & highs) != 0)
+            break;
+    }
+
+    return std::find_if(it, end, is_space);
+}
+
+// scalar
+
+// The size is a multiple of three.
+static void encode_scalar(char* out, const uint8_t* in, size_t size)
+{
+    for (const auto end = in + size; in != end; in += 3)
+    {
+        const uint32_t value = (in[0] << 16) | (in[1] << 8) | in[2];
+        *out++ = base64_digits[value >> 18];
+        *out++ = base64_digits[(value >> 12) & 0x3f];
+        *out++ = base64_digits[(value >> 6) & 0x3f];
+        *out++ = base64_digits[value & 0x3f];
+    }
+}
+
+// Encode the final one or two bytes as a padded quantum.
+static void encode_tail(char* out, const uint8_t* in, size_t size)
+{
+    const uint32_t value = (in[0] << 16) | (size == 2 ? in[1] << 8 : 0);
+    out[0] = base64_digits[value >> 18];
+    out[1] = base64_digits[(value >> 12) & 0x3f];
+    out[2] = size == 2 ? base64_digits[(value >> 6) & 0x3f] : base64_pad;
+    out[3] = base64_pad;
+}
+
+// The size is a multiple of four, and only the last quantum may be padded,
+// as "xx==" or "xxx=".
+static bool decode_scalar(uint8_t* out, size_t& written, const char* in,
+    size_t size, bool& padded)
+{
+    const auto& values = digit_values();
+    const auto start = out;
+    padded = false;
+
+    for (const auto end = in + size; in != end; in += 4)
+    {
+        const auto a = values[static_cast<uint8_t>(in[0])];
+        const auto b = values[static_cast<uint8_t>(in[1])];
+        if (a < 0 || b < 0)
+            return false;
+
+        *out++ = static_cast<uint8_t>((a << 2) | (b >> 4));
+
+        if (in + 4 == end && in[3] == base64_pad)
+        {
+            padded = true;
+            if (in[2] == base64_pad)
+                break;
+
+            const auto c = values[static_cast<uint8_t>(in[2])];
+            if (c < 0)
+                return false;
+
+            *out++ = static_cast<uint8_t>((b << 4) | (c >> 2));
+            break;
+        }
+
+        const auto c = values[static_cast<uint8_t>(in[2])];
+        const auto d = values[static_cast<uint8_t>(in[3])];
+        if (c < 0 || d < 0)
+            return false;
+
+        *out++ = static_cast<uint8_t>((b << 4) | (c >> 2));
+        *out++ = static_cast<uint8_t>((c << 6) | d);
+    }
+
+    written = out - start;
+    return true;
+}
+
+#ifdef BX_X86
+
+// avx2
+
+// Encode 24 bytes to 32 characters at a time, returning the number of bytes
+// encoded. Each step reads 28 bytes.
+__attribute__((target("avx2")))
+static size_t encode_avx2(char* out, const uint8_t* in, size_t size)
+{
+    // Spread each three bytes over four, as [1, 0, 2, 1].
+    const auto spread = _mm256_setr_epi8(
+        1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+        1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+
+    // The offset from each range of digit values to its characters.
+    const auto offsets = _mm256_setr_epi8(
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+
+    size_t done = 0;
+    for (; size - done >= 28; done += 24, out += 32)
+    {
+        const auto low = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(in + done));
+        const auto high = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(in + done + 12));
+        const auto bytes = _mm256_shuffle_epi8(_mm256_inserti128_si256(
+            _mm256_castsi128_si256(low), high, 1), spread);
+
+        // Shift each six bits of the four bytes into its own byte.
+        const auto first = _mm256_mulhi_epu16(
+            _mm256_and_si256(bytes, _mm256_set1_epi32(0x0fc0fc00)),
+            _mm256_set1_epi32(0x04000040));
+        const auto second = _mm256_mullo_epi16(
+            _mm256_and_si256(bytes, _mm256_set1_epi32(0x003f03f0)),
+            _mm256_set1_epi32(0x01000010));
+        const auto values = _mm256_or_si256(first, second);
+
+        // Select the offset of the range of each value.
+        auto range = _mm256_subs_epu8(values, _mm256_set1_epi8(51));
+        const auto upper = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), values);
+        range = _mm256_or_si256(range,
+            _mm256_and_si256(upper, _mm256_set1_epi8(13)));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), _mm256_add_epi8(
+            _mm256_shuffle_epi8(offsets, range), values));
+    }
+
+    return done;
+}
+
+// Decode 32 characters to 24 bytes at a time, returning the number of
+// characters decoded. Decoding stops at the first step that contains a
+// character other than a digit, such as padding, which is left to the
+// scalar decoder.
+__attribute__((target("avx2")))
+static size_t decode_avx2(uint8_t* out, const char* in, size_t size)
+{
+    // A character is a digit if the bits selected by its nibbles are clear.
+    const auto low_bits = _mm256_setr_epi8(
+        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a,
+        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a);
+    const auto high_bits = _mm256_setr_epi8(
+        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+
+    // The offset from the characters of each high nibble to their values.
+    const auto offsets = _mm256_setr_epi8(
+        0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+
+    const auto mask = _mm256_set1_epi8(0x0f);
+
+    size_t done = 0;
+    for (; size - done >= 32; done += 32, out += 24)
+    {
+        const auto text = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(in + done));
+        const auto high = _mm256_and_si256(_mm256_srli_epi32(text, 4), mask);
+        const auto low = _mm256_and_si256(text, mask);
+
+        if (!_mm256_testz_si256(_mm256_shuffle_epi8(low_bits, low),
+            _mm256_shuffle_epi8(high_bits, high)))
+            break;
+
+        // The '/' character shares its high nibble with '+'.
+        const auto slash = _mm256_cmpeq_epi8(text, _mm256_set1_epi8('/'));
+        const auto values = _mm256_add_epi8(text, _mm256_shuffle_epi8(offsets,
+            _mm256_add_epi8(slash, high)));
+
+        // Merge each four six bit values into three bytes.
+        const auto pairs = _mm256_maddubs_epi16(values,
+            _mm256_set1_epi32(0x01400140));
+        const auto quads = _mm256_madd_epi16(pairs,
+            _mm256_set1_epi32(0x00011000));
+        const auto bytes = _mm256_shuffle_epi8(quads, _mm256_setr_epi8(
+            2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+            2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out),
+            _mm256_permutevar8x32_epi32(bytes,
+                _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7)));
+    }
+
+    return done;
+}
+
+#endif
+
+// The size is a multiple of three.
+static void encode_quanta(char* out, const uint8_t* in, size_t size,
+    base64_kernel kernel)
+{
+    size_t done = 0;
+
+#ifdef BX_X86
+    if (kernel == base64_kernel::avx2)
+        done = encode_avx2(out, in, size);
+#endif
+
+    encode_scalar(out + done / 3 * 4, in + done, size - done);
+}
+
+// The size is a multiple of four, and the output requires the slack.
+static bool decode_quanta(uint8_t* out, size_t& written, const char* in,
+    size_t size, bool& padded, base64_kernel kernel)
+{
+    size_t done = 0;
+
+#ifdef BX_X86
+    if (kernel == base64_kernel::avx2)
+        done = decode_avx2(out, in, size);
+#endif
+
+    size_t rest;
+    if (!decode_scalar(out + done / 4 * 3, rest, in + done, size - done,
+        padded))
+        return false;
+
+    written = done / 4 * 3 + rest;
+    return true;
+}
+
+base64_kernel base64_default_kernel()
+{
+    static const auto kernel = []()
+    {
+#ifdef BX_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2"))
+            return base64_kernel::avx2;
+#endif
+        return base64_kernel::scalar;
+    }();
+
+    return kernel;
+}
+
+std::vector<base64_kernel> base64_kernels()
+{
+    std::vector<base64_kernel> kernels{ base64_kernel::scalar };
+    if (base64_default_kernel() == base64_kernel::avx2)
+        kernels.push_back(base64_kernel::avx2);
+
+    return kernels;
+}
+
+std::string fast_encode_base64(data_slice data)
+{
+    return fast_encode_base64(data, base64_default_kernel());
+}
+
+std::string fast_encode_base64(data_slice data, base64_kernel kernel)
+{
+    const auto whole = data.size() / 3 * 3;
+    const auto tail = data.size() - whole;
+    std::string out((whole / 3 + (tail == 0 ? 0 : 1)) * 4, '\0');
+
+    encode_quanta(&out[0], data.data(), whole, kernel);
+    if (tail != 0)
+        encode_tail(&out[whole / 3 * 4], data.data() + whole, tail);
+
+    return out;
+}
+
+bool fast_decode_base64(data_chunk& out, const std::string& in)
+{
+    return fast_decode_base64(out, in, base64_default_kernel());
+}
+
+bool fast_decode_base64(data_chunk& out, const std::string& in,
+    base64_kernel kernel)
+{
+    if (in.size() % 4 != 0)
+        return false;
+
+    data_chunk result(in.size() / 4 * 3 + decode_slack);
+    size_t written;
+    bool padded;
+    if (!decode_quanta(result.data(), written, in.data(), in.size(), padded,
+        kernel))
+        return false;
+
+    result.resize(written);
+    out = std::move(result);
+    return true;
+}
+
+// encoder
+
+base64_encoder::base64_encoder(std::ostream& output, base64_kernel kernel)
+  : output_(output), kernel_(kernel),
+    buffer_(encode_chunk_size / 3 * 4, '\0')
+{
+}
+
+void base64_encoder::write(data_slice data)
+{
+    auto it = data.data();
+    const auto end = it + data.size();
+
+    // Complete the pending quantum.
+    if (!pending_.empty())
+    {
+        while (pending_.size() < 3 && it != end)
+            pending_.push_back(*it++);
+
+        if (pending_.size() < 3)
+            return;
+
+        encode(pending_.data(), pending_.size());
+        pending_.clear();
+    }
+
+    while (end - it >= 3)
+    {
+        const auto size = std::min(static_cast<size_t>(end - it) / 3 * 3,
+            encode_chunk_size);
+
+        encode(it, size);
+        it += size;
+    }
+
+    pending_.assign(it, end);
+}
+
+void base64_encoder::finish()
+{
+    if (pending_.empty())
+        return;
+
+    encode_tail(&buffer_[0], pending_.data(), pending_.size());
+    output_.write(buffer_.data(), 4);
+    pending_.clear();
+}
+
+void base64_encoder::encode(const uint8_t* data, size_t size)
+{
+    encode_quanta(&buffer_[0], data, size, kernel_);
+    output_.write(buffer_.data(), size / 3 * 4);
+}
+
+// decoder
+
+base64_decoder::base64_decoder(std::ostream& output, base64_kernel kernel)
+  : output_(output), kernel_(kernel),
+    buffer_(decode_chunk_size / 4 * 3 + decode_slack), padded_(false)
+{
+}
+
+bool base64_decoder::write(data_slice text)
+{
+    auto it = reinterpret_cast<const char*>(text.data());
+    const auto end = it + text.size();
+
+    while (it != end)
+    {
+        // Decode each run of digits between whitespace.
+        const auto space = find_space(it, end);
+        if (it != space && padded_)
+            return false;
+
+        // Complete the pending quantum.
+        while (!text_.empty() && it != space)
+        {
+            text_.push_back(*it++);
+            if (text_.size() == 4)
+            {
+                if (!decode(text_.data(), text_.size()))
+                    return false;
+
+                text_.clear();
+            }
+        }
+
+        while (space - it >= 4)
+        {
+            const auto size = std::min(static_cast<size_t>(space - it) / 4 * 4,
+                decode_chunk_size);
+
+            if (padded_ || !decode(it, size))
+                return false;
+
+            it += size;
+        }
+
+        if (it != space && padded_)
+            return false;
+
+        text_.append(it, space);
+        it = std::find_if_not(space, end, is_space);
+    }
+
+    return true;
+}
+
+bool base64_decoder::finish()
+{
+    return text_.empty();
+}
+
+bool base64_decoder::decode(const char* text, size_t size)
+{
+    size_t written;
+    if (!decode_quanta(buffer_.data(), written, text, size, padded_, kernel_))
+        return false;
+
+    output_.write(reinterpret_cast<const char*>(buffer_.data()), written);
+    return true;
+}
+
+} // namespace explorer
+} // namespace libbitcoin
@@ -0,0 +1,338 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/base85_codec.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+
+static const auto base85_digits =
+    "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ"
+    ".-:+=^!/*?&<>()[]{}@%$#";
+
+static const size_t group_bytes = 4;
+static const size_t group_digits = 5;
+static const uint32_t pair_base = 85 * 85;
+static const uint8_t invalid_digit = 0xff;
+
+// The chunk sizes are whole groups, 64KiB of text.
+static const size_t encode_chunk_size = 52428;
+static const size_t decode_chunk_size = 65535;
+
+// The two digits of each value below 85^2, most significant first.
+static const std::array<char, 2 * pair_base>& digit_pairs()
+{
+    static const auto pairs = []()
+    {
+        std::array<char, 2 * pair_base> table;
+        for (uint32_t value = 0; value < pair_base; ++value)
+        {
+            table[2 * value + 0] = base85_digits[value / 85];
+            table[2 * value + 1] = base85_digits[value % 85];
+        }
+
+        return table;
+    }();
+
+    return pairs;
+}
+
+static const std::array<uint8_t, 256>& digit_values()
+{
+    static const auto values = []()
+    {
+        std::array<uint8_t, 256> table;
+        table.fill(invalid_digit);
+        for (uint8_t digit = 0; digit < 85; ++digit)
+            table[static_cast<uint8_t>(base85_digits[digit])] = digit;
+
+        return table;
+    }();
+
+    return values;
+}
+
+static bool is_space(char character)
+{
+    return character == ' ' || character == '\n' || character == '\r' ||
+        character == '\t' || character == '\v' || character == '\f';
+}
+
+// Whitespace is below '!' and every Z85 character is at or above it, so
+// eight characters are tested at a time before the exact (scalar) search.
+static const char* find_space(const char* it, const char* end)
+{
+    static const uint64_t ones = 0x0101010101010101;
+    static const uint64_t highs = 0x8080808080808080;
+
+    for (uint64_t word; end - it >= 8; it += 8)
+    {
+        std::memcpy(&word, it, sizeof(word));
+        if (((word - ones * '!') & ~word & highs) != 0)
+            break;
+    }
+
+    return std::find_if(it, end, is_space);
+}
+
+// The size is a multiple of four.
+static void encode_groups(char* out, const uint8_t* in, size_t size)
+{
+    const auto& pairs = digit_pairs();
+    for (const auto end = in + size; in != end; in += group_bytes)
+    {
+        const auto value =
+            (static_cast<uint32_t>(in[0]) << 24) |
+            (static_cast<uint32_t>(in[1]) << 16) |
+            (static_cast<uint32_t>(in[2]) << 8) |
+            (static_cast<uint32_t>(in[3]) << 0);
+
+        // The value is below 85^5, so the high part is below 85^3.
+        const auto high = value / pair_base;
+        const auto low = value % pair_base;
+        *out++ = base85_digits[high / pair_base];
+        std::memcpy(out, &pairs[2 * (high % pair_base)], 2);
+        std::memcpy(out + 2, &pairs[2 * low], 2);
+        out += 4;
+    }
+}
+
+// The size is a multiple of five.
+static bool decode_groups(uint8_t* out, const char* in, size_t size)
+{
+    const auto& values = digit_values();
+    for (const auto end = in + size; in != end; in += group_digits)
+    {
+        const auto d0 = values[static_cast<uint8_t>(in[0])];
+        const auto d1 = values[static_cast<uint8_t>(in[1])];
+        const auto d2 = values[static_cast<uint8_t>(in[2])];
+        const auto d3 = values[static_cast<uint8_t>(in[3])];
+        const auto d4 = values[static_cast<uint8_t>(in[4])];
+        if (((d0 | d1 | d2 | d3 | d4) & 0x80) != 0)
+            return false;
+
+        // The largest group ("%nSc0") is 2^32 - 1.
+        const uint64_t value =
+            (((uint64_t(d0) * 85 + d1) * 85 + d2) * 85 + d3) * 85 + d4;
+        if (value > max_uint32)
+            return false;
+
+        *out++ = static_cast<uint8_t>(value >> 24);
+        *out++ = static_cast<uint8_t>(value >> 16);
+        *out++ = static_cast<uint8_t>(value >> 8);
+        *out++ = static_cast<uint8_t>(value >> 0);
+    }
+
+    return true;
+}
+
+bool fast_encode_base85(std::string& out, data_slice in)
+{
+    if (in.size() % group_bytes != 0)
+        return false;
+
+    std::string text(in.size() / group_bytes * group_digits, '\0');
+    encode_groups(&text[0], in.data(), in.size());
+    out.swap(text);
+    return true;
+}
+
+bool fast_decode_base85(data_chunk& out, const std::string& in)
+{
+    if (in.size() % group_digits != 0)
+        return false;
+
+    data_chunk data(in.size() / group_digits * group_bytes);
+    if (!decode_groups(data.data(), in.data(), in.size()))
+        return false;
+
+    out.swap(data);
+    return true;
+}
+
+bool encode_base85_batch(std::vector<std::string>& out, data_slice in,
+    size_t size)
+{
+    if (size == 0 || size % group_bytes != 0 || in.size() % size != 0)
+        return false;
+
+    const auto count = in.size() / size;
+    const auto length = size / group_bytes * group_digits;
+
+    std::vector<std::string> texts(count, std::string(length, '\0'));
+    for (size_t index = 0; index < count; ++index)
+        encode_groups(&texts[index][0], in.data() + index * size, size);
+
+    out.swap(texts);
+    return true;
+}
+
+std::vector<bool> decode_base85_batch(data_chunk& out,
+    const std::vector<std::string>& in, size_t size)
+{
+    std::vector<bool> valid(in.size(), false);
+    out.assign(in.size() * size, 0x00);
+
+    // Only text of exactly this length decodes to a payload of the size.
+    if (size % group_bytes != 0)
+        return valid;
+
+    const auto length = size / group_bytes * group_digits;
+    for (size_t index = 0; index < in.size(); ++index)
+    {
+        const auto& text = in[index];
+        if (text.size() != length)
+            continue;
+
+        // A partially decoded payload is cleared.
+        const auto slot = out.data() + index * size;
+        valid[index] = decode_groups(slot, text.data(), length);
+        if (!valid[index])
+            std::fill(slot, slot + size, 0x00);
+    }
+
+    return valid;
+}
+
+// encoder
+
+base85_encoder::base85_encoder(std::ostream& output)
+  : output_(output),
+    buffer_(encode_chunk_size / group_bytes * group_digits, '\0')
+{
+}
+
+void base85_encoder::write(data_slice data)
+{
+    auto it = data.data();
+    const auto end = it + data.size();
+
+    // Complete the pending group.
+    if (!pending_.empty())
+    {
+        while (pending_.size() < group_bytes && it != end)
+            pending_.push_back(*it++);
+
+        if (pending_.size() < group_bytes)
+            return;
+
+        encode(pending_.data(), pending_.size());
+        pending_.clear();
+    }
+
+    while (static_cast<size_t>(end - it) >= group_bytes)
+    {
+        const auto size = std::min(static_cast<size_t>(end - it) /
+            group_bytes * group_bytes, encode_chunk_size);
+
+        encode(it, size);
+        it += size;
+    }
+
+    pending_.assign(it, end);
+}
+
+bool base85_encoder::finish()
+{
+    return pending_.empty();
+}
+
+void base85_encoder::encode(const uint8_t* data, size_t size)
+{
+    encode_groups(&buffer_[0], data, size);
+    output_.write(buffer_.data(), size / group_bytes * group_digits);
+}
+
+// decoder
+
+base85_decoder::base85_decoder(std::ostream& output)
+  : output_(output),
+    buffer_(decode_chunk_size / group_digits * group_bytes)
+{
+}
+
+bool base85_decoder::write(data_slice text)
+{
+    auto it = reinterpret_cast<const char*>(text.data());
+    const auto end = it + text.size();
+
+    while (it != end)
+    {
+        // Decode each run of digits between whitespace.
+        const auto space = find_space(it, end);
+
+        // Complete the pending group.
+        while (!text_.empty() && it != space)
+        {
+            text_.push_back(*it++);
+            if (text_.size() == group_digits)
+            {
+                if (!decode(text_.data(), text_.size()))
+                    return false;
+
+                text_.clear();
+            }
+        }
+
+        while (static_cast<size_t>(space - it) >= group_digits)
+        {
+            const auto size = std::min(static_cast<size_t>(space - it) /
+                group_digits * group_digits, decode_chunk_size);
+
+            if (!decode(it, size))
+                return false;
+
+            it += size;
+        }
+
+        text_.append(it, space);
+        it = std::find_if_not(space, end, is_space);
+    }
+
+    return true;
+}
+
+bool base85_decoder::finish()
+{
+    return text_.empty();
+}
+
+bool base85_decoder::decode(const char* text, size_t size)
+{
+    if (!decode_groups(buffer_.data(), text, size))
+        return false;
+
+    output_.write(reinterpret_cast<const char*>(buffer_.data()),
+        size / group_digits * group_bytes);
+    return true;
+}
+
+} // namespace explorer
+} // namespace libbitcoin
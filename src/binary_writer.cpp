@@ -0,0 +1,328 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/binary_writer.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include <boost/property_tree/ptree.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+using namespace pt;
+
+namespace libbitcoin {
+namespace explorer {
+
+enum class value_type
+{
+    text,
+    number,
+    binary
+};
+
+// The types of the property tree values that are not text, by field name.
+// Numbers are written by prop_tree as unsigned decimal and binary values as
+// base16, so any other field, whatever its text, is written as text.
+static const std::map<std::string, value_type> schema
+{
+    { "amount", value_type::number },
+    { "bits", value_type::number },
+    { "branch", value_type::number },
+    { "checksum", value_type::number },
+    { "confirmed", value_type::number },
+    { "hash", value_type::binary },
+    { "height", value_type::number },
+    { "index", value_type::number },
+    { "lock_time", value_type::number },
+    { "merkle_tree_hash", value_type::binary },
+    { "nonce", value_type::number },
+    { "prefix", value_type::number },
+    { "previous_block_hash", value_type::binary },
+    { "public_key_hash", value_type::binary },
+    { "received", value_type::number },
+    { "sequence", value_type::number },
+    { "signatures", value_type::number },
+    { "time_stamp", value_type::number },
+    { "transaction_hash", value_type::binary },
+    { "unspent", value_type::number },
+    { "value", value_type::number },
+    { "version", value_type::number }
+};
+
+static void write_big_endian(std::ostream& output, uint64_t value,
+    size_t bytes)
+{
+    for (auto shift = 8 * bytes; shift > 0; shift -= 8)
+        output.put(static_cast<char>((value >> (shift - 8)) & 0xff));
+}
+
+// CBOR (RFC 7049) major type heads.
+class cbor_writer
+{
+public:
+    cbor_writer(std::ostream& output)
+      : output_(output)
+    {
+    }
+
+    void map(size_t size)
+    {
+        head(5, size);
+    }
+
+    void array(size_t size)
+    {
+        head(4, size);
+    }
+
+    void text(const std::string& value)
+    {
+        head(3, value.size());
+        output_.write(value.data(), value.size());
+    }
+
+    void bytes(const data_chunk& value)
+    {
+        head(2, value.size());
+        output_.write(reinterpret_cast<const char*>(value.data()),
+            value.size());
+    }
+
+    void number(uint64_t value)
+    {
+        head(0, value);
+    }
+
+private:
+    void head(uint8_t major, uint64_t value)
+    {
+        const uint8_t type = major << 5;
+        if (value < 24)
+        {
+            output_.put(static_cast<char>(type | value));
+        }
+        else if (value <= max_uint8)
+        {
+            output_.put(static_cast<char>(type | 24));
+            write_big_endian(output_, value, 1);
+        }
+        else if (value <= max_uint16)
+        {
+            output_.put(static_cast<char>(type | 25));
+            write_big_endian(output_, value, 2);
+        }
+        else if (value <= max_uint32)
+        {
+            output_.put(static_cast<char>(type | 26));
+            write_big_endian(output_, value, 4);
+        }
+        else
+        {
+            output_.put(static_cast<char>(type | 27));
+            write_big_endian(output_, value, 8);
+        }
+    }
+
+    std::ostream& output_;
+};
+
+// MessagePack format families.
+class msgpack_writer
+{
+public:
+    msgpack_writer(std::ostream& output)
+      : output_(output)
+    {
+    }
+
+    void map(size_t size)
+    {
+        if (size < 16)
+            output_.put(static_cast<char>(0x80 | size));
+        else if (size <= max_uint16)
+            typed(0xde, size, 2);
+        else
+            typed(0xdf, size, 4);
+    }
+
+    void array(size_t size)
+    {
+        if (size < 16)
+            output_.put(static_cast<char>(0x90 | size));
+        else if (size <= max_uint16)
+            typed(0xdc, size, 2);
+        else
+            typed(0xdd, size, 4);
+    }
+
+    void text(const std::string& value)
+    {
+        const auto size = value.size();
+        if (size < 32)
+            output_.put(static_cast<char>(0xa0 | size));
+        else if (size <= max_uint8)
+            typed(0xd9, size, 1);
+        else if (size <= max_uint16)
+            typed(0xda, size, 2);
+        else
+            typed(0xdb, size, 4);
+
+        output_.write(value.data(), size);
+    }
+
+    void bytes(const data_chunk& value)
+    {
+        const auto size = value.size();
+        if (size <= max_uint8)
+            typed(0xc4, size, 1);
+        else if (size <= max_uint16)
+            typed(0xc5, size, 2);
+        else
+            typed(0xc6, size, 4);
+
+        output_.write(reinterpret_cast<const char*>(value.data()), size);
+    }
+
+    void number(uint64_t value)
+    {
+        if (value < 0x80)
+            output_.put(static_cast<char>(value));
+        else if (value <= max_uint8)
+            typed(0xcc, value, 1);
+        else if (value <= max_uint16)
+            typed(0xcd, value, 2);
+        else if (value <= max_uint32)
+            typed(0xce, value, 4);
+        else
+            typed(0xcf, value, 8);
+    }
+
+private:
+    void typed(uint8_t type, uint64_t value, size_t bytes)
+    {
+        output_.put(static_cast<char>(type));
+        write_big_endian(output_, value, bytes);
+    }
+
+    std::ostream& output_;
+};
+
+static bool parse_number(uint64_t& out, const std::string& text)
+{
+    // Leading zeros are significant to the text, so it is left as text.
+    if (text.empty() || text.size() > 20 || (text[0] == '0' && text.size() > 1))
+        return false;
+
+    uint64_t value = 0;
+    for (const auto character: text)
+    {
+        if (character < '0' || character > '9')
+            return false;
+
+        const uint64_t digit = character - '0';
+        if (value > (max_uint64 - digit) / 10)
+            return false;
+
+        value = value * 10 + digit;
+    }
+
+    out = value;
+    return true;
+}
+
+// A value that does not parse as the type of its field is written as text.
+template <typename Writer>
+static void write_value(Writer& writer, const std::string& name,
+    const std::string& text)
+{
+    const auto field = schema.find(name);
+    const auto type = field == schema.end() ? value_type::text :
+        field->second;
+
+    uint64_t number;
+    data_chunk data;
+
+    if (type == value_type::number && parse_number(number, text))
+        writer.number(number);
+    else if (type == value_type::binary && !text.empty() &&
+        decode_base16(data, text))
+        writer.bytes(data);
+    else
+        writer.text(text);
+}
+
+template <typename Writer>
+static void write_tree(Writer& writer, const std::string& name,
+    const ptree& tree, bool root)
+{
+    if (!root && tree.empty())
+    {
+        write_value(writer, name, tree.data());
+        return;
+    }
+
+    // Field names in the order of their first appearance.
+    std::set<std::string> seen;
+    std::vector<std::string> names;
+    for (const auto& element: tree)
+        if (seen.insert(element.first).second)
+            names.push_back(element.first);
+
+    // A container of like-named containers is a list, even of one.
+    const auto list = !root && names.size() == 1 &&
+        !tree.front().second.empty();
+
+    writer.map(names.size());
+    for (const auto& name: names)
+    {
+        writer.text(name);
+        const auto count = tree.count(name);
+        const auto range = tree.equal_range(name);
+        if (count == 1 && !list)
+        {
+            write_tree(writer, name, range.first->second, false);
+            continue;
+        }
+
+        writer.array(count);
+        for (auto it = range.first; it != range.second; ++it)
+            write_tree(writer, name, it->second, false);
+    }
+}
+
+void write_cbor(std::ostream& output, const ptree& tree)
+{
+    cbor_writer writer(output);
+    write_tree(writer, "", tree, true);
+}
+
+void write_msgpack(std::ostream& output, const ptree& tree)
+{
+    msgpack_writer writer(output);
+    write_tree(writer, "", tree, true);
+}
+
+} // namespace explorer
+} // namespace libbitcoin
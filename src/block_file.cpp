@@ -0,0 +1,222 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/block_file.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+#include <boost/filesystem.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/hash_stream.hpp>
+#include <bitcoin/explorer/mapped_file.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+
+static const size_t magic_size = 4;
+static const size_t prefix_size = magic_size + sizeof(uint32_t);
+static const size_t header_size = 80;
+static const size_t previous_offset = sizeof(uint32_t);
+
+static uint32_t read_size(const uint8_t* data)
+{
+    return uint32_t(data[0]) | uint32_t(data[1]) << 8 |
+        uint32_t(data[2]) << 16 | uint32_t(data[3]) << 24;
+}
+
+block_file_status index_block_file(std::vector<block_record>& records,
+    size_t file, data_slice data, uint32_t magic)
+{
+    const auto begin = data.data();
+    const auto size = data.size();
+    const auto first = records.size();
+
+    std::vector<data_slice> headers;
+    for (size_t offset = 0; offset + prefix_size <= size;)
+    {
+        // A zero magic is the preallocated remainder of the file.
+        const auto block_magic = read_size(begin + offset);
+        if (block_magic == 0)
+            break;
+
+        if (block_magic != magic)
+            return block_file_status::other_network;
+
+        const auto block_size = read_size(begin + offset + magic_size);
+        const auto block = offset + prefix_size;
+        if (block_size < header_size || block_size > size - block)
+            return block_file_status::truncated;
+
+        block_record record;
+        record.file = file;
+        record.offset = block;
+        record.size = block_size;
+        std::copy(begin + block + previous_offset,
+            begin + block + previous_offset + hash_size,
+            record.previous.begin());
+
+        records.push_back(record);
+        headers.emplace_back(begin + block, begin + block + header_size);
+        offset = block + block_size;
+    }
+
+    const auto hashes = bitcoin256_batch(headers);
+    for (size_t index = 0; index < hashes.size(); ++index)
+        records[first + index].hash = hashes[index];
+
+    return block_file_status::valid;
+}
+
+size_t index_block_files(std::vector<block_record>& records,
+    block_file_status& status, const std::vector<data_slice>& files,
+    uint32_t magic)
+{
+    std::vector<std::vector<block_record>> indexes(files.size());
+    std::vector<block_file_status> statuses(files.size());
+    const auto index = [&files, &indexes, &statuses, magic](size_t file)
+    {
+        statuses[file] = index_block_file(indexes[file], file, files[file],
+            magic);
+    };
+
+    parallel_for(files.size(), index);
+
+    records.clear();
+    status = block_file_status::valid;
+    for (size_t file = 0; file < files.size(); ++file)
+    {
+        if (statuses[file] != block_file_status::valid)
+        {
+            status = statuses[file];
+            return file;
+        }
+
+        records.insert(records.end(), indexes[file].begin(),
+            indexes[file].end());
+    }
+
+    return files.size();
+}
+
+std::vector<size_t> block_chain(const std::vector<block_record>& records)
+{
+    typedef std::unordered_map<hash_digest, size_t, digest_hasher<hash_size>>
+        position_map;
+
+    position_map positions;
+    positions.reserve(records.size());
+    for (size_t position = 0; position < records.size(); ++position)
+        positions.emplace(records[position].hash, position);
+
+    // A height of zero is unknown, so heights are stored plus one. Each
+    // ancestry is walked to a known height and then assigned on the way back,
+    // so that blocks may be in any order.
+    static const size_t unlinked = max_size_t;
+    std::vector<size_t> heights(records.size(), 0);
+    std::vector<size_t> path;
+    for (size_t position = 0; position < records.size(); ++position)
+    {
+        auto current = position;
+        while (heights[current] == 0)
+        {
+            path.push_back(current);
+            const auto& previous = records[current].previous;
+            if (previous == null_hash)
+            {
+                heights[current] = 1;
+                path.pop_back();
+                break;
+            }
+
+            const auto parent = positions.find(previous);
+            if (parent == positions.end())
+            {
+                heights[current] = unlinked;
+                path.pop_back();
+                break;
+            }
+
+            current = parent->second;
+        }
+
+        auto height = heights[current];
+        for (auto child = path.rbegin(); child != path.rend(); ++child)
+        {
+            if (height != unlinked)
+                ++height;
+
+            heights[*child] = height;
+        }
+
+        path.clear();
+    }
+
+    // The first block of greatest height is the tip of the chain.
+    size_t tip = 0;
+    size_t top = 0;
+    for (size_t position = 0; position < records.size(); ++position)
+    {
+        if (heights[position] != unlinked && heights[position] > top)
+        {
+            top = heights[position];
+            tip = position;
+        }
+    }
+
+    std::vector<size_t> chain(top);
+    for (auto height = top; height > 0; --height)
+    {
+        chain[height - 1] = tip;
+        if (height > 1)
+            tip = positions.find(records[tip].previous)->second;
+    }
+
+    return chain;
+}
+
+size_t load_block_files(std::deque<mapped_file>& mapped,
+    std::vector<data_slice>& files, std::vector<block_record>& records,
+    block_file_status& status,
+    const std::vector<boost::filesystem::path>& paths, uint32_t magic)
+{
+    mapped.clear();
+    files.clear();
+    for (size_t position = 0; position < paths.size(); ++position)
+    {
+        mapped.emplace_back(paths[position]);
+        if (!mapped.back().valid())
+        {
+            status = block_file_status::unreadable;
+            return position;
+        }
+
+        files.push_back(mapped.back().data());
+    }
+
+    return index_block_files(records, status, files, magic);
+}
+
+} // namespace explorer
+} // namespace libbitcoin
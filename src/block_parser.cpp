@@ -0,0 +1,119 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/block_parser.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <vector>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/stream.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/hash_stream.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+using namespace boost::iostreams;
+
+namespace libbitcoin {
+namespace explorer {
+
+// The number of transactions hashed by each task.
+static const size_t hash_run = 256;
+
+size_t parse_block(chain::block& block, std::vector<data_slice>& transactions,
+    data_slice data)
+{
+    const auto begin = data.data();
+    stream<array_source> input(reinterpret_cast<const char*>(begin),
+        data.size());
+
+    transactions.clear();
+    if (!block.header.from_data(input, true))
+        return 0;
+
+    // The count is not trusted to size the block before it is parsed.
+    const auto count = block.header.transaction_count;
+    block.transactions.clear();
+    for (uint64_t index = 0; index < count; ++index)
+    {
+        const auto start = static_cast<size_t>(input.tellg());
+        block.transactions.emplace_back();
+        if (!block.transactions.back().from_data(input))
+            return 0;
+
+        const auto end = static_cast<size_t>(input.tellg());
+        transactions.emplace_back(begin + start, begin + end);
+    }
+
+    return static_cast<size_t>(input.tellg());
+}
+
+std::vector<hash_digest> transaction_hashes(
+    const std::vector<data_slice>& transactions, size_t threads)
+{
+    std::vector<hash_digest> hashes(transactions.size());
+    const auto runs = (transactions.size() + hash_run - 1) / hash_run;
+
+    const auto hash = [&transactions, &hashes](size_t run)
+    {
+        const auto first = run * hash_run;
+        const auto last = std::min(first + hash_run, transactions.size());
+        const auto batch = bitcoin256_batch(std::vector<data_slice>(
+            transactions.begin() + first, transactions.begin() + last));
+
+        std::copy(batch.begin(), batch.end(), hashes.begin() + first);
+    };
+
+    parallel_for(runs, hash, threads);
+    return hashes;
+}
+
+hash_digest merkle_root(const std::vector<hash_digest>& hashes)
+{
+    if (hashes.empty())
+        return null_hash;
+
+    // An odd hash at the end of a level is paired with itself.
+    auto level = hashes;
+    while (level.size() > 1)
+    {
+        if (level.size() % 2 != 0)
+            level.push_back(level.back());
+
+        data_chunk pairs;
+        pairs.reserve(level.size() * hash_size);
+        for (const auto& hash: level)
+            pairs.insert(pairs.end(), hash.begin(), hash.end());
+
+        std::vector<data_slice> messages;
+        messages.reserve(level.size() / 2);
+        for (size_t pair = 0; pair < level.size() / 2; ++pair)
+            messages.emplace_back(pairs.data() + pair * 2 * hash_size,
+                pairs.data() + (pair + 1) * 2 * hash_size);
+
+        level = bitcoin256_batch(messages);
+    }
+
+    return level.front();
+}
+
+} // namespace explorer
+} // namespace libbitcoin
@@ -22,12 +22,15 @@
 
 #include <iostream>
 #include <cstdint>
+#include <functional>
 #include <string>
 #include <boost/format.hpp>
 #include <boost/property_tree/ptree.hpp>
 #include <bitcoin/explorer/primitives/encoding.hpp>
 #include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/output_sink.hpp>
 #include <bitcoin/explorer/prop_tree.hpp>
+#include <bitcoin/explorer/prop_writer.hpp>
 #include <bitcoin/explorer/utility.hpp>
 
 using namespace pt;
@@ -37,9 +40,15 @@ namespace explorer {
     
 callback_state::callback_state(std::ostream& error, std::ostream& output,
     const encoding_engine engine)
+    : callback_state(error, output, engine, flush_policy::immediate)
+{
+}
+
+callback_state::callback_state(std::ostream& error, std::ostream& output,
+    const encoding_engine engine, flush_policy policy)
     : stopped_(true), refcount_(0), result_(console_result::okay), 
-    engine_(engine), error_(error), output_(output)
-    
+    engine_(engine), error_(error), sink_(output, policy), buffered_(&sink_),
+    output_(buffered_)
 {
 }
 
@@ -48,15 +57,17 @@ callback_state::callback_state(std::ostream& error, std::ostream& output)
 {
 }
 
-// std::endl adds "/n" and flushes the stream.
+// Buffered output is written first so that it precedes the error.
 void callback_state::error(const ptree tree)
 {
+    sink_.flush();
     write_stream(error_, tree, engine_);
 }
 
 // std::endl adds "/n" and flushes the stream.
 void callback_state::error(const format& message)
 {
+    sink_.flush();
     error_ << message << std::endl;
 }
 
@@ -70,7 +81,14 @@ void callback_state::output(const pt::ptree tree)
     write_stream(output_, tree, engine_);
 }
 
-// std::endl adds "/n" and flushes the stream.
+void callback_state::output(const std::function<void(prop_writer&)>& write)
+{
+    prop_writer writer(output_, engine_);
+    write(writer);
+    writer.finish();
+}
+
+// std::endl adds "/n" and flushes the stream, subject to the flush policy.
 void callback_state::output(const format& message)
 {
     output_ << message  << std::endl;
@@ -86,6 +104,11 @@ void callback_state::output(uint64_t value)
     output(format("%1%") % value);
 }
 
+void callback_state::flush()
+{
+    sink_.flush();
+}
+
 void callback_state::start()
 {
     refcount_ = 1;
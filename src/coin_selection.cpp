@@ -0,0 +1,268 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/coin_selection.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+
+// DRY
+static auto algorithm_exact = "exact";
+static auto algorithm_fee = "fee";
+static auto algorithm_largest = "largest";
+
+// The selection algorithms operate on values and return indexes into them.
+typedef std::vector<uint64_t> value_list;
+typedef std::vector<size_t> index_list;
+
+static value_list to_values(const unspent_list& unspent)
+{
+    value_list values;
+    values.reserve(unspent.size());
+    for (const auto& output: unspent)
+        values.push_back(output.value);
+
+    return values;
+}
+
+static void to_outputs(unspent_list& out, const unspent_list& unspent,
+    const index_list& selected, const index_list& candidates)
+{
+    out.clear();
+    out.reserve(selected.size());
+    for (const auto index: selected)
+        out.push_back(unspent[candidates[index]]);
+}
+
+// Ties are ordered by index so that selection is deterministic.
+static index_list descending(const value_list& values)
+{
+    index_list order(values.size());
+    for (size_t index = 0; index < order.size(); ++index)
+        order[index] = index;
+
+    const auto greater = [&values](size_t left, size_t right)
+    {
+        return values[left] > values[right] ||
+            (values[left] == values[right] && left < right);
+    };
+
+    std::sort(order.begin(), order.end(), greater);
+    return order;
+}
+
+static bool largest(index_list& out, const value_list& values,
+    uint64_t amount)
+{
+    out.clear();
+    if (amount == 0)
+        return true;
+
+    // A single pass finds the smallest output that pays the whole amount.
+    auto best = values.size();
+    for (size_t index = 0; index < values.size(); ++index)
+        if (values[index] >= amount &&
+            (best == values.size() || values[index] < values[best]))
+            best = index;
+
+    if (best != values.size())
+    {
+        out.push_back(best);
+        return true;
+    }
+
+    uint64_t total = 0;
+    for (const auto index: descending(values))
+    {
+        out.push_back(index);
+        total += values[index];
+        if (total >= amount)
+            return true;
+    }
+
+    out.clear();
+    return false;
+}
+
+// Depth-first search over inclusion/omission of the outputs in descending
+// order, inclusion first. A branch is pruned when the outputs that remain
+// cannot pay the amount or when the total exceeds the tolerance.
+static bool exact(index_list& out, const value_list& values, uint64_t amount,
+    uint64_t tolerance)
+{
+    out.clear();
+    if (amount == 0)
+        return true;
+
+    const auto order = descending(values);
+    const auto count = order.size();
+
+    // remaining[depth] is the total value of the outputs from depth onward.
+    value_list remaining(count + 1, 0);
+    for (auto depth = count; depth > 0; --depth)
+        remaining[depth - 1] = remaining[depth] + values[order[depth - 1]];
+
+    if (remaining.front() < amount)
+        return false;
+
+    const auto maximum = std::numeric_limits<uint64_t>::max();
+    const auto limit = tolerance > maximum - amount ? maximum :
+        amount + tolerance;
+
+    index_list path;
+    index_list best;
+    auto found = false;
+    auto best_excess = maximum;
+    uint64_t total = 0;
+    size_t depth = 0;
+
+    for (size_t tries = 0; tries < selection_search_limit; ++tries)
+    {
+        auto backtrack = false;
+
+        if (total + remaining[depth] < amount || total > limit)
+            backtrack = true;
+        else if (total >= amount)
+        {
+            const auto excess = total - amount;
+            if (excess < best_excess)
+            {
+                found = true;
+                best_excess = excess;
+                best = path;
+            }
+
+            if (excess == 0)
+                break;
+
+            backtrack = true;
+        }
+
+        if (backtrack)
+        {
+            if (path.empty())
+                break;
+
+            // Turn the last inclusion into an omission. Omitting an output
+            // and then including one of equal value repeats a searched branch.
+            const auto omitted = path.back();
+            const auto value = values[order[omitted]];
+            path.pop_back();
+            total -= value;
+            depth = omitted + 1;
+            while (depth < count && values[order[depth]] == value)
+                ++depth;
+
+            continue;
+        }
+
+        path.push_back(depth);
+        total += values[order[depth]];
+        ++depth;
+    }
+
+    if (!found)
+        return false;
+
+    for (const auto depth: best)
+        out.push_back(order[depth]);
+
+    return true;
+}
+
+bool parse_selection_algorithm(selection_algorithm& out,
+    const std::string& token)
+{
+    if (token == algorithm_exact)
+        out = selection_algorithm::exact;
+    else if (token == algorithm_fee)
+        out = selection_algorithm::fee;
+    else if (token == algorithm_largest)
+        out = selection_algorithm::largest;
+    else
+        return false;
+
+    return true;
+}
+
+bool select_outputs(unspent_list& out, const unspent_list& unspent,
+    uint64_t amount, selection_algorithm algorithm, uint64_t fee,
+    uint64_t tolerance)
+{
+    const auto fee_aware = (algorithm == selection_algorithm::fee);
+
+    // Fee-aware selection values each output net of the fee to spend it,
+    // which excludes outputs that would cost more to spend than they pay.
+    value_list values;
+    index_list candidates;
+    values.reserve(unspent.size());
+    candidates.reserve(unspent.size());
+    for (size_t index = 0; index < unspent.size(); ++index)
+    {
+        const auto value = unspent[index].value;
+        if (fee_aware && value <= fee)
+            continue;
+
+        values.push_back(fee_aware ? value - fee : value);
+        candidates.push_back(index);
+    }
+
+    index_list selected;
+    const auto search = (algorithm != selection_algorithm::largest);
+    if (!(search && exact(selected, values, amount, tolerance)) &&
+        !largest(selected, values, amount))
+        return false;
+
+    to_outputs(out, unspent, selected, candidates);
+    return true;
+}
+
+bool select_largest(unspent_list& out, const unspent_list& unspent,
+    uint64_t amount)
+{
+    return select_outputs(out, unspent, amount, selection_algorithm::largest);
+}
+
+bool select_exact(unspent_list& out, const unspent_list& unspent,
+    uint64_t amount, uint64_t tolerance)
+{
+    index_list selected;
+    const auto values = to_values(unspent);
+    if (!exact(selected, values, amount, tolerance))
+        return false;
+
+    index_list candidates(values.size());
+    for (size_t index = 0; index < candidates.size(); ++index)
+        candidates[index] = index;
+
+    to_outputs(out, unspent, selected, candidates);
+    return true;
+}
+
+} // namespace explorer
+} // namespace libbitcoin
@@ -20,10 +20,11 @@
 #include <bitcoin/explorer/commands/base64-decode.hpp>
 
 #include <iostream>
+#include <boost/format.hpp>
 #include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/base64_codec.hpp>
 #include <bitcoin/explorer/define.hpp>
-#include <bitcoin/explorer/primitives/base64.hpp>
-#include <bitcoin/explorer/primitives/raw.hpp>
+#include <bitcoin/explorer/mapped_file.hpp>
 
 using namespace bc;
 using namespace bc::explorer;
@@ -34,9 +35,38 @@ console_result base64_decode::invoke(std::ostream& output, std::ostream& error)
 {
     // Bound parameters.
     const auto& base64 = get_base64_argument();
+    const auto& file = get_file_option();
 
     // Do not add terminator to raw (non-textual) output stream.
-    output << raw(base64) /* << std::endl */;
+    base64_decoder decoder(output);
+    auto valid = true;
+
+    if (!file.empty())
+    {
+        const mapped_file mapped(file);
+        if (!mapped.valid())
+        {
+            error << format(BX_BASE64_DECODE_FILE_INVALID) % file <<
+                std::endl;
+            return console_result::failure;
+        }
+
+        valid = decoder.write(mapped.data());
+    }
+    else
+    {
+        valid = base64.read(stream_chunk_size, [&decoder](data_slice chunk)
+        {
+            return decoder.write(chunk);
+        });
+    }
+
+    // Decoded output preceding an invalid character has been written.
+    if (!valid || !decoder.finish())
+    {
+        error << BX_BASE64_DECODE_INVALID << std::endl;
+        return console_result::failure;
+    }
 
     return console_result::okay;
 }
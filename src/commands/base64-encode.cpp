@@ -20,9 +20,11 @@
 #include <bitcoin/explorer/commands/base64-encode.hpp>
 
 #include <iostream>
+#include <boost/format.hpp>
 #include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/base64_codec.hpp>
 #include <bitcoin/explorer/define.hpp>
-#include <bitcoin/explorer/primitives/base64.hpp>
+#include <bitcoin/explorer/mapped_file.hpp>
 
 using namespace bc;
 using namespace bc::explorer;
@@ -33,7 +35,32 @@ console_result base64_encode::invoke(std::ostream& output, std::ostream& error)
 {
     // Bound parameters.
     const auto& data = get_data_argument();
+    const auto& file = get_file_option();
 
-    output << base64(data) << std::endl;
+    base64_encoder encoder(output);
+
+    if (!file.empty())
+    {
+        const mapped_file mapped(file);
+        if (!mapped.valid())
+        {
+            error << format(BX_BASE64_ENCODE_FILE_INVALID) % file <<
+                std::endl;
+            return console_result::failure;
+        }
+
+        encoder.write(mapped.data());
+    }
+    else
+    {
+        data.read(stream_chunk_size, [&encoder](data_slice chunk)
+        {
+            encoder.write(chunk);
+            return true;
+        });
+    }
+
+    encoder.finish();
+    output << std::endl;
     return console_result::okay;
 }
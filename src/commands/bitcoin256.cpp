@@ -22,6 +22,7 @@
 #include <iostream>
 #include <bitcoin/bitcoin.hpp>
 #include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/hash_stream.hpp>
 
 using namespace bc;
 using namespace bc::config;
@@ -33,9 +34,15 @@ console_result bitcoin256::invoke(std::ostream& output, std::ostream& error)
 {
     // Bound parameters.
     const auto& data = get_base16_argument();
+    const auto& file = get_file_option();
+    const auto raw = get_raw_option();
 
-    const auto hash = bitcoin_hash(data);
+    sha256_hasher hasher;
+    if (!hash_input(hasher, data, file, raw, error, BX_BITCOIN256_FILE_INVALID,
+        BX_BITCOIN256_INVALID))
+        return console_result::failure;
 
+    const auto hash = sha256_hash(hasher.finish());
     output << btc256(hash) << std::endl;
     return console_result::okay;
 }
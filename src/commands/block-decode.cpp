@@ -0,0 +1,175 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/commands/block-decode.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/base16_codec.hpp>
+#include <bitcoin/explorer/block_parser.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/mapped_file.hpp>
+#include <bitcoin/explorer/primitives/header.hpp>
+#include <bitcoin/explorer/prop_fields.hpp>
+#include <bitcoin/explorer/prop_tree.hpp>
+#include <bitcoin/explorer/prop_writer.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+using namespace bc;
+using namespace bc::explorer;
+using namespace bc::explorer::commands;
+using namespace bc::explorer::primitives;
+
+// The number of transactions rendered in parallel before they are written.
+static const size_t render_window = 256;
+
+static bool is_text(data_slice data)
+{
+    return !data.empty() && (std::isxdigit(data[0]) != 0 ||
+        std::isspace(data[0]) != 0);
+}
+
+static console_result render(std::ostream& output, std::ostream& error,
+    data_slice data, encoding_engine encoding, const prop_fields& fields)
+{
+    chain::block block;
+    std::vector<data_slice> serialized;
+    const auto size = parse_block(block, serialized, data);
+    if (size == 0 || size != data.size())
+    {
+        error << BX_BLOCK_DECODE_INVALID << std::endl;
+        return console_result::failure;
+    }
+
+    // The transactions are hashed from the parsed data, and the merkle root
+    // is verified before anything is written.
+    const auto hashes = transaction_hashes(serialized);
+    if (merkle_root(hashes) != block.header.merkle)
+    {
+        error << BX_BLOCK_DECODE_MERKLE_MISMATCH << std::endl;
+        return console_result::failure;
+    }
+
+    prop_writer writer(output, encoding);
+    writer.begin("block");
+    writer.write("header", prop_list(header(block.header)));
+    writer.begin("transactions");
+
+    // Each window of transactions is rendered in parallel and then written
+    // in order, so that memory use is bounded by the window.
+    const auto& transactions = block.transactions;
+    std::vector<pt::ptree> trees;
+    for (size_t first = 0; first < transactions.size();
+        first += render_window)
+    {
+        const auto count = std::min(render_window,
+            transactions.size() - first);
+        trees.assign(count, pt::ptree());
+
+        const auto list = [&](size_t index)
+        {
+            const auto position = first + index;
+            trees[index] = prop_list(transactions[position],
+                hashes[position], fields);
+        };
+
+        parallel_for(count, list);
+        for (const auto& tree: trees)
+            writer.write("transaction", tree);
+    }
+
+    writer.end();
+    writer.end();
+    writer.finish();
+    return console_result::okay;
+}
+
+static console_result decode(std::ostream& output, std::ostream& error,
+    data_slice data, bool raw, encoding_engine encoding,
+    const prop_fields& fields)
+{
+    if (raw || !is_text(data))
+        return render(output, error, data, encoding, fields);
+
+    std::string text;
+    text.reserve(data.size());
+    const auto is_space = [](uint8_t byte)
+    {
+        return std::isspace(byte) != 0;
+    };
+
+    std::remove_copy_if(data.begin(), data.end(), std::back_inserter(text),
+        is_space);
+
+    data_chunk decoded;
+    if (!fast_decode_base16(decoded, text))
+    {
+        error << BX_BLOCK_DECODE_INVALID << std::endl;
+        return console_result::failure;
+    }
+
+    return render(output, error, decoded, encoding, fields);
+}
+
+console_result block_decode::invoke(std::ostream& output, std::ostream& error)
+{
+    // Bound parameters.
+    const auto& encoding = get_format_option();
+    const prop_fields fields(get_fields_option());
+    const auto& block = get_block_argument();
+    const auto& file = get_file_option();
+    const auto raw = get_raw_option();
+
+    for (const auto& path: fields.paths())
+    {
+        if (!is_transaction_field(path))
+        {
+            error << format(BX_BLOCK_DECODE_INVALID_FIELD) % path << std::endl;
+            return console_result::failure;
+        }
+    }
+
+    if (!file.empty())
+    {
+        const mapped_file mapped(file);
+        if (!mapped.valid())
+        {
+            error << format(BX_BLOCK_DECODE_FILE_INVALID) % file << std::endl;
+            return console_result::failure;
+        }
+
+        return decode(output, error, mapped.data(), raw, encoding, fields);
+    }
+
+    // A block is parsed as a whole, so the argument or STDIN is collected.
+    data_chunk data;
+    const auto append = [&data](data_slice chunk)
+    {
+        data.insert(data.end(), chunk.begin(), chunk.end());
+        return true;
+    };
+
+    block.read(stream_chunk_size, append);
+    return decode(output, error, data, raw, encoding, fields);
+}
@@ -0,0 +1,123 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/commands/ec-vanity.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/primitives/ec_private.hpp>
+#include <bitcoin/explorer/vanity_search.hpp>
+
+using namespace bc;
+using namespace bc::explorer;
+using namespace bc::explorer::commands;
+
+console_result ec_vanity::invoke(std::ostream& output, std::ostream& error)
+{
+    // Bound parameters.
+    const auto limit = get_limit_option();
+    const auto threads = get_threads_option();
+    const auto version = get_version_option();
+    const auto& prefix = get_prefix_argument();
+    const data_chunk& seed = get_seed_argument();
+
+    if (seed.size() < minimum_seed_size)
+    {
+        error << BX_EC_VANITY_SHORT_SEED << std::endl;
+        return console_result::failure;
+    }
+
+    if (prefix.empty() || !is_base58(prefix))
+    {
+        error << format(BX_EC_VANITY_INVALID_PREFIX) % prefix << std::endl;
+        return console_result::failure;
+    }
+
+    const vanity_prefix target(prefix, version);
+    if (target.ranges().empty())
+    {
+        error << format(BX_EC_VANITY_IMPOSSIBLE_PREFIX) % prefix << std::endl;
+        return console_result::failure;
+    }
+
+    error << format(BX_EC_VANITY_DIFFICULTY) % target.difficulty() <<
+        std::endl;
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto seconds = [&start]()
+    {
+        return std::chrono::duration_cast<std::chrono::duration<double>>(
+            std::chrono::steady_clock::now() - start).count();
+    };
+
+    const auto write_rate = [&error](uint64_t keys, double elapsed)
+    {
+        const auto rate = elapsed > 0 ? keys / elapsed : 0.0;
+        error << format(BX_EC_VANITY_RATE) % keys % elapsed % rate <<
+            std::endl;
+    };
+
+    // The progress of a long search is written about once a second.
+    double reported = 0;
+    const auto progress = [&](uint64_t keys)
+    {
+        const auto elapsed = seconds();
+        if (elapsed - reported < 1)
+            return;
+
+        reported = elapsed;
+        write_rate(keys, elapsed);
+    };
+
+    ec_secret secret;
+    uint64_t keys;
+    const auto found = vanity_search(secret, keys, target, seed, threads,
+        limit, progress);
+    write_rate(keys, seconds());
+
+    if (!found && limit != 0 && keys >= limit)
+    {
+        error << format(BX_EC_VANITY_LIMIT) % limit << std::endl;
+        return console_result::failure;
+    }
+
+    // The search only ends otherwise without a key if every start key is
+    // invalid.
+    if (!found)
+    {
+        error << BX_EC_VANITY_NOT_FOUND << std::endl;
+        return console_result::failure;
+    }
+
+    ec_compressed point;
+    if (!secret_to_public(point, secret))
+    {
+        error << BX_EC_VANITY_NOT_FOUND << std::endl;
+        return console_result::failure;
+    }
+
+    // We don't use bc::ec_private serialization (WIF) here.
+    output << primitives::ec_private(secret) << std::endl;
+    output << wallet::payment_address(wallet::ec_public(point), version) <<
+        std::endl;
+    return console_result::okay;
+}
@@ -23,11 +23,14 @@
 #include <iostream>
 #include <bitcoin/bitcoin.hpp>
 #include <bitcoin/client.hpp>
+#include <bitcoin/explorer/address_index.hpp>
 #include <bitcoin/explorer/callback_state.hpp>
 #include <bitcoin/explorer/define.hpp>
 #include <bitcoin/explorer/display.hpp>
 #include <bitcoin/explorer/obelisk_client.hpp>
 #include <bitcoin/explorer/prop_tree.hpp>
+#include <bitcoin/explorer/utility.hpp>
+#include <bitcoin/explorer/utxo_set.hpp>
 
 using namespace bc;
 using namespace bc::client;
@@ -40,6 +43,63 @@ console_result fetch_balance::invoke(std::ostream& output, std::ostream& error)
     // Bound parameters.
     const auto& encoding = get_format_option();
     const auto& address = get_payment_address_argument();
+    const auto& local_index = get_local_index_option();
+    const auto& snapshot_file = get_snapshot_option();
+
+    if (!snapshot_file.empty() && !local_index.empty())
+    {
+        error << BX_FETCH_BALANCE_SNAPSHOT_AND_INDEX << std::endl;
+        return console_result::failure;
+    }
+
+    if (!snapshot_file.empty())
+    {
+        const utxo_set snapshot(snapshot_file);
+        if (!snapshot.valid())
+        {
+            error << format(BX_FETCH_BALANCE_SNAPSHOT_INVALID) %
+                snapshot_file << std::endl;
+            return console_result::failure;
+        }
+
+        // The snapshot outputs are the confirmed unspent rows of the history.
+        client::history_list rows;
+        for (const auto& entry: snapshot.unspent(address.hash()))
+        {
+            client::history_row row;
+            row.output = entry.point;
+            row.output_height = entry.height;
+            row.value = entry.value;
+            row.spend.hash = null_hash;
+            row.spend.index = max_uint32;
+            row.spend_height = 0;
+            rows.push_back(row);
+        }
+
+        // The spent outputs are not in the snapshot, so the received value
+        // is not known.
+        auto tree = prop_tree(rows, address, true);
+        tree.get_child("balance").erase("received");
+        write_stream(output, tree, encoding);
+        return console_result::okay;
+    }
+
+    if (!local_index.empty())
+    {
+        const address_index index(local_index);
+        if (!index.valid())
+        {
+            error << format(BX_FETCH_BALANCE_INDEX_INVALID) % local_index <<
+                std::endl;
+            return console_result::failure;
+        }
+
+        // The transfers of the index are confirmed.
+        const auto rows = index.history(address.hash());
+        write_stream(output, prop_tree(rows, address, true), encoding);
+        return console_result::okay;
+    }
+
     const auto connection = get_connection(*this);
 
     obelisk_client client(connection);
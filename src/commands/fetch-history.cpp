@@ -22,11 +22,13 @@
 
 #include <iostream>
 #include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/address_index.hpp>
 #include <bitcoin/explorer/callback_state.hpp>
 #include <bitcoin/explorer/define.hpp>
 #include <bitcoin/explorer/display.hpp>
 #include <bitcoin/explorer/obelisk_client.hpp>
 #include <bitcoin/explorer/prop_tree.hpp>
+#include <bitcoin/explorer/prop_writer.hpp>
 
 using namespace bc;
 using namespace bc::client;
@@ -46,6 +48,25 @@ console_result fetch_history::invoke(std::ostream& output, std::ostream& error)
     // Bound parameters.
     const auto& encoding = get_format_option();
     const auto& address = get_payment_address_argument();
+    const auto& local_index = get_local_index_option();
+
+    if (!local_index.empty())
+    {
+        const address_index index(local_index);
+        if (!index.valid())
+        {
+            error << format(BX_FETCH_HISTORY_INDEX_INVALID) % local_index <<
+                std::endl;
+            return console_result::failure;
+        }
+
+        // The transfers of the index are confirmed.
+        prop_writer writer(output, encoding);
+        prop_write(writer, index.history(address.hash()), true);
+        writer.finish();
+        return console_result::okay;
+    }
+
     const auto connection = get_connection(*this);
 
     obelisk_client client(connection);
@@ -56,11 +77,14 @@ console_result fetch_history::invoke(std::ostream& output, std::ostream& error)
         return console_result::failure;
     }
 
-    callback_state state(error, output, encoding);
+    callback_state state(error, output, encoding, flush_policy::interval);
 
     auto on_done = [&state, &address](const client::history_list& rows)
     {
-        state.output(prop_tree(rows));
+        state.output([&rows](prop_writer& writer)
+        {
+            prop_write(writer, rows);
+        });
     };
 
     auto on_error = [&state](const code& error)
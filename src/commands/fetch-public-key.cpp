@@ -20,8 +20,12 @@
 
 #include <bitcoin/explorer/commands/fetch-public-key.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <functional>
 #include <iostream>
 #include <bitcoin/bitcoin.hpp>
+#include <bitcoin/client.hpp>
 #include <bitcoin/explorer/callback_state.hpp>
 #include <bitcoin/explorer/define.hpp>
 #include <bitcoin/explorer/display.hpp>
@@ -31,43 +35,148 @@ using namespace bc;
 using namespace bc::client;
 using namespace bc::explorer;
 using namespace bc::explorer::commands;
+using namespace bc::wallet;
 
-console_result fetch_public_key::invoke(std::ostream& output, std::ostream& error)
+// The push must parse as a point, not only hash to the address.
+static bool is_valid_point(const data_chunk& data)
 {
-    //// Bound parameters.
-    //const auto& address = get_payment_address_argument();
-    //const auto retries = get_general_retries_setting();
-    //const auto timeout = get_general_wait_setting();
-    //const auto& server = get_general_network_setting() == BX_TESTNET ?
-    //    get_testnet_url_setting() : get_mainnet_url_setting());
-
-    //czmqpp::context context;
-    //obelisk_client client(context, period_ms(timeout), retries);
-
-    //if (client.connect(server))
-    //{
-    //    display_connection_failure(error, server);
-    //    return console_result::failure;
-    //}
-
-    //callback_state state(error, output);
-
-    //auto on_done = [&state, &address](const client::history_list& rows)
-    //{
-    //    // TODO: get first rows tx where it (spend.hash) is not null.
-    //    // TODO: convert tx to pubkey and then stop.
-    //};
-
-    //auto on_error = [&state](const std::error_code& error)
-    //{
-    //    state.succeeded(error);
-    //};
-
-    //client.get_codec()->address_fetch_history(on_error, on_done, address);
-    //client.resolve_callbacks();
-
-    //return state.get_result();
-
-    error << BX_FETCH_PUBLIC_KEY_NOT_IMPLEMENTED << std::endl;
-    return console_result::failure;
+    if (is_compressed_key(data))
+    {
+        ec_uncompressed point;
+        return decompress(point, to_array<ec_compressed_size>(data));
+    }
+
+    if (is_uncompressed_key(data))
+    {
+        ec_compressed point;
+        return compress(point, to_array<ec_uncompressed_size>(data));
+    }
+
+    return false;
+}
+
+// Whatever the script form, the public key of a key hash spend is its last
+// push, which is confirmed by hashing it to the address.
+static bool extract_public_key(data_chunk& out, const tx_type& tx,
+    const chain::output_point& spent, const short_hash& key_hash)
+{
+    for (const auto& input: tx.inputs)
+    {
+        if (!(input.previous_output == spent))
+            continue;
+
+        const auto& operations = input.script.operations;
+        if (operations.empty())
+            return false;
+
+        const auto& data = operations.back().data;
+        if (bitcoin_short_hash(data) != key_hash || !is_valid_point(data))
+            return false;
+
+        out = data;
+        return true;
+    }
+
+    return false;
+}
+
+// Only one spending transaction is fetched at a time, earliest spend first,
+// and the next is fetched only if a spend does not reveal the key.
+console_result fetch_public_key::invoke(std::ostream& output,
+    std::ostream& error)
+{
+    // Bound parameters.
+    const auto& address = get_payment_address_argument();
+    const auto connection = get_connection(*this);
+
+    // The last push of a script hash spend is the redeem script.
+    const auto version = address.version();
+    if (version != payment_address::mainnet_p2kh &&
+        version != payment_address::testnet_p2kh)
+    {
+        error << BX_FETCH_PUBLIC_KEY_INVALID_ADDRESS << std::endl;
+        return console_result::failure;
+    }
+
+    data_chunk public_key;
+
+    // The state must outlive the client, which may hold abandoned calls.
+    callback_state state(error, output);
+    obelisk_client client(connection);
+
+    if (!client.connect(connection))
+    {
+        display_connection_failure(error, connection.server);
+        return console_result::failure;
+    }
+
+    auto found = false;
+    size_t next = 0;
+    client::history_list spends;
+    std::function<void()> fetch_next;
+    const auto codec = client.get_codec();
+
+    auto on_error = [&state](const code& error)
+    {
+        state.succeeded(error);
+    };
+
+    auto on_tx = [&](const tx_type& tx)
+    {
+        const auto& spend = spends[next - 1];
+        found = extract_public_key(public_key, tx, spend.output,
+            address.hash());
+
+        if (!found)
+            fetch_next();
+    };
+
+    fetch_next = [&]()
+    {
+        if (next == spends.size())
+            return;
+
+        // Missing spend height implies spend unconfirmed (in the pool).
+        const auto& spend = spends[next++];
+        if (spend.spend_height == 0)
+            codec->fetch_unconfirmed_transaction(on_error, on_tx,
+                spend.spend.hash);
+        else
+            codec->fetch_transaction(on_error, on_tx, spend.spend.hash);
+    };
+
+    auto on_history = [&](const client::history_list& rows)
+    {
+        for (const auto& row: rows)
+            if (row.spend.hash != null_hash)
+                spends.push_back(row);
+
+        // Confirmed spends in height order, then unconfirmed spends.
+        const auto earlier = [](const history_row& left,
+            const history_row& right)
+        {
+            return left.spend_height != 0 && (right.spend_height == 0 ||
+                left.spend_height < right.spend_height);
+        };
+
+        std::stable_sort(spends.begin(), spends.end(), earlier);
+        fetch_next();
+    };
+
+    codec->address_fetch_history(on_error, on_history, address);
+
+    // Anything still in flight once the key is found is abandoned.
+    client.resolve_callbacks([&found]() { return found; });
+
+    if (state.get_result() != console_result::okay)
+        return state.get_result();
+
+    if (!found)
+    {
+        error << BX_FETCH_PUBLIC_KEY_NOT_FOUND << std::endl;
+        return console_result::failure;
+    }
+
+    output << ec_public(public_key) << std::endl;
+    return console_result::okay;
 }
@@ -20,7 +20,9 @@
 
 #include <bitcoin/explorer/commands/fetch-stealth.hpp>
 
+#include <cstdint>
 #include <iostream>
+#include <vector>
 #include <bitcoin/bitcoin.hpp>
 #include <bitcoin/client.hpp>
 #include <bitcoin/explorer/callback_state.hpp>
@@ -28,6 +30,8 @@
 #include <bitcoin/explorer/display.hpp>
 #include <bitcoin/explorer/obelisk_client.hpp>
 #include <bitcoin/explorer/prop_tree.hpp>
+#include <bitcoin/explorer/prop_writer.hpp>
+#include <bitcoin/explorer/utility.hpp>
 
 using namespace bc;
 using namespace bc::client;
@@ -36,14 +40,46 @@ using namespace bc::explorer::commands;
 using namespace bc::explorer::primitives;
 using namespace bc::wallet;
 
+// The EC operations dominate, so the rows are confirmed in contiguous batches
+// across threads, and the matching rows are then collected in server order.
+static client::stealth_list confirm_stealth(const client::stealth_list& rows,
+    const ec_secret& scan_secret, const ec_compressed& spend_pubkey)
+{
+    std::vector<uint8_t> matches(rows.size(), 0);
+    auto confirm = [&](size_t index)
+    {
+        matches[index] = confirm_stealth(rows[index], scan_secret,
+            spend_pubkey) ? 1 : 0;
+    };
+
+    parallel_for(rows.size(), confirm);
+
+    client::stealth_list confirmed;
+    for (size_t index = 0; index < rows.size(); ++index)
+        if (matches[index] != 0)
+            confirmed.push_back(rows[index]);
+
+    return confirmed;
+}
+
 console_result fetch_stealth::invoke(std::ostream& output, std::ostream& error)
 {
     // Bound parameters.
     const auto height = get_height_option();
     const auto& encoding = get_format_option();
+    const ec_secret& scan_secret = get_scan_secret_option();
+    const auto& spend_pubkey = get_spend_pubkey_option();
     const auto& filter = get_filter_argument();
     const auto connection = get_connection(*this);
 
+    const auto have_secret = scan_secret != null_hash;
+    const auto have_pubkey = static_cast<bool>(spend_pubkey);
+    if (have_secret != have_pubkey)
+    {
+        error << BX_FETCH_STEALTH_CONFIRMATION_KEYS << std::endl;
+        return console_result::failure;
+    }
+
     obelisk_client client(connection);
 
     if (!client.connect(connection))
@@ -58,12 +94,27 @@ console_result fetch_stealth::invoke(std::ostream& output, std::ostream& error)
         return console_result::failure;
     }
 
-    callback_state state(error, output, encoding);
+    callback_state state(error, output, encoding, flush_policy::interval);
 
-    auto on_done = [&state, &filter](const client::stealth_list& list)
+    auto on_done = [&state, &scan_secret, &spend_pubkey, have_secret](
+        const client::stealth_list& list)
     {
-        // Write out the transaction hashes of *potential* matches.
-        state.output(prop_tree(list));
+        // Without the scan secret we can only write out *potential* matches.
+        if (!have_secret)
+        {
+            state.output([&list](prop_writer& writer)
+            {
+                prop_write(writer, list);
+            });
+            return;
+        }
+
+        const auto& spend_point = spend_pubkey.point();
+        const auto matches = confirm_stealth(list, scan_secret, spend_point);
+        state.output([&matches](prop_writer& writer)
+        {
+            prop_write(writer, matches);
+        });
     };
 
     auto on_error = [&state](const std::error_code& error)
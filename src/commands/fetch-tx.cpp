@@ -27,6 +27,7 @@
 #include <bitcoin/explorer/display.hpp>
 #include <bitcoin/explorer/obelisk_client.hpp>
 #include <bitcoin/explorer/primitives/transaction.hpp>
+#include <bitcoin/explorer/prop_fields.hpp>
 #include <bitcoin/explorer/prop_tree.hpp>
 #include <bitcoin/explorer/utility.hpp>
 
@@ -40,9 +41,19 @@ console_result fetch_tx::invoke(std::ostream& output, std::ostream& error)
 {
     // Bound parameters.
     const auto& encoding = get_format_option();
+    const prop_fields fields(get_fields_option());
     const auto& hash = get_hash_argument();
     const auto connection = get_connection(*this);
 
+    for (const auto& path: fields.paths())
+    {
+        if (!is_transaction_field(path))
+        {
+            error << format(BX_FETCH_TX_INVALID_FIELD) % path << std::endl;
+            return console_result::failure;
+        }
+    }
+
     obelisk_client client(connection);
 
     if (!client.connect(connection))
@@ -53,9 +64,9 @@ console_result fetch_tx::invoke(std::ostream& output, std::ostream& error)
 
     callback_state state(error, output, encoding);
 
-    auto on_done = [&state](const tx_type& tx)
+    auto on_done = [&state, &fields](const tx_type& tx)
     {
-        state.output(prop_tree(tx));
+        state.output(prop_tree(tx, fields));
     };
 
     auto on_error = [&state](const code& error)
@@ -20,67 +20,118 @@
 
 #include <bitcoin/explorer/commands/fetch-utxo.hpp>
 
+#include <cstdint>
 #include <iostream>
+#include <set>
+#include <string>
 #include <bitcoin/bitcoin.hpp>
+#include <bitcoin/client.hpp>
+#include <bitcoin/explorer/callback_state.hpp>
+#include <bitcoin/explorer/coin_selection.hpp>
 #include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/display.hpp>
+#include <bitcoin/explorer/obelisk_client.hpp>
+#include <bitcoin/explorer/primitives/point.hpp>
+#include <bitcoin/explorer/utxo_set.hpp>
 
 using namespace bc;
+using namespace bc::client;
 using namespace bc::explorer;
 using namespace bc::explorer::commands;
+using namespace bc::explorer::primitives;
 
 console_result fetch_utxo::invoke(std::ostream& output, std::ostream& error)
 {
     // Bound parameters.
-    //const auto satoshi = get_satoshi_argument();
-    //const auto& addresses = get_bitcoin_addresss_argument();
-    //const auto& encoding = get_format_option();
+    const auto satoshi = get_satoshi_argument();
+    const auto& addresses = get_payment_addresss_argument();
+    const auto& algorithm_name = get_algorithm_option();
+    const auto fee = get_fee_option();
+    const auto tolerance = get_tolerance_option();
+    const auto& snapshot_file = get_snapshot_option();
 
-    error << BX_FETCH_UTXO_NOT_IMPLEMENTED << std::endl;
-    return console_result::failure;
-}
+    selection_algorithm algorithm;
+    if (!parse_selection_algorithm(algorithm, algorithm_name))
+    {
+        error << BX_FETCH_UTXO_INVALID_ALGORITHM << std::endl;
+        return console_result::failure;
+    }
+
+    unspent_list unspent;
+
+    if (!snapshot_file.empty())
+    {
+        const utxo_set snapshot(snapshot_file);
+        if (!snapshot.valid())
+        {
+            error << format(BX_FETCH_UTXO_SNAPSHOT_INVALID) % snapshot_file <<
+                std::endl;
+            return console_result::failure;
+        }
+
+        // Repeated addresses would otherwise select the same output twice.
+        std::set<short_hash> requested;
+        for (const auto& address: addresses)
+            if (requested.insert(address.hash()).second)
+                for (const auto& entry: snapshot.unspent(address.hash()))
+                    unspent.push_back({ entry.point, entry.value });
+    }
+    else
+    {
+        const auto connection = get_connection(*this);
+
+        obelisk_client client(connection);
+
+        if (!client.connect(connection))
+        {
+            display_connection_failure(error, connection.server);
+            return console_result::failure;
+        }
+
+        callback_state state(error, output);
+
+        // Missing spend implies unspent (or spend unconfirmed).
+        auto on_done = [&unspent](const client::history_list& rows)
+        {
+            for (const auto& row: rows)
+                if (row.spend.hash == null_hash)
+                    unspent.push_back({ row.output, row.value });
+        };
 
-//#!/usr/bin/python
-//import sys, re, json, os
-//
-//lines = os.popen('sx history '+' '.join(sys.argv[1:-1])).readlines()
-//
-//# Convert to float or int if possible, otherwise leave as string
-//def attempt_num(x):
-//    if re.match('^(-|)[0-9]*(|\.[0-9]*)$',x): return float(x) if '.' in x else int(x)
-//    else: return x
-//
-//# Create objects
-//txo = []
-//obj = {}
-//for i in range(len(lines)):
-//    indent = len(re.match('^ *',lines[i]).group(0))
-//    fields = [x for x in lines[i].strip().split(' ') if x]
-//    if len(fields) < 2:
-//        continue
-//    if indent == 0:
-//        if obj: txo.append(obj)
-//        obj = {}
-//    obj[fields[0][:-1]] = attempt_num(fields[1])
-//    obj["$txt"] = obj.get("$txt","") + lines[i]
-//
-//if obj: txo.append(obj)
-//
-//utxo = [x for x in txo if x["spend"] == "Unspent"]
-//
-//val = int(sys.argv[-1])
-//
-//high = sorted([x for x in utxo if x["value"] >= val], key=lambda x: x["value"])
-//low = sorted([x for x in utxo if x["value"] < val], key=lambda x: -x["value"])
-//
-//if len(high) > 0:
-//    # Look for a single utxo to pay for the whole transaction if possible
-//    print high[0]["$txt"]
-//else:
-//    # Go through smaller outputs highest to lowest
-//    tot,ans = 0,[]
-//    for txo in low:
-//        ans.append(txo)
-//        tot += txo["value"]
-//        if tot >= val: break
-//    if tot < val: print "Not enough UTXO; only accumulated %d out of %d" % (tot,val)
-//    else: print '\n\n'.join([x["$txt"] for x in ans])
+        auto on_error = [&state](const code& error)
+        {
+            state.succeeded(error);
+        };
+
+        // All requests are outstanding at once, so a large address set costs
+        // one round trip rather than one per address. Repeated addresses
+        // would otherwise select the same output twice.
+        std::set<std::string> requested;
+        for (const auto& address: addresses)
+            if (requested.insert(address.encoded()).second)
+                client.get_codec()->address_fetch_history(on_error, on_done,
+                    address);
+
+        client.resolve_callbacks();
+
+        if (state.get_result() != console_result::okay)
+            return state.get_result();
+    }
+
+    unspent_list selected;
+    if (!select_outputs(selected, unspent, satoshi, algorithm, fee, tolerance))
+    {
+        uint64_t available = 0;
+        for (const auto& coin: unspent)
+            available += coin.value;
+
+        error << format(BX_FETCH_UTXO_INSUFFICIENT_FUNDS) % satoshi %
+            available << std::endl;
+        return console_result::failure;
+    }
+
+    for (const auto& coin: selected)
+        output << point(coin.point) << std::endl;
+
+    return console_result::okay;
+}
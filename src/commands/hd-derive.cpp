@@ -0,0 +1,431 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/commands/hd-derive.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/hd_batch.hpp>
+#include <bitcoin/explorer/primitives/hd_path.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+using namespace bc;
+using namespace bc::explorer;
+using namespace bc::explorer::commands;
+
+// The number of leaf keys evaluated as one line of parallel_write, which is
+// also the size of a batch of public derivation.
+static const size_t segment_size = 256;
+
+// The number of segments of each thread held for output at once.
+static const size_t thread_segments = 4;
+
+enum class key_type
+{
+    xprv,
+    xpub,
+    ec,
+    wif,
+    address
+};
+
+struct key_encoding
+{
+    key_type type;
+    uint8_t version;
+    uint8_t wif_version;
+};
+
+template <typename Key>
+struct hd_node
+{
+    Key key;
+    std::string path;
+};
+
+// A run of consecutive leaf indexes of one parent.
+struct leaf_segment
+{
+    size_t node;
+    uint32_t first;
+    uint32_t count;
+    bool batched;
+};
+
+static bool parse_key_type(key_type& out, const std::string& token)
+{
+    if (token == "xprv")
+        out = key_type::xprv;
+    else if (token == "xpub")
+        out = key_type::xpub;
+    else if (token == "ec")
+        out = key_type::ec;
+    else if (token == "wif")
+        out = key_type::wif;
+    else if (token == "address")
+        out = key_type::address;
+    else
+        return false;
+
+    return true;
+}
+
+static std::string to_path(const std::string& parent, uint32_t position)
+{
+    const auto hard = position >= bc::wallet::hd_first_hardened_key;
+    const auto index = hard ? position - bc::wallet::hd_first_hardened_key :
+        position;
+    return parent + "/" + std::to_string(index) + (hard ? "h" : "");
+}
+
+static bc::wallet::hd_private derive_child(
+    const bc::wallet::hd_private& key, uint32_t position)
+{
+    return key.derive_private(position);
+}
+
+static bc::wallet::hd_public derive_child(const bc::wallet::hd_public& key,
+    uint32_t position)
+{
+    return key.derive_public(position);
+}
+
+static bc::wallet::hd_public to_public(const bc::wallet::hd_private& key)
+{
+    return key.to_public();
+}
+
+static bc::wallet::hd_public to_public(const bc::wallet::hd_public& key)
+{
+    return key;
+}
+
+// True if the keys written from a parent depend only on its public key, so
+// that its non-hardened children may be derived by hd_public_batch.
+static bool public_encoding(const bc::wallet::hd_private&, key_type type)
+{
+    return type == key_type::xpub || type == key_type::address;
+}
+
+static bool public_encoding(const bc::wallet::hd_public&, key_type)
+{
+    return true;
+}
+
+static std::string encode_key(const bc::wallet::hd_private& key,
+    const key_encoding& encoding)
+{
+    switch (encoding.type)
+    {
+        case key_type::xprv:
+            return key.encoded();
+        case key_type::xpub:
+            return key.to_public().encoded();
+        case key_type::ec:
+            return encode_base16(key.secret());
+        case key_type::wif:
+            return bc::wallet::ec_private(key.secret(),
+                bc::wallet::ec_private::to_version(encoding.version,
+                    encoding.wif_version)).encoded();
+        case key_type::address:
+        default:
+            return bc::wallet::payment_address(
+                bc::wallet::ec_public(key.point()), encoding.version).encoded();
+    }
+}
+
+// Private key types are rejected before a public parent is derived.
+static std::string encode_key(const bc::wallet::hd_public& key,
+    const key_encoding& encoding)
+{
+    switch (encoding.type)
+    {
+        case key_type::xpub:
+            return key.encoded();
+        case key_type::ec:
+            return bc::wallet::ec_public(key.point()).encoded();
+        case key_type::address:
+            return bc::wallet::payment_address(
+                bc::wallet::ec_public(key.point()), encoding.version).encoded();
+        default:
+            return "";
+    }
+}
+
+static std::string encode_child(const hd_public_batch& batch,
+    const hd_public_child& child, const key_encoding& encoding)
+{
+    switch (encoding.type)
+    {
+        case key_type::xpub:
+            return batch.encoded(child);
+        case key_type::ec:
+            return bc::wallet::ec_public(child.point).encoded();
+        case key_type::address:
+        default:
+            return batch.address(child, encoding.version);
+    }
+}
+
+static void append_line(std::string& out, const std::string& line)
+{
+    if (!out.empty())
+        out += "\n";
+
+    out += line;
+}
+
+// Replace each node with its children at the level, in path order. Each
+// node is derived once for all of its descendants, across threads.
+template <typename Key>
+static bool expand(std::vector<hd_node<Key>>& nodes, std::string& failed,
+    const primitives::hd_path::level& level)
+{
+    std::vector<uint32_t> positions;
+    for (const auto& range: level)
+        for (uint32_t offset = 0; offset < range.count(); ++offset)
+            positions.push_back(range.first() + offset);
+
+    const auto width = positions.size();
+    std::vector<hd_node<Key>> children(nodes.size() * width);
+    std::vector<uint8_t> valid(children.size(), 0);
+
+    const auto derive = [&](size_t index)
+    {
+        const auto& parent = nodes[index / width];
+        const auto position = positions[index % width];
+        auto& child = children[index];
+        child.key = derive_child(parent.key, position);
+        child.path = to_path(parent.path, position);
+        valid[index] = child.key ? 1 : 0;
+    };
+
+    parallel_for(children.size(), derive);
+
+    for (size_t index = 0; index < children.size(); ++index)
+    {
+        if (valid[index] == 0)
+        {
+            failed = children[index].path;
+            return false;
+        }
+    }
+
+    nodes.swap(children);
+    return true;
+}
+
+// The leaves of all parents are divided into segments that are evaluated
+// across threads and written in path order.
+template <typename Key>
+static console_result derive_leaves(std::ostream& output,
+    std::ostream& error, const std::vector<hd_node<Key>>& nodes,
+    const primitives::hd_path::level& level, const key_encoding& encoding)
+{
+    const auto batchable = public_encoding(nodes.front().key, encoding.type);
+
+    std::vector<leaf_segment> segments;
+    for (size_t node = 0; node < nodes.size(); ++node)
+    {
+        for (const auto& range: level)
+        {
+            for (uint32_t offset = 0; offset < range.count();
+                offset += segment_size)
+            {
+                const auto count = std::min<uint32_t>(segment_size,
+                    range.count() - offset);
+                segments.push_back({ node, range.first() + offset, count,
+                    batchable && !range.hard() });
+            }
+        }
+    }
+
+    // The HMAC midstates and fingerprint of each parent are computed once.
+    std::vector<hd_public_batch> batches;
+    const auto batched = [](const leaf_segment& segment)
+    {
+        return segment.batched;
+    };
+
+    if (std::any_of(segments.begin(), segments.end(), batched))
+    {
+        batches.reserve(nodes.size());
+        for (const auto& node: nodes)
+            batches.emplace_back(to_public(node.key));
+    }
+
+    // Returns the number of leading valid keys, with a line for each.
+    const auto evaluate = [&](const leaf_segment& segment, std::string& out)
+    {
+        out.clear();
+        size_t valid = 0;
+
+        if (segment.batched)
+        {
+            const auto& batch = batches[segment.node];
+            std::vector<hd_public_child> children;
+            batch.derive(children, segment.first, segment.count);
+
+            for (const auto& child: children)
+            {
+                if (!child.valid)
+                    break;
+
+                append_line(out, encode_child(batch, child, encoding));
+                ++valid;
+            }
+
+            return valid;
+        }
+
+        const auto& parent = nodes[segment.node].key;
+        for (uint32_t offset = 0; offset < segment.count; ++offset)
+        {
+            const auto child = derive_child(parent, segment.first + offset);
+            if (!child)
+                break;
+
+            append_line(out, encode_key(child, encoding));
+            ++valid;
+        }
+
+        return valid;
+    };
+
+    const auto write = [&](size_t index, std::string& out)
+    {
+        return evaluate(segments[index], out) == segments[index].count;
+    };
+
+    const size_t threads = std::max(std::thread::hardware_concurrency(), 1u);
+    const auto written = parallel_write(output, segments.size(), write,
+        threads * thread_segments);
+
+    if (written == segments.size())
+        return console_result::okay;
+
+    // Write the keys that precede the invalid key and report its path.
+    const auto& segment = segments[written];
+    std::string lines;
+    const auto valid = evaluate(segment, lines);
+    if (!lines.empty())
+        output << lines << std::endl;
+
+    const auto position = static_cast<uint32_t>(segment.first + valid);
+    error << format(BX_HD_DERIVE_INVALID_CHILD) %
+        to_path(nodes[segment.node].path, position) << std::endl;
+    return console_result::failure;
+}
+
+template <typename Key>
+static console_result derive_path(std::ostream& output, std::ostream& error,
+    const Key& key, const primitives::hd_path& path,
+    const key_encoding& encoding)
+{
+    const auto& levels = path.levels();
+    if (levels.empty())
+    {
+        output << encode_key(key, encoding) << std::endl;
+        return console_result::okay;
+    }
+
+    std::vector<hd_node<Key>> nodes{ { key, "m" } };
+    for (size_t depth = 0; depth + 1 < levels.size(); ++depth)
+    {
+        std::string failed;
+        if (!expand(nodes, failed, levels[depth]))
+        {
+            error << format(BX_HD_DERIVE_INVALID_CHILD) % failed << std::endl;
+            return console_result::failure;
+        }
+    }
+
+    return derive_leaves(output, error, nodes, levels.back(), encoding);
+}
+
+console_result hd_derive::invoke(std::ostream& output, std::ostream& error)
+{
+    // Bound parameters.
+    const auto& key_name = get_key_option();
+    const auto version = get_version_option();
+    const auto wif_version = get_wif_version_option();
+    const auto private_version = get_secret_version_option();
+    const auto public_version = get_public_version_option();
+    const auto& path = get_path_argument();
+    const auto& key = get_hd_key_argument();
+
+    key_encoding encoding{ key_type::xpub, version, wif_version };
+    if (!parse_key_type(encoding.type, key_name))
+    {
+        error << format(BX_HD_DERIVE_INVALID_KEY_TYPE) % key_name <<
+            std::endl;
+        return console_result::failure;
+    }
+
+    const auto key_version = key.version();
+    if (key_version == private_version)
+    {
+        const auto prefixes = bc::wallet::hd_private::to_prefixes(key_version,
+            public_version);
+
+        const bc::wallet::hd_private private_key(key, prefixes);
+        if (!private_key)
+        {
+            error << BX_HD_DERIVE_INVALID_KEY << std::endl;
+            return console_result::failure;
+        }
+
+        return derive_path(output, error, private_key, path, encoding);
+    }
+
+    if (key_version != public_version)
+    {
+        error << BX_HD_DERIVE_INVALID_KEY << std::endl;
+        return console_result::failure;
+    }
+
+    if (path.hard())
+    {
+        error << BX_HD_DERIVE_HARD_PATH_CONFLICT << std::endl;
+        return console_result::failure;
+    }
+
+    if (encoding.type == key_type::xprv || encoding.type == key_type::wif)
+    {
+        error << format(BX_HD_DERIVE_PRIVATE_KEY_CONFLICT) % key_name <<
+            std::endl;
+        return console_result::failure;
+    }
+
+    const bc::wallet::hd_public public_key(key, public_version);
+    if (!public_key)
+    {
+        error << BX_HD_DERIVE_INVALID_KEY << std::endl;
+        return console_result::failure;
+    }
+
+    return derive_path(output, error, public_key, path, encoding);
+}
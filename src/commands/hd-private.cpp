@@ -19,9 +19,13 @@
  */
 #include <bitcoin/explorer/commands/hd-private.hpp>
 
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
+#include <string>
 #include <bitcoin/bitcoin.hpp>
 #include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/utility.hpp>
 
 using namespace bc;
 using namespace bc::explorer;
@@ -32,8 +36,36 @@ console_result hd_private::invoke(std::ostream& output, std::ostream& error)
     // Bound parameters.
     const auto hard = get_hard_option();
     const auto index = get_index_option();
+    const auto& range = get_range_option();
     const auto& private_key = get_hd_private_key_argument();
-    
+
+    // The parent is parsed once and the children are derived across threads.
+    if (range.count() != 0)
+    {
+        const auto first = range.first();
+        const auto derive = [&private_key, first](size_t offset,
+            std::string& out)
+        {
+            const auto position = static_cast<uint32_t>(first + offset);
+            const auto child_private_key = private_key.derive_private(position);
+            if (!child_private_key)
+                return false;
+
+            out = child_private_key.encoded();
+            return true;
+        };
+
+        const auto derived = parallel_write(output, range.count(), derive);
+        if (derived != range.count())
+        {
+            error << format(BX_HD_PRIVATE_INVALID_CHILD) % (first + derived) <<
+                std::endl;
+            return console_result::failure;
+        }
+
+        return console_result::okay;
+    }
+
     static constexpr auto first = bc::wallet::hd_first_hardened_key;
     const auto position = hard ? first + index : index;
     const auto child_private_key = private_key.derive_private(position);
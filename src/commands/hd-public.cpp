@@ -19,19 +19,77 @@
  */
 #include <bitcoin/explorer/commands/hd-public.hpp>
 
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
+#include <string>
 #include <bitcoin/bitcoin.hpp>
 #include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/hd_batch.hpp>
+#include <bitcoin/explorer/utility.hpp>
 
 using namespace bc;
 using namespace bc::explorer;
 using namespace bc::explorer::commands;
 
+// Hardened children require the private parent and are derived one at a
+// time, across threads.
+static console_result derive_range(std::ostream& output, std::ostream& error,
+    const bc::wallet::hd_private& key, const primitives::index_range& range)
+{
+    const auto first = range.first();
+    const auto derive = [&key, first](size_t offset, std::string& out)
+    {
+        const auto position = static_cast<uint32_t>(first + offset);
+        const auto child_public_key = key.derive_public(position);
+        if (!child_public_key)
+            return false;
+
+        out = child_public_key.encoded();
+        return true;
+    };
+
+    const auto derived = parallel_write(output, range.count(), derive);
+    if (derived != range.count())
+    {
+        error << format(BX_HD_PUBLIC_INVALID_CHILD) % (first + derived) <<
+            std::endl;
+        return console_result::failure;
+    }
+
+    return console_result::okay;
+}
+
+// Non-hardened children share the parent midstates and are normalized in
+// batches, so a private parent is first converted to its public key.
+static console_result derive_public_range(std::ostream& output,
+    std::ostream& error, const bc::wallet::hd_public& key,
+    const primitives::index_range& range)
+{
+    const hd_public_batch batch(key);
+    const auto encode = [&batch](const hd_public_child& child)
+    {
+        return batch.encoded(child);
+    };
+
+    const auto first = range.first();
+    const auto derived = batch.write(output, first, range.count(), encode);
+    if (derived != range.count())
+    {
+        error << format(BX_HD_PUBLIC_INVALID_CHILD) % (first + derived) <<
+            std::endl;
+        return console_result::failure;
+    }
+
+    return console_result::okay;
+}
+
 console_result hd_public::invoke(std::ostream& output, std::ostream& error)
 {
     // Bound parameters.
     const auto hard = get_hard_option();
     const auto index = get_index_option();
+    const auto& range = get_range_option();
     const auto private_version = get_secret_version_option();
     const auto public_version = get_public_version_option();
     const auto& key = get_hd_key_argument();
@@ -43,7 +101,9 @@ console_result hd_public::invoke(std::ostream& output, std::ostream& error)
         return console_result::failure;
     }
 
-    if (hard && key_version != private_version)
+    const auto ranged = range.count() != 0;
+    const auto hardened = ranged ? range.hard() : hard;
+    if (hardened && key_version != private_version)
     {
         error << BX_HD_PUBLIC_HARD_OPTION_CONFLICT << std::endl;
         return console_result::failure;
@@ -56,6 +116,13 @@ console_result hd_public::invoke(std::ostream& output, std::ostream& error)
 
         // Derive the public key from new private key and the public version.
         const bc::wallet::hd_private private_key(key, prefixes);
+        if (private_key && ranged && hardened)
+            return derive_range(output, error, private_key, range);
+
+        if (private_key && ranged)
+            return derive_public_range(output, error,
+                private_key.to_public(), range);
+
         if (private_key)
         {
             static constexpr auto first = bc::wallet::hd_first_hardened_key;
@@ -73,6 +140,9 @@ console_result hd_public::invoke(std::ostream& output, std::ostream& error)
     {
         // Derive the public key from new private key and the public version.
         const bc::wallet::hd_public public_key(key, public_version);
+        if (public_key && ranged)
+            return derive_public_range(output, error, public_key, range);
+
         if (public_key)
         {
             const auto child_public_key = public_key.derive_public(index);
@@ -0,0 +1,252 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <bitcoin/explorer/commands/hd-scan.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/client.hpp>
+#include <bitcoin/explorer/callback_state.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/display.hpp>
+#include <bitcoin/explorer/obelisk_client.hpp>
+#include <bitcoin/explorer/prop_tree.hpp>
+#include <bitcoin/explorer/prop_writer.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+using namespace bc;
+using namespace bc::client;
+using namespace bc::explorer;
+using namespace bc::explorer::commands;
+using namespace bc::explorer::primitives;
+using namespace bc::wallet;
+
+typedef std::vector<payment_address> address_list;
+
+// The scan position of one branch. Indexes below limit are requested, and
+// limit advances to the gap beyond each used address as it is discovered.
+struct branch_scan
+{
+    uint32_t branch;
+    bc::wallet::hd_public key;
+    uint32_t next;
+    uint32_t limit;
+    uint32_t first;
+    address_list derived;
+};
+
+// Each address is an independent EC multiplication, so a block of addresses
+// is derived across threads. An invalid child yields an invalid address.
+static address_list derive_addresses(const bc::wallet::hd_public& key,
+    uint32_t first, size_t count, uint8_t version)
+{
+    address_list addresses(count);
+    auto derive = [&](size_t offset)
+    {
+        const auto index = static_cast<uint32_t>(first + offset);
+        const auto child = key.derive_public(index);
+        if (child)
+            addresses[offset] = payment_address(ec_public(child.point()),
+                version);
+    };
+
+    parallel_for(count, derive);
+    return addresses;
+}
+
+// Requests are issued from the response handlers, so the server always has a
+// full window of work while the next block of addresses is derived.
+console_result hd_scan::invoke(std::ostream& output, std::ostream& error)
+{
+    // Bound parameters.
+    const auto& encoding = get_format_option();
+    const auto gap = get_gap_option();
+    const auto window = get_window_option();
+    const uint8_t version = get_version_option();
+    const auto private_version = get_secret_version_option();
+    const auto public_version = get_public_version_option();
+    const auto& key = get_hd_key_argument();
+    const auto connection = get_connection(*this);
+
+    auto branches = get_branchs_option();
+    if (branches.empty())
+        branches = { 0, 1 };
+
+    if (window == 0)
+    {
+        error << BX_HD_SCAN_ZERO_WINDOW << std::endl;
+        return console_result::failure;
+    }
+
+    for (const auto branch: branches)
+    {
+        if (branch >= hd_first_hardened_key)
+        {
+            error << BX_HD_SCAN_HARDENED_BRANCH << std::endl;
+            return console_result::failure;
+        }
+    }
+
+    const auto key_version = key.version();
+    if (key_version != private_version && key_version != public_version)
+    {
+        error << BX_HD_SCAN_INVALID_VERSION << std::endl;
+        return console_result::failure;
+    }
+
+    bc::wallet::hd_public account;
+    if (key_version == private_version)
+    {
+        const auto prefixes = bc::wallet::hd_private::to_prefixes(
+            key_version, public_version);
+        account = bc::wallet::hd_private(key, prefixes).to_public();
+    }
+    else
+    {
+        account = bc::wallet::hd_public(key, public_version);
+    }
+
+    if (!account)
+    {
+        error << BX_HD_SCAN_INVALID_KEY << std::endl;
+        return console_result::failure;
+    }
+
+    std::vector<branch_scan> scans;
+    for (const auto branch: branches)
+    {
+        const auto branch_key = account.derive_public(branch);
+        if (!branch_key)
+        {
+            error << BX_HD_SCAN_INVALID_KEY << std::endl;
+            return console_result::failure;
+        }
+
+        scans.push_back({ branch, branch_key, 0, gap, 0, {} });
+    }
+
+    // The state must outlive the client, which may hold abandoned calls.
+    callback_state state(error, output, encoding, flush_policy::interval);
+    obelisk_client client(connection);
+
+    if (!client.connect(connection))
+    {
+        display_connection_failure(error, connection.server);
+        return console_result::failure;
+    }
+
+    auto failed = false;
+    size_t outstanding = 0;
+    std::vector<wallet_address> used;
+    std::function<void()> fill;
+    const auto codec = client.get_codec();
+
+    auto on_error = [&state, &failed](const code& error)
+    {
+        failed = true;
+        state.succeeded(error);
+    };
+
+    // Issue one request for the next address of the branch, deriving the next
+    // block of addresses when the current block is exhausted.
+    auto request = [&](size_t slot)
+    {
+        auto& scan = scans[slot];
+        if (scan.next - scan.first >= scan.derived.size())
+        {
+            scan.first = scan.next;
+            const auto remaining = hd_first_hardened_key - scan.next;
+            const auto block = std::min<size_t>(window, remaining);
+            scan.derived = derive_addresses(scan.key, scan.next, block,
+                version);
+        }
+
+        const auto index = scan.next++;
+        const auto address = scan.derived[index - scan.first];
+        if (!address)
+            return;
+
+        auto on_done = [&, slot, index, address](
+            const client::history_list& rows)
+        {
+            --outstanding;
+            auto& current = scans[slot];
+            if (!rows.empty())
+            {
+                used.push_back({ current.branch, index, address, rows });
+                const auto limit = static_cast<uint64_t>(index) + 1 + gap;
+                current.limit = static_cast<uint32_t>(std::max<uint64_t>(
+                    current.limit, std::min<uint64_t>(limit,
+                        hd_first_hardened_key)));
+            }
+
+            fill();
+        };
+
+        ++outstanding;
+        codec->address_fetch_history(on_error, on_done, address);
+    };
+
+    // Branches are served round robin so that each advances evenly.
+    fill = [&]()
+    {
+        auto issued = true;
+        while (!failed && issued && outstanding < window)
+        {
+            issued = false;
+            for (size_t slot = 0; slot < scans.size(); ++slot)
+            {
+                const auto& scan = scans[slot];
+                if (outstanding < window && scan.next < scan.limit &&
+                    scan.next < hd_first_hardened_key)
+                {
+                    request(slot);
+                    issued = true;
+                }
+            }
+        }
+    };
+
+    fill();
+    client.resolve_callbacks([&failed]() { return failed; });
+
+    if (failed)
+        return state.get_result();
+
+    // Responses arrive out of order.
+    const auto derivation_order = [](const wallet_address& left,
+        const wallet_address& right)
+    {
+        return left.branch < right.branch ||
+            (left.branch == right.branch && left.index < right.index);
+    };
+
+    std::sort(used.begin(), used.end(), derivation_order);
+    state.output([&used](prop_writer& writer)
+    {
+        prop_write(writer, used);
+    });
+    return state.get_result();
+}
@@ -20,15 +20,133 @@
 
 #include <bitcoin/explorer/commands/hd-to-address.hpp>
 
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
 #include <bitcoin/bitcoin.hpp>
 #include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/hd_batch.hpp>
+#include <bitcoin/explorer/utility.hpp>
 
 using namespace bc;
 using namespace bc::explorer;
 using namespace bc::explorer::commands;
+using namespace bc::wallet;
+
+// Hardened children require the private parent and are derived one at a
+// time, across threads.
+static console_result derive_range(std::ostream& output, std::ostream& error,
+    const bc::wallet::hd_private& key, const primitives::index_range& range,
+    uint8_t version)
+{
+    const auto first = range.first();
+    const auto derive = [&key, first, version](size_t offset,
+        std::string& out)
+    {
+        const auto position = static_cast<uint32_t>(first + offset);
+        const auto child_key = key.derive_public(position);
+        if (!child_key)
+            return false;
+
+        out = payment_address(ec_public(child_key.point()), version).encoded();
+        return true;
+    };
+
+    const auto derived = parallel_write(output, range.count(), derive);
+    if (derived != range.count())
+    {
+        error << format(BX_HD_TO_ADDRESS_INVALID_CHILD) % (first + derived) <<
+            std::endl;
+        return console_result::failure;
+    }
+
+    return console_result::okay;
+}
+
+// Non-hardened children share the parent midstates and are normalized in
+// batches, so a private parent is first converted to its public key.
+static console_result derive_public_range(std::ostream& output,
+    std::ostream& error, const bc::wallet::hd_public& key,
+    const primitives::index_range& range, uint8_t version)
+{
+    const hd_public_batch batch(key);
+    const auto encode = [&batch, version](const hd_public_child& child)
+    {
+        return batch.address(child, version);
+    };
+
+    const auto first = range.first();
+    const auto derived = batch.write(output, first, range.count(), encode);
+    if (derived != range.count())
+    {
+        error << format(BX_HD_TO_ADDRESS_INVALID_CHILD) % (first + derived) <<
+            std::endl;
+        return console_result::failure;
+    }
+
+    return console_result::okay;
+}
 
 console_result hd_to_address::invoke(std::ostream& output, std::ostream& error)
 {
-    error << BX_HD_TO_ADDRESS_OBSOLETE << std::endl;
+    // Bound parameters.
+    const uint8_t version = get_version_option();
+    const auto private_version = get_secret_version_option();
+    const auto public_version = get_public_version_option();
+    const auto& range = get_range_option();
+    const auto& key = get_hd_key_argument();
+
+    const auto key_version = key.version();
+    if (key_version != private_version && key_version != public_version)
+    {
+        error << BX_HD_TO_ADDRESS_INVALID_KEY << std::endl;
+        return console_result::failure;
+    }
+
+    const auto ranged = range.count() != 0;
+    if (ranged && range.hard() && key_version != private_version)
+    {
+        error << BX_HD_TO_ADDRESS_HARD_RANGE_CONFLICT << std::endl;
+        return console_result::failure;
+    }
+
+    if (key_version == private_version)
+    {
+        const auto prefixes = bc::wallet::hd_private::to_prefixes(
+            key_version, public_version);
+
+        const bc::wallet::hd_private private_key(key, prefixes);
+        if (private_key && ranged && range.hard())
+            return derive_range(output, error, private_key, range, version);
+
+        if (private_key && ranged)
+            return derive_public_range(output, error,
+                private_key.to_public(), range, version);
+
+        if (private_key)
+        {
+            const auto public_key = private_key.to_public();
+            output << payment_address(ec_public(public_key.point()), version)
+                << std::endl;
+            return console_result::okay;
+        }
+    }
+    else
+    {
+        const bc::wallet::hd_public public_key(key, public_version);
+        if (public_key && ranged)
+            return derive_public_range(output, error, public_key, range,
+                version);
+
+        if (public_key)
+        {
+            output << payment_address(ec_public(public_key.point()), version)
+                << std::endl;
+            return console_result::okay;
+        }
+    }
+
+    error << BX_HD_TO_ADDRESS_INVALID_KEY << std::endl;
     return console_result::failure;
 }
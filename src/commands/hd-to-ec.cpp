@@ -20,18 +20,74 @@
 
 #include <bitcoin/explorer/commands/hd-to-ec.hpp>
 
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
 #include <bitcoin/bitcoin.hpp>
 #include <bitcoin/explorer/define.hpp>
 #include <bitcoin/explorer/primitives/ec_private.hpp>
+#include <bitcoin/explorer/utility.hpp>
 
 using namespace bc;
 using namespace bc::explorer;
 using namespace bc::explorer::commands;
 
+static bc::wallet::hd_private derive_child(
+    const bc::wallet::hd_private& key, uint32_t position)
+{
+    return key.derive_private(position);
+}
+
+static bc::wallet::hd_public derive_child(const bc::wallet::hd_public& key,
+    uint32_t position)
+{
+    return key.derive_public(position);
+}
+
+static std::string encode_key(const bc::wallet::hd_private& key)
+{
+    return encode_base16(key.secret());
+}
+
+static std::string encode_key(const bc::wallet::hd_public& key)
+{
+    return bc::wallet::ec_public(key).encoded();
+}
+
+// The parent is parsed once and the children are derived across threads.
+template <typename Key>
+static console_result derive_range(std::ostream& output, std::ostream& error,
+    const Key& key, const primitives::index_range& range)
+{
+    const auto first = range.first();
+    const auto derive = [&key, first](size_t offset, std::string& out)
+    {
+        const auto position = static_cast<uint32_t>(first + offset);
+        const auto child_key = derive_child(key, position);
+        if (!child_key)
+            return false;
+
+        out = encode_key(child_key);
+        return true;
+    };
+
+    const auto derived = parallel_write(output, range.count(), derive);
+    if (derived != range.count())
+    {
+        error << format(BX_HD_TO_EC_INVALID_CHILD) % (first + derived) <<
+            std::endl;
+        return console_result::failure;
+    }
+
+    return console_result::okay;
+}
+
 console_result hd_to_ec::invoke(std::ostream& output, std::ostream& error)
 {
     // Bound parameters.
     const auto& key = get_hd_key_argument();
+    const auto& range = get_range_option();
     const auto private_version = get_secret_version_option();
     const auto public_version = get_public_version_option();
 
@@ -42,6 +98,13 @@ console_result hd_to_ec::invoke(std::ostream& output, std::ostream& error)
         return console_result::failure;
     }
 
+    const auto ranged = range.count() != 0;
+    if (ranged && range.hard() && key_version != private_version)
+    {
+        error << BX_HD_TO_EC_HARD_RANGE_CONFLICT << std::endl;
+        return console_result::failure;
+    }
+
     if (key.version() == private_version)
     {
         const auto prefixes = bc::wallet::hd_private::to_prefixes(
@@ -49,6 +112,9 @@ console_result hd_to_ec::invoke(std::ostream& output, std::ostream& error)
 
         // Create the private key from hd_key and the public version.
         const auto private_key = bc::wallet::hd_private(key, prefixes);
+        if (private_key && ranged)
+            return derive_range(output, error, private_key, range);
+
         if (private_key)
         {
             output << encode_base16(private_key.secret()) << std::endl;
@@ -59,6 +125,9 @@ console_result hd_to_ec::invoke(std::ostream& output, std::ostream& error)
     {
         // Create the public key from hd_key and the public version.
         const auto public_key = bc::wallet::hd_public(key, public_version);
+        if (public_key && ranged)
+            return derive_range(output, error, public_key, range);
+
         if (public_key)
         {
             output << bc::wallet::ec_public(public_key) << std::endl;
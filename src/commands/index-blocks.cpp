@@ -0,0 +1,94 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/commands/index-blocks.hpp>
+
+#include <deque>
+#include <iostream>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/address_index.hpp>
+#include <bitcoin/explorer/block_file.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/mapped_file.hpp>
+
+using namespace bc;
+using namespace bc::explorer;
+using namespace bc::explorer::commands;
+
+console_result index_blocks::invoke(std::ostream& output, std::ostream& error)
+{
+    // Bound parameters.
+    const auto& index_file = get_index_file_argument();
+    const auto& paths = get_block_files_argument();
+
+    std::deque<mapped_file> mapped;
+    std::vector<data_slice> files;
+    std::vector<block_record> records;
+    block_file_status status;
+    const auto invalid = load_block_files(mapped, files, records, status,
+        paths, get_network_identifier_setting());
+    if (invalid != paths.size())
+    {
+        const auto message = status == block_file_status::other_network ?
+            BX_INDEX_BLOCKS_FILE_NETWORK : BX_INDEX_BLOCKS_FILE_INVALID;
+        error << format(message) % paths[invalid] << std::endl;
+        return console_result::failure;
+    }
+
+    const auto chain = block_chain(records);
+    if (chain.empty())
+    {
+        error << BX_INDEX_BLOCKS_NO_CHAIN << std::endl;
+        return console_result::failure;
+    }
+
+    // An index is only extended, so that an index is never replaced by the
+    // index of a subset of its blocks.
+    address_index_writer index(index_file);
+    if (!index.valid())
+    {
+        error << format(BX_INDEX_BLOCKS_INDEX_INVALID) % index_file <<
+            std::endl;
+        return console_result::failure;
+    }
+
+    if (!index.extends(records, chain))
+    {
+        error << BX_INDEX_BLOCKS_NOT_EXTENDED << std::endl;
+        return console_result::failure;
+    }
+
+    if (!index.add(files, records, chain))
+    {
+        error << BX_INDEX_BLOCKS_BLOCK_INVALID << std::endl;
+        return console_result::failure;
+    }
+
+    if (!index.write())
+    {
+        error << format(BX_INDEX_BLOCKS_WRITE_FAILED) % index_file <<
+            std::endl;
+        return console_result::failure;
+    }
+
+    output << format(BX_INDEX_BLOCKS_OKAY) % index.added() % index.blocks() %
+        index.rows() << std::endl;
+    return console_result::okay;
+}
@@ -22,6 +22,7 @@
 #include <iostream>
 #include <bitcoin/bitcoin.hpp>
 #include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/hash_stream.hpp>
 #include <bitcoin/explorer/primitives/base16.hpp>
 
 using namespace bc;
@@ -32,10 +33,16 @@ using namespace bc::explorer::primitives;
 console_result ripemd160::invoke(std::ostream& output, std::ostream& error)
 {
     // Bound parameters.
-    const data_chunk& data = get_base16_argument();
+    const auto& data = get_base16_argument();
+    const auto& file = get_file_option();
+    const auto raw = get_raw_option();
 
-    const auto hash = ripemd160_hash(data);
+    ripemd160_hasher hasher;
+    if (!hash_input(hasher, data, file, raw, error, BX_RIPEMD160_FILE_INVALID,
+        BX_RIPEMD160_INVALID))
+        return console_result::failure;
 
+    const auto hash = hasher.finish();
     output << base16(hash) << std::endl;
     return console_result::okay;
 }
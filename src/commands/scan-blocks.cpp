@@ -0,0 +1,316 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/commands/scan-blocks.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iostream>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/address_filter.hpp>
+#include <bitcoin/explorer/block_file.hpp>
+#include <bitcoin/explorer/block_parser.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/hash_stream.hpp>
+#include <bitcoin/explorer/mapped_file.hpp>
+#include <bitcoin/explorer/prop_fields.hpp>
+#include <bitcoin/explorer/prop_tree.hpp>
+#include <bitcoin/explorer/prop_writer.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+using namespace bc;
+using namespace bc::client;
+using namespace bc::config;
+using namespace bc::explorer;
+using namespace bc::explorer::commands;
+using namespace bc::explorer::primitives;
+using namespace bc::wallet;
+
+// A transaction of a block and the index of one of its inputs or outputs.
+typedef std::pair<size_t, uint32_t> block_position;
+
+struct scanned_block
+{
+    bool valid;
+    chain::block block;
+    std::vector<data_slice> transactions;
+    std::vector<hash_digest> hashes;
+    std::vector<block_position> receives;
+    std::vector<block_position> spends;
+};
+
+typedef std::unordered_set<hash_digest, digest_hasher<hash_size>> hash_set;
+typedef std::unordered_map<chain::output_point, size_t, point_hasher>
+    unspent_map;
+
+// The hashes of transactions are computed only as they are needed.
+static const hash_digest& transaction_hash(scanned_block& scanned,
+    size_t transaction)
+{
+    auto& hash = scanned.hashes[transaction];
+    if (hash == null_hash)
+        hash = bitcoin_hash(scanned.transactions[transaction]);
+
+    return hash;
+}
+
+static void find_receives(scanned_block& scanned,
+    const address_filter& filter)
+{
+    const auto& transactions = scanned.block.transactions;
+    std::vector<size_t> matched;
+    for (size_t index = 0; index < transactions.size(); ++index)
+    {
+        const auto& outputs = transactions[index].outputs;
+        for (uint32_t output = 0; output < outputs.size(); ++output)
+        {
+            const auto address = payment_address::extract(
+                outputs[output].script);
+
+            if (address && filter.contains(address.hash()))
+            {
+                if (matched.empty() || matched.back() != index)
+                    matched.push_back(index);
+
+                scanned.receives.emplace_back(index, output);
+            }
+        }
+    }
+
+    std::vector<data_slice> serialized;
+    for (const auto index: matched)
+        serialized.push_back(scanned.transactions[index]);
+
+    const auto hashes = bitcoin256_batch(serialized);
+    for (size_t index = 0; index < matched.size(); ++index)
+        scanned.hashes[matched[index]] = hashes[index];
+}
+
+static void find_spends(scanned_block& scanned, const hash_set& funded)
+{
+    const auto& transactions = scanned.block.transactions;
+    for (size_t index = 0; index < transactions.size(); ++index)
+    {
+        const auto& inputs = transactions[index].inputs;
+        for (uint32_t input = 0; input < inputs.size(); ++input)
+            if (funded.find(inputs[input].previous_output.hash) !=
+                funded.end())
+                scanned.spends.emplace_back(index, input);
+    }
+}
+
+console_result scan_blocks::invoke(std::ostream& output, std::ostream& error)
+{
+    // Bound parameters.
+    const auto& addresses = get_addresss_option();
+    const auto& address_file = get_address_file_option();
+    const prop_fields fields(get_fields_option());
+    const auto& encoding = get_format_option();
+    const auto transactions = get_transactions_option();
+    const auto& paths = get_block_files_argument();
+
+    for (const auto& path: fields.paths())
+    {
+        if (!is_transaction_field(path))
+        {
+            error << format(BX_SCAN_BLOCKS_INVALID_FIELD) % path << std::endl;
+            return console_result::failure;
+        }
+    }
+
+    // Addresses are matched by hash, so an address of any version matches.
+    address_filter filter;
+    for (const auto& address: addresses)
+        filter.insert(address.hash());
+
+    if (!address_file.empty())
+    {
+        const mapped_file mapped(address_file);
+        if (!mapped.valid())
+        {
+            error << format(BX_SCAN_BLOCKS_FILE_INVALID) % address_file <<
+                std::endl;
+            return console_result::failure;
+        }
+
+        const auto data = mapped.data();
+        std::vector<payment_address> listed;
+        deserialize(listed, std::string(data.begin(), data.end()), true);
+        for (const auto& address: listed)
+            filter.insert(address.hash());
+    }
+
+    if (filter.size() == 0)
+    {
+        error << BX_SCAN_BLOCKS_NO_ADDRESSES << std::endl;
+        return console_result::failure;
+    }
+
+    std::deque<mapped_file> mapped;
+    std::vector<data_slice> files;
+    std::vector<block_record> records;
+    block_file_status status;
+    const auto invalid = load_block_files(mapped, files, records, status,
+        paths, get_network_identifier_setting());
+    if (invalid != paths.size())
+    {
+        const auto message = status == block_file_status::other_network ?
+            BX_SCAN_BLOCKS_FILE_NETWORK : BX_SCAN_BLOCKS_FILE_INVALID;
+        error << format(message) % paths[invalid] << std::endl;
+        return console_result::failure;
+    }
+
+    // Blocks are processed in chain order, so that each output is received
+    // before it is spent.
+    const auto chain = block_chain(records);
+    if (chain.empty())
+    {
+        error << BX_SCAN_BLOCKS_NO_CHAIN << std::endl;
+        return console_result::failure;
+    }
+
+    prop_writer writer(output, encoding);
+    std::vector<history_row> rows;
+    unspent_map unspent;
+    hash_set funded;
+
+    const auto parse = [&filter](scanned_block& scanned, size_t,
+        data_slice block)
+    {
+        scanned.valid = parse_block(scanned.block, scanned.transactions,
+            block) == block.size();
+
+        if (scanned.valid)
+        {
+            scanned.hashes.resize(scanned.transactions.size(), null_hash);
+            find_receives(scanned, filter);
+        }
+    };
+
+    const auto apply = [&](std::vector<scanned_block>& window, size_t first)
+    {
+        // The funding transactions of the window are known before any of
+        // its inputs are matched, since a block may spend its own outputs.
+        for (size_t position = 0; position < window.size(); ++position)
+        {
+            auto& scanned = window[position];
+            if (!scanned.valid)
+            {
+                const auto& hash = records[chain[first + position]].hash;
+                error << format(BX_SCAN_BLOCKS_BLOCK_INVALID) % btc256(hash) <<
+                    std::endl;
+                return false;
+            }
+
+            for (const auto& receive: scanned.receives)
+                funded.insert(scanned.hashes[receive.first]);
+        }
+
+        const auto spends = [&window, &funded](size_t position)
+        {
+            find_spends(window[position], funded);
+        };
+
+        parallel_for(window.size(), spends);
+
+        for (size_t position = 0; position < window.size(); ++position)
+        {
+            auto& scanned = window[position];
+            const auto height = first + position;
+            const auto& txs = scanned.block.transactions;
+            auto receive = scanned.receives.begin();
+            auto spend = scanned.spends.begin();
+            auto written = txs.size();
+
+            // The spends of a transaction precede its receives.
+            while (receive != scanned.receives.end() ||
+                spend != scanned.spends.end())
+            {
+                const auto is_spend = spend != scanned.spends.end() &&
+                    (receive == scanned.receives.end() ||
+                        spend->first <= receive->first);
+
+                const auto entry = is_spend ? *spend++ : *receive++;
+                const auto tx = entry.first;
+                auto matched = false;
+
+                if (is_spend)
+                {
+                    const auto& input = txs[tx].inputs[entry.second];
+                    const auto row = unspent.find(input.previous_output);
+                    if (row != unspent.end())
+                    {
+                        rows[row->second].spend.hash = transaction_hash(
+                            scanned, tx);
+                        rows[row->second].spend.index = entry.second;
+                        rows[row->second].spend_height = height;
+                        unspent.erase(row);
+                        matched = true;
+                    }
+                }
+                else
+                {
+                    history_row row;
+                    row.output.hash = transaction_hash(scanned, tx);
+                    row.output.index = entry.second;
+                    row.output_height = height;
+                    row.value = txs[tx].outputs[entry.second].value;
+                    row.spend.hash = null_hash;
+                    row.spend.index = max_uint32;
+                    row.spend_height = 0;
+                    unspent.emplace(row.output, rows.size());
+                    rows.push_back(row);
+                    matched = true;
+                }
+
+                if (transactions && matched && written != tx)
+                {
+                    writer.write("transaction", prop_list(txs[tx],
+                        transaction_hash(scanned, tx), fields));
+                    written = tx;
+                }
+            }
+        }
+
+        return true;
+    };
+
+    // The document is abandoned if a block is not valid, so that the
+    // transactions written before it are not mistaken for a complete scan.
+    if (!replay_blocks<scanned_block>(files, records, chain, 0, chain.size(),
+        parse, apply))
+    {
+        writer.abandon();
+        return console_result::failure;
+    }
+
+    // Transfers are written once the scan is complete, since a spend may be
+    // found in any later block. Every transfer is of the chain, so a height
+    // of zero is the genesis block.
+    if (!transactions)
+        prop_write(writer, rows, true);
+
+    writer.finish();
+    return console_result::okay;
+}
@@ -22,7 +22,10 @@
 #include <iostream>
 #include <bitcoin/bitcoin.hpp>
 #include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/mapped_file.hpp>
+#include <bitcoin/explorer/prop_fields.hpp>
 #include <bitcoin/explorer/prop_tree.hpp>
+#include <bitcoin/explorer/prop_writer.hpp>
 #include <bitcoin/explorer/utility.hpp>
 
 using namespace bc;
@@ -30,13 +33,73 @@ using namespace bc::explorer;
 using namespace bc::explorer::commands;
 using namespace bc::explorer::primitives;
 
+// Each transaction is written as it is read, so that a stream or file of
+// many transactions is decoded with memory use bounded by the size of a
+// transaction. The document is abandoned if a transaction is not valid, so
+// that the output is not mistaken for the decoding of all of them.
+template <typename Read>
+static console_result decode(std::ostream& output, std::ostream& error,
+    encoding_engine encoding, const prop_fields& fields, Read read)
+{
+    prop_writer writer(output, encoding);
+    const auto write = [&writer, &fields](const transaction& value)
+    {
+        writer.write("transaction", prop_list(value, fields));
+        return true;
+    };
+
+    if (!read(write))
+    {
+        writer.abandon();
+        error << BX_TX_DECODE_INVALID << std::endl;
+        return console_result::failure;
+    }
+
+    writer.finish();
+    return console_result::okay;
+}
+
 console_result tx_decode::invoke(std::ostream& output, std::ostream& error)
 {
     // Bound parameters.
     const auto& encoding = get_format_option();
-    const auto& transaction = get_transaction_argument();
+    const prop_fields fields(get_fields_option());
+    const auto& transactions = get_transaction_argument();
+    const auto& file = get_file_option();
+    const auto raw = get_raw_option();
 
-    write_stream(output, prop_tree(transaction), encoding);
+    for (const auto& path: fields.paths())
+    {
+        if (!is_transaction_field(path))
+        {
+            error << format(BX_TX_DECODE_INVALID_FIELD) % path << std::endl;
+            return console_result::failure;
+        }
+    }
 
-    return console_result::okay;
+    typedef transaction_stream::transaction_handler handler;
+
+    if (!file.empty())
+    {
+        const mapped_file mapped(file);
+        if (!mapped.valid())
+        {
+            error << format(BX_TX_DECODE_FILE_INVALID) % file << std::endl;
+            return console_result::failure;
+        }
+
+        const auto read = [&mapped, raw](handler write)
+        {
+            return transaction_stream::read(mapped.data(), raw, write);
+        };
+
+        return decode(output, error, encoding, fields, read);
+    }
+
+    const auto read = [&transactions, raw](handler write)
+    {
+        return transactions.read(raw, write);
+    };
+
+    return decode(output, error, encoding, fields, read);
 }
@@ -0,0 +1,83 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/commands/utxo-snapshot.hpp>
+
+#include <deque>
+#include <iostream>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/block_file.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/mapped_file.hpp>
+#include <bitcoin/explorer/utxo_set.hpp>
+
+using namespace bc;
+using namespace bc::explorer;
+using namespace bc::explorer::commands;
+
+console_result utxo_snapshot::invoke(std::ostream& output, std::ostream& error)
+{
+    // Bound parameters.
+    const auto height = get_height_option();
+    const auto& snapshot_file = get_snapshot_file_argument();
+    const auto& paths = get_block_files_argument();
+
+    std::deque<mapped_file> mapped;
+    std::vector<data_slice> files;
+    std::vector<block_record> records;
+    block_file_status status;
+    const auto invalid = load_block_files(mapped, files, records, status,
+        paths, get_network_identifier_setting());
+    if (invalid != paths.size())
+    {
+        const auto message = status == block_file_status::other_network ?
+            BX_UTXO_SNAPSHOT_FILE_NETWORK : BX_UTXO_SNAPSHOT_FILE_INVALID;
+        error << format(message) % paths[invalid] << std::endl;
+        return console_result::failure;
+    }
+
+    const auto chain = block_chain(records);
+    if (chain.empty())
+    {
+        error << BX_UTXO_SNAPSHOT_NO_CHAIN << std::endl;
+        return console_result::failure;
+    }
+
+    // The default height is the top of any chain.
+    const size_t blocks = height == max_uint32 ? max_size_t : height + 1;
+
+    utxo_set_writer snapshot(snapshot_file);
+    if (!snapshot.add(files, records, chain, blocks))
+    {
+        error << BX_UTXO_SNAPSHOT_BLOCK_INVALID << std::endl;
+        return console_result::failure;
+    }
+
+    if (!snapshot.write())
+    {
+        error << format(BX_UTXO_SNAPSHOT_WRITE_FAILED) % snapshot_file <<
+            std::endl;
+        return console_result::failure;
+    }
+
+    output << format(BX_UTXO_SNAPSHOT_OKAY) % snapshot.blocks() %
+        snapshot.size() << std::endl;
+    return console_result::okay;
+}
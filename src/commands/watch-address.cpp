@@ -29,6 +29,7 @@
 #include <bitcoin/explorer/define.hpp>
 #include <bitcoin/explorer/display.hpp>
 #include <bitcoin/explorer/obelisk_client.hpp>
+#include <bitcoin/explorer/output_sink.hpp>
 #include <bitcoin/explorer/primitives/encoding.hpp>
 #include <bitcoin/explorer/primitives/base16.hpp>
 #include <bitcoin/explorer/primitives/transaction.hpp>
@@ -42,16 +43,16 @@ using namespace bc::explorer::commands;
 using namespace bc::explorer::primitives;
 using namespace bc::wallet;
 
-static void handle_signal(int signal)
+// Set by the signal handler, which can do nothing else safely. The poll loop
+// tests it and returns, so buffered output is written on the normal path.
+static volatile std::sig_atomic_t signalled = 0;
+
+static void handle_signal(int)
 {
-    // Can't pass args using lambda capture for a simple function pointer.
-    // This means there's no way to terminate without using a global variable
-    // or process termination. Since the variable would screw with testing all 
-    // other methods we opt for process termination here.
-    exit(console_result::failure);
+    signalled = 1;
 }
 
-// This command only halts on failure or timeout.
+// This command only halts on failure, timeout or a signal.
 // BUGBUG: the server may drop the connection, which is not presently detected.
 console_result watch_address::invoke(std::ostream& output, std::ostream& error)
 {
@@ -68,7 +69,7 @@ console_result watch_address::invoke(std::ostream& output, std::ostream& error)
         return console_result::failure;
     }
 
-    callback_state state(error, output, encoding);
+    callback_state state(error, output, encoding, flush_policy::interval);
 
     auto on_update = [&state](const payment_address& address, size_t,
         const hash_digest& block_hash, const tx_type& tx)
@@ -91,13 +92,23 @@ console_result watch_address::invoke(std::ostream& output, std::ostream& error)
     client.get_codec()->subscribe(on_error, on_subscribed, address);
 
     // Catch C signals for stopping the program.
+    signalled = 0;
     signal(SIGABRT, handle_signal);
     signal(SIGTERM, handle_signal);
     signal(SIGINT, handle_signal);
 
+    const auto interrupted = []()
+    {
+        return signalled != 0;
+    };
+
     // poll for subscribe callbacks if any subscriptions were established.
     if (client.resolve_callbacks() && !state.stopped())
-        client.poll_until_timeout_cumulative(std::chrono::minutes(10));
+        client.poll_until_timeout_cumulative(std::chrono::minutes(10),
+            interrupted);
+
+    if (interrupted())
+        return console_result::failure;
 
     return state.get_result();
 }
@@ -0,0 +1,551 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/ec_batch.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+    #include <intrin.h>
+#endif
+
+namespace libbitcoin {
+namespace explorer {
+
+// field
+
+// The prime is 2^256 - 0x1000003d1, so 2^256 reduces to 0x1000003d1.
+static const uint64_t field_fold = 0x1000003d1;
+static const uint64_t field_prime_low = 0xfffffffefffffc2f;
+static const uint64_t all_ones = 0xffffffffffffffff;
+
+// The exponents p - 2 (inversion) and (p + 1) / 4 (square root).
+static const uint64_t inverse_exponent[4] =
+{
+    0xfffffffefffffc2d, all_ones, all_ones, all_ones
+};
+
+static const uint64_t root_exponent[4] =
+{
+    0xffffffffbfffff0c, all_ones, all_ones, 0x3fffffffffffffff
+};
+
+// The group order, big endian.
+static const uint8_t group_order[ec_secret_size] =
+{
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0xba, 0xae, 0xdc, 0xe6, 0xaf, 0x48, 0xa0, 0x3b,
+    0xbf, 0xd2, 0x5e, 0x8c, 0xd0, 0x36, 0x41, 0x41
+};
+
+static const ec_field field_zero = { { 0, 0, 0, 0 } };
+static const ec_field field_one = { { 1, 0, 0, 0 } };
+
+// Return the low half of the product and set the high half.
+static inline uint64_t multiply(uint64_t left, uint64_t right,
+    uint64_t& high)
+{
+#if defined(__SIZEOF_INT128__)
+    const auto product = static_cast<unsigned __int128>(left) * right;
+    high = static_cast<uint64_t>(product >> 64);
+    return static_cast<uint64_t>(product);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    return _umul128(left, right, &high);
+#else
+    const uint64_t mask = 0xffffffff;
+    const auto low_low = (left & mask) * (right & mask);
+    const auto high_low = (left >> 32) * (right & mask);
+    const auto low_high = (left & mask) * (right >> 32);
+    const auto high_high = (left >> 32) * (right >> 32);
+    const auto middle = (low_low >> 32) + (high_low & mask) +
+        (low_high & mask);
+    high = high_high + (high_low >> 32) + (low_high >> 32) + (middle >> 32);
+    return (middle << 32) | (low_low & mask);
+#endif
+}
+
+static inline bool is_zero(const ec_field& value)
+{
+    return (value.limbs[0] | value.limbs[1] | value.limbs[2] |
+        value.limbs[3]) == 0;
+}
+
+static inline bool is_equal(const ec_field& left, const ec_field& right)
+{
+    return ((left.limbs[0] ^ right.limbs[0]) | (left.limbs[1] ^
+        right.limbs[1]) | (left.limbs[2] ^ right.limbs[2]) |
+        (left.limbs[3] ^ right.limbs[3])) == 0;
+}
+
+static inline bool not_below_prime(const uint64_t* limbs)
+{
+    return limbs[3] == all_ones && limbs[2] == all_ones &&
+        limbs[1] == all_ones && limbs[0] >= field_prime_low;
+}
+
+// Add the fold constant, modulo 2^256, which subtracts the prime from a
+// value that is at least the prime or that has overflowed 2^256.
+static inline void add_fold(uint64_t* limbs)
+{
+    limbs[0] += field_fold;
+    uint64_t carry = limbs[0] < field_fold ? 1 : 0;
+    for (size_t index = 1; index < 4 && carry != 0; ++index)
+    {
+        limbs[index] += carry;
+        carry = limbs[index] < carry ? 1 : 0;
+    }
+}
+
+static inline ec_field add(const ec_field& left, const ec_field& right)
+{
+    ec_field out;
+    uint64_t carry = 0;
+    for (size_t index = 0; index < 4; ++index)
+    {
+        const auto sum = left.limbs[index] + right.limbs[index];
+        const auto total = sum + carry;
+        carry = (sum < left.limbs[index] ? 1 : 0) + (total < sum ? 1 : 0);
+        out.limbs[index] = total;
+    }
+
+    if (carry != 0 || not_below_prime(out.limbs))
+        add_fold(out.limbs);
+
+    return out;
+}
+
+static inline ec_field subtract(const ec_field& left, const ec_field& right)
+{
+    ec_field out;
+    uint64_t borrow = 0;
+    for (size_t index = 0; index < 4; ++index)
+    {
+        const auto difference = left.limbs[index] - right.limbs[index];
+        const auto total = difference - borrow;
+        borrow = (left.limbs[index] < right.limbs[index] ? 1 : 0) +
+            (difference < borrow ? 1 : 0);
+        out.limbs[index] = total;
+    }
+
+    // On borrow the result is 2^256 too large, so subtract the fold constant
+    // (adding the prime).
+    if (borrow != 0)
+    {
+        const auto low = out.limbs[0];
+        out.limbs[0] -= field_fold;
+        borrow = low < field_fold ? 1 : 0;
+        for (size_t index = 1; index < 4 && borrow != 0; ++index)
+        {
+            borrow = out.limbs[index] == 0 ? 1 : 0;
+            out.limbs[index] -= 1;
+        }
+    }
+
+    return out;
+}
+
+static inline ec_field twice(const ec_field& value)
+{
+    return add(value, value);
+}
+
+// Accumulate a product into a three word column sum.
+static inline void accumulate(uint64_t& low, uint64_t& middle,
+    uint64_t& high, uint64_t left, uint64_t right)
+{
+    uint64_t product_high;
+    const auto product_low = multiply(left, right, product_high);
+    low += product_low;
+    product_high += low < product_low ? 1 : 0;
+    middle += product_high;
+    high += middle < product_high ? 1 : 0;
+}
+
+// Accumulate a product twice into a three word column sum.
+static inline void accumulate_twice(uint64_t& low, uint64_t& middle,
+    uint64_t& high, uint64_t left, uint64_t right)
+{
+    uint64_t product_high;
+    const auto product_low = multiply(left, right, product_high);
+    for (size_t pass = 0; pass < 2; ++pass)
+    {
+        low += product_low;
+        const auto carry = product_high + (low < product_low ? 1 : 0);
+        middle += carry;
+        high += middle < carry ? 1 : 0;
+    }
+}
+
+// Shift the column sum down by a word, returning the completed word.
+static inline uint64_t next_column(uint64_t& low, uint64_t& middle,
+    uint64_t& high)
+{
+    const auto word = low;
+    low = middle;
+    middle = high;
+    high = 0;
+    return word;
+}
+
+// Reduce a 512 bit product modulo the prime.
+static inline ec_field reduce(const uint64_t* wide)
+{
+    // Fold the high half into the low half: r = low + high * 0x1000003d1.
+    ec_field out;
+    uint64_t carry = 0;
+    for (size_t index = 0; index < 4; ++index)
+    {
+        uint64_t product_high;
+        const auto product_low = multiply(wide[index + 4], field_fold,
+            product_high);
+        const auto sum = wide[index] + product_low;
+        const auto total = sum + carry;
+        carry = product_high + (sum < product_low ? 1 : 0) +
+            (total < sum ? 1 : 0);
+        out.limbs[index] = total;
+    }
+
+    // Fold the carry word, which is below 2^34.
+    uint64_t product_high;
+    const auto product_low = multiply(carry, field_fold, product_high);
+    out.limbs[0] += product_low;
+    carry = product_high + (out.limbs[0] < product_low ? 1 : 0);
+    for (size_t index = 1; index < 4; ++index)
+    {
+        out.limbs[index] += carry;
+        carry = out.limbs[index] < carry ? 1 : 0;
+    }
+
+    // An overflow leaves a small value, so one more fold cannot overflow.
+    if (carry != 0)
+        add_fold(out.limbs);
+
+    if (not_below_prime(out.limbs))
+        add_fold(out.limbs);
+
+    return out;
+}
+
+// The schoolbook product, column by column.
+static inline ec_field multiply(const ec_field& left, const ec_field& right)
+{
+    const auto a = left.limbs;
+    const auto b = right.limbs;
+    uint64_t wide[8];
+    uint64_t low = 0, middle = 0, high = 0;
+
+    accumulate(low, middle, high, a[0], b[0]);
+    wide[0] = next_column(low, middle, high);
+    accumulate(low, middle, high, a[0], b[1]);
+    accumulate(low, middle, high, a[1], b[0]);
+    wide[1] = next_column(low, middle, high);
+    accumulate(low, middle, high, a[0], b[2]);
+    accumulate(low, middle, high, a[1], b[1]);
+    accumulate(low, middle, high, a[2], b[0]);
+    wide[2] = next_column(low, middle, high);
+    accumulate(low, middle, high, a[0], b[3]);
+    accumulate(low, middle, high, a[1], b[2]);
+    accumulate(low, middle, high, a[2], b[1]);
+    accumulate(low, middle, high, a[3], b[0]);
+    wide[3] = next_column(low, middle, high);
+    accumulate(low, middle, high, a[1], b[3]);
+    accumulate(low, middle, high, a[2], b[2]);
+    accumulate(low, middle, high, a[3], b[1]);
+    wide[4] = next_column(low, middle, high);
+    accumulate(low, middle, high, a[2], b[3]);
+    accumulate(low, middle, high, a[3], b[2]);
+    wide[5] = next_column(low, middle, high);
+    accumulate(low, middle, high, a[3], b[3]);
+    wide[6] = next_column(low, middle, high);
+    wide[7] = low;
+
+    return reduce(wide);
+}
+
+// The product with each cross term computed once and doubled.
+static inline ec_field square(const ec_field& value)
+{
+    const auto a = value.limbs;
+    uint64_t wide[8];
+    uint64_t low = 0, middle = 0, high = 0;
+
+    accumulate(low, middle, high, a[0], a[0]);
+    wide[0] = next_column(low, middle, high);
+    accumulate_twice(low, middle, high, a[0], a[1]);
+    wide[1] = next_column(low, middle, high);
+    accumulate_twice(low, middle, high, a[0], a[2]);
+    accumulate(low, middle, high, a[1], a[1]);
+    wide[2] = next_column(low, middle, high);
+    accumulate_twice(low, middle, high, a[0], a[3]);
+    accumulate_twice(low, middle, high, a[1], a[2]);
+    wide[3] = next_column(low, middle, high);
+    accumulate_twice(low, middle, high, a[1], a[3]);
+    accumulate(low, middle, high, a[2], a[2]);
+    wide[4] = next_column(low, middle, high);
+    accumulate_twice(low, middle, high, a[2], a[3]);
+    wide[5] = next_column(low, middle, high);
+    accumulate(low, middle, high, a[3], a[3]);
+    wide[6] = next_column(low, middle, high);
+    wide[7] = low;
+
+    return reduce(wide);
+}
+
+// Exponentiate with four bit windows.
+static ec_field power(const ec_field& base, const uint64_t* exponent)
+{
+    ec_field table[16];
+    table[0] = field_one;
+    for (size_t index = 1; index < 16; ++index)
+        table[index] = multiply(table[index - 1], base);
+
+    auto out = field_one;
+    for (size_t nibble = 64; nibble-- != 0;)
+    {
+        for (size_t bit = 0; bit < 4; ++bit)
+            out = square(out);
+
+        const auto digit = (exponent[nibble / 16] >> (4 * (nibble % 16))) &
+            0x0f;
+        if (digit != 0)
+            out = multiply(out, table[digit]);
+    }
+
+    return out;
+}
+
+static ec_field invert(const ec_field& value)
+{
+    return power(value, inverse_exponent);
+}
+
+static void from_big_endian(ec_field& out, const uint8_t* data)
+{
+    for (size_t index = 0; index < 4; ++index)
+    {
+        uint64_t limb = 0;
+        for (size_t byte = 0; byte < 8; ++byte)
+            limb = (limb << 8) | data[8 * (3 - index) + byte];
+
+        out.limbs[index] = limb;
+    }
+}
+
+static void to_big_endian(uint8_t* data, const ec_field& value)
+{
+    for (size_t index = 0; index < 4; ++index)
+        for (size_t byte = 0; byte < 8; ++byte)
+            data[8 * (3 - index) + byte] = static_cast<uint8_t>(
+                value.limbs[index] >> (8 * (7 - byte)));
+}
+
+// group
+
+static ec_jacobian to_jacobian(const ec_affine& point)
+{
+    return { point.x, point.y, field_one, false };
+}
+
+// Jacobian doubling for a = 0 (dbl-2009-l).
+static void double_point(ec_jacobian& point)
+{
+    if (point.infinity)
+        return;
+
+    const auto a = square(point.x);
+    const auto b = square(point.y);
+    const auto c = square(b);
+    const auto d = twice(subtract(subtract(square(add(point.x, b)), a), c));
+    const auto e = add(twice(a), a);
+    const auto f = square(e);
+    const auto x = subtract(f, twice(d));
+    const auto c8 = twice(twice(twice(c)));
+    const auto y = subtract(multiply(e, subtract(d, x)), c8);
+    point.z = twice(multiply(point.y, point.z));
+    point.x = x;
+    point.y = y;
+}
+
+void ec_add_point(ec_jacobian& sum, const ec_affine& addend)
+{
+    if (sum.infinity)
+    {
+        sum = to_jacobian(addend);
+        return;
+    }
+
+    // Mixed addition (madd-2007-bl).
+    const auto z1z1 = square(sum.z);
+    const auto u2 = multiply(addend.x, z1z1);
+    const auto s2 = multiply(addend.y, multiply(sum.z, z1z1));
+    const auto h = subtract(u2, sum.x);
+    const auto s = subtract(s2, sum.y);
+
+    if (is_zero(h))
+    {
+        if (is_zero(s))
+            double_point(sum);
+        else
+            sum.infinity = true;
+
+        return;
+    }
+
+    const auto hh = square(h);
+    const auto i = twice(twice(hh));
+    const auto j = multiply(h, i);
+    const auto r = twice(s);
+    const auto v = multiply(sum.x, i);
+    const auto x = subtract(subtract(square(r), j), twice(v));
+    const auto y = subtract(multiply(r, subtract(v, x)),
+        twice(multiply(sum.y, j)));
+    sum.z = twice(multiply(sum.z, h));
+    sum.x = x;
+    sum.y = y;
+}
+
+void ec_normalize_batch(std::vector<ec_affine>& out,
+    const std::vector<ec_jacobian>& points)
+{
+    const auto count = points.size();
+    out.resize(count);
+    if (count == 0)
+        return;
+
+    // Running products of the z coordinates, skipping the infinite points.
+    std::vector<ec_field> products(count);
+    auto product = field_one;
+    for (size_t index = 0; index < count; ++index)
+    {
+        products[index] = product;
+        if (!points[index].infinity)
+            product = multiply(product, points[index].z);
+    }
+
+    // Invert the total once and peel each inverse off in reverse order.
+    auto inverse = invert(product);
+    for (size_t index = count; index-- != 0;)
+    {
+        const auto& point = points[index];
+        if (point.infinity)
+        {
+            out[index] = { field_zero, field_zero };
+            continue;
+        }
+
+        const auto z_inverse = multiply(inverse, products[index]);
+        inverse = multiply(inverse, point.z);
+        const auto z_inverse2 = square(z_inverse);
+        out[index].x = multiply(point.x, z_inverse2);
+        out[index].y = multiply(point.y, multiply(z_inverse2, z_inverse));
+    }
+}
+
+bool ec_decompress_point(ec_affine& out, const ec_compressed& point)
+{
+    const auto prefix = point[0];
+    if (prefix != 0x02 && prefix != 0x03)
+        return false;
+
+    from_big_endian(out.x, point.data() + 1);
+    if (not_below_prime(out.x.limbs))
+        return false;
+
+    // y^2 = x^3 + 7, of which the root is a power since p = 3 (mod 4).
+    static const ec_field seven = { { 7, 0, 0, 0 } };
+    const auto y2 = add(multiply(square(out.x), out.x), seven);
+    out.y = power(y2, root_exponent);
+    if (!is_equal(square(out.y), y2))
+        return false;
+
+    if ((out.y.limbs[0] & 1) != static_cast<uint64_t>(prefix & 1))
+        out.y = subtract(field_zero, out.y);
+
+    return true;
+}
+
+ec_compressed ec_compress_point(const ec_affine& point)
+{
+    ec_compressed out;
+    out[0] = static_cast<uint8_t>(0x02 | (point.y.limbs[0] & 1));
+    to_big_endian(out.data() + 1, point.x);
+    return out;
+}
+
+// generator
+
+// The multiples 1..255 of 256^n * G for each byte position n, little endian.
+static const size_t table_positions = ec_secret_size;
+static const size_t table_multiples = 255;
+static std::vector<ec_affine> generator_table;
+static std::once_flag generator_table_flag;
+
+static void build_generator_table()
+{
+    std::vector<ec_jacobian> multiples(table_multiples + 1);
+    std::vector<ec_affine> normal;
+    generator_table.reserve(table_positions * table_multiples);
+
+    auto base = ec_generator;
+    for (size_t position = 0; position < table_positions; ++position)
+    {
+        // The last multiple is 256 times the base, the next base.
+        multiples[0] = to_jacobian(base);
+        for (size_t index = 1; index <= table_multiples; ++index)
+        {
+            multiples[index] = multiples[index - 1];
+            ec_add_point(multiples[index], base);
+        }
+
+        ec_normalize_batch(normal, multiples);
+        generator_table.insert(generator_table.end(), normal.begin(),
+            normal.end() - 1);
+        base = normal.back();
+    }
+}
+
+bool ec_multiply_generator(ec_jacobian& out, const ec_secret& scalar)
+{
+    if (!std::lexicographical_compare(scalar.begin(), scalar.end(),
+        std::begin(group_order), std::end(group_order)))
+        return false;
+
+    std::call_once(generator_table_flag, build_generator_table);
+
+    out.infinity = true;
+    for (size_t position = 0; position < table_positions; ++position)
+    {
+        const auto byte = scalar[ec_secret_size - 1 - position];
+        if (byte != 0)
+            ec_add_point(out, generator_table[position * table_multiples +
+                byte - 1]);
+    }
+
+    return !out.infinity;
+}
+
+} // namespace explorer
+} // namespace libbitcoin
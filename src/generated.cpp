@@ -50,6 +50,7 @@ void broadcast(const function<void(shared_ptr<command>)> func)
     func(make_shared<base64_encode>());
     func(make_shared<bitcoin160>());
     func(make_shared<bitcoin256>());
+    func(make_shared<block_decode>());
     func(make_shared<btc_to_satoshi>());
     func(make_shared<cert_new>());
     func(make_shared<cert_public>());
@@ -62,6 +63,7 @@ void broadcast(const function<void(shared_ptr<command>)> func)
     func(make_shared<ec_to_ek>());
     func(make_shared<ec_to_public>());
     func(make_shared<ec_to_wif>());
+    func(make_shared<ec_vanity>());
     func(make_shared<ek_address>());
     func(make_shared<ek_new>());
     func(make_shared<ek_public>());
@@ -78,14 +80,17 @@ void broadcast(const function<void(shared_ptr<command>)> func)
     func(make_shared<fetch_tx>());
     func(make_shared<fetch_tx_index>());
     func(make_shared<fetch_utxo>());
+    func(make_shared<hd_derive>());
     func(make_shared<hd_new>());
     func(make_shared<hd_private>());
     func(make_shared<hd_public>());
+    func(make_shared<hd_scan>());
     func(make_shared<hd_to_address>());
     func(make_shared<hd_to_ec>());
     func(make_shared<hd_to_public>());
     func(make_shared<hd_to_wif>());
     func(make_shared<help>());
+    func(make_shared<index_blocks>());
     func(make_shared<input_set>());
     func(make_shared<input_sign>());
     func(make_shared<input_validate>());
@@ -98,6 +103,7 @@ void broadcast(const function<void(shared_ptr<command>)> func)
     func(make_shared<qrcode>());
     func(make_shared<ripemd160>());
     func(make_shared<satoshi_to_btc>());
+    func(make_shared<scan_blocks>());
     func(make_shared<script_decode>());
     func(make_shared<script_encode>());
     func(make_shared<script_to_address>());
@@ -120,6 +126,7 @@ void broadcast(const function<void(shared_ptr<command>)> func)
     func(make_shared<tx_sign>());
     func(make_shared<uri_decode>());
     func(make_shared<uri_encode>());
+    func(make_shared<utxo_snapshot>());
     func(make_shared<validate_tx>());
     func(make_shared<watch_address>());
     func(make_shared<watch_tx>());
@@ -157,6 +164,8 @@ shared_ptr<command> find(const string& symbol)
         return make_shared<bitcoin160>();
     if (symbol == bitcoin256::symbol())
         return make_shared<bitcoin256>();
+    if (symbol == block_decode::symbol())
+        return make_shared<block_decode>();
     if (symbol == btc_to_satoshi::symbol())
         return make_shared<btc_to_satoshi>();
     if (symbol == cert_new::symbol())
@@ -181,6 +190,8 @@ shared_ptr<command> find(const string& symbol)
         return make_shared<ec_to_public>();
     if (symbol == ec_to_wif::symbol())
         return make_shared<ec_to_wif>();
+    if (symbol == ec_vanity::symbol())
+        return make_shared<ec_vanity>();
     if (symbol == ek_address::symbol())
         return make_shared<ek_address>();
     if (symbol == ek_new::symbol())
@@ -213,12 +224,16 @@ shared_ptr<command> find(const string& symbol)
         return make_shared<fetch_tx_index>();
     if (symbol == fetch_utxo::symbol())
         return make_shared<fetch_utxo>();
+    if (symbol == hd_derive::symbol())
+        return make_shared<hd_derive>();
     if (symbol == hd_new::symbol())
         return make_shared<hd_new>();
     if (symbol == hd_private::symbol())
         return make_shared<hd_private>();
     if (symbol == hd_public::symbol())
         return make_shared<hd_public>();
+    if (symbol == hd_scan::symbol())
+        return make_shared<hd_scan>();
     if (symbol == hd_to_address::symbol())
         return make_shared<hd_to_address>();
     if (symbol == hd_to_ec::symbol())
@@ -229,6 +244,8 @@ shared_ptr<command> find(const string& symbol)
         return make_shared<hd_to_wif>();
     if (symbol == help::symbol())
         return make_shared<help>();
+    if (symbol == index_blocks::symbol())
+        return make_shared<index_blocks>();
     if (symbol == input_set::symbol())
         return make_shared<input_set>();
     if (symbol == input_sign::symbol())
@@ -253,6 +270,8 @@ shared_ptr<command> find(const string& symbol)
         return make_shared<ripemd160>();
     if (symbol == satoshi_to_btc::symbol())
         return make_shared<satoshi_to_btc>();
+    if (symbol == scan_blocks::symbol())
+        return make_shared<scan_blocks>();
     if (symbol == script_decode::symbol())
         return make_shared<script_decode>();
     if (symbol == script_encode::symbol())
@@ -297,6 +316,8 @@ shared_ptr<command> find(const string& symbol)
         return make_shared<uri_decode>();
     if (symbol == uri_encode::symbol())
         return make_shared<uri_encode>();
+    if (symbol == utxo_snapshot::symbol())
+        return make_shared<utxo_snapshot>();
     if (symbol == validate_tx::symbol())
         return make_shared<validate_tx>();
     if (symbol == watch_address::symbol())
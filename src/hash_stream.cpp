@@ -0,0 +1,1104 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/hash_stream.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/impl/simd.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+
+static const uint32_t sha256_initial[8] =
+{
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+    0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+static const uint32_t sha256_constants[64] =
+{
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+    0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+    0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+    0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+    0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+    0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+static const uint64_t sha512_initial[8] =
+{
+    0x6a09e667f3bcc908, 0xbb67ae8584caa73b,
+    0x3c6ef372fe94f82b, 0xa54ff53a5f1d36f1,
+    0x510e527fade682d1, 0x9b05688c2b3e6c1f,
+    0x1f83d9abfb41bd6b, 0x5be0cd19137e2179
+};
+
+static const uint64_t sha512_constants[80] =
+{
+    0x428a2f98d728ae22, 0x7137449123ef65cd,
+    0xb5c0fbcfec4d3b2f, 0xe9b5dba58189dbbc,
+    0x3956c25bf348b538, 0x59f111f1b605d019,
+    0x923f82a4af194f9b, 0xab1c5ed5da6d8118,
+    0xd807aa98a3030242, 0x12835b0145706fbe,
+    0x243185be4ee4b28c, 0x550c7dc3d5ffb4e2,
+    0x72be5d74f27b896f, 0x80deb1fe3b1696b1,
+    0x9bdc06a725c71235, 0xc19bf174cf692694,
+    0xe49b69c19ef14ad2, 0xefbe4786384f25e3,
+    0x0fc19dc68b8cd5b5, 0x240ca1cc77ac9c65,
+    0x2de92c6f592b0275, 0x4a7484aa6ea6e483,
+    0x5cb0a9dcbd41fbd4, 0x76f988da831153b5,
+    0x983e5152ee66dfab, 0xa831c66d2db43210,
+    0xb00327c898fb213f, 0xbf597fc7beef0ee4,
+    0xc6e00bf33da88fc2, 0xd5a79147930aa725,
+    0x06ca6351e003826f, 0x142929670a0e6e70,
+    0x27b70a8546d22ffc, 0x2e1b21385c26c926,
+    0x4d2c6dfc5ac42aed, 0x53380d139d95b3df,
+    0x650a73548baf63de, 0x766a0abb3c77b2a8,
+    0x81c2c92e47edaee6, 0x92722c851482353b,
+    0xa2bfe8a14cf10364, 0xa81a664bbc423001,
+    0xc24b8b70d0f89791, 0xc76c51a30654be30,
+    0xd192e819d6ef5218, 0xd69906245565a910,
+    0xf40e35855771202a, 0x106aa07032bbd1b8,
+    0x19a4c116b8d2d0c8, 0x1e376c085141ab53,
+    0x2748774cdf8eeb99, 0x34b0bcb5e19b48a8,
+    0x391c0cb3c5c95a63, 0x4ed8aa4ae3418acb,
+    0x5b9cca4f7763e373, 0x682e6ff3d6b2b8a3,
+    0x748f82ee5defb2fc, 0x78a5636f43172f60,
+    0x84c87814a1f0ab72, 0x8cc702081a6439ec,
+    0x90befffa23631e28, 0xa4506cebde82bde9,
+    0xbef9a3f7b2c67915, 0xc67178f2e372532b,
+    0xca273eceea26619c, 0xd186b8c721c0c207,
+    0xeada7dd6cde0eb1e, 0xf57d4f7fee6ed178,
+    0x06f067aa72176fba, 0x0a637dc5a2c898a6,
+    0x113f9804bef90dae, 0x1b710b35131c471b,
+    0x28db77f523047d84, 0x32caab7b40c72493,
+    0x3c9ebe0a15c9bebc, 0x431d67c49c100d4c,
+    0x4cc5d4becb3e42b6, 0x597f299cfc657e2a,
+    0x5fcb6fab3ad6faec, 0x6c44198c4a475817
+};
+
+static const uint32_t ripemd160_initial[5] =
+{
+    0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0
+};
+
+static inline uint32_t rotate_right(uint32_t value, size_t bits)
+{
+    return (value >> bits) | (value << (32 - bits));
+}
+
+static inline uint64_t rotate_right(uint64_t value, size_t bits)
+{
+    return (value >> bits) | (value << (64 - bits));
+}
+
+static inline uint32_t rotate_left(uint32_t value, size_t bits)
+{
+    return (value << bits) | (value >> (32 - bits));
+}
+
+static inline uint32_t load_big_endian32(const uint8_t* data)
+{
+    return (uint32_t(data[0]) << 24) | (uint32_t(data[1]) << 16) |
+        (uint32_t(data[2]) << 8) | uint32_t(data[3]);
+}
+
+static inline uint64_t load_big_endian64(const uint8_t* data)
+{
+    return (uint64_t(load_big_endian32(data)) << 32) |
+        load_big_endian32(data + 4);
+}
+
+static inline uint32_t load_little_endian32(const uint8_t* data)
+{
+    return uint32_t(data[0]) | (uint32_t(data[1]) << 8) |
+        (uint32_t(data[2]) << 16) | (uint32_t(data[3]) << 24);
+}
+
+static inline void store_big_endian32(uint8_t* data, uint32_t value)
+{
+    data[0] = static_cast<uint8_t>(value >> 24);
+    data[1] = static_cast<uint8_t>(value >> 16);
+    data[2] = static_cast<uint8_t>(value >> 8);
+    data[3] = static_cast<uint8_t>(value);
+}
+
+static inline void store_big_endian64(uint8_t* data, uint64_t value)
+{
+    store_big_endian32(data, static_cast<uint32_t>(value >> 32));
+    store_big_endian32(data + 4, static_cast<uint32_t>(value));
+}
+
+static inline void store_little_endian32(uint8_t* data, uint32_t value)
+{
+    data[0] = static_cast<uint8_t>(value);
+    data[1] = static_cast<uint8_t>(value >> 8);
+    data[2] = static_cast<uint8_t>(value >> 16);
+    data[3] = static_cast<uint8_t>(value >> 24);
+}
+
+// Buffer the data into whole blocks, compressing whole blocks of the data
+// in place rather than copying them.
+template <size_t Size, typename Compress>
+static void absorb(std::array<uint8_t, Size>& block, uint64_t& size,
+    data_slice data, Compress compress)
+{
+    auto it = data.data();
+    auto remaining = data.size();
+    auto used = static_cast<size_t>(size % Size);
+    size += remaining;
+
+    if (used != 0)
+    {
+        const auto fill = std::min(Size - used, remaining);
+        std::memcpy(block.data() + used, it, fill);
+        it += fill;
+        remaining -= fill;
+        if (used + fill < Size)
+            return;
+
+        compress(block.data(), 1);
+    }
+
+    const auto blocks = remaining / Size;
+    if (blocks != 0)
+        compress(it, blocks);
+
+    std::memcpy(block.data(), it + blocks * Size, remaining % Size);
+}
+
+// Append the padding byte and zeros, leaving room for the length.
+template <size_t Size, size_t Length, typename Compress>
+static void pad(std::array<uint8_t, Size>& block, uint64_t size,
+    Compress compress)
+{
+    auto used = static_cast<size_t>(size % Size);
+    block[used++] = 0x80;
+    if (used > Size - Length)
+    {
+        std::fill(block.begin() + used, block.end(), 0x00);
+        compress(block.data(), 1);
+        used = 0;
+    }
+
+    std::fill(block.begin() + used, block.end() - Length, 0x00);
+}
+
+// sha256
+
+static void sha256_generic(uint32_t* state, const uint8_t* data,
+    size_t blocks)
+{
+    uint32_t words[64];
+    for (; blocks != 0; --blocks, data += 64)
+    {
+        for (size_t index = 0; index < 16; ++index)
+            words[index] = load_big_endian32(data + 4 * index);
+
+        for (size_t index = 16; index < 64; ++index)
+        {
+            const auto low = words[index - 15];
+            const auto high = words[index - 2];
+            const auto sigma0 = rotate_right(low, 7) ^
+                rotate_right(low, 18) ^ (low >> 3);
+            const auto sigma1 = rotate_right(high, 17) ^
+                rotate_right(high, 19) ^ (high >> 10);
+
+            words[index] = words[index - 16] + sigma0 + words[index - 7] +
+                sigma1;
+        }
+
+        auto a = state[0], b = state[1], c = state[2], d = state[3];
+        auto e = state[4], f = state[5], g = state[6], h = state[7];
+
+        for (size_t round = 0; round < 64; ++round)
+        {
+            const auto sum1 = rotate_right(e, 6) ^ rotate_right(e, 11) ^
+                rotate_right(e, 25);
+            const auto choose = (e & f) ^ (~e & g);
+            const auto first = h + sum1 + choose + sha256_constants[round] +
+                words[round];
+            const auto sum0 = rotate_right(a, 2) ^ rotate_right(a, 13) ^
+                rotate_right(a, 22);
+            const auto majority = (a & b) ^ (a & c) ^ (b & c);
+            const auto second = sum0 + majority;
+
+            h = g;
+            g = f;
+            f = e;
+            e = d + first;
+            d = c;
+            c = b;
+            b = a;
+            a = first + second;
+        }
+
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+        state[4] += e;
+        state[5] += f;
+        state[6] += g;
+        state[7] += h;
+    }
+}
+
+#ifdef BX_X86
+
+// Each group of four rounds adds the next four schedule words, which are
+// held in a rotation of four registers.
+__attribute__((target("sha,sse4.1")))
+static void sha256_shani(uint32_t* state, const uint8_t* data, size_t blocks)
+{
+    const auto swap = _mm_set_epi64x(0x0c0d0e0f08090a0bull,
+        0x0405060700010203ull);
+
+    // The state is held as ABEF and CDGH.
+    auto swapped = _mm_loadu_si128(reinterpret_cast<const __m128i*>(state));
+    auto state1 = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(state + 4));
+    swapped = _mm_shuffle_epi32(swapped, 0xb1);
+    state1 = _mm_shuffle_epi32(state1, 0x1b);
+    auto state0 = _mm_alignr_epi8(swapped, state1, 8);
+    state1 = _mm_blend_epi16(state1, swapped, 0xf0);
+
+    for (; blocks != 0; --blocks, data += 64)
+    {
+        const auto save0 = state0;
+        const auto save1 = state1;
+        __m128i message[4];
+
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 8
+        #pragma GCC unroll 16
+#endif
+        for (size_t group = 0; group < 16; ++group)
+        {
+            auto& current = message[group % 4];
+            auto& next = message[(group + 1) % 4];
+            auto& previous = message[(group + 3) % 4];
+
+            if (group < 4)
+                current = _mm_shuffle_epi8(_mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(data + 16 * group)),
+                    swap);
+
+            auto words = _mm_add_epi32(current, _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(
+                    sha256_constants + 4 * group)));
+
+            state1 = _mm_sha256rnds2_epu32(state1, state0, words);
+
+            if (group >= 3 && group <= 14)
+            {
+                next = _mm_add_epi32(next,
+                    _mm_alignr_epi8(current, previous, 4));
+                next = _mm_sha256msg2_epu32(next, current);
+            }
+
+            words = _mm_shuffle_epi32(words, 0x0e);
+            state0 = _mm_sha256rnds2_epu32(state0, state1, words);
+
+            if (group >= 1 && group <= 12)
+                previous = _mm_sha256msg1_epu32(previous, current);
+        }
+
+        state0 = _mm_add_epi32(state0, save0);
+        state1 = _mm_add_epi32(state1, save1);
+    }
+
+    swapped = _mm_shuffle_epi32(state0, 0x1b);
+    state1 = _mm_shuffle_epi32(state1, 0xb1);
+    state0 = _mm_blend_epi16(swapped, state1, 0xf0);
+    state1 = _mm_alignr_epi8(state1, swapped, 8);
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(state), state0);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(state + 4), state1);
+}
+
+#endif
+
+static void sha256_compress(uint32_t* state, const uint8_t* data,
+    size_t blocks, sha256_kernel kernel)
+{
+#ifdef BX_X86
+    if (kernel == sha256_kernel::shani)
+    {
+        sha256_shani(state, data, blocks);
+        return;
+    }
+#endif
+
+    sha256_generic(state, data, blocks);
+}
+
+sha256_kernel sha256_default_kernel()
+{
+    static const auto kernel = []()
+    {
+#ifdef BX_X86
+        // SHA-NI is reported in CPUID leaf 7 (EBX bit 29), and the kernel
+        // also requires SSE4.1 (leaf 1, ECX bit 19).
+        unsigned eax, ebx, ecx, edx;
+        if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & (1u << 19)) &&
+            __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) &&
+            (ebx & (1u << 29)))
+            return sha256_kernel::shani;
+#endif
+        return sha256_kernel::generic;
+    }();
+
+    return kernel;
+}
+
+std::vector<sha256_kernel> sha256_kernels()
+{
+    std::vector<sha256_kernel> kernels{ sha256_kernel::generic };
+    if (sha256_default_kernel() == sha256_kernel::shani)
+        kernels.push_back(sha256_kernel::shani);
+
+    return kernels;
+}
+
+sha256_hasher::sha256_hasher(sha256_kernel kernel)
+  : kernel_(kernel), size_(0)
+{
+    std::copy(std::begin(sha256_initial), std::end(sha256_initial),
+        state_.begin());
+}
+
+void sha256_hasher::write(data_slice data)
+{
+    absorb(block_, size_, data, [this](const uint8_t* bytes, size_t blocks)
+    {
+        sha256_compress(state_.data(), bytes, blocks, kernel_);
+    });
+}
+
+hash_digest sha256_hasher::finish()
+{
+    const auto compress = [this](const uint8_t* bytes, size_t blocks)
+    {
+        sha256_compress(state_.data(), bytes, blocks, kernel_);
+    };
+
+    pad<64, 8>(block_, size_, compress);
+    store_big_endian64(block_.data() + 56, size_ * 8);
+    compress(block_.data(), 1);
+
+    hash_digest hash;
+    for (size_t index = 0; index < state_.size(); ++index)
+        store_big_endian32(hash.data() + 4 * index, state_[index]);
+
+    return hash;
+}
+
+// multi-buffer sha256
+
+// The state of a group of lanes is held word by word, so that each vector
+// holds the same state word of every lane.
+#ifdef BX_X86
+
+__attribute__((target("avx2")))
+static inline __m256i rotate_right8(__m256i value, int bits)
+{
+    return _mm256_or_si256(_mm256_srli_epi32(value, bits),
+        _mm256_slli_epi32(value, 32 - bits));
+}
+
+__attribute__((target("avx2")))
+static inline __m256i sum8(__m256i value, int first, int second, int third)
+{
+    return _mm256_xor_si256(_mm256_xor_si256(rotate_right8(value, first),
+        rotate_right8(value, second)), rotate_right8(value, third));
+}
+
+__attribute__((target("avx2")))
+static inline __m256i sigma8(__m256i value, int first, int second,
+    int shift)
+{
+    return _mm256_xor_si256(_mm256_xor_si256(rotate_right8(value, first),
+        rotate_right8(value, second)), _mm256_srli_epi32(value, shift));
+}
+
+// Transpose eight rows of eight words, so that each row holds one word of
+// every row.
+__attribute__((target("avx2")))
+static inline void transpose8(__m256i* rows)
+{
+    __m256i pairs[8], quads[8];
+    for (size_t row = 0; row < 8; row += 2)
+    {
+        pairs[row] = _mm256_unpacklo_epi32(rows[row], rows[row + 1]);
+        pairs[row + 1] = _mm256_unpackhi_epi32(rows[row], rows[row + 1]);
+    }
+
+    for (size_t row = 0; row < 8; row += 4)
+    {
+        quads[row] = _mm256_unpacklo_epi64(pairs[row], pairs[row + 2]);
+        quads[row + 1] = _mm256_unpackhi_epi64(pairs[row], pairs[row + 2]);
+        quads[row + 2] = _mm256_unpacklo_epi64(pairs[row + 1],
+            pairs[row + 3]);
+        quads[row + 3] = _mm256_unpackhi_epi64(pairs[row + 1],
+            pairs[row + 3]);
+    }
+
+    for (size_t row = 0; row < 4; ++row)
+    {
+        rows[row] = _mm256_permute2x128_si256(quads[row], quads[row + 4],
+            0x20);
+        rows[row + 4] = _mm256_permute2x128_si256(quads[row],
+            quads[row + 4], 0x31);
+    }
+}
+
+__attribute__((target("avx2")))
+static void sha256_avx2(uint32_t* state, const uint8_t* const* blocks)
+{
+    const auto swap = _mm256_set_epi64x(0x0c0d0e0f08090a0bull,
+        0x0405060700010203ull, 0x0c0d0e0f08090a0bull, 0x0405060700010203ull);
+
+    __m256i words[16];
+    for (size_t half = 0; half < 2; ++half)
+    {
+        for (size_t lane = 0; lane < 8; ++lane)
+            words[8 * half + lane] = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(blocks[lane] + 32 * half));
+
+        transpose8(words + 8 * half);
+    }
+
+    for (size_t index = 0; index < 16; ++index)
+        words[index] = _mm256_shuffle_epi8(words[index], swap);
+
+    __m256i vector[8];
+    for (size_t word = 0; word < 8; ++word)
+        vector[word] = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(state + 8 * word));
+
+    auto a = vector[0], b = vector[1], c = vector[2], d = vector[3];
+    auto e = vector[4], f = vector[5], g = vector[6], h = vector[7];
+
+    for (size_t round = 0; round < 64; ++round)
+    {
+        auto& word = words[round % 16];
+        if (round >= 16)
+            word = _mm256_add_epi32(_mm256_add_epi32(word,
+                sigma8(words[(round + 1) % 16], 7, 18, 3)),
+                _mm256_add_epi32(words[(round + 9) % 16],
+                sigma8(words[(round + 14) % 16], 17, 19, 10)));
+
+        const auto choose = _mm256_xor_si256(_mm256_and_si256(e, f),
+            _mm256_andnot_si256(e, g));
+        const auto first = _mm256_add_epi32(_mm256_add_epi32(h,
+            sum8(e, 6, 11, 25)), _mm256_add_epi32(choose, _mm256_add_epi32(
+            _mm256_set1_epi32(sha256_constants[round]), word)));
+        const auto majority = _mm256_or_si256(_mm256_and_si256(a, b),
+            _mm256_and_si256(c, _mm256_or_si256(a, b)));
+        const auto second = _mm256_add_epi32(sum8(a, 2, 13, 22), majority);
+
+        h = g;
+        g = f;
+        f = e;
+        e = _mm256_add_epi32(d, first);
+        d = c;
+        c = b;
+        b = a;
+        a = _mm256_add_epi32(first, second);
+    }
+
+    const __m256i result[8] = { a, b, c, d, e, f, g, h };
+    for (size_t word = 0; word < 8; ++word)
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(state + 8 * word),
+            _mm256_add_epi32(vector[word], result[word]));
+}
+
+// AVX-512 provides the rotations and three input functions directly.
+#define BX_ROTATE16(value, bits) _mm512_ror_epi32(value, bits)
+#define BX_XOR16(first, second, third) \
+    _mm512_ternarylogic_epi32(first, second, third, 0x96)
+#define BX_SUM16(value, first, second, third) \
+    BX_XOR16(BX_ROTATE16(value, first), BX_ROTATE16(value, second), \
+        BX_ROTATE16(value, third))
+#define BX_SIGMA16(value, first, second, shift) \
+    BX_XOR16(BX_ROTATE16(value, first), BX_ROTATE16(value, second), \
+        _mm512_srli_epi32(value, shift))
+
+// Transpose sixteen rows of sixteen words, so that each row holds one word
+// of every row.
+__attribute__((target("avx512f")))
+static inline void transpose16(__m512i* rows)
+{
+    __m512i pairs[16], quads[16];
+    for (size_t row = 0; row < 16; row += 2)
+    {
+        pairs[row] = _mm512_unpacklo_epi32(rows[row], rows[row + 1]);
+        pairs[row + 1] = _mm512_unpackhi_epi32(rows[row], rows[row + 1]);
+    }
+
+    for (size_t row = 0; row < 16; row += 4)
+    {
+        quads[row] = _mm512_unpacklo_epi64(pairs[row], pairs[row + 2]);
+        quads[row + 1] = _mm512_unpackhi_epi64(pairs[row], pairs[row + 2]);
+        quads[row + 2] = _mm512_unpacklo_epi64(pairs[row + 1],
+            pairs[row + 3]);
+        quads[row + 3] = _mm512_unpackhi_epi64(pairs[row + 1],
+            pairs[row + 3]);
+    }
+
+    // Each quad holds four words of four rows, one word per 128 bits.
+    for (size_t word = 0; word < 4; ++word)
+    {
+        const auto low0 = _mm512_shuffle_i32x4(quads[word],
+            quads[word + 4], 0x44);
+        const auto high0 = _mm512_shuffle_i32x4(quads[word],
+            quads[word + 4], 0xee);
+        const auto low1 = _mm512_shuffle_i32x4(quads[word + 8],
+            quads[word + 12], 0x44);
+        const auto high1 = _mm512_shuffle_i32x4(quads[word + 8],
+            quads[word + 12], 0xee);
+
+        rows[word] = _mm512_shuffle_i32x4(low0, low1, 0x88);
+        rows[word + 4] = _mm512_shuffle_i32x4(low0, low1, 0xdd);
+        rows[word + 8] = _mm512_shuffle_i32x4(high0, high1, 0x88);
+        rows[word + 12] = _mm512_shuffle_i32x4(high0, high1, 0xdd);
+    }
+}
+
+__attribute__((target("avx512f")))
+static void sha256_avx512(uint32_t* state, const uint8_t* const* blocks)
+{
+    // Each block is one row, and the bytes are swapped by selecting from
+    // the word rotated each way.
+    const auto select = _mm512_set1_epi32(0xff00ff00);
+
+    __m512i words[16];
+    for (size_t lane = 0; lane < 16; ++lane)
+        words[lane] = _mm512_loadu_si512(blocks[lane]);
+
+    transpose16(words);
+
+    for (size_t index = 0; index < 16; ++index)
+        words[index] = _mm512_ternarylogic_epi32(select,
+            _mm512_ror_epi32(words[index], 8),
+            _mm512_rol_epi32(words[index], 8), 0xca);
+
+    __m512i vector[8];
+    for (size_t word = 0; word < 8; ++word)
+        vector[word] = _mm512_loadu_si512(state + 16 * word);
+
+    auto a = vector[0], b = vector[1], c = vector[2], d = vector[3];
+    auto e = vector[4], f = vector[5], g = vector[6], h = vector[7];
+
+    for (size_t round = 0; round < 64; ++round)
+    {
+        auto& word = words[round % 16];
+        if (round >= 16)
+            word = _mm512_add_epi32(_mm512_add_epi32(word,
+                BX_SIGMA16(words[(round + 1) % 16], 7, 18, 3)),
+                _mm512_add_epi32(words[(round + 9) % 16],
+                BX_SIGMA16(words[(round + 14) % 16], 17, 19, 10)));
+
+        const auto choose = _mm512_ternarylogic_epi32(e, f, g, 0xca);
+        const auto first = _mm512_add_epi32(_mm512_add_epi32(h,
+            BX_SUM16(e, 6, 11, 25)), _mm512_add_epi32(choose,
+            _mm512_add_epi32(_mm512_set1_epi32(sha256_constants[round]),
+            word)));
+        const auto majority = _mm512_ternarylogic_epi32(a, b, c, 0xe8);
+        const auto second = _mm512_add_epi32(BX_SUM16(a, 2, 13, 22),
+            majority);
+
+        h = g;
+        g = f;
+        f = e;
+        e = _mm512_add_epi32(d, first);
+        d = c;
+        c = b;
+        b = a;
+        a = _mm512_add_epi32(first, second);
+    }
+
+    const __m512i result[8] = { a, b, c, d, e, f, g, h };
+    for (size_t word = 0; word < 8; ++word)
+        _mm512_storeu_si512(state + 16 * word,
+            _mm512_add_epi32(vector[word], result[word]));
+}
+
+#undef BX_ROTATE16
+#undef BX_XOR16
+#undef BX_SUM16
+#undef BX_SIGMA16
+
+#endif
+
+// Hash the messages in groups of Lanes, with the messages ordered by block
+// count so that the lanes of a group finish together. Lanes without a
+// message, or whose message is complete, compress a block of zeros.
+template <size_t Lanes, typename Compress>
+static void sha256_lanes(std::vector<hash_digest>& out,
+    const std::vector<data_slice>& messages, Compress compress)
+{
+    static const std::array<uint8_t, 64> idle{ {} };
+
+    const auto blocks = [&messages](size_t index)
+    {
+        return (messages[index].size() + 8) / 64 + 1;
+    };
+
+    std::vector<size_t> order(messages.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+        [&blocks](size_t left, size_t right)
+        {
+            return blocks(left) > blocks(right);
+        });
+
+    // The padded tail of each message is one or two blocks.
+    std::array<uint8_t, Lanes * 128> tails;
+    std::array<uint32_t, Lanes * 8> state;
+    std::array<const uint8_t*, Lanes> pointers;
+
+    for (size_t first = 0; first < order.size(); first += Lanes)
+    {
+        const auto used = std::min(Lanes, order.size() - first);
+        size_t whole[Lanes], total[Lanes];
+
+        for (size_t lane = 0; lane < Lanes; ++lane)
+        {
+            total[lane] = 0;
+            whole[lane] = 0;
+            if (lane >= used)
+                continue;
+
+            const auto& message = messages[order[first + lane]];
+            const auto size = message.size();
+            const auto tail = tails.data() + 128 * lane;
+            const auto remainder = size % 64;
+            whole[lane] = size / 64;
+            total[lane] = blocks(order[first + lane]);
+
+            const auto end = 64 * (total[lane] - whole[lane]);
+            std::copy(message.data() + size - remainder,
+                message.data() + size, tail);
+            tail[remainder] = 0x80;
+            std::fill(tail + remainder + 1, tail + end - 8, 0x00);
+            store_big_endian64(tail + end - 8, uint64_t(size) * 8);
+
+            for (size_t word = 0; word < 8; ++word)
+                state[word * Lanes + lane] = sha256_initial[word];
+        }
+
+        for (size_t block = 0; block < total[0]; ++block)
+        {
+            for (size_t lane = 0; lane < Lanes; ++lane)
+            {
+                if (block >= total[lane])
+                    pointers[lane] = idle.data();
+                else if (block < whole[lane])
+                    pointers[lane] = messages[order[first + lane]].data() +
+                        64 * block;
+                else
+                    pointers[lane] = tails.data() + 128 * lane +
+                        64 * (block - whole[lane]);
+            }
+
+            compress(state.data(), pointers.data());
+
+            for (size_t lane = 0; lane < used; ++lane)
+            {
+                if (block + 1 != total[lane])
+                    continue;
+
+                auto& hash = out[order[first + lane]];
+                for (size_t word = 0; word < 8; ++word)
+                    store_big_endian32(hash.data() + 4 * word,
+                        state[word * Lanes + lane]);
+            }
+        }
+    }
+}
+
+sha256_batch_kernel sha256_batch_default_kernel()
+{
+    static const auto kernel = []()
+    {
+#ifdef BX_X86
+        if (__builtin_cpu_supports("avx512f"))
+            return sha256_batch_kernel::avx512;
+
+        // A single SHA-NI stream is faster than eight AVX2 lanes.
+        if (__builtin_cpu_supports("avx2") &&
+            sha256_default_kernel() != sha256_kernel::shani)
+            return sha256_batch_kernel::avx2;
+#endif
+        return sha256_batch_kernel::single;
+    }();
+
+    return kernel;
+}
+
+std::vector<sha256_batch_kernel> sha256_batch_kernels()
+{
+    std::vector<sha256_batch_kernel> kernels{ sha256_batch_kernel::single };
+#ifdef BX_X86
+    if (__builtin_cpu_supports("avx2"))
+        kernels.push_back(sha256_batch_kernel::avx2);
+
+    if (__builtin_cpu_supports("avx512f"))
+        kernels.push_back(sha256_batch_kernel::avx512);
+#endif
+    return kernels;
+}
+
+std::vector<hash_digest> sha256_batch(const std::vector<data_slice>& messages,
+    sha256_batch_kernel kernel)
+{
+    std::vector<hash_digest> out(messages.size());
+
+#ifdef BX_X86
+    if (kernel == sha256_batch_kernel::avx2)
+    {
+        sha256_lanes<8>(out, messages, sha256_avx2);
+        return out;
+    }
+
+    if (kernel == sha256_batch_kernel::avx512)
+    {
+        sha256_lanes<16>(out, messages, sha256_avx512);
+        return out;
+    }
+#endif
+
+    for (size_t index = 0; index < messages.size(); ++index)
+    {
+        sha256_hasher hasher;
+        hasher.write(messages[index]);
+        out[index] = hasher.finish();
+    }
+
+    return out;
+}
+
+std::vector<hash_digest> bitcoin256_batch(
+    const std::vector<data_slice>& messages, sha256_batch_kernel kernel)
+{
+    const auto hashes = sha256_batch(messages, kernel);
+
+    std::vector<data_slice> digests;
+    digests.reserve(hashes.size());
+    for (const auto& hash: hashes)
+        digests.emplace_back(hash.data(), hash.data() + hash.size());
+
+    return sha256_batch(digests, kernel);
+}
+
+std::vector<bool> verify_checksum_batch(
+    const std::vector<data_slice>& payloads, sha256_batch_kernel kernel)
+{
+    static const size_t checksum_size = 4;
+
+    std::vector<data_slice> bodies;
+    bodies.reserve(payloads.size());
+    for (const auto& payload: payloads)
+    {
+        const auto size = std::max(payload.size(), checksum_size);
+        bodies.emplace_back(payload.data(),
+            payload.data() + size - checksum_size);
+    }
+
+    const auto hashes = bitcoin256_batch(bodies, kernel);
+
+    std::vector<bool> valid(payloads.size(), false);
+    for (size_t index = 0; index < payloads.size(); ++index)
+    {
+        const auto& payload = payloads[index];
+        valid[index] = payload.size() >= checksum_size && std::equal(
+            payload.data() + payload.size() - checksum_size,
+            payload.data() + payload.size(), hashes[index].begin());
+    }
+
+    return valid;
+}
+
+// sha512
+
+static void sha512_compress(uint64_t* state, const uint8_t* data,
+    size_t blocks)
+{
+    uint64_t words[80];
+    for (; blocks != 0; --blocks, data += 128)
+    {
+        for (size_t index = 0; index < 16; ++index)
+            words[index] = load_big_endian64(data + 8 * index);
+
+        for (size_t index = 16; index < 80; ++index)
+        {
+            const auto low = words[index - 15];
+            const auto high = words[index - 2];
+            const auto sigma0 = rotate_right(low, 1) ^
+                rotate_right(low, 8) ^ (low >> 7);
+            const auto sigma1 = rotate_right(high, 19) ^
+                rotate_right(high, 61) ^ (high >> 6);
+
+            words[index] = words[index - 16] + sigma0 + words[index - 7] +
+                sigma1;
+        }
+
+        auto a = state[0], b = state[1], c = state[2], d = state[3];
+        auto e = state[4], f = state[5], g = state[6], h = state[7];
+
+        for (size_t round = 0; round < 80; ++round)
+        {
+            const auto sum1 = rotate_right(e, 14) ^ rotate_right(e, 18) ^
+                rotate_right(e, 41);
+            const auto choose = (e & f) ^ (~e & g);
+            const auto first = h + sum1 + choose + sha512_constants[round] +
+                words[round];
+            const auto sum0 = rotate_right(a, 28) ^ rotate_right(a, 34) ^
+                rotate_right(a, 39);
+            const auto majority = (a & b) ^ (a & c) ^ (b & c);
+            const auto second = sum0 + majority;
+
+            h = g;
+            g = f;
+            f = e;
+            e = d + first;
+            d = c;
+            c = b;
+            b = a;
+            a = first + second;
+        }
+
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+        state[4] += e;
+        state[5] += f;
+        state[6] += g;
+        state[7] += h;
+    }
+}
+
+sha512_hasher::sha512_hasher()
+  : size_(0)
+{
+    std::copy(std::begin(sha512_initial), std::end(sha512_initial),
+        state_.begin());
+}
+
+void sha512_hasher::write(data_slice data)
+{
+    absorb(block_, size_, data, [this](const uint8_t* bytes, size_t blocks)
+    {
+        sha512_compress(state_.data(), bytes, blocks);
+    });
+}
+
+long_hash sha512_hasher::finish()
+{
+    const auto compress = [this](const uint8_t* bytes, size_t blocks)
+    {
+        sha512_compress(state_.data(), bytes, blocks);
+    };
+
+    // The length is 128 bits (big endian).
+    pad<128, 16>(block_, size_, compress);
+    store_big_endian64(block_.data() + 112, size_ >> 61);
+    store_big_endian64(block_.data() + 120, size_ * 8);
+    compress(block_.data(), 1);
+
+    long_hash hash;
+    for (size_t index = 0; index < state_.size(); ++index)
+        store_big_endian64(hash.data() + 8 * index, state_[index]);
+
+    return hash;
+}
+
+// ripemd160
+
+static const uint8_t ripemd160_left_words[80] =
+{
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    7, 4, 13, 1, 10, 6, 15, 3, 12, 0, 9, 5, 2, 14, 11, 8,
+    3, 10, 14, 4, 9, 15, 8, 1, 2, 7, 0, 6, 13, 11, 5, 12,
+    1, 9, 11, 10, 0, 8, 12, 4, 13, 3, 7, 15, 14, 5, 6, 2,
+    4, 0, 5, 9, 7, 12, 2, 10, 14, 1, 3, 8, 11, 6, 15, 13
+};
+
+static const uint8_t ripemd160_right_words[80] =
+{
+    5, 14, 7, 0, 9, 2, 11, 4, 13, 6, 15, 8, 1, 10, 3, 12,
+    6, 11, 3, 7, 0, 13, 5, 10, 14, 15, 8, 12, 4, 9, 1, 2,
+    15, 5, 1, 3, 7, 14, 6, 9, 11, 8, 12, 2, 10, 0, 4, 13,
+    8, 6, 4, 1, 3, 11, 15, 0, 5, 12, 2, 13, 9, 7, 10, 14,
+    12, 15, 10, 4, 1, 5, 8, 7, 6, 2, 13, 14, 0, 3, 9, 11
+};
+
+static const uint8_t ripemd160_left_shifts[80] =
+{
+    11, 14, 15, 12, 5, 8, 7, 9, 11, 13, 14, 15, 6, 7, 9, 8,
+    7, 6, 8, 13, 11, 9, 7, 15, 7, 12, 15, 9, 11, 7, 13, 12,
+    11, 13, 6, 7, 14, 9, 13, 15, 14, 8, 13, 6, 5, 12, 7, 5,
+    11, 12, 14, 15, 14, 15, 9, 8, 9, 14, 5, 6, 8, 6, 5, 12,
+    9, 15, 5, 11, 6, 8, 13, 12, 5, 12, 13, 14, 11, 8, 5, 6
+};
+
+static const uint8_t ripemd160_right_shifts[80] =
+{
+    8, 9, 9, 11, 13, 15, 15, 5, 7, 7, 8, 11, 14, 14, 12, 6,
+    9, 13, 15, 7, 12, 8, 9, 11, 7, 7, 12, 7, 6, 15, 13, 11,
+    9, 7, 15, 11, 8, 6, 6, 14, 12, 13, 5, 14, 13, 13, 7, 5,
+    15, 5, 8, 11, 14, 14, 6, 14, 6, 9, 12, 9, 12, 5, 15, 8,
+    8, 5, 12, 9, 12, 5, 14, 6, 8, 13, 6, 5, 15, 13, 11, 11
+};
+
+static const uint32_t ripemd160_left_constants[5] =
+{
+    0x00000000, 0x5a827999, 0x6ed9eba1, 0x8f1bbcdc, 0xa953fd4e
+};
+
+static const uint32_t ripemd160_right_constants[5] =
+{
+    0x50a28be6, 0x5c4dd124, 0x6d703ef3, 0x7a6d76e9, 0x00000000
+};
+
+// The boolean function of each group of sixteen rounds.
+static inline uint32_t ripemd160_function(size_t group, uint32_t x,
+    uint32_t y, uint32_t z)
+{
+    switch (group)
+    {
+        case 0:
+            return x ^ y ^ z;
+        case 1:
+            return (x & y) | (~x & z);
+        case 2:
+            return (x | ~y) ^ z;
+        case 3:
+            return (x & z) | (y & ~z);
+        default:
+            return x ^ (y | ~z);
+    }
+}
+
+static void ripemd160_compress(uint32_t* state, const uint8_t* data,
+    size_t blocks)
+{
+    uint32_t words[16];
+    for (; blocks != 0; --blocks, data += 64)
+    {
+        for (size_t index = 0; index < 16; ++index)
+            words[index] = load_little_endian32(data + 4 * index);
+
+        auto a = state[0], b = state[1], c = state[2], d = state[3];
+        auto e = state[4];
+        auto ar = a, br = b, cr = c, dr = d, er = e;
+
+        // The right line applies the functions in the reverse order.
+        for (size_t round = 0; round < 80; ++round)
+        {
+            const auto group = round / 16;
+            auto sum = a + ripemd160_function(group, b, c, d) +
+                words[ripemd160_left_words[round]] +
+                ripemd160_left_constants[group];
+            sum = rotate_left(sum, ripemd160_left_shifts[round]) + e;
+            a = e;
+            e = d;
+            d = rotate_left(c, 10);
+            c = b;
+            b = sum;
+
+            sum = ar + ripemd160_function(4 - group, br, cr, dr) +
+                words[ripemd160_right_words[round]] +
+                ripemd160_right_constants[group];
+            sum = rotate_left(sum, ripemd160_right_shifts[round]) + er;
+            ar = er;
+            er = dr;
+            dr = rotate_left(cr, 10);
+            cr = br;
+            br = sum;
+        }
+
+        const auto sum = state[1] + c + dr;
+        state[1] = state[2] + d + er;
+        state[2] = state[3] + e + ar;
+        state[3] = state[4] + a + br;
+        state[4] = state[0] + b + cr;
+        state[0] = sum;
+    }
+}
+
+ripemd160_hasher::ripemd160_hasher()
+  : size_(0)
+{
+    std::copy(std::begin(ripemd160_initial), std::end(ripemd160_initial),
+        state_.begin());
+}
+
+void ripemd160_hasher::write(data_slice data)
+{
+    absorb(block_, size_, data, [this](const uint8_t* bytes, size_t blocks)
+    {
+        ripemd160_compress(state_.data(), bytes, blocks);
+    });
+}
+
+short_hash ripemd160_hasher::finish()
+{
+    const auto compress = [this](const uint8_t* bytes, size_t blocks)
+    {
+        ripemd160_compress(state_.data(), bytes, blocks);
+    };
+
+    // The length is little endian.
+    pad<64, 8>(block_, size_, compress);
+    const auto bits = size_ * 8;
+    store_little_endian32(block_.data() + 56, static_cast<uint32_t>(bits));
+    store_little_endian32(block_.data() + 60,
+        static_cast<uint32_t>(bits >> 32));
+    compress(block_.data(), 1);
+
+    short_hash hash;
+    for (size_t index = 0; index < state_.size(); ++index)
+        store_little_endian32(hash.data() + 4 * index, state_[index]);
+
+    return hash;
+}
+
+} // namespace explorer
+} // namespace libbitcoin
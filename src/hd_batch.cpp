@@ -0,0 +1,235 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/hd_batch.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/base58_codec.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/ec_batch.hpp>
+#include <bitcoin/explorer/hash_stream.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+
+// The number of children normalized by one inversion. The inversion costs
+// about as much as 100 multiplications, so it is negligible at this size.
+static const size_t batch_size = 256;
+
+// The number of batches of each thread held for output at once.
+static const size_t thread_batches = 4;
+
+static const size_t hmac_block_size = 128;
+
+static void store_big_endian32(uint8_t* data, uint32_t value)
+{
+    data[0] = static_cast<uint8_t>(value >> 24);
+    data[1] = static_cast<uint8_t>(value >> 16);
+    data[2] = static_cast<uint8_t>(value >> 8);
+    data[3] = static_cast<uint8_t>(value);
+}
+
+hd_public_batch::hd_public_batch(const wallet::hd_public& parent)
+  : valid_(false), point_(), compressed_(parent.point()), lineage_()
+{
+    if (!parent || !ec_decompress_point(point_, compressed_))
+        return;
+
+    // The child depth may not overflow.
+    const auto key = parent.to_hd_key();
+    const auto depth = key[4];
+    if (depth == max_uint8)
+        return;
+
+    std::copy(key.begin(), key.begin() + 4, lineage_.begin());
+    lineage_[4] = static_cast<uint8_t>(depth + 1);
+    const auto fingerprint = bitcoin_short_hash(compressed_);
+    std::copy(fingerprint.begin(), fingerprint.begin() + 4,
+        lineage_.begin() + 5);
+
+    // The HMAC key is the chain code, which is shorter than the block, so
+    // each padded key is a single block hashed once here.
+    std::array<uint8_t, hmac_block_size> inner_pad;
+    std::array<uint8_t, hmac_block_size> outer_pad;
+    inner_pad.fill(0x36);
+    outer_pad.fill(0x5c);
+
+    const auto& chain_code = parent.chain_code();
+    for (size_t index = 0; index < chain_code.size(); ++index)
+    {
+        inner_pad[index] ^= chain_code[index];
+        outer_pad[index] ^= chain_code[index];
+    }
+
+    inner_.write(inner_pad);
+    outer_.write(outer_pad);
+    valid_ = true;
+}
+
+bool hd_public_batch::valid() const
+{
+    return valid_;
+}
+
+void hd_public_batch::derive(std::vector<hd_public_child>& out,
+    uint32_t first, size_t count) const
+{
+    out.resize(count);
+    std::vector<ec_jacobian> points(count);
+
+    std::array<uint8_t, ec_compressed_size + sizeof(uint32_t)> data;
+    std::copy(compressed_.begin(), compressed_.end(), data.begin());
+
+    for (size_t offset = 0; offset < count; ++offset)
+    {
+        auto& child = out[offset];
+        auto& point = points[offset];
+        const auto index = static_cast<uint64_t>(first) + offset;
+        child.index = static_cast<uint32_t>(index);
+        child.valid = false;
+        point.infinity = true;
+
+        if (!valid_ || index >= wallet::hd_first_hardened_key)
+            continue;
+
+        // I = HMAC-SHA512(chain code, point || index), from the midstates.
+        store_big_endian32(data.data() + ec_compressed_size, child.index);
+        auto inner = inner_;
+        inner.write(data);
+        auto outer = outer_;
+        outer.write(inner.finish());
+        const auto hmac = outer.finish();
+
+        ec_secret tweak;
+        std::copy(hmac.begin(), hmac.begin() + ec_secret_size,
+            tweak.begin());
+        std::copy(hmac.begin() + ec_secret_size, hmac.end(),
+            child.chain_code.begin());
+
+        // The child point is IL * G + parent, invalid if IL is not below the
+        // order or the sum is infinite.
+        if (!ec_multiply_generator(point, tweak))
+        {
+            point.infinity = true;
+            continue;
+        }
+
+        ec_add_point(point, point_);
+        child.valid = !point.infinity;
+    }
+
+    std::vector<ec_affine> affine;
+    ec_normalize_batch(affine, points);
+
+    for (size_t offset = 0; offset < count; ++offset)
+        if (out[offset].valid)
+            out[offset].point = ec_compress_point(affine[offset]);
+}
+
+std::string hd_public_batch::encoded(const hd_public_child& child) const
+{
+    data_chunk key(lineage_.begin(), lineage_.end());
+    key.reserve(wallet::hd_key_size);
+    key.resize(lineage_.size() + sizeof(uint32_t));
+    store_big_endian32(key.data() + lineage_.size(), child.index);
+    extend_data(key, child.chain_code);
+    extend_data(key, child.point);
+    append_checksum(key);
+    return fast_encode_base58(key);
+}
+
+std::string hd_public_batch::address(const hd_public_child& child,
+    uint8_t version) const
+{
+    data_chunk payload{ version };
+    payload.reserve(1 + short_hash_size + checksum_size);
+    extend_data(payload, bitcoin_short_hash(child.point));
+    append_checksum(payload);
+    return fast_encode_base58(payload);
+}
+
+size_t hd_public_batch::write(std::ostream& output, uint32_t first,
+    size_t count, encoder encode) const
+{
+    const auto batch_count = [count](size_t batch)
+    {
+        return std::min(batch_size, count - batch * batch_size);
+    };
+
+    // The text of a batch is its children up to the first invalid child,
+    // and the number of these children is returned.
+    const auto encode_batch = [&](size_t batch, std::string& text) -> size_t
+    {
+        // Children from the first hardened index are all invalid.
+        const auto position = static_cast<uint64_t>(first) +
+            batch * batch_size;
+        if (position >= wallet::hd_first_hardened_key)
+            return 0;
+
+        std::vector<hd_public_child> children;
+        derive(children, static_cast<uint32_t>(position), batch_count(batch));
+
+        for (size_t index = 0; index < children.size(); ++index)
+        {
+            if (!children[index].valid)
+                return index;
+
+            if (index != 0)
+                text += "\n";
+
+            text += encode(children[index]);
+        }
+
+        return children.size();
+    };
+
+    const auto evaluate = [&](size_t batch, std::string& text)
+    {
+        return encode_batch(batch, text) == batch_count(batch);
+    };
+
+    const size_t threads = std::max(std::thread::hardware_concurrency(), 1u);
+    const auto batches = (count + batch_size - 1) / batch_size;
+    const auto batch = parallel_write(output, batches, evaluate,
+        threads * thread_batches);
+
+    if (batch == batches)
+        return count;
+
+    // The children of the stopped batch before its invalid child are valid.
+    std::string text;
+    const auto valid = encode_batch(batch, text);
+    if (valid != 0)
+        output << text << "\n";
+
+    output.flush();
+    return batch * batch_size + valid;
+}
+
+} // namespace explorer
+} // namespace libbitcoin
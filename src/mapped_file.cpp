@@ -0,0 +1,74 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/mapped_file.hpp>
+
+#include <cstdint>
+#include <boost/filesystem.hpp>
+#include <boost/interprocess/exceptions.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+using namespace boost::filesystem;
+using namespace boost::interprocess;
+
+namespace libbitcoin {
+namespace explorer {
+
+mapped_file::mapped_file(const path& path)
+  : valid_(false)
+{
+    try
+    {
+        if (!is_regular_file(path))
+            return;
+
+        // An empty file cannot be mapped, but it is valid.
+        if (file_size(path) != 0)
+        {
+            file_mapping(path.string().c_str(), read_only).swap(mapping_);
+            mapped_region(mapping_, read_only).swap(region_);
+            region_.advise(mapped_region::advice_sequential);
+        }
+
+        valid_ = true;
+    }
+    catch (const filesystem_error&)
+    {
+    }
+    catch (const interprocess_exception&)
+    {
+    }
+}
+
+bool mapped_file::valid() const
+{
+    return valid_;
+}
+
+data_slice mapped_file::data() const
+{
+    const auto begin = static_cast<const uint8_t*>(region_.get_address());
+    return data_slice(begin, begin + region_.get_size());
+}
+
+} // namespace explorer
+} // namespace libbitcoin
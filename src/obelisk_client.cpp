@@ -20,6 +20,9 @@
 
 #include <bitcoin/explorer/obelisk_client.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <functional>
 #include <boost/filesystem.hpp>
 #include <czmq++/czmqpp.hpp>
 #include <bitcoin/bitcoin.hpp>
@@ -107,6 +110,11 @@ std::shared_ptr<obelisk_codec> obelisk_client::get_codec()
 }
 
 bool obelisk_client::resolve_callbacks()
+{
+    return resolve_callbacks([]() { return false; });
+}
+
+bool obelisk_client::resolve_callbacks(const std::function<bool()>& done)
 {
     auto delay = static_cast<int>(codec_->wakeup().count());
     czmqpp::poller poller;
@@ -127,7 +135,7 @@ bool obelisk_client::resolve_callbacks()
         }
 
         stream_->signal_response(codec_);
-        if (codec_->outstanding_call_count() == 0)
+        if (done() || codec_->outstanding_call_count() == 0)
             break;
     }
 
@@ -152,6 +160,12 @@ void obelisk_client::poll_until_termination(const client::period_ms& timeout)
 }
 
 void obelisk_client::poll_until_timeout_cumulative(const period_ms& timeout)
+{
+    poll_until_timeout_cumulative(timeout, []() { return false; });
+}
+
+void obelisk_client::poll_until_timeout_cumulative(const period_ms& timeout,
+    const std::function<bool()>& done)
 {
     czmqpp::poller poller;
     poller.add(stream_->get_socket());
@@ -159,11 +173,12 @@ void obelisk_client::poll_until_timeout_cumulative(const period_ms& timeout)
     // calculate expected expiration time
     auto expiry = std::chrono::steady_clock::now() + timeout;
 
-    while (std::chrono::steady_clock::now() < expiry)
+    while (!done() && std::chrono::steady_clock::now() < expiry)
     {
         // calculate maximum interval from now to expiration
-        auto max_wait_interval = std::chrono::duration_cast<period_ms>(
-            expiry - std::chrono::steady_clock::now());
+        auto max_wait_interval = std::min(stop_poll_interval,
+            std::chrono::duration_cast<period_ms>(
+                expiry - std::chrono::steady_clock::now()));
 
         poller.wait(static_cast<int>(max_wait_interval.count()));
 
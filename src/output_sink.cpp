@@ -0,0 +1,132 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/output_sink.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <bitcoin/explorer/define.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+
+output_sink::output_sink(std::ostream& stream, flush_policy policy,
+    size_t size, uint32_t milliseconds)
+  : stream_(stream), policy_(policy), size_(size),
+    milliseconds_(milliseconds), stopped_(false)
+{
+    if (policy_ != flush_policy::immediate)
+        buffer_.reserve(size_);
+
+    if (policy_ == flush_policy::interval)
+        timer_ = std::thread(&output_sink::run, this);
+}
+
+output_sink::~output_sink()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopped_ = true;
+    }
+
+    stopping_.notify_all();
+    if (timer_.joinable())
+        timer_.join();
+
+    flush();
+}
+
+void output_sink::flush()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    drain();
+    stream_.flush();
+}
+
+output_sink::int_type output_sink::overflow(int_type character)
+{
+    if (traits_type::eq_int_type(character, traits_type::eof()))
+        return traits_type::not_eof(character);
+
+    const auto value = traits_type::to_char_type(character);
+    write(&value, 1);
+    return character;
+}
+
+std::streamsize output_sink::xsputn(const char* data, std::streamsize size)
+{
+    write(data, static_cast<size_t>(size));
+    return size;
+}
+
+// A stream flush (such as std::endl) is deferred to the policy.
+int output_sink::sync()
+{
+    if (policy_ == flush_policy::immediate)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stream_.flush();
+    }
+
+    return 0;
+}
+
+void output_sink::write(const char* data, size_t size)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (policy_ == flush_policy::immediate)
+    {
+        stream_.write(data, size);
+        return;
+    }
+
+    buffer_.append(data, size);
+    if (buffer_.size() >= size_)
+        drain();
+}
+
+// The sink must be locked.
+void output_sink::drain()
+{
+    if (buffer_.empty())
+        return;
+
+    stream_.write(buffer_.data(), buffer_.size());
+    stream_.flush();
+    buffer_.clear();
+}
+
+void output_sink::run()
+{
+    const auto interval = std::chrono::milliseconds(milliseconds_);
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stopped_)
+    {
+        stopping_.wait_for(lock, interval, [this]() { return stopped_; });
+        drain();
+    }
+}
+
+} // namespace explorer
+} // namespace libbitcoin
@@ -26,6 +26,7 @@
 #include <cstdint>
 #include <boost/program_options.hpp>
 #include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/base16_codec.hpp>
 #include <bitcoin/explorer/define.hpp>
 
 using namespace po;
@@ -69,7 +70,7 @@ std::istream& operator>>(std::istream& input, base16& argument)
     std::string hexcode;
     input >> hexcode;
 
-    if (!decode_base16(argument.value_, hexcode))
+    if (!fast_decode_base16(argument.value_, hexcode))
     {
         BOOST_THROW_EXCEPTION(invalid_option_value(hexcode));
     }
@@ -79,7 +80,7 @@ std::istream& operator>>(std::istream& input, base16& argument)
 
 std::ostream& operator<<(std::ostream& output, const base16& argument)
 {
-    output << encode_base16(argument.value_);
+    output << fast_encode_base16(argument.value_);
     return output;
 }
 
@@ -0,0 +1,139 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/primitives/base16_stream.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <boost/program_options.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/base16_codec.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/primitives/base16.hpp>
+#include <bitcoin/explorer/primitives/byte_stream.hpp>
+
+using namespace po;
+
+namespace libbitcoin {
+namespace explorer {
+namespace primitives {
+
+static const size_t write_chunk_size = 65536;
+
+base16_stream::base16_stream()
+  : value_(), input_(nullptr)
+{
+}
+
+base16_stream::base16_stream(const std::string& hexcode)
+  : base16_stream()
+{
+    std::stringstream(hexcode) >> *this;
+}
+
+base16_stream::base16_stream(const data_chunk& value)
+  : value_(value), input_(nullptr)
+{
+}
+
+base16_stream::base16_stream(const base16& value)
+  : base16_stream(static_cast<const data_chunk&>(value))
+{
+}
+
+base16_stream::base16_stream(std::istream& input)
+  : value_(), input_(&input)
+{
+}
+
+base16_stream::base16_stream(const base16_stream& other)
+  : value_(other.value_), input_(other.input_)
+{
+}
+
+bool base16_stream::read(size_t size, bool raw, chunk_handler handler) const
+{
+    if (input_ == nullptr)
+        return byte_stream(value_).read(size, handler);
+
+    const byte_stream stream(*input_);
+    if (raw)
+        return stream.read(size, handler);
+
+    // Whitespace is removed from each chunk of text, and an odd digit is
+    // carried to the next chunk.
+    std::string text;
+    data_chunk data;
+    const auto decode = [&text, &data, &handler](data_slice chunk)
+    {
+        std::remove_copy_if(chunk.begin(), chunk.end(),
+            std::back_inserter(text), [](uint8_t character)
+            {
+                return std::isspace(character) != 0;
+            });
+
+        const auto even = text.size() / 2 * 2;
+        if (!fast_decode_base16(data, text.substr(0, even)))
+            return false;
+
+        text.erase(0, even);
+        return handler(data);
+    };
+
+    return stream.read(size, decode) && text.empty();
+}
+
+std::istream& operator>>(std::istream& input, base16_stream& argument)
+{
+    std::string hexcode;
+    input >> hexcode;
+
+    if (!fast_decode_base16(argument.value_, hexcode))
+    {
+        BOOST_THROW_EXCEPTION(invalid_option_value(hexcode));
+    }
+
+    argument.input_ = nullptr;
+    return input;
+}
+
+std::ostream& operator<<(std::ostream& output, const base16_stream& argument)
+{
+    argument.read(write_chunk_size, false, [&output](data_slice chunk)
+    {
+        output << fast_encode_base16(chunk);
+        return true;
+    });
+
+    return output;
+}
+
+void deserialize(base16_stream& value, std::istream& input, bool)
+{
+    value = base16_stream(input);
+}
+
+} // namespace explorer
+} // namespace primitives
+} // namespace libbitcoin
@@ -24,6 +24,7 @@
 #include <string>
 #include <boost/program_options.hpp>
 #include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/base58_codec.hpp>
 #include <bitcoin/explorer/define.hpp>
 
 using namespace po;
@@ -67,7 +68,7 @@ std::istream& operator>>(std::istream& input, base58& argument)
     std::string base58;
     input >> base58;
 
-    if (!decode_base58(argument.value_, base58))
+    if (!fast_decode_base58(argument.value_, base58))
     {
         BOOST_THROW_EXCEPTION(invalid_option_value(base58));
     }
@@ -77,7 +78,7 @@ std::istream& operator>>(std::istream& input, base58& argument)
 
 std::ostream& operator<<(std::ostream& output, const base58& argument)
 {
-    output << encode_base58(argument.value_);
+    output << fast_encode_base58(argument.value_);
     return output;
 }
 
@@ -24,6 +24,7 @@
 #include <string>
 #include <boost/program_options.hpp>
 #include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/base64_codec.hpp>
 #include <bitcoin/explorer/define.hpp>
 
 using namespace po;
@@ -67,7 +68,7 @@ std::istream& operator>>(std::istream& input, base64& argument)
     std::string base64;
     input >> base64;
 
-    if (!decode_base64(argument.value_, base64))
+    if (!fast_decode_base64(argument.value_, base64))
     {
         BOOST_THROW_EXCEPTION(invalid_option_value(base64));
     }
@@ -77,7 +78,7 @@ std::istream& operator>>(std::istream& input, base64& argument)
 
 std::ostream& operator<<(std::ostream& output, const base64& argument)
 {
-    output << encode_base64(argument.value_);
+    output << fast_encode_base64(argument.value_);
     return output;
 }
 
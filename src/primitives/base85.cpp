@@ -24,6 +24,7 @@
 #include <string>
 #include <boost/program_options.hpp>
 #include <bitcoin/client.hpp>
+#include <bitcoin/explorer/base85_codec.hpp>
 #include <bitcoin/explorer/define.hpp>
 
 using namespace po;
@@ -47,7 +48,7 @@ base85::base85(const data_chunk& value)
     : value_(value)
 {
     std::string encoded;
-    if (!encode_base85(encoded, value))
+    if (!fast_encode_base85(encoded, value))
     {
         BOOST_THROW_EXCEPTION(
             invalid_option_value(encode_base16(value)));
@@ -74,7 +75,7 @@ std::istream& operator>>(std::istream& input, base85& argument)
     std::string base85;
     input >> base85;
 
-    if (!decode_base85(argument.value_, base85))
+    if (!fast_decode_base85(argument.value_, base85))
     {
         BOOST_THROW_EXCEPTION(invalid_option_value(base85));
     }
@@ -88,7 +89,7 @@ std::ostream& operator<<(std::ostream& output, const base85& argument)
 
     // Z85 is unusual in that it requires four byte alignment.
     // We have already guarded construction against this, so we can ignore here.
-    /* bool */ encode_base85(decoded, argument.value_);
+    /* bool */ fast_encode_base85(decoded, argument.value_);
 
     output << decoded;
     return output;
@@ -0,0 +1,123 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/primitives/byte_stream.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+namespace primitives {
+
+static const size_t write_chunk_size = 65536;
+
+byte_stream::byte_stream()
+  : value_(), input_(nullptr)
+{
+}
+
+byte_stream::byte_stream(const std::string& text)
+  : byte_stream()
+{
+    std::stringstream(text) >> *this;
+}
+
+byte_stream::byte_stream(const data_chunk& value)
+  : value_(value), input_(nullptr)
+{
+}
+
+byte_stream::byte_stream(std::istream& input)
+  : value_(), input_(&input)
+{
+}
+
+byte_stream::byte_stream(const byte_stream& other)
+  : value_(other.value_), input_(other.input_)
+{
+}
+
+bool byte_stream::read(size_t size, chunk_handler handler) const
+{
+    BITCOIN_ASSERT(size != 0);
+
+    if (input_ == nullptr)
+    {
+        for (size_t offset = 0; offset < value_.size(); offset += size)
+        {
+            const auto begin = value_.data() + offset;
+            const auto end = begin + std::min(size, value_.size() - offset);
+            if (!handler(data_slice(begin, end)))
+                return false;
+        }
+
+        return true;
+    }
+
+    data_chunk buffer(size);
+    const auto data = reinterpret_cast<char*>(buffer.data());
+    while (*input_)
+    {
+        input_->read(data, size);
+        const auto count = static_cast<size_t>(input_->gcount());
+        if (count == 0)
+            break;
+
+        if (!handler(data_slice(buffer.data(), buffer.data() + count)))
+            return false;
+    }
+
+    return true;
+}
+
+std::istream& operator>>(std::istream& input, byte_stream& argument)
+{
+    std::istreambuf_iterator<char> first(input), last;
+    argument.value_.assign(first, last);
+    argument.input_ = nullptr;
+    return input;
+}
+
+std::ostream& operator<<(std::ostream& output, const byte_stream& argument)
+{
+    std::ostreambuf_iterator<char> iterator(output);
+    argument.read(write_chunk_size, [&iterator](data_slice chunk)
+    {
+        std::copy(chunk.begin(), chunk.end(), iterator);
+        return true;
+    });
+
+    return output;
+}
+
+void deserialize(byte_stream& value, std::istream& input, bool)
+{
+    value = byte_stream(input);
+}
+
+} // namespace explorer
+} // namespace primitives
+} // namespace libbitcoin
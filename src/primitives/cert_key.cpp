@@ -24,6 +24,7 @@
 #include <string>
 #include <boost/program_options.hpp>
 #include <bitcoin/client.hpp>
+#include <bitcoin/explorer/base85_codec.hpp>
 #include <bitcoin/explorer/define.hpp>
 
 using namespace po;
@@ -53,9 +54,9 @@ cert_key::cert_key(const cert_key& other)
 // Returns empty string if not initialized.
 std::string cert_key::get_base85() const
 {
-    std::stringstream base85;
-    base85 << *this;
-    return base85.str();
+    std::string base85;
+    /* bool */ fast_encode_base85(base85, value_);
+    return base85;
 }
 
 cert_key::operator const data_chunk&() const
@@ -74,7 +75,7 @@ std::istream& operator>>(std::istream& input, cert_key& argument)
     input >> base85;
 
     if (base85.size() != cert_key_string_length ||
-        !decode_base85(argument.value_, base85))
+        !fast_decode_base85(argument.value_, base85))
     {
         BOOST_THROW_EXCEPTION(invalid_option_value(base85));
     }
@@ -84,13 +85,9 @@ std::istream& operator>>(std::istream& input, cert_key& argument)
 
 std::ostream& operator<<(std::ostream& output, const cert_key& argument)
 {
-    std::string decoded;
-
     // Z85 is unusual in that it requires four byte alignment.
     // We have already guarded construction against this, so we can ignore here.
-    /* bool */ encode_base85(decoded, argument.value_);
-
-    output << decoded;
+    output << argument.get_base85();
     return output;
 }
 
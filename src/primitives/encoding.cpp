@@ -32,8 +32,13 @@ namespace explorer {
 namespace primitives {
 
 // DRY
+static auto encoding_cbor = "cbor";
+static auto encoding_csv = "csv";
 static auto encoding_info = "info";
 static auto encoding_json = "json";
+static auto encoding_msgpack = "msgpack";
+static auto encoding_ndjson = "ndjson";
+static auto encoding_tsv = "tsv";
 static auto encoding_xml = "xml";
 
 encoding::encoding()
@@ -70,8 +75,18 @@ std::istream& operator>>(std::istream& input, encoding& argument)
         argument.value_ = encoding_engine::info;
     else if (text == encoding_json)
         argument.value_ = encoding_engine::json;
+    else if (text == encoding_ndjson)
+        argument.value_ = encoding_engine::ndjson;
     else if (text == encoding_xml)
         argument.value_ = encoding_engine::xml;
+    else if (text == encoding_cbor)
+        argument.value_ = encoding_engine::cbor;
+    else if (text == encoding_msgpack)
+        argument.value_ = encoding_engine::msgpack;
+    else if (text == encoding_csv)
+        argument.value_ = encoding_engine::csv;
+    else if (text == encoding_tsv)
+        argument.value_ = encoding_engine::tsv;
     else
     {
         BOOST_THROW_EXCEPTION(invalid_option_value(text));
@@ -92,13 +107,29 @@ std::ostream& operator<<(std::ostream& output, const encoding& argument)
         case encoding_engine::json:
             value = encoding_json;
             break;
+        case encoding_engine::ndjson:
+            value = encoding_ndjson;
+            break;
         case encoding_engine::xml:
             value = encoding_xml;
             break;
+        case encoding_engine::cbor:
+            value = encoding_cbor;
+            break;
+        case encoding_engine::msgpack:
+            value = encoding_msgpack;
+            break;
+        case encoding_engine::csv:
+            value = encoding_csv;
+            break;
+        case encoding_engine::tsv:
+            value = encoding_tsv;
+            break;
         default:
             BITCOIN_ASSERT_MSG(false, "Unexpected encoding value.");
     }
 
+    output << value;
     return output;
 }
 
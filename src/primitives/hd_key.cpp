@@ -24,6 +24,7 @@
 #include <string>
 #include <boost/program_options.hpp>
 #include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/base58_codec.hpp>
 #include <bitcoin/explorer/define.hpp>
 
 using namespace po;
@@ -53,7 +54,7 @@ std::istream& operator>>(std::istream& input, hd_key& argument)
     input >> base58;
 
     data_chunk value;
-    if (!decode_base58(value, base58) || value.size() != wallet::hd_key_size)
+    if (!fast_decode_base58(value, base58) || value.size() != wallet::hd_key_size)
     {
         BOOST_THROW_EXCEPTION(invalid_option_value(base58));
     }
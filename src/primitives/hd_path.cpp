@@ -0,0 +1,241 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/primitives/hd_path.hpp>
+
+#include <iostream>
+#include <string>
+#include <cstdint>
+#include <vector>
+#include <boost/program_options.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/primitives/index_range.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+using namespace po;
+
+namespace libbitcoin {
+namespace explorer {
+namespace primitives {
+
+// Only digits are accepted, so that a sign or space is not read as zero.
+static bool decode_index(uint32_t& index, bool& hard, std::string text)
+{
+    hard = !text.empty() && (text.back() == '\'' || text.back() == 'h' ||
+        text.back() == 'H');
+    if (hard)
+        text.pop_back();
+
+    if (text.empty() || text.size() > 10 ||
+        text.find_first_not_of("0123456789") != std::string::npos)
+        return false;
+
+    const auto value = std::stoull(text);
+    if (value >= bc::wallet::hd_first_hardened_key)
+        return false;
+
+    index = static_cast<uint32_t>(value);
+    return true;
+}
+
+// An element is an index or an inclusive range of indexes, hardened by a
+// suffix on the last index (and optionally also on the first).
+static bool decode_element(index_range& out, const std::string& text)
+{
+    const auto tokens = split(text, "-");
+    if (tokens.size() != 1 && tokens.size() != 2)
+        return false;
+
+    uint32_t first;
+    bool first_hard;
+    if (!decode_index(first, first_hard, tokens.front()))
+        return false;
+
+    uint32_t last = first;
+    bool last_hard = first_hard;
+    if (tokens.size() == 2 && !decode_index(last, last_hard, tokens.back()))
+        return false;
+
+    if (last < first || (first_hard && !last_hard))
+        return false;
+
+    out = index_range(first, last - first + 1, last_hard);
+    return true;
+}
+
+static bool decode_level(hd_path::level& out, const std::string& text)
+{
+    out.clear();
+    auto elements = text;
+    const auto braced = elements.size() > 1 && elements.front() == '{' &&
+        elements.back() == '}';
+    if (braced)
+        elements = elements.substr(1, elements.size() - 2);
+
+    const auto tokens = braced ? split(elements, ",") :
+        std::vector<std::string>{ elements };
+
+    for (const auto& token: tokens)
+    {
+        index_range range;
+        if (!decode_element(range, token))
+            return false;
+
+        out.push_back(range);
+    }
+
+    return !out.empty();
+}
+
+static bool decode_path(std::vector<hd_path::level>& out,
+    const std::string& text)
+{
+    out.clear();
+    auto tokens = split(text, "/");
+    if (!tokens.empty() && (tokens.front() == "m" || tokens.front() == "M"))
+        tokens.erase(tokens.begin());
+
+    // The number of keys is bounded so that it may be counted.
+    uint64_t keys = 1;
+    for (const auto& token: tokens)
+    {
+        hd_path::level level;
+        if (!decode_level(level, token))
+            return false;
+
+        uint64_t width = 0;
+        for (const auto& range: level)
+            width += range.count();
+
+        // The product is checked before it is formed, since it may overflow.
+        if (width != 0 && keys > max_uint32 / width)
+            return false;
+
+        keys *= width;
+
+        out.push_back(level);
+    }
+
+    return true;
+}
+
+static void encode_element(std::ostream& output, const index_range& range)
+{
+    const auto offset = range.hard() ? bc::wallet::hd_first_hardened_key : 0;
+    const auto first = range.first() - offset;
+    output << first;
+
+    if (range.count() > 1)
+        output << "-" << first + range.count() - 1;
+
+    output << (range.hard() ? "h" : "");
+}
+
+hd_path::hd_path()
+  : levels_()
+{
+}
+
+hd_path::hd_path(const std::string& text)
+{
+    std::stringstream(text) >> *this;
+}
+
+hd_path::hd_path(const std::vector<level>& levels)
+  : levels_(levels)
+{
+}
+
+hd_path::hd_path(const hd_path& other)
+  : hd_path(other.levels_)
+{
+}
+
+const std::vector<hd_path::level>& hd_path::levels() const
+{
+    return levels_;
+}
+
+uint32_t hd_path::count() const
+{
+    uint32_t keys = 1;
+    for (const auto& level: levels_)
+    {
+        uint32_t width = 0;
+        for (const auto& range: level)
+            width += range.count();
+
+        keys *= width;
+    }
+
+    return keys;
+}
+
+bool hd_path::hard() const
+{
+    for (const auto& level: levels_)
+        for (const auto& range: level)
+            if (range.hard())
+                return true;
+
+    return false;
+}
+
+std::istream& operator>>(std::istream& input, hd_path& argument)
+{
+    std::string text;
+    input >> text;
+
+    if (!decode_path(argument.levels_, text))
+    {
+        BOOST_THROW_EXCEPTION(invalid_option_value(text));
+    }
+
+    return input;
+}
+
+std::ostream& operator<<(std::ostream& output, const hd_path& argument)
+{
+    output << "m";
+    for (const auto& level: argument.levels_)
+    {
+        output << "/";
+        if (level.size() == 1)
+        {
+            encode_element(output, level.front());
+            continue;
+        }
+
+        output << "{";
+        for (size_t index = 0; index < level.size(); ++index)
+        {
+            output << (index == 0 ? "" : ",");
+            encode_element(output, level[index]);
+        }
+
+        output << "}";
+    }
+
+    return output;
+}
+
+} // namespace explorer
+} // namespace primitives
+} // namespace libbitcoin
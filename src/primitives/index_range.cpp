@@ -0,0 +1,127 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/primitives/index_range.hpp>
+
+#include <iostream>
+#include <string>
+#include <cstdint>
+#include <boost/program_options.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+using namespace po;
+
+namespace libbitcoin {
+namespace explorer {
+namespace primitives {
+
+static bool decode_range(uint32_t& start, uint32_t& count, bool& hard,
+    const std::string& tuple)
+{
+    const auto tokens = split(tuple, ":");
+    if (tokens.size() != 2 || tokens[0].empty() || tokens[1].empty())
+        return false;
+
+    auto first = tokens[0];
+    hard = first.back() == 'h' || first.back() == '\'';
+    if (hard)
+        first.pop_back();
+
+    // Only digits are accepted, so that a sign or space is not read as zero.
+    const auto digits = [](const std::string& text)
+    {
+        return !text.empty() && text.size() <= 10 &&
+            text.find_first_not_of("0123456789") == std::string::npos;
+    };
+
+    if (!digits(first) || !digits(tokens[1]))
+        return false;
+
+    const auto start_value = std::stoull(first);
+    const auto count_value = std::stoull(tokens[1]);
+    const uint64_t limit = bc::wallet::hd_first_hardened_key;
+    if (count_value == 0 || start_value + count_value > limit)
+        return false;
+
+    start = static_cast<uint32_t>(start_value);
+    count = static_cast<uint32_t>(count_value);
+    return true;
+}
+
+index_range::index_range()
+  : start_(0), count_(0), hard_(false)
+{
+}
+
+index_range::index_range(const std::string& tuple)
+{
+    std::stringstream(tuple) >> *this;
+}
+
+index_range::index_range(uint32_t start, uint32_t count, bool hard)
+  : start_(start), count_(count), hard_(hard)
+{
+}
+
+index_range::index_range(const index_range& other)
+  : index_range(other.start_, other.count_, other.hard_)
+{
+}
+
+uint32_t index_range::first() const
+{
+    return hard_ ? bc::wallet::hd_first_hardened_key + start_ : start_;
+}
+
+uint32_t index_range::count() const
+{
+    return count_;
+}
+
+bool index_range::hard() const
+{
+    return hard_;
+}
+
+std::istream& operator>>(std::istream& input, index_range& argument)
+{
+    std::string tuple;
+    input >> tuple;
+
+    if (!decode_range(argument.start_, argument.count_, argument.hard_,
+        tuple))
+    {
+        BOOST_THROW_EXCEPTION(invalid_option_value(tuple));
+    }
+
+    return input;
+}
+
+std::ostream& operator<<(std::ostream& output, const index_range& argument)
+{
+    output << argument.start_ << (argument.hard_ ? "h" : "") << ":" <<
+        argument.count_;
+    return output;
+}
+
+} // namespace explorer
+} // namespace primitives
+} // namespace libbitcoin
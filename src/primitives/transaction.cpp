@@ -19,11 +19,13 @@
  */
 #include <bitcoin/explorer/primitives/transaction.hpp>
 
+#include <cctype>
 #include <iostream>
 #include <sstream>
 #include <string>
 #include <boost/program_options.hpp>
 #include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/base16_codec.hpp>
 #include <bitcoin/explorer/define.hpp>
 #include <bitcoin/explorer/primitives/base16.hpp>
 #include <bitcoin/explorer/utility.hpp>
@@ -70,7 +72,9 @@ std::istream& operator>>(std::istream& input, transaction& argument)
     input >> hexcode;
 
     // tx base16 is a private encoding in bx, used to pass between commands.
-    if (!deserialize_satoshi_item(argument.value_, base16(hexcode)))
+    data_chunk data;
+    if (!fast_decode_base16(data, hexcode) ||
+        !deserialize_satoshi_item(argument.value_, data))
     {
         BOOST_THROW_EXCEPTION(invalid_option_value(hexcode));
     }
@@ -86,6 +90,34 @@ std::ostream& operator<<(std::ostream& output, const transaction& argument)
     return output;
 }
 
+bool is_binary_transaction(std::istream& input)
+{
+    const auto character = input.peek();
+    return character != std::istream::traits_type::eof() &&
+        std::isxdigit(character) == 0 && std::isspace(character) == 0;
+}
+
+void deserialize(transaction& value, std::istream& input, bool)
+{
+    // A binary transaction is not copied before it is parsed.
+    if (is_binary_transaction(input))
+    {
+        if (!value.data().from_data(input) ||
+            input.peek() != std::istream::traits_type::eof())
+        {
+            BOOST_THROW_EXCEPTION(invalid_option_value("binary"));
+        }
+
+        return;
+    }
+
+    input >> value;
+    if (!(input >> std::ws).eof())
+    {
+        BOOST_THROW_EXCEPTION(invalid_option_value(read_stream(input)));
+    }
+}
+
 } // namespace explorer
 } // namespace primitives
 } // namespace libbitcoin
@@ -0,0 +1,142 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/primitives/transaction_stream.hpp>
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/stream.hpp>
+#include <boost/program_options.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/base16_codec.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/primitives/transaction.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+namespace primitives {
+
+// Each binary transaction is parsed from the stream where it ends the last,
+// and each Base16 transaction is a token.
+static bool read_transactions(std::istream& input, bool raw,
+    const transaction_stream::transaction_handler& handler)
+{
+    transaction value;
+    if (raw || is_binary_transaction(input))
+    {
+        while (input.peek() != std::istream::traits_type::eof())
+            if (!value.data().from_data(input) || !handler(value))
+                return false;
+
+        return true;
+    }
+
+    std::string hexcode;
+    data_chunk data;
+    while (input >> hexcode)
+        if (!fast_decode_base16(data, hexcode) ||
+            !deserialize_satoshi_item(value.data(), data) || !handler(value))
+            return false;
+
+    return true;
+}
+
+transaction_stream::transaction_stream()
+  : values_(), input_(nullptr)
+{
+}
+
+transaction_stream::transaction_stream(const std::string& hexcode)
+  : transaction_stream()
+{
+    std::stringstream(hexcode) >> *this;
+}
+
+transaction_stream::transaction_stream(const transaction& value)
+  : values_{ value }, input_(nullptr)
+{
+}
+
+transaction_stream::transaction_stream(std::istream& input)
+  : values_(), input_(&input)
+{
+}
+
+transaction_stream::transaction_stream(const transaction_stream& other)
+  : values_(other.values_), input_(other.input_)
+{
+}
+
+bool transaction_stream::read(bool raw, transaction_handler handler) const
+{
+    if (input_ != nullptr)
+        return read_transactions(*input_, raw, handler);
+
+    for (const auto& value: values_)
+        if (!handler(value))
+            return false;
+
+    return true;
+}
+
+bool transaction_stream::read(data_slice data, bool raw,
+    transaction_handler handler)
+{
+    using namespace boost::iostreams;
+    stream<array_source> input(reinterpret_cast<const char*>(data.data()),
+        data.size());
+
+    return read_transactions(input, raw, handler);
+}
+
+std::istream& operator>>(std::istream& input, transaction_stream& argument)
+{
+    transaction value;
+    input >> value;
+
+    argument.values_.assign(1, value);
+    argument.input_ = nullptr;
+    return input;
+}
+
+std::ostream& operator<<(std::ostream& output,
+    const transaction_stream& argument)
+{
+    auto first = true;
+    argument.read(false, [&output, &first](const transaction& value)
+    {
+        output << (first ? "" : "\n") << value;
+        first = false;
+        return true;
+    });
+
+    return output;
+}
+
+void deserialize(transaction_stream& value, std::istream& input, bool)
+{
+    value = transaction_stream(input);
+}
+
+} // namespace explorer
+} // namespace primitives
+} // namespace libbitcoin
@@ -0,0 +1,96 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/prop_fields.hpp>
+
+#include <string>
+#include <vector>
+#include <boost/algorithm/string.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+
+prop_fields::prop_fields()
+  : all_(true)
+{
+}
+
+prop_fields::prop_fields(const std::string& list)
+  : all_(false)
+{
+    std::vector<std::string> tokens;
+    boost::split(tokens, list, boost::is_any_of(","));
+    for (auto& token: tokens)
+    {
+        boost::trim(token);
+        if (!token.empty())
+            paths_.push_back(token);
+    }
+
+    all_ = paths_.empty();
+}
+
+bool prop_fields::all() const
+{
+    return all_;
+}
+
+bool prop_fields::includes(const std::string& name) const
+{
+    if (all())
+        return true;
+
+    for (const auto& path: paths_)
+        if (path == name || boost::starts_with(path, name + "."))
+            return true;
+
+    return false;
+}
+
+prop_fields prop_fields::child(const std::string& name) const
+{
+    if (all())
+        return prop_fields();
+
+    // A projection of no paths that is not all() selects nothing.
+    prop_fields projection;
+    projection.all_ = false;
+
+    const auto prefix = name + ".";
+    for (const auto& path: paths_)
+    {
+        // Selecting the field itself selects all of its fields.
+        if (path == name)
+            return prop_fields();
+
+        if (boost::starts_with(path, prefix))
+            projection.paths_.push_back(path.substr(prefix.size()));
+    }
+
+    return projection;
+}
+
+const std::vector<std::string>& prop_fields::paths() const
+{
+    return paths_;
+}
+
+} // namespace explorer
+} // namespace libbitcoin
@@ -21,11 +21,13 @@
 #include <bitcoin/explorer/prop_tree.hpp>
 
 #include <cstdint>
+#include <set>
 #include <string>
 #include <vector>
 #include <boost/property_tree/ptree.hpp>
 #include <bitcoin/client.hpp>
 #include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/hash_stream.hpp>
 #include <bitcoin/explorer/primitives/base16.hpp>
 #include <bitcoin/explorer/primitives/base2.hpp>
 #include <bitcoin/explorer/primitives/btc160.hpp>
@@ -36,6 +38,8 @@
 #include <bitcoin/explorer/primitives/script.hpp>
 #include <bitcoin/explorer/primitives/transaction.hpp>
 #include <bitcoin/explorer/primitives/wrapper.hpp>
+#include <bitcoin/explorer/prop_fields.hpp>
+#include <bitcoin/explorer/prop_writer.hpp>
 
 using namespace pt;
 using namespace bc::client;
@@ -83,17 +87,23 @@ ptree prop_tree(const std::vector<header>& headers)
     tree.add_child("headers", prop_tree_list("header", headers));
     return tree;
 }
+void prop_write(prop_writer& writer, const std::vector<header>& headers)
+{
+    writer.begin("headers");
+    prop_write_list(writer, "header", headers);
+    writer.end();
+}
 
 // transfers
 
-ptree prop_list(const history_row& row)
+ptree prop_list(const history_row& row, bool confirmed)
 {
     ptree tree;
 
     tree.put("received.hash", btc256(row.output.hash));
 
     // missing received.height implies pending
-    if (row.output_height != 0)
+    if (confirmed || row.output_height != 0)
         tree.put("received.height", row.output_height);
 
     tree.put("received.index", row.output.index);
@@ -104,7 +114,7 @@ ptree prop_list(const history_row& row)
         tree.put("spent.hash", btc256(row.spend.hash));
 
         // missing input.height implies spend unconfirmed
-        if (row.spend_height != 0)
+        if (confirmed || row.spend_height != 0)
             tree.put("spent.height", row.spend_height);
 
         tree.put("spent.index", row.spend.index);
@@ -119,23 +129,73 @@ ptree prop_tree(const history_row& row)
     tree.add_child("transfer", prop_list(row));
     return tree;
 }
-ptree prop_tree(const std::vector<history_row>& rows)
+ptree prop_tree(const std::vector<history_row>& rows, bool confirmed)
 {
+    ptree list;
+    for (const auto& row: rows)
+        list.add_child("transfer", prop_list(row, confirmed));
+
     ptree tree;
-    tree.add_child("transfers", prop_tree_list("transfer", rows));
+    tree.add_child("transfers", list);
     return tree;
 }
+void prop_write(prop_writer& writer, const std::vector<history_row>& rows,
+    bool confirmed)
+{
+    // Table rows are formatted directly, without a property tree per row.
+    const auto table = writer.table();
+    if (table != nullptr)
+    {
+        for (const auto& row: rows)
+        {
+            table->begin("transfer");
+            table->cell(row.output.hash);
+
+            if (confirmed || row.output_height != 0)
+                table->cell(row.output_height);
+            else
+                table->skip();
+
+            table->cell(row.output.index);
+
+            if (row.spend.hash != null_hash)
+            {
+                table->cell(row.spend.hash);
+
+                if (confirmed || row.spend_height != 0)
+                    table->cell(row.spend_height);
+                else
+                    table->skip();
+
+                table->cell(row.spend.index);
+            }
+            else
+            {
+                table->skip();
+                table->skip();
+                table->skip();
+            }
+
+            table->cell(row.value);
+            table->end();
+        }
+
+        return;
+    }
+
+    writer.begin("transfers");
+    for (const auto& row: rows)
+        writer.write("transfer", prop_list(row, confirmed));
+
+    writer.end();
+}
 
 // balance
 
-ptree prop_list(const std::vector<balance_row>& rows,
-    const payment_address& balance_address)
+static void accumulate_balance(const std::vector<balance_row>& rows,
+    uint64_t& total_recieved, uint64_t& confirmed_balance,
+    uint64_t& unspent_balance, bool confirmed=false)
 {
-    ptree tree;
-    uint64_t total_recieved = 0;
-    uint64_t confirmed_balance = 0;
-    uint64_t unspent_balance = 0;
-
     for (const auto& row: rows)
     {
         total_recieved += row.value;
@@ -144,10 +204,22 @@ ptree prop_list(const std::vector<balance_row>& rows,
         if (row.spend.hash == null_hash)
             unspent_balance += row.value;
 
-        if (row.output_height != 0 &&
-            (row.spend.hash == null_hash || row.spend_height == 0))
+        if ((confirmed || row.output_height != 0) &&
+            (row.spend.hash == null_hash ||
+                (!confirmed && row.spend_height == 0)))
             confirmed_balance += row.value;
     }
+}
+
+ptree prop_list(const std::vector<balance_row>& rows,
+    const payment_address& balance_address, bool confirmed)
+{
+    ptree tree;
+    uint64_t total_recieved = 0;
+    uint64_t confirmed_balance = 0;
+    uint64_t unspent_balance = 0;
+    accumulate_balance(rows, total_recieved, confirmed_balance,
+        unspent_balance, confirmed);
 
     tree.put("address", balance_address);
     tree.put("confirmed", confirmed_balance);
@@ -156,26 +228,92 @@ ptree prop_list(const std::vector<balance_row>& rows,
     return tree;
 }
 ptree prop_tree(const std::vector<balance_row>& rows,
-    const payment_address& balance_address)
+    const payment_address& balance_address, bool confirmed)
+{
+    ptree tree;
+    tree.add_child("balance", prop_list(rows, balance_address, confirmed));
+    return tree;
+}
+
+// wallet
+
+ptree prop_list(const wallet_address& address)
+{
+    ptree tree;
+    tree.put("branch", address.branch);
+    tree.put("index", address.index);
+    tree.put("payment_address", address.address);
+    tree.add_child("transfers", prop_tree_list("transfer", address.history));
+    return tree;
+}
+ptree prop_tree(const std::vector<wallet_address>& addresses)
 {
+    uint64_t total_recieved = 0;
+    uint64_t confirmed_balance = 0;
+    uint64_t unspent_balance = 0;
+    for (const auto& address: addresses)
+        accumulate_balance(address.history, total_recieved,
+            confirmed_balance, unspent_balance);
+
     ptree tree;
-    tree.add_child("balance", prop_list(rows, balance_address));
+    tree.add_child("wallet.addresses", prop_tree_list("address", addresses));
+    tree.put("wallet.balance.confirmed", confirmed_balance);
+    tree.put("wallet.balance.received", total_recieved);
+    tree.put("wallet.balance.unspent", unspent_balance);
     return tree;
 }
+void prop_write(prop_writer& writer,
+    const std::vector<wallet_address>& addresses)
+{
+    uint64_t total_recieved = 0;
+    uint64_t confirmed_balance = 0;
+    uint64_t unspent_balance = 0;
+    for (const auto& address: addresses)
+        accumulate_balance(address.history, total_recieved,
+            confirmed_balance, unspent_balance);
+
+    writer.begin("wallet");
+    writer.begin("addresses");
+    prop_write_list(writer, "address", addresses);
+    writer.end();
+    writer.begin("balance");
+    writer.put("confirmed", confirmed_balance);
+    writer.put("received", total_recieved);
+    writer.put("unspent", unspent_balance);
+    writer.end();
+    writer.end();
+}
 
 // inputs
 
 ptree prop_list(const tx_input_type& tx_input)
+{
+    return prop_list(tx_input, prop_fields());
+}
+ptree prop_list(const tx_input_type& tx_input, const prop_fields& fields)
 {
     ptree tree;
-    const auto script_address = payment_address::extract(tx_input.script);
-    if (script_address)
-        tree.put("address", script_address);
+    if (fields.includes("address"))
+    {
+        const auto script_address = payment_address::extract(tx_input.script);
+        if (script_address)
+            tree.put("address", script_address);
+    }
+
+    const auto& previous_output = tx_input.previous_output;
+    const auto previous = fields.child("previous_output");
+    if (previous.includes("hash"))
+        tree.put("previous_output.hash", btc256(previous_output.hash));
+
+    if (previous.includes("index"))
+        tree.put("previous_output.index", previous_output.index);
+
+    if (fields.includes("script"))
+        tree.put("script", script(tx_input.script).to_string());
+
+    if (fields.includes("sequence"))
+        tree.put("sequence", tx_input.sequence);
 
-    tree.put("previous_output.hash", btc256(tx_input.previous_output.hash));
-    tree.put("previous_output.index", tx_input.previous_output.index);
-    tree.put("script", script(tx_input.script).to_string());
-    tree.put("sequence", tx_input.sequence);
     return tree;
 }
 ptree prop_tree(const tx_input_type& tx_input)
@@ -214,30 +352,49 @@ ptree prop_tree(const std::vector<input>& inputs)
 // outputs
 
 ptree prop_list(const tx_output_type& tx_output)
+{
+    return prop_list(tx_output, prop_fields());
+}
+ptree prop_list(const tx_output_type& tx_output, const prop_fields& fields)
 {
     ptree tree;
-    const auto address = payment_address::extract(tx_output.script);
-    if (address)
-        tree.put("address", address);
+    const auto stealth = fields.child("stealth");
+    const auto want_stealth = fields.includes("stealth");
+
+    // The address is also required to exclude the stealth fields.
+    payment_address address;
+    if (fields.includes("address") || want_stealth)
+    {
+        address = payment_address::extract(tx_output.script);
+        if (address && fields.includes("address"))
+            tree.put("address", address);
+    }
 
-    tree.put("script", script(tx_output.script).to_string());
+    if (fields.includes("script"))
+        tree.put("script", script(tx_output.script).to_string());
 
     // TODO: this will eventually change due to privacy problems, see:
     // lists.dyne.org/lurker/message/20140812.214120.317490ae.en.html
 
-    if (!address)
+    if (want_stealth && !address)
     {
         uint32_t stealth_prefix;
         ec_compressed ephemeral_key;
         if (to_stealth_prefix(stealth_prefix, tx_output.script) &&
             extract_ephemeral_key(ephemeral_key, tx_output.script))
         {
-            tree.put("stealth.prefix", stealth_prefix);
-            tree.put("stealth.ephemeral_public_key", ec_public(ephemeral_key));
+            if (stealth.includes("prefix"))
+                tree.put("stealth.prefix", stealth_prefix);
+
+            if (stealth.includes("ephemeral_public_key"))
+                tree.put("stealth.ephemeral_public_key",
+                    ec_public(ephemeral_key));
         }
     }
 
-    tree.put("value", tx_output.value);
+    if (fields.includes("value"))
+        tree.put("value", tx_output.value);
+
     return tree;
 }
 ptree prop_tree(const tx_output_type& tx_output)
@@ -257,29 +414,110 @@ ptree prop_tree(const std::vector<tx_output_type>& tx_outputs)
 
 ptree prop_list(const transaction& transaction)
 {
-    const tx_type& tx = transaction;
-
+    return prop_list(transaction, prop_fields());
+}
+ptree prop_list(const tx_type& tx, const hash_digest& hash,
+    const prop_fields& fields)
+{
     ptree tree;
-    tree.put("hash", btc256(tx.hash()));
-    tree.add_child("inputs", prop_tree_list("input", tx.inputs));
-    tree.put("lock_time", tx.locktime);
-    tree.add_child("outputs", prop_tree_list("output", tx.outputs));
-    tree.put("version", tx.version);
+    if (fields.includes("hash"))
+        tree.put("hash", btc256(hash));
+
+    if (fields.includes("inputs"))
+        tree.add_child("inputs", prop_tree_list("input", tx.inputs,
+            fields.child("inputs")));
+
+    if (fields.includes("lock_time"))
+        tree.put("lock_time", tx.locktime);
+
+    if (fields.includes("outputs"))
+        tree.add_child("outputs", prop_tree_list("output", tx.outputs,
+            fields.child("outputs")));
+
+    if (fields.includes("version"))
+        tree.put("version", tx.version);
+
     return tree;
 }
+ptree prop_list(const transaction& transaction, const prop_fields& fields)
+{
+    const tx_type& tx = transaction;
+    const auto hash = fields.includes("hash") ? tx.hash() : null_hash;
+    return prop_list(tx, hash, fields);
+}
 ptree prop_tree(const transaction& transaction)
+{
+    return prop_tree(transaction, prop_fields());
+}
+ptree prop_tree(const transaction& transaction, const prop_fields& fields)
 {
     ptree tree;
-    tree.add_child("transaction", prop_list(transaction));
+    tree.add_child("transaction", prop_list(transaction, fields));
     return tree;
 }
+
+bool is_transaction_field(const std::string& path)
+{
+    static const std::set<std::string> paths
+    {
+        "hash",
+        "inputs",
+        "inputs.address",
+        "inputs.previous_output",
+        "inputs.previous_output.hash",
+        "inputs.previous_output.index",
+        "inputs.script",
+        "inputs.sequence",
+        "lock_time",
+        "outputs",
+        "outputs.address",
+        "outputs.script",
+        "outputs.stealth",
+        "outputs.stealth.ephemeral_public_key",
+        "outputs.stealth.prefix",
+        "outputs.value",
+        "version"
+    };
+
+    return paths.find(path) != paths.end();
+}
+static std::vector<hash_digest> transaction_hashes(
+    const std::vector<transaction>& transactions)
+{
+    std::vector<data_chunk> serialized;
+    serialized.reserve(transactions.size());
+    for (const auto& transaction: transactions)
+        serialized.push_back(static_cast<const tx_type&>(transaction)
+            .to_data());
+
+    return bitcoin256_batch(std::vector<data_slice>(serialized.begin(),
+        serialized.end()));
+}
 ptree prop_tree(const std::vector<transaction>& transactions)
 {
+    const auto hashes = transaction_hashes(transactions);
+
+    ptree list;
+    for (size_t index = 0; index < transactions.size(); ++index)
+        list.add_child("transaction", prop_list(transactions[index],
+            hashes[index], prop_fields()));
+
     ptree tree;
-    tree.add_child("transactions",
-        prop_tree_list("transaction", transactions));
+    tree.add_child("transactions", list);
     return tree;
 }
+void prop_write(prop_writer& writer,
+    const std::vector<transaction>& transactions)
+{
+    const auto hashes = transaction_hashes(transactions);
+
+    writer.begin("transactions");
+    for (size_t index = 0; index < transactions.size(); ++index)
+        writer.write("transaction", prop_list(transactions[index],
+            hashes[index], prop_fields()));
+
+    writer.end();
+}
 
 // wrapper
 
@@ -388,6 +626,29 @@ ptree prop_tree(const std::vector<client::stealth_row>& rows)
     tree.add_child("stealth", prop_tree_list("match", rows));
     return tree;
 }
+void prop_write(prop_writer& writer,
+    const std::vector<client::stealth_row>& rows)
+{
+    // Table rows are formatted directly, without a property tree per row.
+    const auto table = writer.table();
+    if (table != nullptr)
+    {
+        for (const auto& row: rows)
+        {
+            table->begin("match");
+            table->cell_base16(row.ephemeral_public_key);
+            table->cell_base16(row.public_key_hash);
+            table->cell(row.transaction_hash);
+            table->end();
+        }
+
+        return;
+    }
+
+    writer.begin("stealth");
+    prop_write_list(writer, "match", rows);
+    writer.end();
+}
 
 // metadata
 
@@ -0,0 +1,499 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/prop_writer.hpp>
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <boost/property_tree/ptree.hpp>
+#include <bitcoin/explorer/binary_writer.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/table_writer.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+
+// The escaping and layout rules below reproduce those of the property_tree
+// info, json and xml writers (with default settings) exactly. The ndjson
+// layout is that of the json writer without pretty printing.
+
+static const size_t indent_size = 4;
+static const std::string info_reserved(" \t{};\n\"");
+
+static std::string info_escape(const std::string& text)
+{
+    std::string out;
+    for (const auto character: text)
+    {
+        switch (character)
+        {
+            case '\0': out += "\\0"; break;
+            case '\a': out += "\\a"; break;
+            case '\b': out += "\\b"; break;
+            case '\f': out += "\\f"; break;
+            case '\n': out += "\\n"; break;
+            case '\r': out += "\\r"; break;
+            case '\v': out += "\\v"; break;
+            case '"': out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            default: out += character; break;
+        }
+    }
+
+    return out;
+}
+
+static bool info_simple(const std::string& text)
+{
+    return !text.empty() &&
+        text.find_first_of(info_reserved) == std::string::npos;
+}
+
+static std::string json_escape(const std::string& text)
+{
+    static const auto digits = "0123456789ABCDEF";
+
+    std::string out;
+    for (const auto character: text)
+    {
+        const auto value = static_cast<unsigned char>(character);
+        if (value == 0x20 || value == 0x21 || (value >= 0x23 && value <= 0x2e) ||
+            (value >= 0x30 && value <= 0x5b) || value >= 0x5d)
+            out += character;
+        else if (character == '\b') out += "\\b";
+        else if (character == '\f') out += "\\f";
+        else if (character == '\n') out += "\\n";
+        else if (character == '\r') out += "\\r";
+        else if (character == '\t') out += "\\t";
+        else if (character == '/') out += "\\/";
+        else if (character == '"') out += "\\\"";
+        else if (character == '\\') out += "\\\\";
+        else
+        {
+            out += "\\u00";
+            out += digits[value / 16];
+            out += digits[value % 16];
+        }
+    }
+
+    return out;
+}
+
+static std::string xml_escape(const std::string& text)
+{
+    // Text of only spaces encodes the first to preserve it on round trip.
+    if (!text.empty() && text.find_first_not_of(' ') == std::string::npos)
+        return "&#32;" + std::string(text.size() - 1, ' ');
+
+    std::string out;
+    for (const auto character: text)
+    {
+        switch (character)
+        {
+            case '<': out += "&lt;"; break;
+            case '>': out += "&gt;"; break;
+            case '&': out += "&amp;"; break;
+            case '"': out += "&quot;"; break;
+            case '\'': out += "&apos;"; break;
+            default: out += character; break;
+        }
+    }
+
+    return out;
+}
+
+prop_writer::prop_writer(std::ostream& output, encoding_engine engine)
+  : output_(output), engine_(engine), levels_{ { "", true, 0 } },
+    finished_(false), record_depth_(0), table_(output, engine)
+{
+    switch (engine_)
+    {
+        case encoding_engine::json:
+            output_ << "{";
+            break;
+        case encoding_engine::xml:
+            output_ << "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n";
+            break;
+        case encoding_engine::cbor:
+        case encoding_engine::msgpack:
+            record_path_.push_back(&record_);
+            break;
+        default:
+            break;
+    }
+}
+
+prop_writer::~prop_writer()
+{
+    finish();
+}
+
+void prop_writer::begin(const std::string& name)
+{
+    levels_.push_back({ name, false, 0 });
+
+    if (!record_path_.empty())
+    {
+        auto& parent = *record_path_.back();
+        auto child = parent.push_back({ name, pt::ptree() });
+        record_path_.push_back(&child->second);
+    }
+}
+
+void prop_writer::end()
+{
+    BITCOIN_ASSERT_MSG(levels_.size() > 1, "No open container.");
+    if (buffered())
+    {
+        const auto name = levels_.back().name;
+        levels_.pop_back();
+        if (record_path_.empty())
+            return;
+
+        record_path_.pop_back();
+        if (levels_.size() == record_depth_)
+            write_record(name, record_);
+
+        return;
+    }
+
+    const auto top = levels_.back();
+    if (top.opened)
+    {
+        close(levels_.size() - 1);
+        levels_.pop_back();
+        return;
+    }
+
+    // A container without elements is written as an empty value.
+    levels_.pop_back();
+    put(top.name, std::string());
+}
+
+void prop_writer::put(const std::string& name, const std::string& value)
+{
+    if (buffered())
+    {
+        // A value makes its container a record, written when it is closed.
+        if (record_path_.empty())
+        {
+            record_.clear();
+            record_path_.push_back(&record_);
+            record_depth_ = levels_.size() - 1;
+        }
+
+        record_path_.back()->push_back({ name, pt::ptree(value) });
+        return;
+    }
+
+    open_pending();
+    write_value(name, value);
+}
+
+void prop_writer::write(const std::string& name, const pt::ptree& tree)
+{
+    // An empty list has no records.
+    if (engine_ == encoding_engine::ndjson && record_path_.empty() &&
+        tree.empty() && tree.data().empty())
+        return;
+
+    if (tree.empty())
+    {
+        put(name, tree.data());
+        return;
+    }
+
+    if (buffered())
+    {
+        if (record_path_.empty())
+            write_records(name, tree);
+        else
+            record_path_.back()->push_back({ name, tree });
+
+        return;
+    }
+
+    begin(name);
+    write(tree);
+    end();
+}
+
+void prop_writer::write(const pt::ptree& tree)
+{
+    for (const auto& element: tree)
+        write(element.first, element.second);
+}
+
+void prop_writer::finish()
+{
+    if (finished_)
+        return;
+
+    while (levels_.size() > 1)
+        end();
+
+    // Collected values outside of any container, or the collected binary
+    // document, form the final record.
+    if (!record_path_.empty())
+    {
+        record_path_.clear();
+        write_record("", record_);
+    }
+
+    switch (engine_)
+    {
+        case encoding_engine::json:
+            output_ << "\n}\n";
+            break;
+        case encoding_engine::xml:
+            output_ << "\n";
+            break;
+        default:
+            break;
+    }
+
+    output_.flush();
+    finished_ = true;
+}
+
+void prop_writer::abandon()
+{
+    output_.flush();
+    finished_ = true;
+}
+
+// Containers are opened when their first element is written.
+void prop_writer::open_pending()
+{
+    for (size_t depth = 1; depth < levels_.size(); ++depth)
+        if (!levels_[depth].opened)
+            open(depth);
+}
+
+// Write the separator and indentation for a new element of a container.
+void prop_writer::start_element(size_t depth)
+{
+    auto& parent = levels_[depth];
+    switch (engine_)
+    {
+        case encoding_engine::json:
+            output_ << (parent.elements == 0 ? "\n" : ",\n");
+            write_indent(depth + 1);
+            break;
+        case encoding_engine::xml:
+            break;
+        default:
+            write_indent(depth);
+            break;
+    }
+
+    ++parent.elements;
+}
+
+void prop_writer::open(size_t depth)
+{
+    auto& container = levels_[depth];
+    start_element(depth - 1);
+
+    switch (engine_)
+    {
+        case encoding_engine::json:
+            output_ << "\"" << json_escape(container.name) << "\": {";
+            break;
+        case encoding_engine::xml:
+            output_ << "<" << container.name << ">";
+            break;
+        default:
+            write_key(container.name);
+            output_ << "\n";
+            write_indent(depth - 1);
+            output_ << "{\n";
+            break;
+    }
+
+    container.opened = true;
+}
+
+void prop_writer::close(size_t depth)
+{
+    const auto& container = levels_[depth];
+    switch (engine_)
+    {
+        case encoding_engine::json:
+            output_ << "\n";
+            write_indent(depth);
+            output_ << "}";
+            break;
+        case encoding_engine::xml:
+            output_ << "</" << container.name << ">";
+            break;
+        default:
+            write_indent(depth - 1);
+            output_ << "}\n";
+            break;
+    }
+}
+
+void prop_writer::write_key(const std::string& name)
+{
+    const auto key = info_escape(name);
+    if (info_simple(key))
+        output_ << key;
+    else
+        output_ << "\"" << key << "\"";
+}
+
+void prop_writer::write_value(const std::string& name,
+    const std::string& value)
+{
+    start_element(levels_.size() - 1);
+
+    switch (engine_)
+    {
+        case encoding_engine::json:
+            output_ << "\"" << json_escape(name) << "\": \"" <<
+                json_escape(value) << "\"";
+            break;
+        case encoding_engine::xml:
+            if (value.empty())
+                output_ << "<" << name << "/>";
+            else
+                output_ << "<" << name << ">" << xml_escape(value) << "</" <<
+                    name << ">";
+            break;
+        default:
+        {
+            write_key(name);
+            const auto data = info_escape(value);
+            if (data.empty())
+                output_ << " \"\"\n";
+            else if (info_simple(data))
+                output_ << " " << data << "\n";
+            else
+                output_ << " \"" << data << "\"\n";
+            break;
+        }
+    }
+}
+
+void prop_writer::write_indent(size_t count)
+{
+    output_ << std::string(count * indent_size, ' ');
+}
+
+bool prop_writer::buffered() const
+{
+    return engine_ == encoding_engine::ndjson ||
+        engine_ == encoding_engine::cbor ||
+        engine_ == encoding_engine::msgpack ||
+        engine_ == encoding_engine::csv ||
+        engine_ == encoding_engine::tsv;
+}
+
+table_writer* prop_writer::table()
+{
+    const auto table = engine_ == encoding_engine::csv ||
+        engine_ == encoding_engine::tsv;
+
+    return table ? &table_ : nullptr;
+}
+
+// A container of values is a record, a container of like-named containers
+// is a list of records, and any other container is searched for records.
+void prop_writer::write_records(const std::string& name,
+    const pt::ptree& tree)
+{
+    const auto& first = tree.front().first;
+    auto values = false;
+    auto list = true;
+    for (const auto& element: tree)
+    {
+        values |= element.second.empty();
+        list &= (element.first == first);
+    }
+
+    if (values)
+    {
+        write_record(name, tree);
+        return;
+    }
+
+    for (const auto& element: tree)
+    {
+        if (list)
+            write_record(element.first, element.second);
+        else
+            write_records(element.first, element.second);
+    }
+}
+
+void prop_writer::write_record(const std::string& name,
+    const pt::ptree& tree)
+{
+    switch (engine_)
+    {
+        case encoding_engine::csv:
+        case encoding_engine::tsv:
+            // Table rows are not flushed individually.
+            table_.write(name, tree);
+            return;
+        case encoding_engine::cbor:
+            write_cbor(output_, tree);
+            break;
+        case encoding_engine::msgpack:
+            write_msgpack(output_, tree);
+            break;
+        default:
+            write_compact(tree, true);
+            output_ << "\n";
+            break;
+    }
+
+    output_.flush();
+}
+
+void prop_writer::write_compact(const pt::ptree& tree, bool root)
+{
+    if (!root && tree.empty())
+    {
+        output_ << "\"" << json_escape(tree.data()) << "\"";
+        return;
+    }
+
+    // Children without names form an array, as in the json writer.
+    const auto array = !root && tree.count("") == tree.size();
+    output_ << (array ? "[" : "{");
+
+    auto separator = "";
+    for (const auto& element: tree)
+    {
+        output_ << separator;
+        if (!array)
+            output_ << "\"" << json_escape(element.first) << "\":";
+
+        write_compact(element.second, false);
+        separator = ",";
+    }
+
+    output_ << (array ? "]" : "}");
+}
+
+} // namespace explorer
+} // namespace libbitcoin
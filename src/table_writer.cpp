@@ -0,0 +1,349 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/table_writer.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+#include <boost/property_tree/ptree.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+using namespace pt;
+
+namespace libbitcoin {
+namespace explorer {
+
+static const auto hex_digits = "0123456789abcdef";
+
+// The largest uint64_t has 20 decimal digits.
+static const size_t decimal_digits = 20;
+
+const std::vector<std::string>& table_columns(const std::string& type)
+{
+    static const std::map<std::string, std::vector<std::string>> columns
+    {
+        { "address", { "branch", "index", "payment_address" } },
+        { "balance", { "address", "confirmed", "received", "unspent" } },
+        { "header", { "bits", "hash", "merkle_tree_hash", "nonce",
+            "previous_block_hash", "time_stamp", "version" } },
+        { "input", { "address", "previous_output.hash",
+            "previous_output.index", "script", "sequence" } },
+        { "match", { "ephemeral_public_key", "public_key_hash",
+            "transaction_hash" } },
+        { "output", { "address", "script", "stealth.ephemeral_public_key",
+            "stealth.prefix", "value" } },
+        { "transaction", { "hash", "lock_time", "version" } },
+        { "transfer", { "received.hash", "received.height", "received.index",
+            "spent.hash", "spent.height", "spent.index", "value" } }
+    };
+
+    static const std::vector<std::string> none;
+    const auto it = columns.find(type);
+    return it == columns.end() ? none : it->second;
+}
+
+const std::vector<std::string>& table_types(const std::string& type)
+{
+    static const std::vector<std::string> transaction
+    {
+        "transaction", "input", "output"
+    };
+
+    static const std::map<std::string, std::vector<std::string>> types
+    {
+        { "address", { "address", "transfer", "balance" } },
+        { "header", { "header", "transaction", "input", "output" } },
+        { "input", transaction },
+        { "output", transaction },
+        { "transaction", transaction }
+    };
+
+    static const std::vector<std::string> none;
+    const auto it = types.find(type);
+    return it == types.end() ? none : it->second;
+}
+
+// A list is a container of like-named containers.
+static bool is_list(const ptree& tree)
+{
+    if (tree.empty())
+        return false;
+
+    const auto& name = tree.front().first;
+    for (const auto& element: tree)
+        if (element.first != name || element.second.empty())
+            return false;
+
+    return true;
+}
+
+// The value paths of a row, excluding those of any lists it contains.
+static void value_paths(std::vector<std::string>& out, const ptree& tree,
+    const std::string& prefix)
+{
+    for (const auto& element: tree)
+    {
+        const auto path = prefix + element.first;
+        if (element.second.empty())
+        {
+            if (std::find(out.begin(), out.end(), path) == out.end())
+                out.push_back(path);
+        }
+        else if (!is_list(element.second))
+        {
+            value_paths(out, element.second, path + ".");
+        }
+    }
+}
+
+table_writer::table_writer(std::ostream& output, encoding_engine engine)
+  : output_(output), separator_(engine == encoding_engine::tsv ? '\t' : ','),
+    cell_text_(&line_), first_(true), started_(false), skipped_(false),
+    cell_(0)
+{
+}
+
+// The first row sets the table and writes its header. Returns false if the
+// row type is not in the table.
+bool table_writer::start(const std::string& type, const ptree* row)
+{
+    if (!started_)
+    {
+        started_ = true;
+        types_ = table_types(type);
+        if (types_.empty())
+            types_.push_back(type);
+
+        for (const auto& table_type: types_)
+            for (const auto& column: table_columns(table_type))
+                if (std::find(columns_.begin(), columns_.end(), column) ==
+                    columns_.end())
+                    columns_.push_back(column);
+
+        if (columns_.empty() && row != nullptr)
+            value_paths(columns_, *row, "");
+
+        skipped_ = false;
+        line_.clear();
+        first_ = true;
+        if (types_.size() > 1)
+            cell("type");
+
+        for (const auto& column: columns_)
+            cell(column);
+
+        end();
+    }
+
+    return std::find(types_.begin(), types_.end(), type) != types_.end();
+}
+
+void table_writer::begin(const std::string& type)
+{
+    positions_.clear();
+    skipped_ = !start(type, nullptr);
+
+    line_.clear();
+    first_ = true;
+    if (skipped_ || types_.size() == 1)
+        return;
+
+    // The cells of the type are placed in its columns of the table.
+    cell(type);
+    for (const auto& column: table_columns(type))
+        positions_.push_back(std::find(columns_.begin(), columns_.end(),
+            column) - columns_.begin());
+
+    cells_.assign(columns_.size() + 1, std::string());
+    cell_ = 0;
+}
+
+void table_writer::cell(const std::string& value)
+{
+    separate();
+    escape(value.data(), value.data() + value.size());
+}
+
+void table_writer::cell(uint64_t value)
+{
+    separate();
+
+    char digits[decimal_digits];
+    auto it = digits + decimal_digits;
+    do
+    {
+        *--it = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+
+    cell_text_->append(it, digits + decimal_digits);
+}
+
+void table_writer::cell(const hash_digest& value)
+{
+    separate();
+    for (auto it = value.rbegin(); it != value.rend(); ++it)
+    {
+        *cell_text_ += hex_digits[*it >> 4];
+        *cell_text_ += hex_digits[*it & 0x0f];
+    }
+}
+
+void table_writer::cell_base16(data_slice value)
+{
+    separate();
+    for (const auto byte: value)
+    {
+        *cell_text_ += hex_digits[byte >> 4];
+        *cell_text_ += hex_digits[byte & 0x0f];
+    }
+}
+
+void table_writer::skip()
+{
+    separate();
+}
+
+void table_writer::end()
+{
+    if (skipped_)
+        return;
+
+    if (!positions_.empty())
+    {
+        for (size_t index = 0; index < columns_.size(); ++index)
+        {
+            line_ += separator_;
+            line_ += cells_[index];
+        }
+
+        positions_.clear();
+    }
+
+    line_ += '\n';
+    output_.write(line_.data(), line_.size());
+}
+
+void table_writer::write(const std::string& type, const ptree& row)
+{
+    // A row of an unknown type without values of its own only holds lists.
+    std::vector<std::string> paths;
+    if (table_columns(type).empty() && table_types(type).empty())
+        value_paths(paths, row, "");
+
+    const auto values = !paths.empty() || !table_columns(type).empty();
+    if (values && start(type, &row))
+    {
+        positions_.clear();
+        skipped_ = false;
+        line_.clear();
+        first_ = true;
+        if (types_.size() > 1)
+            cell(type);
+
+        for (const auto& column: columns_)
+        {
+            const auto value = row.get_optional<std::string>(
+                ptree::path_type(column, '.'));
+
+            if (value)
+                cell(value.get());
+            else
+                skip();
+        }
+
+        end();
+    }
+
+    for (const auto& element: row)
+        if (is_list(element.second))
+            for (const auto& child: element.second)
+                write(child.first, child.second);
+}
+
+// A cell of a row of several row types is held until the row is complete.
+void table_writer::separate()
+{
+    if (!positions_.empty())
+    {
+        const auto index = cell_ < positions_.size() ? positions_[cell_] :
+            columns_.size();
+
+        cell_text_ = &cells_[index];
+        ++cell_;
+        return;
+    }
+
+    if (!first_)
+        line_ += separator_;
+
+    first_ = false;
+    cell_text_ = &line_;
+}
+
+// Csv quotes a cell that requires it, and tsv escapes the special characters.
+void table_writer::escape(const char* begin, const char* end)
+{
+    if (separator_ == '\t')
+    {
+        for (auto it = begin; it != end; ++it)
+        {
+            switch (*it)
+            {
+                case '\t': *cell_text_ += "\\t"; break;
+                case '\n': *cell_text_ += "\\n"; break;
+                case '\r': *cell_text_ += "\\r"; break;
+                case '\\': *cell_text_ += "\\\\"; break;
+                default: *cell_text_ += *it; break;
+            }
+        }
+
+        return;
+    }
+
+    if (std::find_if(begin, end, [](char character)
+    {
+        return character == ',' || character == '"' || character == '\n' ||
+            character == '\r';
+    }) == end)
+    {
+        cell_text_->append(begin, end);
+        return;
+    }
+
+    *cell_text_ += '"';
+    for (auto it = begin; it != end; ++it)
+    {
+        if (*it == '"')
+            *cell_text_ += '"';
+
+        *cell_text_ += *it;
+    }
+
+    *cell_text_ += '"';
+}
+
+} // namespace explorer
+} // namespace libbitcoin
@@ -41,8 +41,10 @@
 #include <boost/property_tree/json_parser.hpp>
 #include <boost/property_tree/xml_parser.hpp>
 #include <bitcoin/client.hpp>
+#include <bitcoin/explorer/binary_writer.hpp>
 #include <bitcoin/explorer/command.hpp>
 #include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/prop_writer.hpp>
 
 using namespace boost::posix_time;
 using namespace bc::client;
@@ -51,6 +53,12 @@ using boost::filesystem::path;
 namespace libbitcoin {
 namespace explorer {
 
+size_t point_hasher::operator()(const chain::output_point& point) const
+{
+    return static_cast<size_t>(read_little(point.hash.data(), 8) ^
+        (point.index * 0x9e3779b97f4a7c15ull));
+}
+
 bool is_base2(const std::string& text)
 {
     for (const auto& character: text)
@@ -60,6 +68,33 @@ bool is_base2(const std::string& text)
     return true;
 }
 
+// Stealth senders grind for an even ephemeral key, so a key without its
+// sign byte is even.
+bool confirm_stealth(const client::stealth_row& row,
+    const ec_secret& scan_secret, const ec_compressed& spend_pubkey)
+{
+    const auto& ephemeral_key = row.ephemeral_public_key;
+    const auto size = ephemeral_key.size();
+    if (size != ec_compressed_size && size != ec_compressed_size - 1)
+        return false;
+
+    ec_compressed product;
+    static constexpr uint8_t even_sign = 0x02;
+    product[0] = even_sign;
+    std::copy(ephemeral_key.begin(), ephemeral_key.end(),
+        product.end() - size);
+
+    if (!bc::ec_multiply(product, scan_secret))
+        return false;
+
+    const auto shared_secret = sha256_hash(product);
+    ec_compressed stealth_public(spend_pubkey);
+    if (!bc::ec_add(stealth_public, shared_secret))
+        return false;
+
+    return bitcoin_short_hash(stealth_public) == row.public_key_hash;
+}
+
 connection_type get_connection(const command& cmd)
 {
     const auto connect_timeout_milliseconds = period_ms(
@@ -116,6 +151,15 @@ void random_fill(data_chunk& chunk)
     pseudo_random_fill(chunk);
 }
 
+uint64_t read_little(const uint8_t* data, size_t size)
+{
+    uint64_t value = 0;
+    for (size_t byte = size; byte > 0; --byte)
+        value = (value << 8) | data[byte - 1];
+
+    return value;
+}
+
 // TODO: switch to binary for raw (primitive) reads in windows.
 std::string read_stream(std::istream& stream)
 {
@@ -186,6 +230,14 @@ data_chunk wrap(const wrapped_data& data)
     return bytes;
 }
 
+uint8_t* write_little(uint8_t* data, uint64_t value, size_t size)
+{
+    for (size_t byte = 0; byte < size; ++byte, value >>= 8)
+        data[byte] = static_cast<uint8_t>(value);
+
+    return data + size;
+}
+
 // We aren't yet using a reader, although it is possible using ptree.
 std::ostream& write_stream(std::ostream& output, const pt::ptree& tree,
     encoding_engine engine)
@@ -195,12 +247,30 @@ std::ostream& write_stream(std::ostream& output, const pt::ptree& tree,
         case encoding_engine::json:
             pt::write_json(output, tree);
             break;
+        case encoding_engine::ndjson:
+        case encoding_engine::csv:
+        case encoding_engine::tsv:
+        {
+            // Each row of the tree is written as a line as it is visited.
+            prop_writer writer(output, engine);
+            writer.write(tree);
+            writer.finish();
+            break;
+        }
         case encoding_engine::xml:
             pt::write_xml(output, tree);
 
             // property tree XML serialization doesn't terminate the string.
             output << std::endl;
 
+            break;
+        case encoding_engine::cbor:
+            write_cbor(output, tree);
+            output.flush();
+            break;
+        case encoding_engine::msgpack:
+            write_msgpack(output, tree);
+            output.flush();
             break;
         default:
             pt::write_info(output, tree);
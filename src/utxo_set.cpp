@@ -0,0 +1,508 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/utxo_set.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+#include <boost/filesystem.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/block_file.hpp>
+#include <bitcoin/explorer/block_parser.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/hash_stream.hpp>
+#include <bitcoin/explorer/mapped_file.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+using namespace bc::wallet;
+using namespace boost::filesystem;
+
+namespace libbitcoin {
+namespace explorer {
+
+// The file is a header, the output table, the address table and the output
+// positions of the addresses, all little-endian:
+// header:   magic[4] version[4] blocks[8] outputs[8] output_capacity[8]
+//           address_capacity[8] positions[8]
+// output:   kind[1] point.hash[32] point.index[4] height[4] value[8]
+//           address[20]
+// address:  address[20] first[8] count[4]
+// position: output[8]
+// Both tables are open addressing with linear probing and a power of two
+// capacity. An empty output has kind zero and an empty address a zero count.
+static const uint32_t snapshot_magic = 0x75786278;
+static const uint32_t snapshot_version = 1;
+static const size_t header_size = 48;
+static const size_t output_size = 69;
+static const size_t address_size = 32;
+static const size_t position_size = 8;
+
+static const uint8_t kind_empty = 0;
+static const uint8_t kind_unaddressed = 1;
+static const uint8_t kind_addressed = 2;
+
+// Tables are at most half full, which bounds the length of probes.
+static const size_t minimum_capacity = 16;
+
+// The number of outputs written to the file at a time.
+static const size_t write_outputs = 4096;
+
+// The hashes place the entries of the file, so they do not depend on the
+// platform, see point_hasher. Address hashes are uniformly distributed.
+static uint64_t address_hash(const short_hash& address)
+{
+    return read_little(address.data(), 8);
+}
+
+static size_t table_capacity(size_t count)
+{
+    auto capacity = minimum_capacity;
+    while (capacity < 2 * count)
+        capacity *= 2;
+
+    return capacity;
+}
+
+static bool point_equal(const uint8_t* data, const chain::output_point& point)
+{
+    return std::memcmp(data + 1, point.hash.data(), hash_size) == 0 &&
+        read_little(data + 1 + hash_size, 4) == point.index;
+}
+
+static utxo_entry read_output(const uint8_t* data)
+{
+    utxo_entry entry;
+    entry.addressed = data[0] == kind_addressed;
+    std::copy(data + 1, data + 33, entry.point.hash.begin());
+    entry.point.index = static_cast<uint32_t>(read_little(data + 33, 4));
+    entry.height = static_cast<uint32_t>(read_little(data + 37, 4));
+    entry.value = read_little(data + 41, 8);
+    std::copy(data + 49, data + 69, entry.address.begin());
+    return entry;
+}
+
+static void write_output(uint8_t* data, const utxo_entry& entry)
+{
+    *data++ = entry.addressed ? kind_addressed : kind_unaddressed;
+    data = std::copy(entry.point.hash.begin(), entry.point.hash.end(), data);
+    data = write_little(data, entry.point.index, 4);
+    data = write_little(data, entry.height, 4);
+    data = write_little(data, entry.value, 8);
+    std::copy(entry.address.begin(), entry.address.end(), data);
+}
+
+// utxo_set
+// ----------------------------------------------------------------------------
+
+utxo_set::utxo_set(const path& path)
+  : file_(path), valid_(false), blocks_(0), outputs_(0), output_capacity_(0),
+    address_capacity_(0), positions_(0)
+{
+    const auto data = file_.data();
+    if (!file_.valid() || data.size() < header_size)
+        return;
+
+    const auto begin = data.data();
+    if (read_little(begin, 4) != snapshot_magic ||
+        read_little(begin + 4, 4) != snapshot_version)
+        return;
+
+    const auto blocks = read_little(begin + 8, 8);
+    const auto outputs = read_little(begin + 16, 8);
+    const auto output_capacity = read_little(begin + 24, 8);
+    const auto address_capacity = read_little(begin + 32, 8);
+    const auto positions = read_little(begin + 40, 8);
+    const auto power_of_two = [](uint64_t value)
+    {
+        return value != 0 && (value & (value - 1)) == 0;
+    };
+
+    // The capacities are bounded before the sizes are multiplied.
+    const auto available = data.size() - header_size;
+    if (!power_of_two(output_capacity) || !power_of_two(address_capacity) ||
+        outputs >= output_capacity || positions > outputs ||
+        output_capacity > available / output_size ||
+        address_capacity > available / address_size ||
+        header_size + output_capacity * output_size +
+        address_capacity * address_size + positions * position_size !=
+        data.size())
+        return;
+
+    blocks_ = static_cast<size_t>(blocks);
+    outputs_ = static_cast<size_t>(outputs);
+    output_capacity_ = static_cast<size_t>(output_capacity);
+    address_capacity_ = static_cast<size_t>(address_capacity);
+    positions_ = static_cast<size_t>(positions);
+    valid_ = true;
+}
+
+bool utxo_set::valid() const
+{
+    return valid_;
+}
+
+size_t utxo_set::blocks() const
+{
+    return blocks_;
+}
+
+size_t utxo_set::size() const
+{
+    return outputs_;
+}
+
+bool utxo_set::find(utxo_entry& out,
+    const chain::output_point& point) const
+{
+    // Probes are bounded by the capacity in case the file is not sound.
+    const auto outputs = outputs_begin();
+    const auto mask = output_capacity_ - 1;
+    auto slot = point_hasher()(point) & mask;
+    for (size_t probe = 0; probe < output_capacity_; ++probe)
+    {
+        const auto output = outputs + slot * output_size;
+        if (output[0] == kind_empty)
+            return false;
+
+        if (point_equal(output, point))
+        {
+            out = read_output(output);
+            return true;
+        }
+
+        slot = (slot + 1) & mask;
+    }
+
+    return false;
+}
+
+std::vector<utxo_entry> utxo_set::unspent(
+    const short_hash& address) const
+{
+    std::vector<utxo_entry> entries;
+    const auto addresses = addresses_begin();
+    const auto mask = address_capacity_ - 1;
+    auto slot = address_hash(address) & mask;
+    for (size_t probe = 0; probe < address_capacity_; ++probe)
+    {
+        const auto entry = addresses + slot * address_size;
+        const auto count = read_little(entry + 28, 4);
+        if (count == 0)
+            break;
+
+        if (std::memcmp(entry, address.data(), short_hash_size) != 0)
+        {
+            slot = (slot + 1) & mask;
+            continue;
+        }
+
+        const auto first = read_little(entry + 20, 8);
+        if (first > positions_ || count > positions_ - first)
+            break;
+
+        const auto positions = positions_begin() + first * position_size;
+        for (size_t index = 0; index < count; ++index)
+        {
+            const auto position = read_little(
+                positions + index * position_size, 8);
+
+            if (position < output_capacity_)
+                entries.push_back(read_output(
+                    outputs_begin() + position * output_size));
+        }
+
+        break;
+    }
+
+    return entries;
+}
+
+const uint8_t* utxo_set::outputs_begin() const
+{
+    return file_.data().data() + header_size;
+}
+
+const uint8_t* utxo_set::addresses_begin() const
+{
+    return outputs_begin() + output_capacity_ * output_size;
+}
+
+const uint8_t* utxo_set::positions_begin() const
+{
+    return addresses_begin() + address_capacity_ * address_size;
+}
+
+// utxo_set_writer
+// ----------------------------------------------------------------------------
+
+struct replayed_block
+{
+    bool valid;
+    chain::block block;
+    std::vector<data_slice> transactions;
+    std::vector<hash_digest> hashes;
+    std::vector<utxo_entry> outputs;
+};
+
+static void find_outputs(replayed_block& replayed, size_t height)
+{
+    const auto& transactions = replayed.block.transactions;
+    for (size_t index = 0; index < transactions.size(); ++index)
+    {
+        const auto& outputs = transactions[index].outputs;
+        for (uint32_t output = 0; output < outputs.size(); ++output)
+        {
+            const auto address = payment_address::extract(
+                outputs[output].script);
+
+            utxo_entry entry;
+            entry.point.hash = replayed.hashes[index];
+            entry.point.index = output;
+            entry.value = outputs[output].value;
+            entry.height = static_cast<uint32_t>(height);
+            entry.addressed = static_cast<bool>(address);
+            entry.address = address ? address.hash() : short_hash();
+            replayed.outputs.push_back(entry);
+        }
+    }
+}
+
+utxo_set_writer::utxo_set_writer(const path& path)
+  : path_(path), blocks_(0), size_(0), used_(minimum_capacity),
+    slots_(minimum_capacity)
+{
+}
+
+size_t utxo_set_writer::blocks() const
+{
+    return blocks_;
+}
+
+size_t utxo_set_writer::size() const
+{
+    return size_;
+}
+
+bool utxo_set_writer::add(const std::vector<data_slice>& files,
+    const std::vector<block_record>& records,
+    const std::vector<size_t>& chain, size_t blocks)
+{
+    const auto parse = [](replayed_block& replayed, size_t height,
+        data_slice block)
+    {
+        replayed.valid = parse_block(replayed.block, replayed.transactions,
+            block) == block.size();
+
+        if (replayed.valid)
+        {
+            replayed.hashes = bitcoin256_batch(replayed.transactions);
+            find_outputs(replayed, height);
+        }
+    };
+
+    // The table is updated in chain order, spends before the outputs of each
+    // transaction. The coinbase input spends nothing.
+    const auto apply = [this](std::vector<replayed_block>& window, size_t)
+    {
+        for (const auto& replayed: window)
+        {
+            if (!replayed.valid)
+                return false;
+
+            auto output = replayed.outputs.begin();
+            for (const auto& transaction: replayed.block.transactions)
+            {
+                for (const auto& input: transaction.inputs)
+                    erase(input.previous_output);
+
+                const auto outputs = transaction.outputs.size();
+                for (size_t index = 0; index < outputs; ++index)
+                    insert(*output++);
+            }
+
+            ++blocks_;
+        }
+
+        return true;
+    };
+
+    return replay_blocks<replayed_block>(files, records, chain, blocks_,
+        std::min(blocks, chain.size()), parse, apply);
+}
+
+size_t utxo_set_writer::find(const chain::output_point& point) const
+{
+    const auto mask = slots_.size() - 1;
+    auto slot = point_hasher()(point) & mask;
+    while (used_[slot] && !(slots_[slot].point == point))
+        slot = (slot + 1) & mask;
+
+    return slot;
+}
+
+void utxo_set_writer::insert(const utxo_entry& entry)
+{
+    // A duplicate transaction hash replaces the unspent outputs of the
+    // earlier transaction, as it did in the chain.
+    const auto slot = find(entry.point);
+    if (!used_[slot])
+        ++size_;
+
+    used_[slot] = true;
+    slots_[slot] = entry;
+
+    if (2 * size_ > slots_.size())
+        grow();
+}
+
+// Removal shifts back the following entries of the probe sequence that are
+// not at their home slot, so that the table needs no tombstones.
+void utxo_set_writer::erase(const chain::output_point& point)
+{
+    auto hole = find(point);
+    if (!used_[hole])
+        return;
+
+    const auto mask = slots_.size() - 1;
+    for (auto slot = (hole + 1) & mask; used_[slot]; slot = (slot + 1) & mask)
+    {
+        const auto home = point_hasher()(slots_[slot].point) & mask;
+
+        // Move the entry if its home is not cyclically within (hole, slot].
+        const auto distance = (slot - home) & mask;
+        if (distance >= ((slot - hole) & mask))
+        {
+            slots_[hole] = slots_[slot];
+            hole = slot;
+        }
+    }
+
+    used_[hole] = false;
+    --size_;
+}
+
+void utxo_set_writer::grow()
+{
+    std::vector<uint8_t> used(2 * slots_.size());
+    std::vector<utxo_entry> slots(2 * slots_.size());
+    used_.swap(used);
+    slots_.swap(slots);
+    size_ = 0;
+
+    for (size_t slot = 0; slot < slots.size(); ++slot)
+        if (used[slot])
+            insert(slots[slot]);
+}
+
+bool utxo_set_writer::write() const
+{
+    // The positions of the addressed outputs, grouped by address.
+    std::vector<std::pair<short_hash, uint64_t>> positions;
+    for (size_t slot = 0; slot < slots_.size(); ++slot)
+        if (used_[slot] && slots_[slot].addressed)
+            positions.emplace_back(slots_[slot].address, slot);
+
+    std::sort(positions.begin(), positions.end());
+
+    size_t addresses = 0;
+    for (size_t index = 0; index < positions.size(); ++index)
+        if (index == 0 || positions[index].first != positions[index - 1].first)
+            ++addresses;
+
+    const auto address_capacity = table_capacity(addresses);
+    const auto mask = address_capacity - 1;
+    data_chunk address_table(address_capacity * address_size, 0);
+    for (size_t first = 0; first < positions.size();)
+    {
+        const auto& address = positions[first].first;
+        auto last = first + 1;
+        while (last < positions.size() && positions[last].first == address)
+            ++last;
+
+        auto slot = address_hash(address) & mask;
+        while (read_little(address_table.data() + slot * address_size + 28, 4)
+            != 0)
+            slot = (slot + 1) & mask;
+
+        auto data = address_table.data() + slot * address_size;
+        data = std::copy(address.begin(), address.end(), data);
+        data = write_little(data, first, 8);
+        write_little(data, last - first, 4);
+        first = last;
+    }
+
+    auto temporary = path_;
+    temporary += ".tmp";
+
+    {
+        bc::ofstream file(temporary.string(), std::ios::binary);
+        if (!file.good())
+            return false;
+
+        data_chunk buffer(header_size);
+        auto data = buffer.data();
+        data = write_little(data, snapshot_magic, 4);
+        data = write_little(data, snapshot_version, 4);
+        data = write_little(data, blocks_, 8);
+        data = write_little(data, size_, 8);
+        data = write_little(data, slots_.size(), 8);
+        data = write_little(data, address_capacity, 8);
+        write_little(data, positions.size(), 8);
+        file.write(reinterpret_cast<const char*>(buffer.data()),
+            buffer.size());
+
+        for (size_t first = 0; first < slots_.size(); first += write_outputs)
+        {
+            const auto count = std::min(write_outputs, slots_.size() - first);
+            buffer.assign(count * output_size, 0);
+            for (size_t index = 0; index < count; ++index)
+                if (used_[first + index])
+                    write_output(buffer.data() + index * output_size,
+                        slots_[first + index]);
+
+            file.write(reinterpret_cast<const char*>(buffer.data()),
+                buffer.size());
+        }
+
+        file.write(reinterpret_cast<const char*>(address_table.data()),
+            address_table.size());
+
+        buffer.resize(positions.size() * position_size);
+        for (size_t index = 0; index < positions.size(); ++index)
+            write_little(buffer.data() + index * position_size,
+                positions[index].second, 8);
+
+        file.write(reinterpret_cast<const char*>(buffer.data()),
+            buffer.size());
+
+        if (!file.good())
+            return false;
+    }
+
+    boost::system::error_code ec;
+    rename(temporary, path_, ec);
+    return !ec;
+}
+
+} // namespace explorer
+} // namespace libbitcoin
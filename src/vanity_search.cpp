@@ -0,0 +1,282 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/vanity_search.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <boost/multiprecision/cpp_int.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/base58_codec.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/ec_batch.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+
+using boost::multiprecision::cpp_int;
+
+static const std::string base58_alphabet =
+    "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
+
+// An address is the version, the hash and the checksum, as one integer.
+static const size_t payload_size = 1 + short_hash_size + checksum_size;
+static const size_t checksum_bits = checksum_size * byte_bits;
+static const size_t hash_bits = short_hash_size * byte_bits;
+
+// The number of points normalized by one inversion.
+static const size_t batch_size = 256;
+
+static cpp_int power(unsigned base, size_t exponent)
+{
+    cpp_int value = 1;
+    for (size_t count = 0; count < exponent; ++count)
+        value *= base;
+
+    return value;
+}
+
+static short_hash to_hash(const cpp_int& value)
+{
+    std::vector<uint8_t> bytes;
+    export_bits(value, std::back_inserter(bytes), byte_bits);
+
+    short_hash out{ { 0 } };
+    std::copy(bytes.begin(), bytes.end(), out.end() - bytes.size());
+    return out;
+}
+
+// The intervals [first, last) of address integers whose encoding begins with
+// the prefix. Each leading '1' is a leading zero byte. The remaining digits
+// are the leading digits of the rest of the integer, for each length of its
+// encoding, so the integer must have exactly as many zero bytes.
+static std::vector<std::pair<cpp_int, cpp_int>> address_intervals(
+    const std::string& prefix)
+{
+    std::vector<std::pair<cpp_int, cpp_int>> out;
+    const auto zeros = prefix.find_first_not_of('1') == std::string::npos ?
+        prefix.size() : prefix.find_first_not_of('1');
+
+    if (zeros > payload_size)
+        return out;
+
+    const auto upper = power(256, payload_size - zeros);
+    if (zeros == prefix.size())
+    {
+        out.push_back({ 0, upper });
+        return out;
+    }
+
+    if (zeros == payload_size)
+        return out;
+
+    cpp_int digits = 0;
+    for (auto character: prefix.substr(zeros))
+        digits = digits * 58 + base58_alphabet.find(character);
+
+    const auto lower = power(256, payload_size - zeros - 1);
+    for (cpp_int scale = 1; digits * scale < upper; scale *= 58)
+    {
+        const auto first = std::max<cpp_int>(digits * scale, lower);
+        const auto last = std::min<cpp_int>((digits + 1) * scale, upper);
+        if (first < last)
+            out.push_back({ first, last });
+    }
+
+    return out;
+}
+
+vanity_prefix::vanity_prefix(const std::string& prefix, uint8_t version)
+  : prefix_(prefix), version_(version), ranges_(), difficulty_(0)
+{
+    if (prefix.empty() ||
+        prefix.find_first_not_of(base58_alphabet) != std::string::npos)
+        return;
+
+    // The version is the high byte and the checksum the low bytes.
+    const auto span = cpp_int(1) << (hash_bits + checksum_bits);
+    const auto base = cpp_int(version) * span;
+    cpp_int measure = 0;
+
+    for (const auto& interval: address_intervals(prefix))
+    {
+        const auto first = std::max<cpp_int>(interval.first, base);
+        const auto last = std::min<cpp_int>(interval.second, base + span);
+        if (first >= last)
+            continue;
+
+        measure += last - first;
+        ranges_.push_back(
+        {
+            to_hash((first - base) >> checksum_bits),
+            to_hash((last - base - 1) >> checksum_bits)
+        });
+    }
+
+    if (ranges_.empty())
+        return;
+
+    // Ranges of adjacent encoding lengths may share a boundary hash.
+    std::sort(ranges_.begin(), ranges_.end());
+    std::vector<range> merged{ ranges_.front() };
+    for (const auto& next: ranges_)
+    {
+        if (next.first <= merged.back().second)
+            merged.back().second = std::max(merged.back().second, next.second);
+        else
+            merged.push_back(next);
+    }
+
+    ranges_.swap(merged);
+    difficulty_ = span.convert_to<double>() / measure.convert_to<double>();
+}
+
+const std::vector<vanity_prefix::range>& vanity_prefix::ranges() const
+{
+    return ranges_;
+}
+
+double vanity_prefix::difficulty() const
+{
+    return difficulty_;
+}
+
+bool vanity_prefix::matches(const short_hash& hash) const
+{
+    const auto below = [](const range& range, const short_hash& hash)
+    {
+        return range.second < hash;
+    };
+
+    const auto it = std::lower_bound(ranges_.begin(), ranges_.end(), hash,
+        below);
+
+    if (it == ranges_.end() || hash < it->first)
+        return false;
+
+    data_chunk payload{ version_ };
+    payload.reserve(payload_size);
+    extend_data(payload, hash);
+    append_checksum(payload);
+    return fast_encode_base58(payload).compare(0, prefix_.size(),
+        prefix_) == 0;
+}
+
+static ec_secret to_secret(uint64_t value)
+{
+    ec_secret out{ { 0 } };
+    for (auto byte = out.rbegin(); value != 0; ++byte, value >>= byte_bits)
+        *byte = static_cast<uint8_t>(value);
+
+    return out;
+}
+
+bool vanity_search(ec_secret& out, uint64_t& keys,
+    const vanity_prefix& prefix, const data_chunk& seed, size_t threads,
+    uint64_t limit, vanity_progress_handler progress)
+{
+    keys = 0;
+    if (prefix.ranges().empty())
+        return false;
+
+    if (threads == 0)
+        threads = std::max(std::thread::hardware_concurrency(), 1u);
+
+    static const ec_field one{ { 1, 0, 0, 0 } };
+
+    std::atomic<bool> stop(false);
+    std::atomic<uint64_t> searched(0);
+    std::mutex mutex;
+    bool found = false;
+
+    const auto search = [&](size_t thread)
+    {
+        auto thread_seed = seed;
+        extend_data(thread_seed, to_big_endian(static_cast<uint32_t>(thread)));
+        const auto start = new_key(thread_seed);
+
+        ec_compressed compressed;
+        ec_affine start_point;
+        if (!secret_to_public(compressed, start) ||
+            !ec_decompress_point(start_point, compressed))
+            return;
+
+        ec_jacobian point{ start_point.x, start_point.y, one, false };
+        std::vector<ec_jacobian> points(batch_size);
+        std::vector<ec_affine> affine;
+
+        for (uint64_t walked = 0; !stop; walked += batch_size)
+        {
+            for (auto& next: points)
+            {
+                next = point;
+                ec_add_point(point, ec_generator);
+            }
+
+            ec_normalize_batch(affine, points);
+
+            for (size_t offset = 0; offset < batch_size; ++offset)
+            {
+                if (points[offset].infinity)
+                    continue;
+
+                const auto hash = bitcoin_short_hash(
+                    ec_compress_point(affine[offset]));
+                if (!prefix.matches(hash))
+                    continue;
+
+                // The key is the start plus its offset, modulo the order.
+                auto secret = start;
+                const auto position = walked + offset;
+                if (position != 0 && !ec_add(secret, to_secret(position)))
+                    continue;
+
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!found)
+                    out = secret;
+
+                found = true;
+                stop = true;
+                break;
+            }
+
+            const auto total = searched += batch_size;
+            if (limit != 0 && total >= limit)
+                stop = true;
+
+            if (thread == 0 && progress)
+                progress(total);
+        }
+    };
+
+    parallel_for(threads, search, threads);
+    keys = searched;
+    return found;
+}
+
+} // namespace explorer
+} // namespace libbitcoin
@@ -0,0 +1,83 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <cstddef>
+#include <random>
+#include <vector>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer.hpp>
+
+using namespace bc;
+using namespace bc::explorer;
+
+BOOST_AUTO_TEST_SUITE(address_filter__match)
+
+static std::vector<short_hash> random_hashes(size_t count, uint32_t seed)
+{
+    std::mt19937 twister(seed);
+    std::vector<short_hash> hashes(count);
+    for (auto& hash: hashes)
+        for (auto& byte: hash)
+            byte = static_cast<uint8_t>(twister());
+
+    return hashes;
+}
+
+BOOST_AUTO_TEST_CASE(address_filter__contains__empty__false)
+{
+    const address_filter filter;
+    BOOST_REQUIRE_EQUAL(filter.size(), 0u);
+    BOOST_REQUIRE(!filter.contains(short_hash()));
+}
+
+BOOST_AUTO_TEST_CASE(address_filter__contains__inserted__true)
+{
+    // Enough hashes to grow the bloom filter several times.
+    const auto hashes = random_hashes(10000, 42);
+    address_filter filter;
+    for (const auto& hash: hashes)
+        filter.insert(hash);
+
+    BOOST_REQUIRE_EQUAL(filter.size(), hashes.size());
+    for (const auto& hash: hashes)
+        BOOST_REQUIRE(filter.contains(hash));
+}
+
+BOOST_AUTO_TEST_CASE(address_filter__contains__not_inserted__false)
+{
+    address_filter filter;
+    for (const auto& hash: random_hashes(1000, 42))
+        filter.insert(hash);
+
+    for (const auto& hash: random_hashes(1000, 43))
+        BOOST_REQUIRE(!filter.contains(hash));
+}
+
+BOOST_AUTO_TEST_CASE(address_filter__insert__duplicate__counted_once)
+{
+    const auto hashes = random_hashes(1, 42);
+    address_filter filter;
+    filter.insert(hashes.front());
+    filter.insert(hashes.front());
+    BOOST_REQUIRE_EQUAL(filter.size(), 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,129 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer.hpp>
+
+using namespace bc;
+using namespace bc::explorer;
+
+// Sizes span the vector widths and their scalar tails.
+static const size_t maximum_size = 200;
+
+static data_chunk random_data(std::mt19937& generator, size_t size)
+{
+    std::uniform_int_distribution<int> byte(0, 255);
+    data_chunk data(size);
+    for (auto& value: data)
+        value = static_cast<uint8_t>(byte(generator));
+
+    return data;
+}
+
+BOOST_AUTO_TEST_SUITE(base16_codec)
+
+BOOST_AUTO_TEST_CASE(base16_codec__kernels__always__include_scalar_and_default)
+{
+    const auto kernels = base16_kernels();
+    BOOST_REQUIRE(kernels.front() == base16_kernel::scalar);
+    BOOST_REQUIRE(kernels.back() == base16_default_kernel());
+}
+
+BOOST_AUTO_TEST_CASE(base16_codec__encode__random__matches_encode_base16)
+{
+    std::mt19937 generator(42);
+    for (size_t size = 0; size <= maximum_size; ++size)
+    {
+        const auto data = random_data(generator, size);
+        const auto expected = encode_base16(data);
+        for (const auto kernel: base16_kernels())
+            BOOST_REQUIRE_EQUAL(fast_encode_base16(data, kernel), expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(base16_codec__decode__random__matches_decode_base16)
+{
+    std::mt19937 generator(42);
+    for (size_t size = 0; size <= maximum_size; ++size)
+    {
+        const auto data = random_data(generator, size);
+        auto text = encode_base16(data);
+
+        // Mix the case of the letters, which are valid in either case.
+        for (size_t index = 0; index < text.size(); index += 3)
+            text[index] = static_cast<char>(std::toupper(text[index]));
+
+        data_chunk expected;
+        BOOST_REQUIRE(decode_base16(expected, text));
+        for (const auto kernel: base16_kernels())
+        {
+            data_chunk out;
+            BOOST_REQUIRE(fast_decode_base16(out, text, kernel));
+            BOOST_REQUIRE(out == expected);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(base16_codec__decode__invalid_character__matches_decode_base16)
+{
+    static const std::string invalid("/:@G`g \x80\xff\0", 10);
+
+    std::mt19937 generator(42);
+    for (size_t size = 1; size <= maximum_size / 2; ++size)
+    {
+        const auto text = encode_base16(random_data(generator, size));
+        for (size_t index = 0; index < text.size(); ++index)
+        {
+            auto malformed = text;
+            malformed[index] = invalid[(size + index) % invalid.size()];
+
+            data_chunk expected;
+            BOOST_REQUIRE(!decode_base16(expected, malformed));
+            for (const auto kernel: base16_kernels())
+            {
+                data_chunk out{ 42 };
+                BOOST_REQUIRE(!fast_decode_base16(out, malformed, kernel));
+                BOOST_REQUIRE(out == data_chunk{ 42 });
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(base16_codec__decode__odd_length__false)
+{
+    std::mt19937 generator(42);
+    for (size_t size = 0; size <= maximum_size / 2; ++size)
+    {
+        const auto text = encode_base16(random_data(generator, size)) + "a";
+        for (const auto kernel: base16_kernels())
+        {
+            data_chunk out;
+            BOOST_REQUIRE(!fast_decode_base16(out, text, kernel));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,159 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer.hpp>
+
+using namespace bc;
+using namespace bc::explorer;
+
+static const size_t maximum_size = 100;
+static const size_t address_size = 25;
+
+static data_chunk random_data(std::mt19937& generator, size_t size,
+    size_t zeros)
+{
+    std::uniform_int_distribution<int> byte(0, 255);
+    data_chunk data(size);
+    for (size_t index = zeros; index < size; ++index)
+        data[index] = static_cast<uint8_t>(byte(generator));
+
+    return data;
+}
+
+static data_chunk random_address(std::mt19937& generator, size_t zeros)
+{
+    auto address = random_data(generator, address_size - checksum_size,
+        zeros);
+    append_checksum(address);
+    return address;
+}
+
+BOOST_AUTO_TEST_SUITE(base58_codec)
+
+BOOST_AUTO_TEST_CASE(base58_codec__encode__random__matches_encode_base58)
+{
+    std::mt19937 generator(42);
+    for (size_t size = 0; size <= maximum_size; ++size)
+    {
+        for (size_t zeros = 0; zeros <= std::min<size_t>(size, 3); ++zeros)
+        {
+            const auto data = random_data(generator, size, zeros);
+            BOOST_REQUIRE_EQUAL(fast_encode_base58(data), encode_base58(data));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(base58_codec__decode__random__matches_decode_base58)
+{
+    std::mt19937 generator(42);
+    for (size_t size = 0; size <= maximum_size; ++size)
+    {
+        for (size_t zeros = 0; zeros <= std::min<size_t>(size, 3); ++zeros)
+        {
+            const auto text = encode_base58(random_data(generator, size,
+                zeros));
+
+            data_chunk expected;
+            BOOST_REQUIRE(decode_base58(expected, text));
+
+            data_chunk out;
+            BOOST_REQUIRE(fast_decode_base58(out, text));
+            BOOST_REQUIRE(out == expected);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(base58_codec__decode__invalid_character__false)
+{
+    static const std::string invalid("0OIl+/ \xff");
+
+    std::mt19937 generator(42);
+    const auto text = encode_base58(random_data(generator, 40, 1));
+    for (size_t index = 0; index < text.size(); ++index)
+    {
+        auto malformed = text;
+        malformed[index] = invalid[index % invalid.size()];
+
+        data_chunk out{ 42 };
+        BOOST_REQUIRE(!fast_decode_base58(out, malformed));
+        BOOST_REQUIRE(out == data_chunk{ 42 });
+    }
+}
+
+BOOST_AUTO_TEST_CASE(base58_codec__decode_batch__addresses__expected)
+{
+    std::mt19937 generator(42);
+    std::vector<std::string> texts;
+    std::vector<data_chunk> payloads;
+    for (size_t zeros = 0; zeros < 4; ++zeros)
+    {
+        payloads.push_back(random_address(generator, zeros));
+        texts.push_back(encode_base58(payloads.back()));
+    }
+
+    // Corrupt checksum, short payload, long payload, invalid character,
+    // missing leading zero digit and overlong text.
+    auto corrupt = payloads.front();
+    corrupt.back() ^= 0x01;
+    texts.push_back(encode_base58(corrupt));
+    texts.push_back(encode_base58(random_address(generator, 0)).substr(1));
+    texts.push_back(encode_base58(random_data(generator, 26, 0)));
+    texts.push_back(texts.front().substr(0, 10) + "0" + texts.front().substr(11));
+    texts.push_back(texts[1].substr(1));
+    texts.push_back(std::string(40, 'z'));
+
+    data_chunk out;
+    const auto unchecked = decode_base58_batch(out, texts, address_size);
+    BOOST_REQUIRE_EQUAL(out.size(), texts.size() * address_size);
+
+    for (size_t index = 0; index < texts.size(); ++index)
+    {
+        data_chunk expected;
+        const auto valid = decode_base58(expected, texts[index]) &&
+            expected.size() == address_size;
+
+        const data_chunk slot(out.begin() + index * address_size,
+            out.begin() + (index + 1) * address_size);
+
+        BOOST_REQUIRE_EQUAL(unchecked[index], valid);
+        BOOST_REQUIRE(slot == (valid ? expected : data_chunk(address_size)));
+    }
+
+    const auto checked = decode_base58_batch(out, texts, address_size, true);
+    for (size_t index = 0; index < texts.size(); ++index)
+    {
+        data_chunk expected;
+        const auto valid = decode_base58(expected, texts[index]) &&
+            expected.size() == address_size && verify_checksum(expected);
+
+        BOOST_REQUIRE_EQUAL(checked[index], valid);
+        BOOST_REQUIRE_EQUAL(checked[index], index < payloads.size());
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,200 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <sstream>
+#include <string>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer.hpp>
+
+using namespace bc;
+using namespace bc::explorer;
+
+// Sizes span the vector widths and their scalar tails.
+static const size_t maximum_size = 200;
+static const size_t stream_size = 300000;
+
+static data_chunk random_data(std::mt19937& generator, size_t size)
+{
+    std::uniform_int_distribution<int> byte(0, 255);
+    data_chunk data(size);
+    for (auto& value: data)
+        value = static_cast<uint8_t>(byte(generator));
+
+    return data;
+}
+
+// Write the data to the handler in pieces of random size.
+template <typename Handler>
+static void write_pieces(std::mt19937& generator, data_slice data,
+    Handler handler)
+{
+    std::uniform_int_distribution<size_t> piece(0, 100000);
+    for (auto it = data.begin(); it != data.end();)
+    {
+        const auto size = std::min<size_t>(piece(generator), data.end() - it);
+        handler(data_slice(it, it + size));
+        it += size;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(base64_codec)
+
+BOOST_AUTO_TEST_CASE(base64_codec__encode__random__matches_encode_base64)
+{
+    std::mt19937 generator(42);
+    for (size_t size = 0; size <= maximum_size; ++size)
+    {
+        const auto data = random_data(generator, size);
+        const auto expected = encode_base64(data);
+        for (const auto kernel: base64_kernels())
+            BOOST_REQUIRE_EQUAL(fast_encode_base64(data, kernel), expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(base64_codec__decode__random__matches_decode_base64)
+{
+    std::mt19937 generator(42);
+    for (size_t size = 0; size <= maximum_size; ++size)
+    {
+        const auto text = encode_base64(random_data(generator, size));
+
+        data_chunk expected;
+        BOOST_REQUIRE(decode_base64(expected, text));
+        for (const auto kernel: base64_kernels())
+        {
+            data_chunk out;
+            BOOST_REQUIRE(fast_decode_base64(out, text, kernel));
+            BOOST_REQUIRE(out == expected);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(base64_codec__decode__invalid_character__false)
+{
+    std::mt19937 generator(42);
+    const auto text = encode_base64(random_data(generator, 96));
+    const auto& digits = std::string(
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/=");
+
+    for (int value = 0; value < 256; ++value)
+    {
+        const auto character = static_cast<char>(value);
+        if (digits.find(character) != std::string::npos)
+            continue;
+
+        for (size_t index = 0; index < text.size(); index += 7)
+        {
+            auto malformed = text;
+            malformed[index] = character;
+            for (const auto kernel: base64_kernels())
+            {
+                data_chunk out{ 42 };
+                BOOST_REQUIRE(!fast_decode_base64(out, malformed, kernel));
+                BOOST_REQUIRE(out == data_chunk{ 42 });
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(base64_codec__decode__misplaced_padding__false)
+{
+    static const std::string malformed[] =
+    {
+        "Zm9v=m9v", "Zg==Zm9v", "Z===", "====", "Zm9", "Zm9vY"
+    };
+
+    for (const auto& text: malformed)
+    {
+        for (const auto kernel: base64_kernels())
+        {
+            data_chunk out;
+            BOOST_REQUIRE(!fast_decode_base64(out, text, kernel));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(base64_codec__encoder__pieces__matches_encode_base64)
+{
+    std::mt19937 generator(42);
+    const auto data = random_data(generator, stream_size);
+    for (const auto kernel: base64_kernels())
+    {
+        std::ostringstream output;
+        base64_encoder encoder(output, kernel);
+        write_pieces(generator, data, [&encoder](data_slice piece)
+        {
+            encoder.write(piece);
+        });
+
+        encoder.finish();
+        BOOST_REQUIRE(output.str() == encode_base64(data));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(base64_codec__decoder__wrapped_pieces__expected)
+{
+    std::mt19937 generator(42);
+    const auto data = random_data(generator, stream_size + 1);
+    const auto encoded = encode_base64(data);
+
+    // Wrap the text in lines of 76 characters.
+    std::string wrapped;
+    for (size_t index = 0; index < encoded.size(); index += 76)
+        wrapped += encoded.substr(index, 76) + "\r\n";
+
+    for (const auto kernel: base64_kernels())
+    {
+        std::ostringstream output;
+        base64_decoder decoder(output, kernel);
+        write_pieces(generator, to_chunk(wrapped),
+            [&decoder](data_slice piece)
+            {
+                BOOST_REQUIRE(decoder.write(piece));
+            });
+
+        BOOST_REQUIRE(decoder.finish());
+        BOOST_REQUIRE(to_chunk(output.str()) == data);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(base64_codec__decoder__malformed__false)
+{
+    for (const auto kernel: base64_kernels())
+    {
+        std::ostringstream output;
+        base64_decoder incomplete(output, kernel);
+        BOOST_REQUIRE(incomplete.write(to_chunk(std::string("Zm9vY"))));
+        BOOST_REQUIRE(!incomplete.finish());
+
+        base64_decoder trailing(output, kernel);
+        BOOST_REQUIRE(trailing.write(to_chunk(std::string("Zg== \n"))));
+        BOOST_REQUIRE(!trailing.write(to_chunk(std::string("Zm9v"))));
+
+        base64_decoder invalid(output, kernel);
+        BOOST_REQUIRE(!invalid.write(to_chunk(std::string("Zm9v Zm*v"))));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
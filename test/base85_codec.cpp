@@ -0,0 +1,241 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer.hpp>
+
+using namespace bc;
+using namespace bc::explorer;
+
+static const size_t maximum_size = 200;
+static const size_t stream_size = 300000;
+static const size_t key_size = 32;
+
+static data_chunk random_data(std::mt19937& generator, size_t size)
+{
+    std::uniform_int_distribution<int> byte(0, 255);
+    data_chunk data(size);
+    for (auto& value: data)
+        value = static_cast<uint8_t>(byte(generator));
+
+    return data;
+}
+
+// Write the data to the handler in pieces of random size.
+template <typename Handler>
+static void write_pieces(std::mt19937& generator, data_slice data,
+    Handler handler)
+{
+    std::uniform_int_distribution<size_t> piece(0, 100000);
+    for (auto it = data.begin(); it != data.end();)
+    {
+        const auto size = std::min<size_t>(piece(generator), data.end() - it);
+        handler(data_slice(it, it + size));
+        it += size;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(base85_codec)
+
+BOOST_AUTO_TEST_CASE(base85_codec__encode__random__matches_encode_base85)
+{
+    std::mt19937 generator(42);
+    for (size_t size = 0; size <= maximum_size; size += 4)
+    {
+        const auto data = random_data(generator, size);
+
+        std::string expected;
+        BOOST_REQUIRE(encode_base85(expected, data));
+
+        std::string out;
+        BOOST_REQUIRE(fast_encode_base85(out, data));
+        BOOST_REQUIRE_EQUAL(out, expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(base85_codec__encode__unaligned__false)
+{
+    std::string out("unchanged");
+    BOOST_REQUIRE(!fast_encode_base85(out, data_chunk(5)));
+    BOOST_REQUIRE_EQUAL(out, "unchanged");
+}
+
+BOOST_AUTO_TEST_CASE(base85_codec__decode__random__matches_decode_base85)
+{
+    std::mt19937 generator(42);
+    for (size_t size = 0; size <= maximum_size; size += 4)
+    {
+        std::string text;
+        BOOST_REQUIRE(encode_base85(text, random_data(generator, size)));
+
+        data_chunk expected;
+        BOOST_REQUIRE(decode_base85(expected, text));
+
+        data_chunk out;
+        BOOST_REQUIRE(fast_decode_base85(out, text));
+        BOOST_REQUIRE(out == expected);
+    }
+}
+
+// rfc.zeromq.org/spec:32
+BOOST_AUTO_TEST_CASE(base85_codec__decode__z85_vectors__expected)
+{
+    data_chunk out;
+    BOOST_REQUIRE(fast_decode_base85(out, "HelloWorld"));
+    BOOST_REQUIRE(out == (data_chunk
+    {
+        0x86, 0x4f, 0xd2, 0x6f, 0xb5, 0x59, 0xf7, 0x5b
+    }));
+
+    BOOST_REQUIRE(fast_decode_base85(out, "%nSc0"));
+    BOOST_REQUIRE(out == (data_chunk{ 0xff, 0xff, 0xff, 0xff }));
+}
+
+BOOST_AUTO_TEST_CASE(base85_codec__decode__invalid__false)
+{
+    // Characters outside of the alphabet, a group above 2^32 - 1 and text
+    // that is not a multiple of five characters.
+    static const std::vector<std::string> invalid
+    {
+        "Hello World", "Hello\"orld", "Hello_orld", "Hello~orld",
+        "Hello\xfforld", "%nSc1", "#####", "Hell"
+    };
+
+    for (const auto& text: invalid)
+    {
+        data_chunk out{ 42 };
+        BOOST_REQUIRE(!fast_decode_base85(out, text));
+        BOOST_REQUIRE(out == data_chunk{ 42 });
+    }
+}
+
+BOOST_AUTO_TEST_CASE(base85_codec__batch__keys__round_trip)
+{
+    std::mt19937 generator(42);
+    const auto keys = random_data(generator, 10 * key_size);
+
+    std::vector<std::string> texts;
+    BOOST_REQUIRE(!encode_base85_batch(texts, keys, 6));
+    BOOST_REQUIRE(!encode_base85_batch(texts, keys, 0));
+    BOOST_REQUIRE(encode_base85_batch(texts, keys, key_size));
+    BOOST_REQUIRE_EQUAL(texts.size(), 10u);
+
+    for (size_t index = 0; index < texts.size(); ++index)
+    {
+        std::string expected;
+        const data_chunk key(keys.begin() + index * key_size,
+            keys.begin() + (index + 1) * key_size);
+
+        BOOST_REQUIRE(encode_base85(expected, key));
+        BOOST_REQUIRE_EQUAL(texts[index], expected);
+    }
+
+    // Invalid character, overflow, short and long text.
+    texts.push_back(std::string(39, '0') + " ");
+    texts.push_back(std::string(40, '#'));
+    texts.push_back(std::string(35, '0'));
+    texts.push_back(std::string(45, '0'));
+
+    data_chunk out;
+    const auto valid = decode_base85_batch(out, texts, key_size);
+    BOOST_REQUIRE_EQUAL(out.size(), texts.size() * key_size);
+
+    for (size_t index = 0; index < texts.size(); ++index)
+    {
+        const auto slot = out.begin() + index * key_size;
+        const data_chunk key(slot, slot + key_size);
+        BOOST_REQUIRE_EQUAL(valid[index], index < 10);
+
+        if (index < 10)
+            BOOST_REQUIRE(std::equal(key.begin(), key.end(),
+                keys.begin() + index * key_size));
+        else
+            BOOST_REQUIRE(key == data_chunk(key_size));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(base85_codec__encoder__pieces__matches_encode_base85)
+{
+    std::mt19937 generator(42);
+    const auto data = random_data(generator, stream_size);
+
+    std::string expected;
+    BOOST_REQUIRE(encode_base85(expected, data));
+
+    std::ostringstream output;
+    base85_encoder encoder(output);
+    write_pieces(generator, data, [&encoder](data_slice piece)
+    {
+        encoder.write(piece);
+    });
+
+    BOOST_REQUIRE(encoder.finish());
+    BOOST_REQUIRE(output.str() == expected);
+
+    std::ostringstream unaligned_output;
+    base85_encoder unaligned(unaligned_output);
+    unaligned.write(data_chunk(6));
+    BOOST_REQUIRE(!unaligned.finish());
+}
+
+BOOST_AUTO_TEST_CASE(base85_codec__decoder__wrapped_pieces__expected)
+{
+    std::mt19937 generator(42);
+    const auto data = random_data(generator, stream_size);
+
+    std::string encoded;
+    BOOST_REQUIRE(encode_base85(encoded, data));
+
+    // Wrap the text in lines of 78 characters.
+    std::string wrapped;
+    for (size_t index = 0; index < encoded.size(); index += 78)
+        wrapped += encoded.substr(index, 78) + "\n";
+
+    std::ostringstream output;
+    base85_decoder decoder(output);
+    write_pieces(generator, to_chunk(wrapped), [&decoder](data_slice piece)
+    {
+        BOOST_REQUIRE(decoder.write(piece));
+    });
+
+    BOOST_REQUIRE(decoder.finish());
+    BOOST_REQUIRE(to_chunk(output.str()) == data);
+}
+
+BOOST_AUTO_TEST_CASE(base85_codec__decoder__malformed__false)
+{
+    std::ostringstream output;
+    base85_decoder invalid(output);
+    BOOST_REQUIRE(!invalid.write(to_chunk(std::string("Hello_orld"))));
+
+    base85_decoder incomplete(output);
+    BOOST_REQUIRE(incomplete.write(to_chunk(std::string("Hello\nWor"))));
+    BOOST_REQUIRE(!incomplete.finish());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,182 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <sstream>
+#include <string>
+#include <boost/property_tree/ptree.hpp>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer.hpp>
+
+using namespace bc;
+using namespace bc::explorer;
+
+static const std::string hash_text(
+    "000000000019d6689c085ae165831e934ff763ae46a2a6c172b3f1b60a8ce26f");
+
+static std::string hash_bytes()
+{
+    data_chunk hash;
+    decode_base16(hash, hash_text);
+    return std::string(hash.begin(), hash.end());
+}
+
+static pt::ptree make_values()
+{
+    pt::ptree tree;
+    tree.put("value", 2);
+    tree.put("filter", "1010");
+    tree.put("label", "123");
+    return tree;
+}
+
+static pt::ptree make_list()
+{
+    pt::ptree row;
+    row.put("value", 1);
+
+    pt::ptree tree;
+    tree.add_child("rows.row", row);
+    return tree;
+}
+
+static std::string cbor(const pt::ptree& tree)
+{
+    std::stringstream output;
+    write_cbor(output, tree);
+    return output.str();
+}
+
+static std::string msgpack(const pt::ptree& tree)
+{
+    std::stringstream output;
+    write_msgpack(output, tree);
+    return output.str();
+}
+
+static std::string streamed(const pt::ptree& tree, encoding_engine engine)
+{
+    std::stringstream output;
+    prop_writer writer(output, engine);
+    writer.write(tree);
+    writer.finish();
+    return output.str();
+}
+
+BOOST_AUTO_TEST_SUITE(binary_writer)
+
+BOOST_AUTO_TEST_CASE(binary_writer__write_cbor__values__schema_types)
+{
+    const std::string expected("\xa3" "\x65" "value" "\x02" "\x66" "filter"
+        "\x64" "1010" "\x65" "label" "\x63" "123");
+    BOOST_REQUIRE_EQUAL(cbor(make_values()), expected);
+}
+
+BOOST_AUTO_TEST_CASE(binary_writer__write_cbor__list_of_one__array)
+{
+    const std::string expected("\xa1" "\x64" "rows" "\xa1" "\x63" "row"
+        "\x81" "\xa1" "\x65" "value" "\x01");
+    BOOST_REQUIRE_EQUAL(cbor(make_list()), expected);
+}
+
+BOOST_AUTO_TEST_CASE(binary_writer__write_cbor__hash__raw_bytes)
+{
+    pt::ptree tree;
+    tree.put("hash", hash_text);
+    const auto expected = std::string("\xa1" "\x64" "hash" "\x58" "\x20") +
+        hash_bytes();
+    BOOST_REQUIRE_EQUAL(cbor(tree), expected);
+}
+
+BOOST_AUTO_TEST_CASE(binary_writer__write_cbor__text_field__text)
+{
+    pt::ptree tree;
+    tree.put("label", hash_text);
+    const auto expected = std::string("\xa1" "\x65" "label" "\x78" "\x40") +
+        hash_text;
+    BOOST_REQUIRE_EQUAL(cbor(tree), expected);
+}
+
+BOOST_AUTO_TEST_CASE(binary_writer__write_cbor__numbers__sized)
+{
+    pt::ptree tree;
+    tree.put("height", 300);
+    tree.put("index", "007");
+    const std::string expected("\xa2" "\x66" "height" "\x19" "\x01" "\x2c"
+        "\x65" "index" "\x63" "007");
+    BOOST_REQUIRE_EQUAL(cbor(tree), expected);
+}
+
+BOOST_AUTO_TEST_CASE(binary_writer__write_msgpack__values__schema_types)
+{
+    const std::string expected("\x83" "\xa5" "value" "\x02" "\xa6" "filter"
+        "\xa4" "1010" "\xa5" "label" "\xa3" "123");
+    BOOST_REQUIRE_EQUAL(msgpack(make_values()), expected);
+}
+
+BOOST_AUTO_TEST_CASE(binary_writer__write_msgpack__list_of_one__array)
+{
+    const std::string expected("\x81" "\xa4" "rows" "\x81" "\xa3" "row"
+        "\x91" "\x81" "\xa5" "value" "\x01");
+    BOOST_REQUIRE_EQUAL(msgpack(make_list()), expected);
+}
+
+BOOST_AUTO_TEST_CASE(binary_writer__write_msgpack__hash__raw_bytes)
+{
+    pt::ptree tree;
+    tree.put("hash", hash_text);
+    const auto expected = std::string("\x81" "\xa4" "hash" "\xc4" "\x20") +
+        hash_bytes();
+    BOOST_REQUIRE_EQUAL(msgpack(tree), expected);
+}
+
+BOOST_AUTO_TEST_CASE(binary_writer__write_msgpack__text_field__text)
+{
+    pt::ptree tree;
+    tree.put("label", hash_text);
+    const auto expected = std::string("\x81" "\xa5" "label" "\xd9" "\x40") +
+        hash_text;
+    BOOST_REQUIRE_EQUAL(msgpack(tree), expected);
+}
+
+BOOST_AUTO_TEST_CASE(binary_writer__write_msgpack__numbers__sized)
+{
+    pt::ptree tree;
+    tree.put("height", 300);
+    tree.put("index", "007");
+    const std::string expected("\x82" "\xa6" "height" "\xcd" "\x01" "\x2c"
+        "\xa5" "index" "\xa3" "007");
+    BOOST_REQUIRE_EQUAL(msgpack(tree), expected);
+}
+
+BOOST_AUTO_TEST_CASE(binary_writer__prop_writer__cbor__matches_tree)
+{
+    const auto tree = make_list();
+    BOOST_REQUIRE_EQUAL(streamed(tree, encoding_engine::cbor), cbor(tree));
+}
+
+BOOST_AUTO_TEST_CASE(binary_writer__prop_writer__msgpack__matches_tree)
+{
+    const auto tree = make_values();
+    BOOST_REQUIRE_EQUAL(streamed(tree, encoding_engine::msgpack),
+        msgpack(tree));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,156 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer.hpp>
+
+using namespace bc;
+using namespace bc::explorer;
+
+BOOST_AUTO_TEST_SUITE(block_file__index)
+
+// The mainnet magic (f9beb4d9) as a little-endian integer.
+static const uint32_t mainnet_magic = 0xd9b4bef9;
+
+static hash_digest test_hash(uint8_t value)
+{
+    hash_digest hash = null_hash;
+    hash[0] = value;
+    return hash;
+}
+
+static block_record test_record(uint8_t hash, uint8_t previous)
+{
+    block_record record;
+    record.file = 0;
+    record.offset = 0;
+    record.size = 0;
+    record.hash = test_hash(hash);
+    record.previous = previous == 0 ? null_hash : test_hash(previous);
+    return record;
+}
+
+static void append_block(data_chunk& file, const data_chunk& block)
+{
+    const auto size = static_cast<uint32_t>(block.size());
+    const data_chunk prefix
+    {
+        0xf9, 0xbe, 0xb4, 0xd9,
+        uint8_t(size), uint8_t(size >> 8), uint8_t(size >> 16),
+        uint8_t(size >> 24)
+    };
+
+    file.insert(file.end(), prefix.begin(), prefix.end());
+    file.insert(file.end(), block.begin(), block.end());
+}
+
+BOOST_AUTO_TEST_CASE(block_file__index_block_file__padded__records)
+{
+    data_chunk first(81, 0x01);
+    data_chunk second(90, 0x02);
+    data_chunk file;
+    append_block(file, first);
+    append_block(file, second);
+    file.resize(file.size() + 64, 0x00);
+
+    std::vector<block_record> records;
+    BOOST_REQUIRE(index_block_file(records, 7, file, mainnet_magic) ==
+        block_file_status::valid);
+    BOOST_REQUIRE_EQUAL(records.size(), 2u);
+    BOOST_REQUIRE_EQUAL(records[0].file, 7u);
+    BOOST_REQUIRE_EQUAL(records[0].offset, 8u);
+    BOOST_REQUIRE_EQUAL(records[0].size, 81u);
+    BOOST_REQUIRE_EQUAL(records[1].offset, 8u + 81u + 8u);
+    BOOST_REQUIRE_EQUAL(records[1].size, 90u);
+
+    const data_chunk header(second.begin(), second.begin() + 80);
+    BOOST_REQUIRE(records[1].hash == bitcoin_hash(header));
+
+    hash_digest previous;
+    previous.fill(0x02);
+    BOOST_REQUIRE(records[1].previous == previous);
+}
+
+BOOST_AUTO_TEST_CASE(block_file__index_block_file__truncated__truncated)
+{
+    data_chunk file;
+    append_block(file, data_chunk(81, 0x01));
+    file.resize(file.size() - 1);
+
+    std::vector<block_record> records;
+    BOOST_REQUIRE(index_block_file(records, 0, file, mainnet_magic) ==
+        block_file_status::truncated);
+}
+
+BOOST_AUTO_TEST_CASE(block_file__index_block_file__other_magic__other_network)
+{
+    data_chunk file;
+    append_block(file, data_chunk(81, 0x01));
+    append_block(file, data_chunk(81, 0x02));
+
+    std::vector<block_record> records;
+    BOOST_REQUIRE(index_block_file(records, 0, file, 0x0709110b) ==
+        block_file_status::other_network);
+
+    // A later block may also be of another network.
+    file[8 + 81] = 0x0b;
+    records.clear();
+    BOOST_REQUIRE(index_block_file(records, 0, file, mainnet_magic) ==
+        block_file_status::other_network);
+}
+
+BOOST_AUTO_TEST_CASE(block_file__block_chain__unordered_fork__longest)
+{
+    // 1 <- 2 <- 3 <- 4 is the longest chain, 5 is a stale branch from 2 and
+    // 7 is not linked to the chain.
+    const std::vector<block_record> records
+    {
+        test_record(4, 3),
+        test_record(5, 2),
+        test_record(7, 6),
+        test_record(2, 1),
+        test_record(1, 0),
+        test_record(3, 2)
+    };
+
+    const auto chain = block_chain(records);
+    BOOST_REQUIRE_EQUAL(chain.size(), 4u);
+    BOOST_REQUIRE_EQUAL(chain[0], 4u);
+    BOOST_REQUIRE_EQUAL(chain[1], 3u);
+    BOOST_REQUIRE_EQUAL(chain[2], 5u);
+    BOOST_REQUIRE_EQUAL(chain[3], 0u);
+}
+
+BOOST_AUTO_TEST_CASE(block_file__block_chain__no_genesis__empty)
+{
+    const std::vector<block_record> records
+    {
+        test_record(2, 1),
+        test_record(3, 2)
+    };
+
+    BOOST_REQUIRE(block_chain(records).empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,138 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <cstdint>
+#include <vector>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer.hpp>
+
+using namespace bc;
+using namespace bc::explorer;
+
+static unspent_list make_unspent(const std::vector<uint64_t>& values)
+{
+    unspent_list unspent;
+    uint32_t index = 0;
+    for (const auto value: values)
+        unspent.push_back({ { null_hash, index++ }, value });
+
+    return unspent;
+}
+
+static uint64_t total(const unspent_list& unspent)
+{
+    uint64_t sum = 0;
+    for (const auto& output: unspent)
+        sum += output.value;
+
+    return sum;
+}
+
+BOOST_AUTO_TEST_SUITE(coin_selection)
+
+BOOST_AUTO_TEST_CASE(coin_selection__parse_selection_algorithm__bogus__false)
+{
+    selection_algorithm algorithm;
+    BOOST_REQUIRE(!parse_selection_algorithm(algorithm, "bogus"));
+}
+
+BOOST_AUTO_TEST_CASE(coin_selection__parse_selection_algorithm__fee__fee)
+{
+    selection_algorithm algorithm;
+    BOOST_REQUIRE(parse_selection_algorithm(algorithm, "fee"));
+    BOOST_REQUIRE(algorithm == selection_algorithm::fee);
+}
+
+BOOST_AUTO_TEST_CASE(coin_selection__select_largest__single_sufficient__smallest_single)
+{
+    unspent_list out;
+    const auto unspent = make_unspent({ 5, 7, 11, 20, 3 });
+    BOOST_REQUIRE(select_largest(out, unspent, 10));
+    BOOST_REQUIRE_EQUAL(out.size(), 1u);
+    BOOST_REQUIRE_EQUAL(out[0].value, 11u);
+    BOOST_REQUIRE_EQUAL(out[0].point.index, 2u);
+}
+
+BOOST_AUTO_TEST_CASE(coin_selection__select_largest__none_sufficient__accumulates_largest)
+{
+    unspent_list out;
+    const auto unspent = make_unspent({ 5, 7, 11, 20, 3 });
+    BOOST_REQUIRE(select_largest(out, unspent, 25));
+    BOOST_REQUIRE_EQUAL(out.size(), 2u);
+    BOOST_REQUIRE_EQUAL(out[0].value, 20u);
+    BOOST_REQUIRE_EQUAL(out[1].value, 11u);
+}
+
+BOOST_AUTO_TEST_CASE(coin_selection__select_largest__insufficient__false)
+{
+    unspent_list out;
+    const auto unspent = make_unspent({ 5, 7, 11, 20, 3 });
+    BOOST_REQUIRE(!select_largest(out, unspent, 47));
+}
+
+BOOST_AUTO_TEST_CASE(coin_selection__select_exact__match__no_excess)
+{
+    unspent_list out;
+    const auto unspent = make_unspent({ 5, 7, 11, 20, 3 });
+    BOOST_REQUIRE(select_exact(out, unspent, 30));
+    BOOST_REQUIRE_EQUAL(total(out), 30u);
+}
+
+BOOST_AUTO_TEST_CASE(coin_selection__select_exact__no_match__false)
+{
+    unspent_list out;
+    const auto unspent = make_unspent({ 10, 20, 40 });
+    BOOST_REQUIRE(!select_exact(out, unspent, 25));
+}
+
+BOOST_AUTO_TEST_CASE(coin_selection__select_exact__within_tolerance__least_excess)
+{
+    unspent_list out;
+    const auto unspent = make_unspent({ 10, 20, 40 });
+    BOOST_REQUIRE(select_exact(out, unspent, 25, 10));
+    BOOST_REQUIRE_EQUAL(total(out), 30u);
+}
+
+BOOST_AUTO_TEST_CASE(coin_selection__select_outputs__exact_no_match__falls_back_to_largest)
+{
+    unspent_list out;
+    const auto unspent = make_unspent({ 10, 20, 40 });
+    BOOST_REQUIRE(select_outputs(out, unspent, 25, selection_algorithm::exact));
+    BOOST_REQUIRE_EQUAL(out.size(), 1u);
+    BOOST_REQUIRE_EQUAL(out[0].value, 40u);
+}
+
+BOOST_AUTO_TEST_CASE(coin_selection__select_outputs__fee__pays_amount_and_fees)
+{
+    unspent_list out;
+    const auto unspent = make_unspent({ 5, 7, 11, 20, 3, 2 });
+    BOOST_REQUIRE(select_outputs(out, unspent, 21, selection_algorithm::fee, 2));
+    BOOST_REQUIRE_EQUAL(total(out), 21u + 2u * out.size());
+}
+
+BOOST_AUTO_TEST_CASE(coin_selection__select_outputs__fee_uneconomic__excluded)
+{
+    unspent_list out;
+    const auto unspent = make_unspent({ 2, 2, 2 });
+    BOOST_REQUIRE(!select_outputs(out, unspent, 1, selection_algorithm::fee, 2));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
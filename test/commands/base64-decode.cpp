@@ -93,5 +93,28 @@ BOOST_AUTO_TEST_CASE(base64_decode__invoke__SNOWDEN__okay_output)
     BX_REQUIRE_OUTPUT(BX_BASE64_DECODE_SNOWDEN_DECODED);
 }
 
+BOOST_AUTO_TEST_CASE(base64_decode__invoke__wrapped_lines__okay_output)
+{
+    BX_DECLARE_COMMAND(base64_decode);
+    command.set_base64_argument({ "Zm9v\nYmFy\n" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(BX_BASE64_DECODE_RFC4648_DECODED_D);
+}
+
+BOOST_AUTO_TEST_CASE(base64_decode__invoke__invalid__failure_error)
+{
+    BX_DECLARE_COMMAND(base64_decode);
+    command.set_base64_argument({ "Zm9v*mFy" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_BASE64_DECODE_INVALID "\n");
+}
+
+BOOST_AUTO_TEST_CASE(base64_decode__invoke__missing_file__failure)
+{
+    BX_DECLARE_COMMAND(base64_decode);
+    command.set_file_option({ "missing.base64" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
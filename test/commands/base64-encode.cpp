@@ -91,5 +91,14 @@ BOOST_AUTO_TEST_CASE(base64_encode__invoke__SNOWDEN__okay_output)
     BX_REQUIRE_OUTPUT(BX_BASE64_ENCODE_SNOWDEN_ENCODED "\n");
 }
 
+BOOST_AUTO_TEST_CASE(base64_encode__invoke__stream__okay_output)
+{
+    BX_DECLARE_COMMAND(base64_encode);
+    std::stringstream input(BX_BASE64_ENCODE_SNOWDEN_DECODED);
+    command.set_data_argument(byte_stream(input));
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(BX_BASE64_ENCODE_SNOWDEN_ENCODED "\n");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
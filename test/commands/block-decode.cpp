@@ -0,0 +1,147 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "command.hpp"
+
+BX_USING_NAMESPACES()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(block_decode__invoke)
+
+// A block of one transaction, so the merkle root is the transaction hash.
+#define BLOCK_DECODE_BLOCK_A_BASE16 \
+"01000000" \
+"0000000000000000000000000000000000000000000000000000000000000000" \
+"e0186b90a14746f76b416e584e93683476e3140b5d0ce04b36212f11afcad239" \
+"29ab5f49ffff001d2a000000" \
+"01" \
+"0100000001b3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee0970100000000ffffffff01905f0100000000001976a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac00000000"
+#define BLOCK_DECODE_BLOCK_A_INFO \
+"block\n" \
+"{\n" \
+"    header\n" \
+"    {\n" \
+"        bits 486604799\n" \
+"        hash 5b48776ccd7e2d98c7e047aedfa8d8203fa85ecbcd9448bebcf17488d4db0895\n" \
+"        merkle_tree_hash 39d2caaf112f21364be00c5d0b14e3763468934e586e416bf74647a1906b18e0\n" \
+"        nonce 42\n" \
+"        previous_block_hash 0000000000000000000000000000000000000000000000000000000000000000\n" \
+"        time_stamp 1231006505\n" \
+"        version 1\n" \
+"    }\n" \
+"    transactions\n" \
+"    {\n" \
+"        transaction\n" \
+"        {\n" \
+"            hash 39d2caaf112f21364be00c5d0b14e3763468934e586e416bf74647a1906b18e0\n" \
+"            outputs\n" \
+"            {\n" \
+"                output\n" \
+"                {\n" \
+"                    value 90000\n" \
+"                }\n" \
+"            }\n" \
+"        }\n" \
+"    }\n" \
+"}\n"
+
+// The same block with a null merkle root.
+#define BLOCK_DECODE_BLOCK_B_BASE16 \
+"01000000" \
+"0000000000000000000000000000000000000000000000000000000000000000" \
+"0000000000000000000000000000000000000000000000000000000000000000" \
+"29ab5f49ffff001d2a000000" \
+"01" \
+"0100000001b3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee0970100000000ffffffff01905f0100000000001976a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac00000000"
+
+BOOST_AUTO_TEST_CASE(block_decode__invoke__block_A_base16__okay_output)
+{
+    BX_DECLARE_COMMAND(block_decode);
+    command.set_format_option({ "info" });
+    command.set_fields_option("hash, outputs.value");
+    command.set_block_argument({ BLOCK_DECODE_BLOCK_A_BASE16 });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(BLOCK_DECODE_BLOCK_A_INFO);
+}
+
+// The format shortcut is not shared with another option.
+BOOST_AUTO_TEST_CASE(block_decode__parse__format_shortcut__json)
+{
+    block_decode command;
+    parser metadata(command);
+    std::string message;
+    std::stringstream input;
+    const char* argv[] =
+    {
+        "block-decode", "-f", "json", BLOCK_DECODE_BLOCK_A_BASE16
+    };
+    BOOST_REQUIRE(metadata.parse(message, input, 4, argv));
+    const encoding_engine engine = command.get_format_option();
+    BOOST_REQUIRE(engine == encoding_engine::json);
+}
+
+BOOST_AUTO_TEST_CASE(block_decode__invoke__block_A_binary__okay_output)
+{
+    BX_DECLARE_COMMAND(block_decode);
+    command.set_format_option({ "info" });
+    command.set_fields_option("hash, outputs.value");
+    const auto binary = base16(BLOCK_DECODE_BLOCK_A_BASE16);
+    const data_chunk& bytes = binary;
+    command.set_block_argument(byte_stream(bytes));
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(BLOCK_DECODE_BLOCK_A_INFO);
+}
+
+BOOST_AUTO_TEST_CASE(block_decode__invoke__trailing_data__failure_error)
+{
+    BX_DECLARE_COMMAND(block_decode);
+    command.set_block_argument({ BLOCK_DECODE_BLOCK_A_BASE16 "00" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_BLOCK_DECODE_INVALID "\n");
+}
+
+BOOST_AUTO_TEST_CASE(block_decode__invoke__merkle_mismatch__failure_error)
+{
+    BX_DECLARE_COMMAND(block_decode);
+    command.set_block_argument({ BLOCK_DECODE_BLOCK_B_BASE16 });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_BLOCK_DECODE_MERKLE_MISMATCH "\n");
+}
+
+BOOST_AUTO_TEST_CASE(block_decode__invoke__bogus_field__failure_error)
+{
+    BX_DECLARE_COMMAND(block_decode);
+    command.set_fields_option("hash,outputs.bogus");
+    command.set_block_argument({ BLOCK_DECODE_BLOCK_A_BASE16 });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    const auto message = format(BX_BLOCK_DECODE_INVALID_FIELD) %
+        "outputs.bogus";
+    BX_REQUIRE_ERROR(message.str() + "\n");
+}
+
+BOOST_AUTO_TEST_CASE(block_decode__invoke__missing_file__failure)
+{
+    BX_DECLARE_COMMAND(block_decode);
+    command.set_file_option({ "missing.dat" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,59 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_TEST_BLOCK_FILES_HPP
+#define BX_TEST_BLOCK_FILES_HPP
+
+#include <fstream>
+#include <string>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer.hpp>
+
+// The network identifier of the blocks, the mainnet magic (f9beb4d9) as a
+// little-endian integer, and that of testnet (0b110907).
+#define BX_BLOCK_FILES_MAGIC 3652501241
+#define BX_BLOCK_FILES_TESTNET_MAGIC 118034699
+
+// Block A (height 0) pays 90000 to the address, and block C (height 1)
+// spends that output to pay 80000 to the same address. The file holds the
+// blocks in reverse order, followed by preallocated zeros.
+#define BX_BLOCK_FILES_ADDRESS "13Ft7SkreJY9D823NPm4t6D1cBqLYTJtAe"
+#define BX_BLOCK_FILES_BLOCK_A_BASE16 \
+"f9beb4d9a6000000" \
+"010000000000000000000000000000000000000000000000000000000000000000000000e0186b90a14746f76b416e584e93683476e3140b5d0ce04b36212f11afcad23929ab5f49ffff001d2a000000" \
+"01" \
+"0100000001b3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee0970100000000ffffffff01905f0100000000001976a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac00000000"
+#define BX_BLOCK_FILES_BLOCK_C_BASE16 \
+"f9beb4d9a6000000" \
+"010000009508dbd48874f1bcbe4894cdcb5ea83f20d8a8dfae47e0c7982d7ecd6c77485b7d5fba79bcd27b9673073fe14e866d371930ecf588603f97ce0830998982ce362aab5f49ffff001d07000000" \
+"01" \
+"0100000001e0186b90a14746f76b416e584e93683476e3140b5d0ce04b36212f11afcad2390000000000ffffffff0180380100000000001976a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac00000000"
+#define BX_BLOCK_FILES_BASE16 \
+BX_BLOCK_FILES_BLOCK_C_BASE16 \
+BX_BLOCK_FILES_BLOCK_A_BASE16 \
+"0000000000000000"
+
+inline void write_block_file(const std::string& path, const std::string& hex)
+{
+    const bc::data_chunk& data = bc::explorer::primitives::base16(hex);
+    std::ofstream file(path, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(data.data()), data.size());
+}
+
+#endif
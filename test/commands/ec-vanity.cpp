@@ -0,0 +1,103 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "command.hpp"
+
+BX_USING_NAMESPACES()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(ec_vanity__invoke)
+
+#define BX_EC_VANITY_SEED "42424242424242424242424242424242"
+
+BOOST_AUTO_TEST_CASE(ec_vanity__invoke__one__okay_output)
+{
+    BX_DECLARE_COMMAND(ec_vanity);
+    command.set_threads_option(1);
+    command.set_version_option(0);
+    command.set_prefix_argument("1");
+    command.set_seed_argument({ BX_EC_VANITY_SEED });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("726e5e73da00289dc0bef2b2b0f82c2ddd518c6a00c65d03b18fc8d9fd2af1f6\n14a4LRcKUjFVhaZtmeXK7UH5dJQLCrtTGf\n");
+}
+
+BOOST_AUTO_TEST_CASE(ec_vanity__invoke__prefix__okay_output)
+{
+    BX_DECLARE_COMMAND(ec_vanity);
+    command.set_threads_option(1);
+    command.set_version_option(0);
+    command.set_prefix_argument("1Bx");
+    command.set_seed_argument({ BX_EC_VANITY_SEED });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("726e5e73da00289dc0bef2b2b0f82c2ddd518c6a00c65d03b18fc8d9fd2af3a8\n1BxfJEsEsWfkdZtpPQWvhxSbAwA8JSXnSR\n");
+}
+
+BOOST_AUTO_TEST_CASE(ec_vanity__invoke__64_bit_seed__failure_error)
+{
+    BX_DECLARE_COMMAND(ec_vanity);
+    command.set_threads_option(1);
+    command.set_version_option(0);
+    command.set_prefix_argument("1");
+    command.set_seed_argument({ "baadf00dbaadf00d" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_EC_VANITY_SHORT_SEED "\n");
+}
+
+BOOST_AUTO_TEST_CASE(ec_vanity__invoke__not_base58__failure_error)
+{
+    BX_DECLARE_COMMAND(ec_vanity);
+    command.set_threads_option(1);
+    command.set_version_option(0);
+    command.set_prefix_argument("10");
+    command.set_seed_argument({ BX_EC_VANITY_SEED });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    const auto message = format(BX_EC_VANITY_INVALID_PREFIX) % "10";
+    BX_REQUIRE_ERROR(message.str() + "\n");
+}
+
+BOOST_AUTO_TEST_CASE(ec_vanity__invoke__other_version__failure_error)
+{
+    BX_DECLARE_COMMAND(ec_vanity);
+    command.set_threads_option(1);
+    command.set_version_option(0);
+    command.set_prefix_argument("2");
+    command.set_seed_argument({ BX_EC_VANITY_SEED });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    const auto message = format(BX_EC_VANITY_IMPOSSIBLE_PREFIX) % "2";
+    BX_REQUIRE_ERROR(message.str() + "\n");
+}
+
+BOOST_AUTO_TEST_CASE(ec_vanity__invoke__limit__failure_error)
+{
+    BX_DECLARE_COMMAND(ec_vanity);
+    command.set_limit_option(512);
+    command.set_threads_option(1);
+    command.set_version_option(0);
+    command.set_prefix_argument("1zzzzzzz");
+    command.set_seed_argument({ BX_EC_VANITY_SEED });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("");
+    const auto message = format(BX_EC_VANITY_LIMIT) % 512;
+    BOOST_REQUIRE(boost::algorithm::ends_with(error.str(),
+        message.str() + "\n"));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
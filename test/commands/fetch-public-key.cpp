@@ -21,14 +21,32 @@
 
 BX_USING_NAMESPACES()
 
-BOOST_AUTO_TEST_SUITE(stub)
+BOOST_AUTO_TEST_SUITE(offline)
 BOOST_AUTO_TEST_SUITE(fetch_public_key__invoke)
 
-BOOST_AUTO_TEST_CASE(fetch_public_key__invoke__always__failure_error)
+// The script hash address is rejected before connecting.
+BOOST_AUTO_TEST_CASE(fetch_public_key__invoke__script_hash_address__failure_error)
 {
     BX_DECLARE_COMMAND(fetch_public_key);
+    command.set_payment_address_argument({ "3J98t1WpEZ73CNmQviecrnyiWrnqRhWNLy" });
     BX_REQUIRE_FAILURE(command.invoke(output, error));
-    //BX_REQUIRE_ERROR(BX_FETCH_PUBLIC_KEY_NOT_IMPLEMENTED "\n");
+    BX_REQUIRE_ERROR(BX_FETCH_PUBLIC_KEY_INVALID_ADDRESS "\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(network)
+BOOST_AUTO_TEST_SUITE(fetch_public_key__invoke)
+
+// requires libbitcoin-server.
+// The genesis coinbase is unspendable, so its address has no spend.
+BOOST_AUTO_TEST_CASE(fetch_public_key__invoke__mainnet_first_address__failure_error)
+{
+    BX_DECLARE_NETWORK_COMMAND(fetch_public_key);
+    command.set_payment_address_argument({ BX_FIRST_ADDRESS });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_FETCH_PUBLIC_KEY_NOT_FOUND "\n");
 }
 
 BOOST_AUTO_TEST_SUITE_END()
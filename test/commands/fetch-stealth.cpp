@@ -22,6 +22,81 @@
 
 BX_USING_NAMESPACES()
 
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(fetch_stealth__confirm_stealth)
+
+// vector (see stealth-shared and stealth-public)
+#define BX_FETCH_STEALTH_SCAN_SECRET "af4afaeb40810e5f8abdbb177c31a2d310913f91cf556f5350bca10cbfe8b9ec"
+#define BX_FETCH_STEALTH_SPEND_PUBKEY "024c6988f8e64242a1b8f33513f5f27b9e135ad0a11433fc590816ff92a353a969"
+#define BX_FETCH_STEALTH_EPHEMERAL_PUBKEY "0247140d2811498679fe9a0467a75ac7aa581476c102d27377bc0232635af8ad36"
+
+// expectation
+// STEALTH_PUBKEY = SPEND_PUBKEY + sha256(SCAN_SECRET * EPHEM_PUBKEY) * G
+// STEALTH_PUBKEY = 03ac9e60013853128b42a1324609bac2ccff6a0b4844b6301f1f552e15ee14c7a5
+#define BX_FETCH_STEALTH_PUBLIC_KEY_HASH "80de74d96f6ac59c78e2a2f0312607dc30c7ebc5"
+
+static stealth_row make_row(const std::string& ephemeral_key,
+    const std::string& public_key_hash)
+{
+    stealth_row row;
+    BOOST_REQUIRE(decode_base16(row.ephemeral_public_key, ephemeral_key));
+    BOOST_REQUIRE(decode_base16(row.public_key_hash, public_key_hash));
+    row.transaction_hash = null_hash;
+    return row;
+}
+
+static bool confirm(const stealth_row& row)
+{
+    ec_secret scan_secret;
+    ec_compressed spend_pubkey;
+    BOOST_REQUIRE(decode_base16(scan_secret, BX_FETCH_STEALTH_SCAN_SECRET));
+    BOOST_REQUIRE(decode_base16(spend_pubkey, BX_FETCH_STEALTH_SPEND_PUBKEY));
+    return confirm_stealth(row, scan_secret, spend_pubkey);
+}
+
+BOOST_AUTO_TEST_CASE(fetch_stealth__confirm_stealth__matching_row__true)
+{
+    const auto row = make_row(BX_FETCH_STEALTH_EPHEMERAL_PUBKEY,
+        BX_FETCH_STEALTH_PUBLIC_KEY_HASH);
+    BOOST_REQUIRE(confirm(row));
+}
+
+BOOST_AUTO_TEST_CASE(fetch_stealth__confirm_stealth__unsigned_ephemeral_key__true)
+{
+    const std::string ephemeral_key(BX_FETCH_STEALTH_EPHEMERAL_PUBKEY);
+    const auto row = make_row(ephemeral_key.substr(2),
+        BX_FETCH_STEALTH_PUBLIC_KEY_HASH);
+    BOOST_REQUIRE_EQUAL(row.ephemeral_public_key.size(), 32u);
+    BOOST_REQUIRE(confirm(row));
+}
+
+BOOST_AUTO_TEST_CASE(fetch_stealth__confirm_stealth__other_key_hash__false)
+{
+    const auto row = make_row(BX_FETCH_STEALTH_EPHEMERAL_PUBKEY,
+        "65393bf10822868aba54b130914a9aab79246ea4");
+    BOOST_REQUIRE(!confirm(row));
+}
+
+BOOST_AUTO_TEST_CASE(fetch_stealth__confirm_stealth__odd_ephemeral_key__false)
+{
+    // The same key with the other sign is a different point.
+    const std::string ephemeral_key(BX_FETCH_STEALTH_EPHEMERAL_PUBKEY);
+    const auto row = make_row("03" + ephemeral_key.substr(2),
+        BX_FETCH_STEALTH_PUBLIC_KEY_HASH);
+    BOOST_REQUIRE(!confirm(row));
+}
+
+BOOST_AUTO_TEST_CASE(fetch_stealth__confirm_stealth__short_ephemeral_key__false)
+{
+    const std::string ephemeral_key(BX_FETCH_STEALTH_EPHEMERAL_PUBKEY);
+    const auto row = make_row(ephemeral_key.substr(4),
+        BX_FETCH_STEALTH_PUBLIC_KEY_HASH);
+    BOOST_REQUIRE(!confirm(row));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+
 BOOST_AUTO_TEST_SUITE(network)
 BOOST_AUTO_TEST_SUITE(fetch_stealth__invoke)
 
@@ -108,5 +183,14 @@ BOOST_AUTO_TEST_CASE(fetch_stealth__invoke_mainnet_height_323557__okay)
 ////    BX_REQUIRE_OUTPUT(BX_FETCH_STEALTH_HEIGHT0_PREFIX10101010101_INFO);
 ////}
 
+// Vector: the scan secret without the spend public key is rejected before connecting.
+BOOST_AUTO_TEST_CASE(fetch_stealth__invoke__scan_secret_without_spend_pubkey__failure_error)
+{
+    BX_DECLARE_NETWORK_COMMAND(fetch_stealth);
+    command.set_scan_secret_option({ "4b4974266ee6c8bed9eff2dd1a1f1ac7adaf28ba8ab1ef9bdb4c9e1e2ede9be1" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_FETCH_STEALTH_CONFIRMATION_KEYS "\n");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
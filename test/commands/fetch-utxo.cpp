@@ -21,14 +21,27 @@
 
 BX_USING_NAMESPACES()
 
-BOOST_AUTO_TEST_SUITE(stub)
+BOOST_AUTO_TEST_SUITE(network)
 BOOST_AUTO_TEST_SUITE(fetch_utxo__invoke)
 
-BOOST_AUTO_TEST_CASE(fetch_utxo__invoke__always__failure_error)
+BOOST_AUTO_TEST_CASE(fetch_utxo__invoke__bogus_algorithm__failure_error)
 {
-    BX_DECLARE_COMMAND(fetch_utxo);
+    BX_DECLARE_NETWORK_COMMAND(fetch_utxo);
+    command.set_algorithm_option("bogus");
+    command.set_satoshi_argument(100000);
+    command.set_payment_addresss_argument({ { BX_FIRST_ADDRESS } });
     BX_REQUIRE_FAILURE(command.invoke(output, error));
-    BX_REQUIRE_ERROR(BX_FETCH_UTXO_NOT_IMPLEMENTED "\n");
+    BX_REQUIRE_ERROR(BX_FETCH_UTXO_INVALID_ALGORITHM "\n");
+}
+
+// requires libbitcoin-server.
+BOOST_AUTO_TEST_CASE(fetch_utxo__invoke__mainnet_first_address__okay)
+{
+    BX_DECLARE_NETWORK_COMMAND(fetch_utxo);
+    command.set_algorithm_option("largest");
+    command.set_satoshi_argument(100000);
+    command.set_payment_addresss_argument({ { BX_FIRST_ADDRESS } });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
 }
 
 BOOST_AUTO_TEST_SUITE_END()
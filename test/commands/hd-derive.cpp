@@ -0,0 +1,193 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "command.hpp"
+
+BX_USING_NAMESPACES()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(hd_derive__invoke)
+
+BOOST_AUTO_TEST_CASE(hd_derive__invoke__mainnet_vector1_private_m__address__okay_output)
+{
+    BX_DECLARE_COMMAND(hd_derive);
+    command.set_key_option("address");
+    command.set_version_option(0);
+    command.set_wif_version_option(128);
+    command.set_public_version_option(76067358);
+    command.set_secret_version_option(76066276);
+    command.set_path_argument({ "m" });
+    command.set_hd_key_argument({ "xprv9s21ZrQH143K3QTDL4LXw2F7HEK3wJUD2nW2nRk4stbPy6cq3jPPqjiChkVvvNKmPGJxWUtg6LnF5kejMRNNU3TGtRBeJgk33yuGBxrMPHi" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("15mKKb2eos1hWa6tisdPwwDC1a5J1y9nma\n");
+}
+
+BOOST_AUTO_TEST_CASE(hd_derive__invoke__mainnet_vector1_private_m_0h_set_0_1__xpub__okay_output)
+{
+    BX_DECLARE_COMMAND(hd_derive);
+    command.set_key_option("xpub");
+    command.set_version_option(0);
+    command.set_wif_version_option(128);
+    command.set_public_version_option(76067358);
+    command.set_secret_version_option(76066276);
+    command.set_path_argument({ "m/0h/{0,1}" });
+    command.set_hd_key_argument({ "xprv9s21ZrQH143K3QTDL4LXw2F7HEK3wJUD2nW2nRk4stbPy6cq3jPPqjiChkVvvNKmPGJxWUtg6LnF5kejMRNNU3TGtRBeJgk33yuGBxrMPHi" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(
+        "xpub6ASuArnXKPbfEVRpCesNx4P939HDXENHkksgxsVG1yNp9958A33qYoPiTN9QrJmWFa2jNLdK84bWmyqTSPGtApP8P7nHUYwxHPhqmzUyeFG\n"
+        "xpub6ASuArnXKPbfEwhqN6e3mwBcDTgzisQN1wXN9BJcM47sSikHjJf3UFHKkNAWbWMiGj7Wf5uMash7SyYq527Hqck2AxYysAA7xmALppuCkwQ\n");
+}
+
+BOOST_AUTO_TEST_CASE(hd_derive__invoke__mainnet_vector1_private_m_0h_1_2h__xprv__okay_output)
+{
+    BX_DECLARE_COMMAND(hd_derive);
+    command.set_key_option("xprv");
+    command.set_version_option(0);
+    command.set_wif_version_option(128);
+    command.set_public_version_option(76067358);
+    command.set_secret_version_option(76066276);
+    command.set_path_argument({ "m/0'/1/2'" });
+    command.set_hd_key_argument({ "xprv9s21ZrQH143K3QTDL4LXw2F7HEK3wJUD2nW2nRk4stbPy6cq3jPPqjiChkVvvNKmPGJxWUtg6LnF5kejMRNNU3TGtRBeJgk33yuGBxrMPHi" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("xprv9z4pot5VBttmtdRTWfWQmoH1taj2axGVzFqSb8C9xaxKymcFzXBDptWmT7FwuEzG3ryjH4ktypQSAewRiNMjANTtpgP4mLTj34bhnZX7UiM\n");
+}
+
+BOOST_AUTO_TEST_CASE(hd_derive__invoke__mainnet_vector1_private_m_0h_range_0_1__address__okay_output)
+{
+    BX_DECLARE_COMMAND(hd_derive);
+    command.set_key_option("address");
+    command.set_version_option(0);
+    command.set_wif_version_option(128);
+    command.set_public_version_option(76067358);
+    command.set_secret_version_option(76066276);
+    command.set_path_argument({ "0h/0-1" });
+    command.set_hd_key_argument({ "xprv9s21ZrQH143K3QTDL4LXw2F7HEK3wJUD2nW2nRk4stbPy6cq3jPPqjiChkVvvNKmPGJxWUtg6LnF5kejMRNNU3TGtRBeJgk33yuGBxrMPHi" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(
+        "1LZaBnH11M2yN5ZNiK67yUbaspfX6XKmRr\n"
+        "1JQheacLPdM5ySCkrZkV66G2ApAXe1mqLj\n");
+}
+
+BOOST_AUTO_TEST_CASE(hd_derive__invoke__mainnet_vector1_private_m_0h_0__ec__okay_output)
+{
+    BX_DECLARE_COMMAND(hd_derive);
+    command.set_key_option("ec");
+    command.set_version_option(0);
+    command.set_wif_version_option(128);
+    command.set_public_version_option(76067358);
+    command.set_secret_version_option(76066276);
+    command.set_path_argument({ "m/0h/0" });
+    command.set_hd_key_argument({ "xprv9s21ZrQH143K3QTDL4LXw2F7HEK3wJUD2nW2nRk4stbPy6cq3jPPqjiChkVvvNKmPGJxWUtg6LnF5kejMRNNU3TGtRBeJgk33yuGBxrMPHi" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("47a62230342a7cd15e02c3e8cc9386befe55ac129893e457166d46f37442c606\n");
+}
+
+BOOST_AUTO_TEST_CASE(hd_derive__invoke__mainnet_vector1_private_m_0h_range_0_1__wif__okay_output)
+{
+    BX_DECLARE_COMMAND(hd_derive);
+    command.set_key_option("wif");
+    command.set_version_option(0);
+    command.set_wif_version_option(128);
+    command.set_public_version_option(76067358);
+    command.set_secret_version_option(76066276);
+    command.set_path_argument({ "m/0h/0-1" });
+    command.set_hd_key_argument({ "xprv9s21ZrQH143K3QTDL4LXw2F7HEK3wJUD2nW2nRk4stbPy6cq3jPPqjiChkVvvNKmPGJxWUtg6LnF5kejMRNNU3TGtRBeJgk33yuGBxrMPHi" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(
+        "KyczCqnEp32q2od5wySn2PKJeFtv7c7Roodmu4ZUdajzqYuxePtg\n"
+        "KyFAjQ5rgrKvhXvNMtFB5PCSKUYD1yyPEe3xr3T34TZSUHycXtMM\n");
+}
+
+BOOST_AUTO_TEST_CASE(hd_derive__invoke__mainnet_vector1_public_m_0h_1_set__address__okay_output)
+{
+    BX_DECLARE_COMMAND(hd_derive);
+    command.set_key_option("address");
+    command.set_version_option(0);
+    command.set_wif_version_option(128);
+    command.set_public_version_option(76067358);
+    command.set_secret_version_option(76066276);
+    command.set_path_argument({ "m/1/{0-1,5}" });
+    command.set_hd_key_argument({ "xpub68Gmy5EdvgibQVfPdqkBBCHxA5htiqg55crXYuXoQRKfDBFA1WEjWgP6LHhwBZeNK1VTsfTFUHCdrfp1bgwQ9xv5ski8PX9rL2dZXvgGDnw" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(
+        "1J5rebbkQaunJTUoNVREDbeB49DqMNFFXk\n"
+        "15Gwr548Jmcbr4RTrwzxMSo9heuwHqMmBz\n"
+        "1BUQtzYo1f2Xv6Vg2aK1NNy8cT45PW6shL\n");
+}
+
+BOOST_AUTO_TEST_CASE(hd_derive__invoke__mainnet_vector1_public_m_0h_0__ec__okay_output)
+{
+    BX_DECLARE_COMMAND(hd_derive);
+    command.set_key_option("ec");
+    command.set_version_option(0);
+    command.set_wif_version_option(128);
+    command.set_public_version_option(76067358);
+    command.set_secret_version_option(76066276);
+    command.set_path_argument({ "m/0" });
+    command.set_hd_key_argument({ "xpub68Gmy5EdvgibQVfPdqkBBCHxA5htiqg55crXYuXoQRKfDBFA1WEjWgP6LHhwBZeNK1VTsfTFUHCdrfp1bgwQ9xv5ski8PX9rL2dZXvgGDnw" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("033171c5f58a4504363dba2ca6cb7d6275f743bc8dada02dffef75912eaeeacf13\n");
+}
+
+BOOST_AUTO_TEST_CASE(hd_derive__invoke__mainnet_vector1_public_hardened_path__failure_error)
+{
+    BX_DECLARE_COMMAND(hd_derive);
+    command.set_key_option("xpub");
+    command.set_version_option(0);
+    command.set_wif_version_option(128);
+    command.set_public_version_option(76067358);
+    command.set_secret_version_option(76066276);
+    command.set_path_argument({ "m/1h" });
+    command.set_hd_key_argument({ "xpub68Gmy5EdvgibQVfPdqkBBCHxA5htiqg55crXYuXoQRKfDBFA1WEjWgP6LHhwBZeNK1VTsfTFUHCdrfp1bgwQ9xv5ski8PX9rL2dZXvgGDnw" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_HD_DERIVE_HARD_PATH_CONFLICT "\n");
+}
+
+BOOST_AUTO_TEST_CASE(hd_derive__invoke__bogus_key_type__failure_error)
+{
+    BX_DECLARE_COMMAND(hd_derive);
+    command.set_key_option("bogus");
+    command.set_version_option(0);
+    command.set_wif_version_option(128);
+    command.set_public_version_option(76067358);
+    command.set_secret_version_option(76066276);
+    command.set_path_argument({ "m/0" });
+    command.set_hd_key_argument({ "xprv9s21ZrQH143K3QTDL4LXw2F7HEK3wJUD2nW2nRk4stbPy6cq3jPPqjiChkVvvNKmPGJxWUtg6LnF5kejMRNNU3TGtRBeJgk33yuGBxrMPHi" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    const auto message = format(BX_HD_DERIVE_INVALID_KEY_TYPE) % "bogus";
+    BX_REQUIRE_ERROR(message.str() + "\n");
+}
+
+BOOST_AUTO_TEST_CASE(hd_derive__invoke__mainnet_vector1_public_wif__failure_error)
+{
+    BX_DECLARE_COMMAND(hd_derive);
+    command.set_key_option("wif");
+    command.set_version_option(0);
+    command.set_wif_version_option(128);
+    command.set_public_version_option(76067358);
+    command.set_secret_version_option(76066276);
+    command.set_path_argument({ "m/0" });
+    command.set_hd_key_argument({ "xpub68Gmy5EdvgibQVfPdqkBBCHxA5htiqg55crXYuXoQRKfDBFA1WEjWgP6LHhwBZeNK1VTsfTFUHCdrfp1bgwQ9xv5ski8PX9rL2dZXvgGDnw" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    const auto message = format(BX_HD_DERIVE_PRIVATE_KEY_CONFLICT) % "wif";
+    BX_REQUIRE_ERROR(message.str() + "\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
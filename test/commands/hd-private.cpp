@@ -139,5 +139,30 @@ BOOST_AUTO_TEST_CASE(hd_private__invoke__testnet__okay_output)
     BX_REQUIRE_OUTPUT("tprv8ceMhknangxznNWYWLbRe6ovqv4rPkrnv61XEwfaoaXwHtPQVT8Rg4PUQaGuuHCEyRC4bAthkWKmmKGML38nCcn7sEZ4v1Cw5Ar6TP63QcC\n");
 }
 
+// range
+
+BOOST_AUTO_TEST_CASE(hd_private__invoke__mainnet_vector1_m_0h_range_0_3__okay_output)
+{
+    BX_DECLARE_COMMAND(hd_private);
+    command.set_range_option({ "0:3" });
+    command.set_hd_private_key_argument({ "xprv9uHRZZhk6KAJC1avXpDAp4MDc3sQKNxDiPvvkX8Br5ngLNv1TxvUxt4cV1rGL5hj6KCesnDYUhd7oWgT11eZG7XnxHrnYeSvkzY7d2bhkJ7" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(
+        "xprv9wTYmMFdV23N21MM6dLNavSQV7Sj7meSPXx6AV5eTdqqGLjycVjb115Ec5LgRAXscPZgy5G4jQ9csyyZLN3PZLxoM1h3BoPuEJzsgeypdKj\n"
+        "xprv9wTYmMFdV23N2TdNG573QoEsfRrWKQgWeibmLntzniatZvR9BmLnvSxqu53Kw1UmYPxLgboyZQaXwTCg8MSY3H2EU4pWcQDnRnrVA1xe8fs\n"
+        "xprv9wTYmMFdV23N5YFSz5ydPEz3GQEYuhD6VSTaVgj8eahfG2GcnK3HhnLS67vFBLpwxqDemxMm4oRXgFLcxVhYmWYxjCdpNJP6rg6CsGtVBQC\n");
+}
+
+BOOST_AUTO_TEST_CASE(hd_private__invoke__mainnet_vector1_m_range_0h_2__okay_output)
+{
+    BX_DECLARE_COMMAND(hd_private);
+    command.set_range_option({ "0h:2" });
+    command.set_hd_private_key_argument({ "xprv9s21ZrQH143K3QTDL4LXw2F7HEK3wJUD2nW2nRk4stbPy6cq3jPPqjiChkVvvNKmPGJxWUtg6LnF5kejMRNNU3TGtRBeJgk33yuGBxrMPHi" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(
+        "xprv9uHRZZhk6KAJC1avXpDAp4MDc3sQKNxDiPvvkX8Br5ngLNv1TxvUxt4cV1rGL5hj6KCesnDYUhd7oWgT11eZG7XnxHrnYeSvkzY7d2bhkJ7\n"
+        "xprv9uHRZZhk6KAJFszJGW6LoUFq92uL7FvkBhmYiMurCWPHLJZkX2aGvNdRUBNnJu7nv36WnwCN59uNy6sxLDZvvNSgFz3TCCcKo7iutQzpg78\n");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
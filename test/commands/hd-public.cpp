@@ -303,5 +303,44 @@ BOOST_AUTO_TEST_CASE(hd_public__invoke__public_derivation_testnet__okay_output)
     BX_REQUIRE_OUTPUT("tpubDBUXE2QrFFQBfPLxoKD3U1zG294LmLSG3rD9MvREmKcExYBeH4U1gyHcrtZDZe6JFxMFYVzYYhRDWCuJAQE3AbdpD3Qz4FdPVu5UHLT1NKa\n");
 }
 
+// range
+
+BOOST_AUTO_TEST_CASE(hd_public__invoke__mainnet_vector1_public_m_0h_range_0_2__okay_output)
+{
+    BX_DECLARE_COMMAND(hd_public);
+    command.set_range_option({ "0:2" });
+    command.set_public_version_option(76067358);
+    command.set_secret_version_option(76066276);
+    command.set_hd_key_argument({ "xpub68Gmy5EdvgibQVfPdqkBBCHxA5htiqg55crXYuXoQRKfDBFA1WEjWgP6LHhwBZeNK1VTsfTFUHCdrfp1bgwQ9xv5ski8PX9rL2dZXvgGDnw" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(
+        "xpub6ASuArnXKPbfEVRpCesNx4P939HDXENHkksgxsVG1yNp9958A33qYoPiTN9QrJmWFa2jNLdK84bWmyqTSPGtApP8P7nHUYwxHPhqmzUyeFG\n"
+        "xpub6ASuArnXKPbfEwhqN6e3mwBcDTgzisQN1wXN9BJcM47sSikHjJf3UFHKkNAWbWMiGj7Wf5uMash7SyYq527Hqck2AxYysAA7xmALppuCkwQ\n");
+}
+
+BOOST_AUTO_TEST_CASE(hd_public__invoke__mainnet_vector1_private_m_0h_range_0_2__okay_output)
+{
+    BX_DECLARE_COMMAND(hd_public);
+    command.set_range_option({ "0:2" });
+    command.set_public_version_option(76067358);
+    command.set_secret_version_option(76066276);
+    command.set_hd_key_argument({ "xprv9uHRZZhk6KAJC1avXpDAp4MDc3sQKNxDiPvvkX8Br5ngLNv1TxvUxt4cV1rGL5hj6KCesnDYUhd7oWgT11eZG7XnxHrnYeSvkzY7d2bhkJ7" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(
+        "xpub6ASuArnXKPbfEVRpCesNx4P939HDXENHkksgxsVG1yNp9958A33qYoPiTN9QrJmWFa2jNLdK84bWmyqTSPGtApP8P7nHUYwxHPhqmzUyeFG\n"
+        "xpub6ASuArnXKPbfEwhqN6e3mwBcDTgzisQN1wXN9BJcM47sSikHjJf3UFHKkNAWbWMiGj7Wf5uMash7SyYq527Hqck2AxYysAA7xmALppuCkwQ\n");
+}
+
+BOOST_AUTO_TEST_CASE(hd_public__invoke__mainnet_vector1_public_hard_range__failure_error)
+{
+    BX_DECLARE_COMMAND(hd_public);
+    command.set_range_option({ "0h:2" });
+    command.set_public_version_option(76067358);
+    command.set_secret_version_option(76066276);
+    command.set_hd_key_argument({ "xpub661MyMwAqRbcFtXgS5sYJABqqG9YLmC4Q1Rdap9gSE8NqtwybGhePY2gZ29ESFjqJoCu1Rupje8YtGqsefD265TMg7usUDFdp6W1EGMcet8" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_HD_PUBLIC_HARD_OPTION_CONFLICT "\n");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
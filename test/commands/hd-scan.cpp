@@ -0,0 +1,81 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "command.hpp"
+
+BX_USING_NAMESPACES()
+
+BOOST_AUTO_TEST_SUITE(network)
+BOOST_AUTO_TEST_SUITE(hd_scan__invoke)
+
+#define BX_HD_SCAN_VECTOR1_M_0H_1 \
+"xpub6ASuArnXKPbfEwhqN6e3mwBcDTgzisQN1wXN9BJcM47sSikHjJf3UFHKkNAWbWMiGj7Wf5uMash7SyYq527Hqck2AxYysAA7xmALppuCkwQ"
+
+BOOST_AUTO_TEST_CASE(hd_scan__invoke__zero_window__failure_error)
+{
+    BX_DECLARE_NETWORK_COMMAND(hd_scan);
+    command.set_gap_option(20);
+    command.set_window_option(0);
+    command.set_public_version_option(76067358);
+    command.set_secret_version_option(76066276);
+    command.set_hd_key_argument({ BX_HD_SCAN_VECTOR1_M_0H_1 });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_HD_SCAN_ZERO_WINDOW "\n");
+}
+
+BOOST_AUTO_TEST_CASE(hd_scan__invoke__hardened_branch__failure_error)
+{
+    BX_DECLARE_NETWORK_COMMAND(hd_scan);
+    command.set_branchs_option({ 0, 2147483648 });
+    command.set_gap_option(20);
+    command.set_window_option(100);
+    command.set_public_version_option(76067358);
+    command.set_secret_version_option(76066276);
+    command.set_hd_key_argument({ BX_HD_SCAN_VECTOR1_M_0H_1 });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_HD_SCAN_HARDENED_BRANCH "\n");
+}
+
+BOOST_AUTO_TEST_CASE(hd_scan__invoke__unexpected_version__failure_error)
+{
+    BX_DECLARE_NETWORK_COMMAND(hd_scan);
+    command.set_gap_option(20);
+    command.set_window_option(100);
+    command.set_public_version_option(42);
+    command.set_secret_version_option(76066276);
+    command.set_hd_key_argument({ BX_HD_SCAN_VECTOR1_M_0H_1 });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_HD_SCAN_INVALID_VERSION "\n");
+}
+
+// requires libbitcoin-server.
+BOOST_AUTO_TEST_CASE(hd_scan__invoke__mainnet_vector1__okay)
+{
+    BX_DECLARE_NETWORK_COMMAND(hd_scan);
+    command.set_gap_option(5);
+    command.set_window_option(10);
+    command.set_public_version_option(76067358);
+    command.set_secret_version_option(76066276);
+    command.set_hd_key_argument({ BX_HD_SCAN_VECTOR1_M_0H_1 });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
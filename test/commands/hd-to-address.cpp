@@ -21,14 +21,82 @@
 
 BX_USING_NAMESPACES()
 
-BOOST_AUTO_TEST_SUITE(obsolete)
+BOOST_AUTO_TEST_SUITE(offline)
 BOOST_AUTO_TEST_SUITE(hd_to_address__invoke)
 
-BOOST_AUTO_TEST_CASE(hd_to_address__invoke__always__failure_error)
+BOOST_AUTO_TEST_CASE(hd_to_address__invoke__mainnet_vector1_public_m__okay_output)
 {
     BX_DECLARE_COMMAND(hd_to_address);
+    command.set_version_option(0);
+    command.set_public_version_option(76067358);
+    command.set_secret_version_option(76066276);
+    command.set_hd_key_argument({ "xpub661MyMwAqRbcFtXgS5sYJABqqG9YLmC4Q1Rdap9gSE8NqtwybGhePY2gZ29ESFjqJoCu1Rupje8YtGqsefD265TMg7usUDFdp6W1EGMcet8" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("15mKKb2eos1hWa6tisdPwwDC1a5J1y9nma\n");
+}
+
+BOOST_AUTO_TEST_CASE(hd_to_address__invoke__mainnet_vector1_private_m__okay_output)
+{
+    BX_DECLARE_COMMAND(hd_to_address);
+    command.set_version_option(0);
+    command.set_public_version_option(76067358);
+    command.set_secret_version_option(76066276);
+    command.set_hd_key_argument({ "xprv9s21ZrQH143K3QTDL4LXw2F7HEK3wJUD2nW2nRk4stbPy6cq3jPPqjiChkVvvNKmPGJxWUtg6LnF5kejMRNNU3TGtRBeJgk33yuGBxrMPHi" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("15mKKb2eos1hWa6tisdPwwDC1a5J1y9nma\n");
+}
+
+BOOST_AUTO_TEST_CASE(hd_to_address__invoke__mainnet_vector1_public_m_0h_range_0_2__okay_output)
+{
+    BX_DECLARE_COMMAND(hd_to_address);
+    command.set_version_option(0);
+    command.set_range_option({ "0:2" });
+    command.set_public_version_option(76067358);
+    command.set_secret_version_option(76066276);
+    command.set_hd_key_argument({ "xpub68Gmy5EdvgibQVfPdqkBBCHxA5htiqg55crXYuXoQRKfDBFA1WEjWgP6LHhwBZeNK1VTsfTFUHCdrfp1bgwQ9xv5ski8PX9rL2dZXvgGDnw" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(
+        "1LZaBnH11M2yN5ZNiK67yUbaspfX6XKmRr\n"
+        "1JQheacLPdM5ySCkrZkV66G2ApAXe1mqLj\n");
+}
+
+BOOST_AUTO_TEST_CASE(hd_to_address__invoke__mainnet_vector1_private_m_0h_range_0_2__okay_output)
+{
+    BX_DECLARE_COMMAND(hd_to_address);
+    command.set_version_option(0);
+    command.set_range_option({ "0:2" });
+    command.set_public_version_option(76067358);
+    command.set_secret_version_option(76066276);
+    command.set_hd_key_argument({ "xprv9uHRZZhk6KAJC1avXpDAp4MDc3sQKNxDiPvvkX8Br5ngLNv1TxvUxt4cV1rGL5hj6KCesnDYUhd7oWgT11eZG7XnxHrnYeSvkzY7d2bhkJ7" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(
+        "1LZaBnH11M2yN5ZNiK67yUbaspfX6XKmRr\n"
+        "1JQheacLPdM5ySCkrZkV66G2ApAXe1mqLj\n");
+}
+
+BOOST_AUTO_TEST_CASE(hd_to_address__invoke__mainnet_vector1_private_m_range_0h_2__okay_output)
+{
+    BX_DECLARE_COMMAND(hd_to_address);
+    command.set_version_option(0);
+    command.set_range_option({ "0h:2" });
+    command.set_public_version_option(76067358);
+    command.set_secret_version_option(76066276);
+    command.set_hd_key_argument({ "xprv9s21ZrQH143K3QTDL4LXw2F7HEK3wJUD2nW2nRk4stbPy6cq3jPPqjiChkVvvNKmPGJxWUtg6LnF5kejMRNNU3TGtRBeJgk33yuGBxrMPHi" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(
+        "19Q2WoS5hSS6T8GjhK8KZLMgmWaq4neXrh\n"
+        "18K46Cws3R7irQTGnSrp9Xpj6e5MhyAGf8\n");
+}
+
+BOOST_AUTO_TEST_CASE(hd_to_address__invoke__mainnet_vector1_public_hard_range__failure_error)
+{
+    BX_DECLARE_COMMAND(hd_to_address);
+    command.set_range_option({ "0h:2" });
+    command.set_public_version_option(76067358);
+    command.set_secret_version_option(76066276);
+    command.set_hd_key_argument({ "xpub661MyMwAqRbcFtXgS5sYJABqqG9YLmC4Q1Rdap9gSE8NqtwybGhePY2gZ29ESFjqJoCu1Rupje8YtGqsefD265TMg7usUDFdp6W1EGMcet8" });
     BX_REQUIRE_FAILURE(command.invoke(output, error));
-    BX_REQUIRE_ERROR(BX_HD_TO_ADDRESS_OBSOLETE "\n");
+    BX_REQUIRE_ERROR(BX_HD_TO_ADDRESS_HARD_RANGE_CONFLICT "\n");
 }
 
 BOOST_AUTO_TEST_SUITE_END()
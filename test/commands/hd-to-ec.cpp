@@ -67,5 +67,44 @@ BOOST_AUTO_TEST_CASE(hd_to_ec__invoke__testnet_public_key__okay_output)
     BX_REQUIRE_OUTPUT("029220af53b11605932e6101c962bdc752a234c6b0c2f0c398844e47b75503a692\n");
 }
 
+// range
+
+BOOST_AUTO_TEST_CASE(hd_to_ec__invoke__mainnet_private_key_range_0_2__okay_output)
+{
+    BX_DECLARE_COMMAND(hd_to_ec);
+    command.set_range_option({ "0:2" });
+    command.set_public_version_option(76067358);
+    command.set_secret_version_option(76066276);
+    command.set_hd_key_argument({ "xprv9uHRZZhk6KAJC1avXpDAp4MDc3sQKNxDiPvvkX8Br5ngLNv1TxvUxt4cV1rGL5hj6KCesnDYUhd7oWgT11eZG7XnxHrnYeSvkzY7d2bhkJ7" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(
+        "47a62230342a7cd15e02c3e8cc9386befe55ac129893e457166d46f37442c606\n"
+        "3c6cb8d0f6a264c91ea8b5030fadaa8e538b020f0a387421a12de9319dc93368\n");
+}
+
+BOOST_AUTO_TEST_CASE(hd_to_ec__invoke__mainnet_public_key_range_0_2__okay_output)
+{
+    BX_DECLARE_COMMAND(hd_to_ec);
+    command.set_range_option({ "0:2" });
+    command.set_public_version_option(76067358);
+    command.set_secret_version_option(76066276);
+    command.set_hd_key_argument({ "xpub68Gmy5EdvgibQVfPdqkBBCHxA5htiqg55crXYuXoQRKfDBFA1WEjWgP6LHhwBZeNK1VTsfTFUHCdrfp1bgwQ9xv5ski8PX9rL2dZXvgGDnw" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(
+        "033171c5f58a4504363dba2ca6cb7d6275f743bc8dada02dffef75912eaeeacf13\n"
+        "03501e454bf00751f24b1b489aa925215d66af2234e3891c3b21a52bedb3cd711c\n");
+}
+
+BOOST_AUTO_TEST_CASE(hd_to_ec__invoke__mainnet_public_key_hard_range__failure_error)
+{
+    BX_DECLARE_COMMAND(hd_to_ec);
+    command.set_range_option({ "0h:2" });
+    command.set_public_version_option(76067358);
+    command.set_secret_version_option(76066276);
+    command.set_hd_key_argument({ "xpub68Gmy5EdvgibQVfPdqkBBCHxA5htiqg55crXYuXoQRKfDBFA1WEjWgP6LHhwBZeNK1VTsfTFUHCdrfp1bgwQ9xv5ski8PX9rL2dZXvgGDnw" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_HD_TO_EC_HARD_RANGE_CONFLICT "\n");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,238 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <string>
+#include <boost/filesystem.hpp>
+
+#include "block_files.hpp"
+#include "command.hpp"
+
+BX_USING_NAMESPACES()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(index_blocks__invoke)
+
+#define INDEX_BLOCKS_PATH "index-blocks.dat"
+#define INDEX_BLOCKS_INDEX "index-blocks.idx"
+#define INDEX_BLOCKS_TRANSFERS_INFO \
+"transfers\n" \
+"{\n" \
+"    transfer\n" \
+"    {\n" \
+"        received\n" \
+"        {\n" \
+"            hash 39d2caaf112f21364be00c5d0b14e3763468934e586e416bf74647a1906b18e0\n" \
+"            height 0\n" \
+"            index 0\n" \
+"        }\n" \
+"        spent\n" \
+"        {\n" \
+"            hash 36ce8289993008ce973f6088f5ec3019376d864ee13f0773967bd2bc79ba5f7d\n" \
+"            height 1\n" \
+"            index 0\n" \
+"        }\n" \
+"        value 90000\n" \
+"    }\n" \
+"    transfer\n" \
+"    {\n" \
+"        received\n" \
+"        {\n" \
+"            hash 36ce8289993008ce973f6088f5ec3019376d864ee13f0773967bd2bc79ba5f7d\n" \
+"            height 1\n" \
+"            index 0\n" \
+"        }\n" \
+"        value 80000\n" \
+"    }\n" \
+"}\n"
+#define INDEX_BLOCKS_BALANCE_XML \
+"<?xml version=\"1.0\" encoding=\"utf-8\"?>\n" \
+"<balance><address>13Ft7SkreJY9D823NPm4t6D1cBqLYTJtAe</address><confirmed>80000</confirmed><received>170000</received><unspent>80000</unspent></balance>\n"
+
+static bool build_index(const std::string& hex)
+{
+    write_block_file(INDEX_BLOCKS_PATH, hex);
+    std::stringstream output;
+    std::stringstream error;
+    index_blocks command;
+    command.set_network_identifier_setting(BX_BLOCK_FILES_MAGIC);
+    command.set_index_file_argument({ INDEX_BLOCKS_INDEX });
+    command.set_block_files_argument({ INDEX_BLOCKS_PATH });
+    const auto result = command.invoke(output, error);
+    boost::filesystem::remove(INDEX_BLOCKS_PATH);
+    return result == console_result::okay;
+}
+
+BOOST_AUTO_TEST_CASE(index_blocks__invoke__new_then_current__okay_output)
+{
+    BX_DECLARE_COMMAND(index_blocks);
+    command.set_network_identifier_setting(BX_BLOCK_FILES_MAGIC);
+    boost::filesystem::remove(INDEX_BLOCKS_INDEX);
+    write_block_file(INDEX_BLOCKS_PATH, BX_BLOCK_FILES_BASE16);
+    command.set_index_file_argument({ INDEX_BLOCKS_INDEX });
+    command.set_block_files_argument({ INDEX_BLOCKS_PATH });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    const auto created = (format(BX_INDEX_BLOCKS_OKAY) % 2 % 2 % 2).str();
+    BX_REQUIRE_OUTPUT(created + "\n");
+
+    // The chain of the files is already indexed.
+    output.str("");
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    boost::filesystem::remove(INDEX_BLOCKS_PATH);
+    boost::filesystem::remove(INDEX_BLOCKS_INDEX);
+    const auto current = (format(BX_INDEX_BLOCKS_OKAY) % 0 % 2 % 2).str();
+    BX_REQUIRE_OUTPUT(current + "\n");
+}
+
+BOOST_AUTO_TEST_CASE(index_blocks__invoke__extended__okay_output)
+{
+    boost::filesystem::remove(INDEX_BLOCKS_INDEX);
+    BOOST_REQUIRE(build_index(BX_BLOCK_FILES_BLOCK_A_BASE16));
+    BX_DECLARE_COMMAND(index_blocks);
+    command.set_network_identifier_setting(BX_BLOCK_FILES_MAGIC);
+    write_block_file(INDEX_BLOCKS_PATH, BX_BLOCK_FILES_BASE16);
+    command.set_index_file_argument({ INDEX_BLOCKS_INDEX });
+    command.set_block_files_argument({ INDEX_BLOCKS_PATH });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    boost::filesystem::remove(INDEX_BLOCKS_PATH);
+    boost::filesystem::remove(INDEX_BLOCKS_INDEX);
+    const auto extended = (format(BX_INDEX_BLOCKS_OKAY) % 1 % 2 % 2).str();
+    BX_REQUIRE_OUTPUT(extended + "\n");
+}
+
+BOOST_AUTO_TEST_CASE(index_blocks__invoke__extended_fetch_history__okay_output)
+{
+    boost::filesystem::remove(INDEX_BLOCKS_INDEX);
+    BOOST_REQUIRE(build_index(BX_BLOCK_FILES_BLOCK_A_BASE16));
+    BOOST_REQUIRE(build_index(BX_BLOCK_FILES_BASE16));
+    BX_DECLARE_COMMAND(fetch_history);
+    command.set_format_option({ "info" });
+    command.set_local_index_option({ INDEX_BLOCKS_INDEX });
+    command.set_payment_address_argument({ BX_BLOCK_FILES_ADDRESS });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    boost::filesystem::remove(INDEX_BLOCKS_INDEX);
+    BX_REQUIRE_OUTPUT(INDEX_BLOCKS_TRANSFERS_INFO);
+}
+
+BOOST_AUTO_TEST_CASE(index_blocks__invoke__not_extended__failure_error)
+{
+    boost::filesystem::remove(INDEX_BLOCKS_INDEX);
+    BOOST_REQUIRE(build_index(BX_BLOCK_FILES_BASE16));
+    BX_DECLARE_COMMAND(index_blocks);
+    command.set_network_identifier_setting(BX_BLOCK_FILES_MAGIC);
+    write_block_file(INDEX_BLOCKS_PATH, BX_BLOCK_FILES_BLOCK_A_BASE16);
+    command.set_index_file_argument({ INDEX_BLOCKS_INDEX });
+    command.set_block_files_argument({ INDEX_BLOCKS_PATH });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    boost::filesystem::remove(INDEX_BLOCKS_PATH);
+    BX_REQUIRE_ERROR(BX_INDEX_BLOCKS_NOT_EXTENDED "\n");
+
+    // The index is not changed.
+    const address_index index(INDEX_BLOCKS_INDEX);
+    BOOST_REQUIRE(index.valid());
+    BOOST_REQUIRE_EQUAL(index.blocks(), 2u);
+    boost::filesystem::remove(INDEX_BLOCKS_INDEX);
+}
+
+BOOST_AUTO_TEST_CASE(index_blocks__invoke__no_genesis__failure_error)
+{
+    BX_DECLARE_COMMAND(index_blocks);
+    command.set_network_identifier_setting(BX_BLOCK_FILES_MAGIC);
+    write_block_file(INDEX_BLOCKS_PATH, BX_BLOCK_FILES_BLOCK_C_BASE16);
+    command.set_index_file_argument({ INDEX_BLOCKS_INDEX });
+    command.set_block_files_argument({ INDEX_BLOCKS_PATH });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    boost::filesystem::remove(INDEX_BLOCKS_PATH);
+    BX_REQUIRE_ERROR(BX_INDEX_BLOCKS_NO_CHAIN "\n");
+}
+
+BOOST_AUTO_TEST_CASE(index_blocks__invoke__invalid_index__failure_error)
+{
+    BX_DECLARE_COMMAND(index_blocks);
+    command.set_network_identifier_setting(BX_BLOCK_FILES_MAGIC);
+    write_block_file(INDEX_BLOCKS_INDEX, BX_BLOCK_FILES_BLOCK_A_BASE16);
+    write_block_file(INDEX_BLOCKS_PATH, BX_BLOCK_FILES_BASE16);
+    command.set_index_file_argument({ INDEX_BLOCKS_INDEX });
+    command.set_block_files_argument({ INDEX_BLOCKS_PATH });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    boost::filesystem::remove(INDEX_BLOCKS_PATH);
+    boost::filesystem::remove(INDEX_BLOCKS_INDEX);
+    const auto message = format(BX_INDEX_BLOCKS_INDEX_INVALID) %
+        boost::filesystem::path(INDEX_BLOCKS_INDEX);
+    BX_REQUIRE_ERROR(message.str() + "\n");
+}
+
+BOOST_AUTO_TEST_CASE(index_blocks__invoke__fetch_history_local_index__okay_output)
+{
+    BOOST_REQUIRE(build_index(BX_BLOCK_FILES_BASE16));
+    BX_DECLARE_COMMAND(fetch_history);
+    command.set_format_option({ "info" });
+    command.set_local_index_option({ INDEX_BLOCKS_INDEX });
+    command.set_payment_address_argument({ BX_BLOCK_FILES_ADDRESS });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    boost::filesystem::remove(INDEX_BLOCKS_INDEX);
+    BX_REQUIRE_OUTPUT(INDEX_BLOCKS_TRANSFERS_INFO);
+}
+
+BOOST_AUTO_TEST_CASE(index_blocks__invoke__fetch_balance_local_index__okay_output)
+{
+    BOOST_REQUIRE(build_index(BX_BLOCK_FILES_BASE16));
+    BX_DECLARE_COMMAND(fetch_balance);
+    command.set_format_option({ "xml" });
+    command.set_local_index_option({ INDEX_BLOCKS_INDEX });
+    command.set_payment_address_argument({ BX_BLOCK_FILES_ADDRESS });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    boost::filesystem::remove(INDEX_BLOCKS_INDEX);
+    BX_REQUIRE_OUTPUT(INDEX_BLOCKS_BALANCE_XML);
+}
+
+BOOST_AUTO_TEST_CASE(index_blocks__invoke__fetch_history_missing_index__failure)
+{
+    BX_DECLARE_COMMAND(fetch_history);
+    command.set_local_index_option({ "missing.idx" });
+    command.set_payment_address_argument({ BX_BLOCK_FILES_ADDRESS });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+}
+
+BOOST_AUTO_TEST_CASE(index_blocks__invoke__testnet__failure_error)
+{
+    boost::filesystem::remove(INDEX_BLOCKS_INDEX);
+    BX_DECLARE_COMMAND(index_blocks);
+    command.set_network_identifier_setting(BX_BLOCK_FILES_TESTNET_MAGIC);
+    write_block_file(INDEX_BLOCKS_PATH, BX_BLOCK_FILES_BASE16);
+    command.set_index_file_argument({ INDEX_BLOCKS_INDEX });
+    command.set_block_files_argument({ INDEX_BLOCKS_PATH });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    boost::filesystem::remove(INDEX_BLOCKS_PATH);
+    BOOST_REQUIRE(!boost::filesystem::exists(INDEX_BLOCKS_INDEX));
+    const auto message = format(BX_INDEX_BLOCKS_FILE_NETWORK) %
+        boost::filesystem::path(INDEX_BLOCKS_PATH);
+    BX_REQUIRE_ERROR(message.str() + "\n");
+}
+
+BOOST_AUTO_TEST_CASE(index_blocks__invoke__missing_file__failure)
+{
+    BX_DECLARE_COMMAND(index_blocks);
+    command.set_network_identifier_setting(BX_BLOCK_FILES_MAGIC);
+    command.set_index_file_argument({ INDEX_BLOCKS_INDEX });
+    command.set_block_files_argument({ "missing.dat" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,167 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <string>
+#include <boost/filesystem.hpp>
+
+#include "block_files.hpp"
+#include "command.hpp"
+
+BX_USING_NAMESPACES()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(scan_blocks__invoke)
+
+#define SCAN_BLOCKS_OTHER_ADDRESS "1DRCR5Gvg18FNo8HUPH1u5bfd9b5XfnJDj"
+#define SCAN_BLOCKS_PATH "scan-blocks.dat"
+#define SCAN_BLOCKS_TRANSFERS_INFO \
+"transfers\n" \
+"{\n" \
+"    transfer\n" \
+"    {\n" \
+"        received\n" \
+"        {\n" \
+"            hash 39d2caaf112f21364be00c5d0b14e3763468934e586e416bf74647a1906b18e0\n" \
+"            height 0\n" \
+"            index 0\n" \
+"        }\n" \
+"        spent\n" \
+"        {\n" \
+"            hash 36ce8289993008ce973f6088f5ec3019376d864ee13f0773967bd2bc79ba5f7d\n" \
+"            height 1\n" \
+"            index 0\n" \
+"        }\n" \
+"        value 90000\n" \
+"    }\n" \
+"    transfer\n" \
+"    {\n" \
+"        received\n" \
+"        {\n" \
+"            hash 36ce8289993008ce973f6088f5ec3019376d864ee13f0773967bd2bc79ba5f7d\n" \
+"            height 1\n" \
+"            index 0\n" \
+"        }\n" \
+"        value 80000\n" \
+"    }\n" \
+"}\n"
+#define SCAN_BLOCKS_TRANSACTIONS_INFO \
+"transaction\n" \
+"{\n" \
+"    hash 39d2caaf112f21364be00c5d0b14e3763468934e586e416bf74647a1906b18e0\n" \
+"}\n" \
+"transaction\n" \
+"{\n" \
+"    hash 36ce8289993008ce973f6088f5ec3019376d864ee13f0773967bd2bc79ba5f7d\n" \
+"}\n"
+
+BOOST_AUTO_TEST_CASE(scan_blocks__invoke__transfers__okay_output)
+{
+    BX_DECLARE_COMMAND(scan_blocks);
+    command.set_network_identifier_setting(BX_BLOCK_FILES_MAGIC);
+    write_block_file(SCAN_BLOCKS_PATH, BX_BLOCK_FILES_BASE16);
+    command.set_format_option({ "info" });
+    const wallet::payment_address address(BX_BLOCK_FILES_ADDRESS);
+    command.set_addresss_option({ address });
+    command.set_block_files_argument({ SCAN_BLOCKS_PATH });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    boost::filesystem::remove(SCAN_BLOCKS_PATH);
+    BX_REQUIRE_OUTPUT(SCAN_BLOCKS_TRANSFERS_INFO);
+}
+
+BOOST_AUTO_TEST_CASE(scan_blocks__invoke__transactions__okay_output)
+{
+    BX_DECLARE_COMMAND(scan_blocks);
+    command.set_network_identifier_setting(BX_BLOCK_FILES_MAGIC);
+    write_block_file(SCAN_BLOCKS_PATH, BX_BLOCK_FILES_BASE16);
+    command.set_format_option({ "info" });
+    command.set_fields_option("hash");
+    command.set_transactions_option(true);
+    const wallet::payment_address address(BX_BLOCK_FILES_ADDRESS);
+    command.set_addresss_option({ address });
+    command.set_block_files_argument({ SCAN_BLOCKS_PATH });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    boost::filesystem::remove(SCAN_BLOCKS_PATH);
+    BX_REQUIRE_OUTPUT(SCAN_BLOCKS_TRANSACTIONS_INFO);
+}
+
+BOOST_AUTO_TEST_CASE(scan_blocks__invoke__other_address__okay_no_transfers)
+{
+    BX_DECLARE_COMMAND(scan_blocks);
+    command.set_network_identifier_setting(BX_BLOCK_FILES_MAGIC);
+    write_block_file(SCAN_BLOCKS_PATH, BX_BLOCK_FILES_BASE16);
+    command.set_format_option({ "info" });
+    command.set_fields_option("hash");
+    command.set_transactions_option(true);
+    const wallet::payment_address address(SCAN_BLOCKS_OTHER_ADDRESS);
+    command.set_addresss_option({ address });
+    command.set_block_files_argument({ SCAN_BLOCKS_PATH });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    boost::filesystem::remove(SCAN_BLOCKS_PATH);
+    BX_REQUIRE_OUTPUT("");
+}
+
+BOOST_AUTO_TEST_CASE(scan_blocks__invoke__truncated_file__failure_error)
+{
+    BX_DECLARE_COMMAND(scan_blocks);
+    command.set_network_identifier_setting(BX_BLOCK_FILES_MAGIC);
+    write_block_file(SCAN_BLOCKS_PATH, "f9beb4d9a6000000" "0100");
+    const wallet::payment_address address(BX_BLOCK_FILES_ADDRESS);
+    command.set_addresss_option({ address });
+    command.set_block_files_argument({ SCAN_BLOCKS_PATH });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    boost::filesystem::remove(SCAN_BLOCKS_PATH);
+    const auto message = format(BX_SCAN_BLOCKS_FILE_INVALID) %
+        boost::filesystem::path(SCAN_BLOCKS_PATH);
+    BX_REQUIRE_ERROR(message.str() + "\n");
+}
+
+BOOST_AUTO_TEST_CASE(scan_blocks__invoke__no_genesis__failure_error)
+{
+    BX_DECLARE_COMMAND(scan_blocks);
+    command.set_network_identifier_setting(BX_BLOCK_FILES_MAGIC);
+    write_block_file(SCAN_BLOCKS_PATH, BX_BLOCK_FILES_BLOCK_C_BASE16);
+    const wallet::payment_address address(BX_BLOCK_FILES_ADDRESS);
+    command.set_addresss_option({ address });
+    command.set_block_files_argument({ SCAN_BLOCKS_PATH });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    boost::filesystem::remove(SCAN_BLOCKS_PATH);
+    BX_REQUIRE_ERROR(BX_SCAN_BLOCKS_NO_CHAIN "\n");
+}
+
+BOOST_AUTO_TEST_CASE(scan_blocks__invoke__no_addresses__failure_error)
+{
+    BX_DECLARE_COMMAND(scan_blocks);
+    command.set_network_identifier_setting(BX_BLOCK_FILES_MAGIC);
+    command.set_block_files_argument({ SCAN_BLOCKS_PATH });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_SCAN_BLOCKS_NO_ADDRESSES "\n");
+}
+
+BOOST_AUTO_TEST_CASE(scan_blocks__invoke__missing_file__failure)
+{
+    BX_DECLARE_COMMAND(scan_blocks);
+    command.set_network_identifier_setting(BX_BLOCK_FILES_MAGIC);
+    const wallet::payment_address address(BX_BLOCK_FILES_ADDRESS);
+    command.set_addresss_option({ address });
+    command.set_block_files_argument({ "missing.dat" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
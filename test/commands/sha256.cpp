@@ -56,5 +56,33 @@ BOOST_AUTO_TEST_CASE(sha256__invoke__good_food__okay_output)
     BX_REQUIRE_OUTPUT("f0ebe3bd55115e573ba35c2b1b65a923ff64c7a548d0deab73f9314754a9149d\n");
 }
 
+BOOST_AUTO_TEST_CASE(sha256__invoke__wrapped_stream__okay_output)
+{
+    BX_DECLARE_COMMAND(sha256);
+    std::stringstream input("900d\nf00d\n");
+    command.set_base16_argument(base16_stream(input));
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("f0ebe3bd55115e573ba35c2b1b65a923ff64c7a548d0deab73f9314754a9149d\n");
+}
+
+BOOST_AUTO_TEST_CASE(sha256__invoke__raw_stream__okay_output)
+{
+    BX_DECLARE_COMMAND(sha256);
+    std::stringstream input(BX_SHA256_NIST_MESSAGE_B);
+    command.set_base16_argument(base16_stream(input));
+    command.set_raw_option(true);
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(BX_SHA256_NIST_DIGEST_B "\n");
+}
+
+BOOST_AUTO_TEST_CASE(sha256__invoke__invalid_stream__failure_error)
+{
+    BX_DECLARE_COMMAND(sha256);
+    std::stringstream input("900df00");
+    command.set_base16_argument(base16_stream(input));
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_SHA256_INVALID "\n");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
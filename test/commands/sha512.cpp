@@ -33,5 +33,15 @@ BOOST_AUTO_TEST_CASE(sha1512__invoke__always__okay_output)
     BX_REQUIRE_OUTPUT("d1f51c57b00d399be4e708bfd1d76d711bbbdda534383df4f06933187bce41fdfdaa6385cfa960f68abcd33ae0573deb39503f73e8e2b7645845671f11855f8e\n");
 }
 
+BOOST_AUTO_TEST_CASE(sha512__invoke__raw_stream__okay_output)
+{
+    BX_DECLARE_COMMAND(sha512);
+    std::stringstream input("abc");
+    command.set_base16_argument(base16_stream(input));
+    command.set_raw_option(true);
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("ddaf35a193617abacc417349ae20413112e6fa4e89a97ea20a9eeee64b55d39a2192992a274fc1a836ba3c23a3feebbd454d4423643ce80e2a9ac94fa54ca49f\n");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
@@ -95,6 +95,19 @@ BOOST_AUTO_TEST_SUITE(tx_decode__invoke)
 "    version 1\n" \
 "}\n"
 
+#define TX_DECODE_TX_A_FIELDS_INFO \
+"transaction\n" \
+"{\n" \
+"    hash 39d2caaf112f21364be00c5d0b14e3763468934e586e416bf74647a1906b18e0\n" \
+"    outputs\n" \
+"    {\n" \
+"        output\n" \
+"        {\n" \
+"            value 90000\n" \
+"        }\n" \
+"    }\n" \
+"}\n"
+
 BOOST_AUTO_TEST_CASE(tx_decode__invoke__tx_A_info__okay_output)
 {
     BX_DECLARE_COMMAND(tx_decode);
@@ -132,5 +145,102 @@ BOOST_AUTO_TEST_CASE(tx_decode__invoke__tx_B_info__okay_output)
     BX_REQUIRE_OUTPUT(TX_DECODE_TX_B_INFO);
 }
 
+BOOST_AUTO_TEST_CASE(tx_decode__invoke__tx_A_fields__okay_output)
+{
+    BX_DECLARE_COMMAND(tx_decode);
+    command.set_format_option({ "info" });
+    command.set_fields_option("hash, outputs.value");
+    command.set_transaction_argument({ TX_DECODE_TX_A_BASE16 });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(TX_DECODE_TX_A_FIELDS_INFO);
+}
+
+BOOST_AUTO_TEST_CASE(tx_decode__invoke__bogus_field__failure_error)
+{
+    BX_DECLARE_COMMAND(tx_decode);
+    command.set_fields_option("hash,outputs.bogus");
+    command.set_transaction_argument({ TX_DECODE_TX_A_BASE16 });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    const auto message = format(BX_TX_DECODE_INVALID_FIELD) % "outputs.bogus";
+    BX_REQUIRE_ERROR(message.str() + "\n");
+}
+
+// The format shortcut is not shared with another option.
+BOOST_AUTO_TEST_CASE(tx_decode__parse__format_shortcut__json)
+{
+    tx_decode command;
+    parser metadata(command);
+    std::string message;
+    std::stringstream input;
+    const char* argv[] = { "tx-decode", "-f", "json", TX_DECODE_TX_A_BASE16 };
+    BOOST_REQUIRE(metadata.parse(message, input, 4, argv));
+    const encoding_engine engine = command.get_format_option();
+    BOOST_REQUIRE(engine == encoding_engine::json);
+}
+
+BOOST_AUTO_TEST_CASE(tx_decode__invoke__base16_stream__okay_output)
+{
+    BX_DECLARE_COMMAND(tx_decode);
+    command.set_format_option({ "info" });
+    std::stringstream input(TX_DECODE_TX_A_BASE16 "\n"
+        TX_DECODE_TX_B_BASE16 "\n");
+    command.set_transaction_argument(transaction_stream(input));
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(TX_DECODE_TX_A_INFO TX_DECODE_TX_B_INFO);
+}
+
+BOOST_AUTO_TEST_CASE(tx_decode__invoke__binary_stream__okay_output)
+{
+    BX_DECLARE_COMMAND(tx_decode);
+    command.set_format_option({ "info" });
+    const auto binary = base16(TX_DECODE_TX_A_BASE16 TX_DECODE_TX_B_BASE16);
+    const data_chunk& bytes = binary;
+    std::stringstream input(std::string(bytes.begin(), bytes.end()));
+    command.set_transaction_argument(transaction_stream(input));
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(TX_DECODE_TX_A_INFO TX_DECODE_TX_B_INFO);
+}
+
+BOOST_AUTO_TEST_CASE(tx_decode__invoke__raw_stream__okay_output)
+{
+    BX_DECLARE_COMMAND(tx_decode);
+    command.set_format_option({ "info" });
+    const auto binary = base16(TX_DECODE_TX_A_BASE16);
+    const data_chunk& bytes = binary;
+    std::stringstream input(std::string(bytes.begin(), bytes.end()));
+    command.set_transaction_argument(transaction_stream(input));
+    command.set_raw_option(true);
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(TX_DECODE_TX_A_INFO);
+}
+
+BOOST_AUTO_TEST_CASE(tx_decode__invoke__invalid_stream__failure_error)
+{
+    BX_DECLARE_COMMAND(tx_decode);
+    command.set_format_option({ "info" });
+    std::stringstream input(TX_DECODE_TX_A_BASE16 " bogus");
+    command.set_transaction_argument(transaction_stream(input));
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_TX_DECODE_INVALID "\n");
+}
+
+BOOST_AUTO_TEST_CASE(tx_decode__invoke__invalid_stream_cbor__failure_no_output)
+{
+    BX_DECLARE_COMMAND(tx_decode);
+    command.set_format_option({ "cbor" });
+    std::stringstream input(TX_DECODE_TX_A_BASE16 " bogus");
+    command.set_transaction_argument(transaction_stream(input));
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("");
+    BX_REQUIRE_ERROR(BX_TX_DECODE_INVALID "\n");
+}
+
+BOOST_AUTO_TEST_CASE(tx_decode__invoke__missing_file__failure)
+{
+    BX_DECLARE_COMMAND(tx_decode);
+    command.set_file_option({ "missing.tx" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,176 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <string>
+#include <boost/filesystem.hpp>
+
+#include "block_files.hpp"
+#include "command.hpp"
+
+BX_USING_NAMESPACES()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(utxo_snapshot__invoke)
+
+#define UTXO_SNAPSHOT_PATH "utxo-snapshot.dat"
+#define UTXO_SNAPSHOT_SNAPSHOT "utxo-snapshot.utxo"
+#define UTXO_SNAPSHOT_POINT \
+"36ce8289993008ce973f6088f5ec3019376d864ee13f0773967bd2bc79ba5f7d:0\n"
+#define UTXO_SNAPSHOT_BALANCE_XML \
+"<?xml version=\"1.0\" encoding=\"utf-8\"?>\n" \
+"<balance><address>13Ft7SkreJY9D823NPm4t6D1cBqLYTJtAe</address><confirmed>80000</confirmed><unspent>80000</unspent></balance>\n"
+#define UTXO_SNAPSHOT_GENESIS_BALANCE_XML \
+"<?xml version=\"1.0\" encoding=\"utf-8\"?>\n" \
+"<balance><address>13Ft7SkreJY9D823NPm4t6D1cBqLYTJtAe</address><confirmed>90000</confirmed><unspent>90000</unspent></balance>\n"
+
+static bool build_snapshot(uint32_t height=max_uint32)
+{
+    write_block_file(UTXO_SNAPSHOT_PATH, BX_BLOCK_FILES_BASE16);
+    std::stringstream output;
+    std::stringstream error;
+    utxo_snapshot command;
+    command.set_network_identifier_setting(BX_BLOCK_FILES_MAGIC);
+    command.set_height_option(height);
+    command.set_snapshot_file_argument({ UTXO_SNAPSHOT_SNAPSHOT });
+    command.set_block_files_argument({ UTXO_SNAPSHOT_PATH });
+    const auto result = command.invoke(output, error);
+    boost::filesystem::remove(UTXO_SNAPSHOT_PATH);
+    return result == console_result::okay;
+}
+
+BOOST_AUTO_TEST_CASE(utxo_snapshot__invoke__top__okay_output)
+{
+    BX_DECLARE_COMMAND(utxo_snapshot);
+    command.set_network_identifier_setting(BX_BLOCK_FILES_MAGIC);
+    write_block_file(UTXO_SNAPSHOT_PATH, BX_BLOCK_FILES_BASE16);
+    command.set_height_option(max_uint32);
+    command.set_snapshot_file_argument({ UTXO_SNAPSHOT_SNAPSHOT });
+    command.set_block_files_argument({ UTXO_SNAPSHOT_PATH });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    boost::filesystem::remove(UTXO_SNAPSHOT_PATH);
+    boost::filesystem::remove(UTXO_SNAPSHOT_SNAPSHOT);
+    const auto expected = (format(BX_UTXO_SNAPSHOT_OKAY) % 2 % 1).str();
+    BX_REQUIRE_OUTPUT(expected + "\n");
+}
+
+BOOST_AUTO_TEST_CASE(utxo_snapshot__invoke__height_zero__okay_output)
+{
+    BX_DECLARE_COMMAND(utxo_snapshot);
+    command.set_network_identifier_setting(BX_BLOCK_FILES_MAGIC);
+    write_block_file(UTXO_SNAPSHOT_PATH, BX_BLOCK_FILES_BASE16);
+    command.set_height_option(0);
+    command.set_snapshot_file_argument({ UTXO_SNAPSHOT_SNAPSHOT });
+    command.set_block_files_argument({ UTXO_SNAPSHOT_PATH });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    boost::filesystem::remove(UTXO_SNAPSHOT_PATH);
+    boost::filesystem::remove(UTXO_SNAPSHOT_SNAPSHOT);
+    const auto expected = (format(BX_UTXO_SNAPSHOT_OKAY) % 1 % 1).str();
+    BX_REQUIRE_OUTPUT(expected + "\n");
+}
+
+BOOST_AUTO_TEST_CASE(utxo_snapshot__invoke__fetch_balance_snapshot__okay_output)
+{
+    BOOST_REQUIRE(build_snapshot());
+    BX_DECLARE_COMMAND(fetch_balance);
+    command.set_format_option({ "xml" });
+    command.set_snapshot_option({ UTXO_SNAPSHOT_SNAPSHOT });
+    command.set_payment_address_argument({ BX_BLOCK_FILES_ADDRESS });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    boost::filesystem::remove(UTXO_SNAPSHOT_SNAPSHOT);
+    BX_REQUIRE_OUTPUT(UTXO_SNAPSHOT_BALANCE_XML);
+}
+
+BOOST_AUTO_TEST_CASE(utxo_snapshot__invoke__fetch_balance_genesis_snapshot__okay_output)
+{
+    BOOST_REQUIRE(build_snapshot(0));
+    BX_DECLARE_COMMAND(fetch_balance);
+    command.set_format_option({ "xml" });
+    command.set_snapshot_option({ UTXO_SNAPSHOT_SNAPSHOT });
+    command.set_payment_address_argument({ BX_BLOCK_FILES_ADDRESS });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    boost::filesystem::remove(UTXO_SNAPSHOT_SNAPSHOT);
+    BX_REQUIRE_OUTPUT(UTXO_SNAPSHOT_GENESIS_BALANCE_XML);
+}
+
+BOOST_AUTO_TEST_CASE(utxo_snapshot__invoke__fetch_balance_snapshot_and_index__failure_error)
+{
+    BX_DECLARE_COMMAND(fetch_balance);
+    command.set_snapshot_option({ UTXO_SNAPSHOT_SNAPSHOT });
+    command.set_local_index_option({ "utxo-snapshot.idx" });
+    command.set_payment_address_argument({ BX_BLOCK_FILES_ADDRESS });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_FETCH_BALANCE_SNAPSHOT_AND_INDEX "\n");
+}
+
+BOOST_AUTO_TEST_CASE(utxo_snapshot__invoke__fetch_utxo_snapshot__okay_output)
+{
+    BOOST_REQUIRE(build_snapshot());
+    BX_DECLARE_COMMAND(fetch_utxo);
+    command.set_algorithm_option("largest");
+    command.set_satoshi_argument(50000);
+    command.set_snapshot_option({ UTXO_SNAPSHOT_SNAPSHOT });
+    command.set_payment_addresss_argument({ { BX_BLOCK_FILES_ADDRESS } });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    boost::filesystem::remove(UTXO_SNAPSHOT_SNAPSHOT);
+    BX_REQUIRE_OUTPUT(UTXO_SNAPSHOT_POINT);
+}
+
+BOOST_AUTO_TEST_CASE(utxo_snapshot__invoke__fetch_utxo_insufficient__failure)
+{
+    BOOST_REQUIRE(build_snapshot());
+    BX_DECLARE_COMMAND(fetch_utxo);
+    command.set_algorithm_option("largest");
+    command.set_satoshi_argument(90000);
+    command.set_snapshot_option({ UTXO_SNAPSHOT_SNAPSHOT });
+    command.set_payment_addresss_argument({ { BX_BLOCK_FILES_ADDRESS } });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    boost::filesystem::remove(UTXO_SNAPSHOT_SNAPSHOT);
+}
+
+BOOST_AUTO_TEST_CASE(utxo_snapshot__invoke__fetch_balance_missing_snapshot__failure)
+{
+    BX_DECLARE_COMMAND(fetch_balance);
+    command.set_snapshot_option({ "missing.utxo" });
+    command.set_payment_address_argument({ BX_BLOCK_FILES_ADDRESS });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+}
+
+BOOST_AUTO_TEST_CASE(utxo_snapshot__invoke__no_genesis__failure_error)
+{
+    BX_DECLARE_COMMAND(utxo_snapshot);
+    command.set_network_identifier_setting(BX_BLOCK_FILES_MAGIC);
+    write_block_file(UTXO_SNAPSHOT_PATH, BX_BLOCK_FILES_BLOCK_C_BASE16);
+    command.set_snapshot_file_argument({ UTXO_SNAPSHOT_SNAPSHOT });
+    command.set_block_files_argument({ UTXO_SNAPSHOT_PATH });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    boost::filesystem::remove(UTXO_SNAPSHOT_PATH);
+    BX_REQUIRE_ERROR(BX_UTXO_SNAPSHOT_NO_CHAIN "\n");
+}
+
+BOOST_AUTO_TEST_CASE(utxo_snapshot__invoke__missing_file__failure)
+{
+    BX_DECLARE_COMMAND(utxo_snapshot);
+    command.set_network_identifier_setting(BX_BLOCK_FILES_MAGIC);
+    command.set_snapshot_file_argument({ UTXO_SNAPSHOT_SNAPSHOT });
+    command.set_block_files_argument({ "missing.dat" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,210 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer.hpp>
+
+using namespace bc;
+using namespace bc::explorer;
+
+static const size_t iterations = 200;
+
+// The group order, and the order less one (the negation of one).
+static const char* group_order =
+    "fffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364141";
+static const char* order_less_one =
+    "fffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364140";
+
+template <size_t Size>
+static byte_array<Size> from_base16(const std::string& text)
+{
+    data_chunk data;
+    BOOST_REQUIRE(decode_base16(data, text));
+    BOOST_REQUIRE_EQUAL(data.size(), Size);
+
+    byte_array<Size> out;
+    std::copy(data.begin(), data.end(), out.begin());
+    return out;
+}
+
+static ec_secret random_secret(std::mt19937& generator)
+{
+    std::uniform_int_distribution<int> byte(0, 255);
+    ec_secret secret;
+    for (auto& value: secret)
+        value = static_cast<uint8_t>(byte(generator));
+
+    // Keep the secret below the order.
+    secret[0] &= 0x7f;
+    return secret;
+}
+
+static ec_compressed to_public(const ec_secret& secret)
+{
+    ec_compressed point;
+    BOOST_REQUIRE(secret_to_public(point, secret));
+    return point;
+}
+
+static ec_affine to_affine(const ec_compressed& point)
+{
+    ec_affine out;
+    BOOST_REQUIRE(ec_decompress_point(out, point));
+    return out;
+}
+
+static ec_compressed to_compressed(const ec_jacobian& point)
+{
+    std::vector<ec_affine> out;
+    ec_normalize_batch(out, { point });
+    return ec_compress_point(out.front());
+}
+
+BOOST_AUTO_TEST_SUITE(ec_batch)
+
+BOOST_AUTO_TEST_CASE(ec_batch__decompress__random__round_trips)
+{
+    std::mt19937 generator(42);
+    for (size_t iteration = 0; iteration < iterations; ++iteration)
+    {
+        const auto point = to_public(random_secret(generator));
+        BOOST_REQUIRE(ec_compress_point(to_affine(point)) == point);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ec_batch__decompress__invalid__false)
+{
+    std::mt19937 generator(42);
+    auto point = to_public(random_secret(generator));
+    ec_affine out;
+
+    point[0] = 0x04;
+    BOOST_REQUIRE(!ec_decompress_point(out, point));
+
+    // The field prime is not a valid coordinate.
+    const auto prime = from_base16<ec_compressed_size>(
+        "02fffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f");
+    BOOST_REQUIRE(!ec_decompress_point(out, prime));
+
+    // There is no point with x = 5 (5^3 + 7 is not a square).
+    const auto off_curve = from_base16<ec_compressed_size>(
+        "020000000000000000000000000000000000000000000000000000000000000005");
+    BOOST_REQUIRE(!ec_decompress_point(out, off_curve));
+}
+
+BOOST_AUTO_TEST_CASE(ec_batch__multiply_generator__random__matches_secret_to_public)
+{
+    std::mt19937 generator(42);
+    for (size_t iteration = 0; iteration < iterations; ++iteration)
+    {
+        const auto secret = random_secret(generator);
+        ec_jacobian product;
+        BOOST_REQUIRE(ec_multiply_generator(product, secret));
+        BOOST_REQUIRE(to_compressed(product) == to_public(secret));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ec_batch__multiply_generator__out_of_range__false)
+{
+    ec_jacobian product;
+    BOOST_REQUIRE(!ec_multiply_generator(product, null_hash));
+    BOOST_REQUIRE(!ec_multiply_generator(product,
+        from_base16<ec_secret_size>(group_order)));
+    BOOST_REQUIRE(ec_multiply_generator(product,
+        from_base16<ec_secret_size>(order_less_one)));
+}
+
+BOOST_AUTO_TEST_CASE(ec_batch__add_point__random__matches_ec_add)
+{
+    std::mt19937 generator(42);
+    for (size_t iteration = 0; iteration < iterations; ++iteration)
+    {
+        const auto tweak = random_secret(generator);
+        auto point = to_public(random_secret(generator));
+        const auto addend = to_affine(point);
+
+        ec_jacobian sum;
+        BOOST_REQUIRE(ec_multiply_generator(sum, tweak));
+        ec_add_point(sum, addend);
+        BOOST_REQUIRE(!sum.infinity);
+
+        BOOST_REQUIRE(ec_add(point, tweak));
+        BOOST_REQUIRE(to_compressed(sum) == point);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ec_batch__add_point__equal__doubles)
+{
+    std::mt19937 generator(42);
+    const auto secret = random_secret(generator);
+
+    ec_jacobian sum;
+    BOOST_REQUIRE(ec_multiply_generator(sum, secret));
+    ec_add_point(sum, to_affine(to_public(secret)));
+
+    auto twice = secret;
+    BOOST_REQUIRE(ec_add(twice, secret));
+    BOOST_REQUIRE(to_compressed(sum) == to_public(twice));
+}
+
+BOOST_AUTO_TEST_CASE(ec_batch__add_point__negation__infinity)
+{
+    ec_secret one{ { 0 } };
+    one.back() = 1;
+
+    ec_jacobian sum;
+    BOOST_REQUIRE(ec_multiply_generator(sum,
+        from_base16<ec_secret_size>(order_less_one)));
+    ec_add_point(sum, to_affine(to_public(one)));
+    BOOST_REQUIRE(sum.infinity);
+}
+
+BOOST_AUTO_TEST_CASE(ec_batch__normalize_batch__mixed__each_normalized)
+{
+    std::mt19937 generator(42);
+    std::vector<ec_jacobian> points(iterations);
+    std::vector<ec_compressed> expected(iterations);
+    for (size_t index = 0; index < iterations; ++index)
+    {
+        const auto secret = random_secret(generator);
+        BOOST_REQUIRE(ec_multiply_generator(points[index], secret));
+        expected[index] = to_public(secret);
+    }
+
+    // An infinite point does not disturb the others.
+    points[iterations / 2].infinity = true;
+
+    std::vector<ec_affine> out;
+    ec_normalize_batch(out, points);
+    BOOST_REQUIRE_EQUAL(out.size(), iterations);
+
+    for (size_t index = 0; index < iterations; ++index)
+        if (index != iterations / 2)
+            BOOST_REQUIRE(ec_compress_point(out[index]) == expected[index]);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
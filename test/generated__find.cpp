@@ -94,6 +94,11 @@ BOOST_AUTO_TEST_CASE(generated__find__bitcoin256__returns_object)
     BOOST_REQUIRE(find("bitcoin256") != nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(generated__find__block_decode__returns_object)
+{
+    BOOST_REQUIRE(find("block-decode") != nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(generated__find__btc_to_satoshi__returns_object)
 {
     BOOST_REQUIRE(find("btc-to-satoshi") != nullptr);
@@ -154,6 +159,11 @@ BOOST_AUTO_TEST_CASE(generated__find__ec_to_wif__returns_object)
     BOOST_REQUIRE(find("ec-to-wif") != nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(generated__find__ec_vanity__returns_object)
+{
+    BOOST_REQUIRE(find("ec-vanity") != nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(generated__find__ek_address__returns_object)
 {
     BOOST_REQUIRE(find("ek-address") != nullptr);
@@ -234,6 +244,11 @@ BOOST_AUTO_TEST_CASE(generated__find__fetch_utxo__returns_object)
     BOOST_REQUIRE(find("fetch-utxo") != nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(generated__find__hd_derive__returns_object)
+{
+    BOOST_REQUIRE(find("hd-derive") != nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(generated__find__hd_new__returns_object)
 {
     BOOST_REQUIRE(find("hd-new") != nullptr);
@@ -249,6 +264,11 @@ BOOST_AUTO_TEST_CASE(generated__find__hd_public__returns_object)
     BOOST_REQUIRE(find("hd-public") != nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(generated__find__hd_scan__returns_object)
+{
+    BOOST_REQUIRE(find("hd-scan") != nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(generated__find__hd_to_address__returns_object)
 {
     BOOST_REQUIRE(find("hd-to-address") != nullptr);
@@ -274,6 +294,11 @@ BOOST_AUTO_TEST_CASE(generated__find__help__returns_object)
     BOOST_REQUIRE(find("help") != nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(generated__find__index_blocks__returns_object)
+{
+    BOOST_REQUIRE(find("index-blocks") != nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(generated__find__input_set__returns_object)
 {
     BOOST_REQUIRE(find("input-set") != nullptr);
@@ -334,6 +359,11 @@ BOOST_AUTO_TEST_CASE(generated__find__satoshi_to_btc__returns_object)
     BOOST_REQUIRE(find("satoshi-to-btc") != nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(generated__find__scan_blocks__returns_object)
+{
+    BOOST_REQUIRE(find("scan-blocks") != nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(generated__find__script_decode__returns_object)
 {
     BOOST_REQUIRE(find("script-decode") != nullptr);
@@ -444,6 +474,11 @@ BOOST_AUTO_TEST_CASE(generated__find__uri_encode__returns_object)
     BOOST_REQUIRE(find("uri-encode") != nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(generated__find__utxo_snapshot__returns_object)
+{
+    BOOST_REQUIRE(find("utxo-snapshot") != nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(generated__find__validate_tx__returns_object)
 {
     BOOST_REQUIRE(find("validate-tx") != nullptr);
@@ -94,6 +94,11 @@ BOOST_AUTO_TEST_CASE(generated__symbol__bitcoin256__returns_expected_value)
     BOOST_REQUIRE_EQUAL(bitcoin256::symbol(), "bitcoin256");
 }
 
+BOOST_AUTO_TEST_CASE(generated__symbol__block_decode__returns_expected_value)
+{
+    BOOST_REQUIRE_EQUAL(block_decode::symbol(), "block-decode");
+}
+
 BOOST_AUTO_TEST_CASE(generated__symbol__btc_to_satoshi__returns_expected_value)
 {
     BOOST_REQUIRE_EQUAL(btc_to_satoshi::symbol(), "btc-to-satoshi");
@@ -154,6 +159,11 @@ BOOST_AUTO_TEST_CASE(generated__symbol__ec_to_wif__returns_expected_value)
     BOOST_REQUIRE_EQUAL(ec_to_wif::symbol(), "ec-to-wif");
 }
 
+BOOST_AUTO_TEST_CASE(generated__symbol__ec_vanity__returns_expected_value)
+{
+    BOOST_REQUIRE_EQUAL(ec_vanity::symbol(), "ec-vanity");
+}
+
 BOOST_AUTO_TEST_CASE(generated__symbol__ek_address__returns_expected_value)
 {
     BOOST_REQUIRE_EQUAL(ek_address::symbol(), "ek-address");
@@ -234,6 +244,11 @@ BOOST_AUTO_TEST_CASE(generated__symbol__fetch_utxo__returns_expected_value)
     BOOST_REQUIRE_EQUAL(fetch_utxo::symbol(), "fetch-utxo");
 }
 
+BOOST_AUTO_TEST_CASE(generated__symbol__hd_derive__returns_expected_value)
+{
+    BOOST_REQUIRE_EQUAL(hd_derive::symbol(), "hd-derive");
+}
+
 BOOST_AUTO_TEST_CASE(generated__symbol__hd_new__returns_expected_value)
 {
     BOOST_REQUIRE_EQUAL(hd_new::symbol(), "hd-new");
@@ -249,6 +264,11 @@ BOOST_AUTO_TEST_CASE(generated__symbol__hd_public__returns_expected_value)
     BOOST_REQUIRE_EQUAL(hd_public::symbol(), "hd-public");
 }
 
+BOOST_AUTO_TEST_CASE(generated__symbol__hd_scan__returns_expected_value)
+{
+    BOOST_REQUIRE_EQUAL(hd_scan::symbol(), "hd-scan");
+}
+
 BOOST_AUTO_TEST_CASE(generated__symbol__hd_to_address__returns_expected_value)
 {
     BOOST_REQUIRE_EQUAL(hd_to_address::symbol(), "hd-to-address");
@@ -274,6 +294,11 @@ BOOST_AUTO_TEST_CASE(generated__symbol__help__returns_expected_value)
     BOOST_REQUIRE_EQUAL(help::symbol(), "help");
 }
 
+BOOST_AUTO_TEST_CASE(generated__symbol__index_blocks__returns_expected_value)
+{
+    BOOST_REQUIRE_EQUAL(index_blocks::symbol(), "index-blocks");
+}
+
 BOOST_AUTO_TEST_CASE(generated__symbol__input_set__returns_expected_value)
 {
     BOOST_REQUIRE_EQUAL(input_set::symbol(), "input-set");
@@ -334,6 +359,11 @@ BOOST_AUTO_TEST_CASE(generated__symbol__satoshi_to_btc__returns_expected_value)
     BOOST_REQUIRE_EQUAL(satoshi_to_btc::symbol(), "satoshi-to-btc");
 }
 
+BOOST_AUTO_TEST_CASE(generated__symbol__scan_blocks__returns_expected_value)
+{
+    BOOST_REQUIRE_EQUAL(scan_blocks::symbol(), "scan-blocks");
+}
+
 BOOST_AUTO_TEST_CASE(generated__symbol__script_decode__returns_expected_value)
 {
     BOOST_REQUIRE_EQUAL(script_decode::symbol(), "script-decode");
@@ -444,6 +474,11 @@ BOOST_AUTO_TEST_CASE(generated__symbol__uri_encode__returns_expected_value)
     BOOST_REQUIRE_EQUAL(uri_encode::symbol(), "uri-encode");
 }
 
+BOOST_AUTO_TEST_CASE(generated__symbol__utxo_snapshot__returns_expected_value)
+{
+    BOOST_REQUIRE_EQUAL(utxo_snapshot::symbol(), "utxo-snapshot");
+}
+
 BOOST_AUTO_TEST_CASE(generated__symbol__validate_tx__returns_expected_value)
 {
     BOOST_REQUIRE_EQUAL(validate_tx::symbol(), "validate-tx");
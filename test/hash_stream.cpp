@@ -0,0 +1,198 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer.hpp>
+
+using namespace bc;
+using namespace bc::explorer;
+
+// Sizes span the block sizes and both padding cases.
+static const size_t maximum_size = 300;
+static const size_t stream_size = 1000000;
+
+static data_chunk random_data(std::mt19937& generator, size_t size)
+{
+    std::uniform_int_distribution<int> byte(0, 255);
+    data_chunk data(size);
+    for (auto& value: data)
+        value = static_cast<uint8_t>(byte(generator));
+
+    return data;
+}
+
+// Write the data to the hasher in pieces of random size.
+template <typename Hasher>
+static void write_pieces(std::mt19937& generator, Hasher& hasher,
+    const data_chunk& data, size_t maximum)
+{
+    std::uniform_int_distribution<size_t> piece(0, maximum);
+    for (auto it = data.begin(); it != data.end();)
+    {
+        const auto size = std::min<size_t>(piece(generator), data.end() - it);
+        hasher.write(data_chunk(it, it + size));
+        it += size;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(hash_stream)
+
+BOOST_AUTO_TEST_CASE(hash_stream__sha256__nist__expected)
+{
+    for (const auto kernel: sha256_kernels())
+    {
+        sha256_hasher hasher(kernel);
+        hasher.write(to_chunk(std::string("abc")));
+        BOOST_REQUIRE_EQUAL(encode_base16(hasher.finish()),
+            "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hash_stream__sha256__random__matches_sha256_hash)
+{
+    std::mt19937 generator(42);
+    for (size_t size = 0; size <= maximum_size; ++size)
+    {
+        const auto data = random_data(generator, size);
+        for (const auto kernel: sha256_kernels())
+        {
+            sha256_hasher hasher(kernel);
+            write_pieces(generator, hasher, data, 70);
+            BOOST_REQUIRE(hasher.finish() == sha256_hash(data));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hash_stream__sha256__stream__matches_sha256_hash)
+{
+    std::mt19937 generator(42);
+    const auto data = random_data(generator, stream_size);
+    for (const auto kernel: sha256_kernels())
+    {
+        sha256_hasher hasher(kernel);
+        write_pieces(generator, hasher, data, 100000);
+        BOOST_REQUIRE(hasher.finish() == sha256_hash(data));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hash_stream__sha512__random__matches_sha512_hash)
+{
+    std::mt19937 generator(42);
+    for (size_t size = 0; size <= maximum_size; ++size)
+    {
+        const auto data = random_data(generator, size);
+        sha512_hasher hasher;
+        write_pieces(generator, hasher, data, 150);
+        BOOST_REQUIRE(hasher.finish() == sha512_hash(data));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hash_stream__ripemd160__random__matches_ripemd160_hash)
+{
+    std::mt19937 generator(42);
+    for (size_t size = 0; size <= maximum_size; ++size)
+    {
+        const auto data = random_data(generator, size);
+        ripemd160_hasher hasher;
+        write_pieces(generator, hasher, data, 70);
+        BOOST_REQUIRE(hasher.finish() == ripemd160_hash(data));
+    }
+}
+
+// The messages are of every size, in an order that mixes block counts, and
+// the count is not a multiple of any lane count.
+static std::vector<data_chunk> random_messages(std::mt19937& generator)
+{
+    std::vector<data_chunk> messages;
+    for (size_t size = 0; size <= maximum_size; ++size)
+        messages.push_back(random_data(generator, (size * 37) %
+            (maximum_size + 1)));
+
+    return messages;
+}
+
+static std::vector<data_slice> to_slices(const std::vector<data_chunk>& data)
+{
+    return std::vector<data_slice>(data.begin(), data.end());
+}
+
+BOOST_AUTO_TEST_CASE(hash_stream__sha256_batch__empty__empty)
+{
+    for (const auto kernel: sha256_batch_kernels())
+        BOOST_REQUIRE(sha256_batch({}, kernel).empty());
+}
+
+BOOST_AUTO_TEST_CASE(hash_stream__sha256_batch__random__matches_sha256_hash)
+{
+    std::mt19937 generator(42);
+    const auto messages = random_messages(generator);
+    for (const auto kernel: sha256_batch_kernels())
+    {
+        for (size_t count = 1; count <= messages.size(); count += 7)
+        {
+            const std::vector<data_chunk> batch(messages.begin(),
+                messages.begin() + count);
+            const auto hashes = sha256_batch(to_slices(batch), kernel);
+            BOOST_REQUIRE_EQUAL(hashes.size(), count);
+            for (size_t index = 0; index < count; ++index)
+                BOOST_REQUIRE(hashes[index] == sha256_hash(batch[index]));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hash_stream__bitcoin256_batch__random__matches_bitcoin_hash)
+{
+    std::mt19937 generator(42);
+    const auto messages = random_messages(generator);
+    for (const auto kernel: sha256_batch_kernels())
+    {
+        const auto hashes = bitcoin256_batch(to_slices(messages), kernel);
+        BOOST_REQUIRE_EQUAL(hashes.size(), messages.size());
+        for (size_t index = 0; index < messages.size(); ++index)
+            BOOST_REQUIRE(hashes[index] == bitcoin_hash(messages[index]));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hash_stream__verify_checksum_batch__mixed__matches_verify_checksum)
+{
+    std::mt19937 generator(42);
+    auto payloads = random_messages(generator);
+    for (size_t index = 0; index < payloads.size(); ++index)
+        if (index % 3 != 0 && payloads[index].size() >= 4)
+            append_checksum(payloads[index]);
+
+    for (const auto kernel: sha256_batch_kernels())
+    {
+        const auto valid = verify_checksum_batch(to_slices(payloads), kernel);
+        BOOST_REQUIRE_EQUAL(valid.size(), payloads.size());
+        for (size_t index = 0; index < payloads.size(); ++index)
+            BOOST_REQUIRE_EQUAL(valid[index],
+                verify_checksum(payloads[index]));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
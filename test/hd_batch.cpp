@@ -0,0 +1,142 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer.hpp>
+
+using namespace bc;
+using namespace bc::explorer;
+using namespace bc::wallet;
+
+// BIP32 test vector 1, m/0h.
+static const std::string parent_key = "xpub68Gmy5EdvgibQVfPdqkBBCHxA5htiqg55crXYuXoQRKfDBFA1WEjWgP6LHhwBZeNK1VTsfTFUHCdrfp1bgwQ9xv5ski8PX9rL2dZXvgGDnw";
+
+// The children span several batches.
+static const size_t children = 600;
+
+BOOST_AUTO_TEST_SUITE(hd_batch)
+
+BOOST_AUTO_TEST_CASE(hd_batch__derive__vector1__expected)
+{
+    const hd_public parent(parent_key);
+    const hd_public_batch batch(parent);
+    BOOST_REQUIRE(batch.valid());
+
+    std::vector<hd_public_child> out;
+    batch.derive(out, 0, 2);
+    BOOST_REQUIRE_EQUAL(out.size(), 2u);
+    BOOST_REQUIRE(out[0].valid);
+    BOOST_REQUIRE(out[1].valid);
+    BOOST_REQUIRE_EQUAL(batch.encoded(out[0]), "xpub6ASuArnXKPbfEVRpCesNx4P939HDXENHkksgxsVG1yNp9958A33qYoPiTN9QrJmWFa2jNLdK84bWmyqTSPGtApP8P7nHUYwxHPhqmzUyeFG");
+    BOOST_REQUIRE_EQUAL(batch.encoded(out[1]), "xpub6ASuArnXKPbfEwhqN6e3mwBcDTgzisQN1wXN9BJcM47sSikHjJf3UFHKkNAWbWMiGj7Wf5uMash7SyYq527Hqck2AxYysAA7xmALppuCkwQ");
+    BOOST_REQUIRE_EQUAL(batch.address(out[0], 0), "1LZaBnH11M2yN5ZNiK67yUbaspfX6XKmRr");
+    BOOST_REQUIRE_EQUAL(batch.address(out[1], 0), "1JQheacLPdM5ySCkrZkV66G2ApAXe1mqLj");
+}
+
+BOOST_AUTO_TEST_CASE(hd_batch__derive__range__matches_derive_public)
+{
+    const hd_public parent(parent_key);
+    const hd_public_batch batch(parent);
+
+    std::vector<hd_public_child> out;
+    batch.derive(out, 1000, children);
+    BOOST_REQUIRE_EQUAL(out.size(), children);
+
+    for (size_t offset = 0; offset < children; ++offset)
+    {
+        const auto index = static_cast<uint32_t>(1000 + offset);
+        const auto expected = parent.derive_public(index);
+        BOOST_REQUIRE(out[offset].valid);
+        BOOST_REQUIRE_EQUAL(out[offset].index, index);
+        BOOST_REQUIRE(out[offset].point == expected.point());
+        BOOST_REQUIRE(out[offset].chain_code == expected.chain_code());
+        BOOST_REQUIRE_EQUAL(batch.encoded(out[offset]), expected.encoded());
+        BOOST_REQUIRE_EQUAL(batch.address(out[offset], 111),
+            payment_address(ec_public(expected.point()), 111).encoded());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hd_batch__derive__hardened__invalid)
+{
+    const hd_public parent(parent_key);
+    const hd_public_batch batch(parent);
+
+    std::vector<hd_public_child> out;
+    batch.derive(out, hd_first_hardened_key - 1, 2);
+    BOOST_REQUIRE(out[0].valid);
+    BOOST_REQUIRE(!out[1].valid);
+}
+
+BOOST_AUTO_TEST_CASE(hd_batch__derive__invalid_parent__invalid)
+{
+    const hd_public_batch batch(hd_public{});
+    BOOST_REQUIRE(!batch.valid());
+
+    std::vector<hd_public_child> out;
+    batch.derive(out, 0, 1);
+    BOOST_REQUIRE(!out[0].valid);
+}
+
+BOOST_AUTO_TEST_CASE(hd_batch__write__range__matches_derive_public)
+{
+    const hd_public parent(parent_key);
+    const hd_public_batch batch(parent);
+    const auto encode = [&batch](const hd_public_child& child)
+    {
+        return batch.encoded(child);
+    };
+
+    std::ostringstream output;
+    BOOST_REQUIRE_EQUAL(batch.write(output, 7, children, encode), children);
+
+    std::ostringstream expected;
+    for (size_t offset = 0; offset < children; ++offset)
+        expected << parent.derive_public(static_cast<uint32_t>(7 + offset))
+            .encoded() << "\n";
+
+    BOOST_REQUIRE_EQUAL(output.str(), expected.str());
+}
+
+BOOST_AUTO_TEST_CASE(hd_batch__write__hardened_boundary__stops)
+{
+    const hd_public parent(parent_key);
+    const hd_public_batch batch(parent);
+    const auto encode = [&batch](const hd_public_child& child)
+    {
+        return batch.encoded(child);
+    };
+
+    std::ostringstream output;
+    const auto first = hd_first_hardened_key - 2;
+    BOOST_REQUIRE_EQUAL(batch.write(output, first, 4, encode), 2u);
+
+    std::ostringstream expected;
+    expected << parent.derive_public(first).encoded() << "\n";
+    expected << parent.derive_public(first + 1).encoded() << "\n";
+    BOOST_REQUIRE_EQUAL(output.str(), expected.str());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,144 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer.hpp>
+
+using namespace bc;
+using namespace bc::explorer;
+
+// A stream that counts the flushes that reach it.
+class counting_buffer
+  : public std::stringbuf
+{
+public:
+    size_t flushes = 0;
+
+protected:
+    virtual int sync()
+    {
+        ++flushes;
+        return std::stringbuf::sync();
+    }
+};
+
+// A stream that may be written by the timer of a sink while it is read. The
+// lock is recursive since the buffer overflows within a write.
+class locked_buffer
+  : public std::stringbuf
+{
+public:
+    std::string text()
+    {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        return str();
+    }
+
+protected:
+    virtual int_type overflow(int_type character)
+    {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        return std::stringbuf::overflow(character);
+    }
+
+    virtual std::streamsize xsputn(const char* data, std::streamsize size)
+    {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        return std::stringbuf::xsputn(data, size);
+    }
+
+private:
+    std::recursive_mutex mutex_;
+};
+
+BOOST_AUTO_TEST_SUITE(output_sink__write)
+
+BOOST_AUTO_TEST_CASE(output_sink__write__immediate__flushes_each_line)
+{
+    counting_buffer buffer;
+    std::ostream target(&buffer);
+    output_sink sink(target);
+    std::ostream stream(&sink);
+
+    stream << "a" << std::endl;
+    BOOST_REQUIRE_EQUAL(buffer.str(), "a\n");
+    stream << "b" << std::endl;
+    BOOST_REQUIRE_EQUAL(buffer.str(), "a\nb\n");
+    BOOST_REQUIRE_EQUAL(buffer.flushes, 2u);
+}
+
+BOOST_AUTO_TEST_CASE(output_sink__write__size__writes_full_blocks)
+{
+    counting_buffer buffer;
+    std::ostream target(&buffer);
+
+    {
+        output_sink sink(target, flush_policy::size, 4);
+        std::ostream stream(&sink);
+
+        stream << "a" << std::endl;
+        BOOST_REQUIRE(buffer.str().empty());
+        stream << "b" << std::endl;
+        BOOST_REQUIRE_EQUAL(buffer.str(), "a\nb\n");
+        stream << "c" << std::endl;
+        BOOST_REQUIRE_EQUAL(buffer.str(), "a\nb\n");
+    }
+
+    BOOST_REQUIRE_EQUAL(buffer.str(), "a\nb\nc\n");
+}
+
+BOOST_AUTO_TEST_CASE(output_sink__write__interval__writes_after_interval)
+{
+    locked_buffer buffer;
+    std::ostream target(&buffer);
+    output_sink sink(target, flush_policy::interval, sink_buffer_size, 10);
+    std::ostream stream(&sink);
+
+    stream << "a" << std::endl;
+
+    // The timer writes the text without a flush of the sink, so the target
+    // is polled, with a bound well above the interval for a loaded machine.
+    const auto limit = std::chrono::steady_clock::now() +
+        std::chrono::seconds(10);
+    while (buffer.text().empty() && std::chrono::steady_clock::now() < limit)
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+    BOOST_REQUIRE_EQUAL(buffer.text(), "a\n");
+}
+
+BOOST_AUTO_TEST_CASE(output_sink__flush__size__writes_buffer)
+{
+    std::stringstream target;
+    output_sink sink(target, flush_policy::size);
+    std::ostream stream(&sink);
+
+    stream << "a" << std::endl;
+    BOOST_REQUIRE(target.str().empty());
+    sink.flush();
+    BOOST_REQUIRE_EQUAL(target.str(), "a\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,116 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer.hpp>
+
+using namespace bc;
+using namespace bc::explorer::primitives;
+using namespace po;
+
+BOOST_AUTO_TEST_SUITE(primitives)
+BOOST_AUTO_TEST_SUITE(primitives__hd_path)
+
+BOOST_AUTO_TEST_CASE(hd_path__constructor__default__empty)
+{
+    const hd_path instance;
+    BOOST_REQUIRE(instance.levels().empty());
+    BOOST_REQUIRE_EQUAL(instance.count(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(hd_path__constructor__master__empty)
+{
+    BOOST_REQUIRE(hd_path("m").levels().empty());
+    BOOST_REQUIRE(hd_path("M").levels().empty());
+}
+
+BOOST_AUTO_TEST_CASE(hd_path__constructor__account__expected)
+{
+    const hd_path instance("m/44'/0h/0H/{0,1}/0-999");
+    const auto& levels = instance.levels();
+    BOOST_REQUIRE_EQUAL(levels.size(), 5u);
+    BOOST_REQUIRE_EQUAL(levels[0].front().first(),
+        wallet::hd_first_hardened_key + 44);
+    BOOST_REQUIRE(levels[1].front().hard());
+    BOOST_REQUIRE(levels[2].front().hard());
+    BOOST_REQUIRE_EQUAL(levels[3].size(), 2u);
+    BOOST_REQUIRE_EQUAL(levels[3][1].first(), 1u);
+    BOOST_REQUIRE_EQUAL(levels[4].front().first(), 0u);
+    BOOST_REQUIRE_EQUAL(levels[4].front().count(), 1000u);
+    BOOST_REQUIRE_EQUAL(instance.count(), 2000u);
+    BOOST_REQUIRE(instance.hard());
+}
+
+BOOST_AUTO_TEST_CASE(hd_path__constructor__without_master__expected)
+{
+    const hd_path instance("0/{1-2,5}");
+    BOOST_REQUIRE_EQUAL(instance.levels().size(), 2u);
+    BOOST_REQUIRE_EQUAL(instance.count(), 3u);
+    BOOST_REQUIRE(!instance.hard());
+}
+
+BOOST_AUTO_TEST_CASE(hd_path__constructor__hardened_range__expected)
+{
+    const hd_path last("3-4h");
+    BOOST_REQUIRE(last.levels().front().front().hard());
+    BOOST_REQUIRE_EQUAL(last.levels().front().front().count(), 2u);
+
+    const hd_path both("3h-4h");
+    BOOST_REQUIRE_EQUAL(both.levels().front().front().first(),
+        last.levels().front().front().first());
+}
+
+BOOST_AUTO_TEST_CASE(hd_path__constructor__bogus__throws_invalid_option)
+{
+    BOOST_REQUIRE_THROW(hd_path(""), invalid_option_value);
+    BOOST_REQUIRE_THROW(hd_path("m/"), invalid_option_value);
+    BOOST_REQUIRE_THROW(hd_path("m//0"), invalid_option_value);
+    BOOST_REQUIRE_THROW(hd_path("m/-1"), invalid_option_value);
+    BOOST_REQUIRE_THROW(hd_path("m/5-3"), invalid_option_value);
+    BOOST_REQUIRE_THROW(hd_path("m/3h-5"), invalid_option_value);
+    BOOST_REQUIRE_THROW(hd_path("m/{}"), invalid_option_value);
+    BOOST_REQUIRE_THROW(hd_path("m/{0,}"), invalid_option_value);
+    BOOST_REQUIRE_THROW(hd_path("m/x"), invalid_option_value);
+    BOOST_REQUIRE_THROW(hd_path("m/2147483648"), invalid_option_value);
+}
+
+BOOST_AUTO_TEST_CASE(hd_path__constructor__too_many_keys__throws_invalid_option)
+{
+    BOOST_REQUIRE_THROW(hd_path("m/0-99999/0-99999"), invalid_option_value);
+}
+
+BOOST_AUTO_TEST_CASE(hd_path__constructor__overflowed_keys__throws_invalid_option)
+{
+    // The product of the widths is 2^64, which wraps to zero.
+    const auto path = "m/0-2147483647/{0-2147483647,0-2147483647,"
+        "0-2147483647,0-2147483647}";
+    BOOST_REQUIRE_THROW(hd_path(path), invalid_option_value);
+}
+
+BOOST_AUTO_TEST_CASE(hd_path__serialize__account__canonical)
+{
+    std::stringstream stream;
+    stream << hd_path("44'/0H/{0,2-3}/7-7");
+    BOOST_REQUIRE_EQUAL(stream.str(), "m/44h/0h/{0,2-3}/7");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
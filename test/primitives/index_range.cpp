@@ -0,0 +1,88 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer.hpp>
+
+using namespace bc;
+using namespace bc::explorer::primitives;
+using namespace po;
+
+BOOST_AUTO_TEST_SUITE(primitives)
+BOOST_AUTO_TEST_SUITE(primitives__index_range)
+
+BOOST_AUTO_TEST_CASE(index_range__constructor__default__empty)
+{
+    const index_range instance;
+    BOOST_REQUIRE_EQUAL(instance.count(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(index_range__constructor__plain__expected)
+{
+    const index_range instance("5:100");
+    BOOST_REQUIRE_EQUAL(instance.first(), 5u);
+    BOOST_REQUIRE_EQUAL(instance.count(), 100u);
+    BOOST_REQUIRE(!instance.hard());
+}
+
+BOOST_AUTO_TEST_CASE(index_range__constructor__hardened__expected)
+{
+    const index_range h_suffix("3h:2");
+    BOOST_REQUIRE_EQUAL(h_suffix.first(), wallet::hd_first_hardened_key + 3);
+    BOOST_REQUIRE_EQUAL(h_suffix.count(), 2u);
+    BOOST_REQUIRE(h_suffix.hard());
+
+    const index_range apostrophe("3':2");
+    BOOST_REQUIRE_EQUAL(apostrophe.first(), h_suffix.first());
+}
+
+BOOST_AUTO_TEST_CASE(index_range__constructor__last_index__expected)
+{
+    const index_range instance("2147483647:1");
+    BOOST_REQUIRE_EQUAL(instance.first(), 2147483647u);
+}
+
+BOOST_AUTO_TEST_CASE(index_range__constructor__beyond_last_index__throws_invalid_option)
+{
+    BOOST_REQUIRE_THROW(index_range("2147483647:2"), invalid_option_value);
+}
+
+BOOST_AUTO_TEST_CASE(index_range__constructor__zero_count__throws_invalid_option)
+{
+    BOOST_REQUIRE_THROW(index_range("0:0"), invalid_option_value);
+}
+
+BOOST_AUTO_TEST_CASE(index_range__constructor__bogus__throws_invalid_option)
+{
+    BOOST_REQUIRE_THROW(index_range("-1:5"), invalid_option_value);
+    BOOST_REQUIRE_THROW(index_range("5"), invalid_option_value);
+    BOOST_REQUIRE_THROW(index_range("a:b"), invalid_option_value);
+}
+
+BOOST_AUTO_TEST_CASE(index_range__serialize__hardened__round_trips)
+{
+    std::stringstream stream;
+    stream << index_range("7h:9");
+    BOOST_REQUIRE_EQUAL(stream.str(), "7h:9");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
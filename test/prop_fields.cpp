@@ -0,0 +1,80 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer.hpp>
+
+using namespace bc;
+using namespace bc::explorer;
+
+BOOST_AUTO_TEST_SUITE(prop_fields__projection)
+
+BOOST_AUTO_TEST_CASE(prop_fields__default__all)
+{
+    const prop_fields fields;
+    BOOST_REQUIRE(fields.all());
+    BOOST_REQUIRE(fields.includes("hash"));
+    BOOST_REQUIRE(fields.child("outputs").includes("value"));
+}
+
+BOOST_AUTO_TEST_CASE(prop_fields__empty_list__all)
+{
+    const prop_fields fields(" , ");
+    BOOST_REQUIRE(fields.all());
+}
+
+BOOST_AUTO_TEST_CASE(prop_fields__includes__selected_and_parents)
+{
+    const prop_fields fields("hash, outputs.value");
+    BOOST_REQUIRE(!fields.all());
+    BOOST_REQUIRE(fields.includes("hash"));
+    BOOST_REQUIRE(fields.includes("outputs"));
+    BOOST_REQUIRE(!fields.includes("inputs"));
+    BOOST_REQUIRE(!fields.includes("version"));
+}
+
+BOOST_AUTO_TEST_CASE(prop_fields__child__relative_paths)
+{
+    const prop_fields fields("inputs.previous_output.hash,outputs.value");
+    const auto previous = fields.child("inputs").child("previous_output");
+    BOOST_REQUIRE(previous.includes("hash"));
+    BOOST_REQUIRE(!previous.includes("index"));
+
+    const auto outputs = fields.child("outputs");
+    BOOST_REQUIRE(outputs.includes("value"));
+    BOOST_REQUIRE(!outputs.includes("script"));
+}
+
+BOOST_AUTO_TEST_CASE(prop_fields__child__selected_field__all)
+{
+    const prop_fields fields("outputs");
+    BOOST_REQUIRE(fields.child("outputs").all());
+}
+
+BOOST_AUTO_TEST_CASE(prop_fields__child__unselected_field__none)
+{
+    const prop_fields fields("hash");
+    const auto version = fields.child("version");
+    BOOST_REQUIRE(!version.all());
+    BOOST_REQUIRE(!version.includes("anything"));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
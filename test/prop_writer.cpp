@@ -0,0 +1,178 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <sstream>
+#include <string>
+#include <boost/property_tree/ptree.hpp>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer.hpp>
+
+using namespace bc;
+using namespace bc::explorer;
+
+static pt::ptree make_tree()
+{
+    pt::ptree row;
+    row.put("hash", "01ab");
+    row.put("memo", "a \"quoted\" <value> & {braces};");
+    row.put("value", 42);
+
+    pt::ptree rows;
+    rows.add_child("row", row);
+    rows.add_child("row", row);
+
+    pt::ptree tree;
+    tree.add_child("rows", rows);
+    tree.put("total.count", 2);
+    tree.put("total.empty", "");
+    return tree;
+}
+
+static std::string expected(const pt::ptree& tree, encoding_engine engine)
+{
+    std::stringstream output;
+    write_stream(output, tree, engine);
+    return output.str();
+}
+
+static std::string streamed(const pt::ptree& tree, encoding_engine engine)
+{
+    std::stringstream output;
+    prop_writer writer(output, engine);
+    writer.write(tree);
+    writer.finish();
+    return output.str();
+}
+
+static std::string streamed_rows(encoding_engine engine)
+{
+    std::stringstream output;
+    prop_writer writer(output, engine);
+    const auto tree = make_tree();
+    writer.begin("rows");
+    for (const auto& row: tree.get_child("rows"))
+        writer.write(row.first, row.second);
+
+    writer.end();
+    writer.begin("total");
+    writer.put("count", 2);
+    writer.put("empty", std::string());
+    writer.end();
+    writer.finish();
+    return output.str();
+}
+
+BOOST_AUTO_TEST_SUITE(prop_writer__write)
+
+BOOST_AUTO_TEST_CASE(prop_writer__write__info__matches_tree)
+{
+    const auto tree = make_tree();
+    BOOST_REQUIRE_EQUAL(streamed(tree, encoding_engine::info),
+        expected(tree, encoding_engine::info));
+}
+
+BOOST_AUTO_TEST_CASE(prop_writer__write__json__matches_tree)
+{
+    const auto tree = make_tree();
+    BOOST_REQUIRE_EQUAL(streamed(tree, encoding_engine::json),
+        expected(tree, encoding_engine::json));
+}
+
+BOOST_AUTO_TEST_CASE(prop_writer__write__xml__matches_tree)
+{
+    const auto tree = make_tree();
+    BOOST_REQUIRE_EQUAL(streamed(tree, encoding_engine::xml),
+        expected(tree, encoding_engine::xml));
+}
+
+BOOST_AUTO_TEST_CASE(prop_writer__write__empty_container__matches_tree)
+{
+    pt::ptree tree;
+    tree.add_child("transfers", pt::ptree());
+
+    std::stringstream output;
+    prop_writer writer(output, encoding_engine::json);
+    writer.begin("transfers");
+    writer.end();
+    writer.finish();
+    BOOST_REQUIRE_EQUAL(output.str(), expected(tree, encoding_engine::json));
+}
+
+BOOST_AUTO_TEST_CASE(prop_writer__begin_put_end__json__matches_tree)
+{
+    BOOST_REQUIRE_EQUAL(streamed_rows(encoding_engine::json),
+        expected(make_tree(), encoding_engine::json));
+}
+
+BOOST_AUTO_TEST_CASE(prop_writer__begin_put_end__info__matches_tree)
+{
+    BOOST_REQUIRE_EQUAL(streamed_rows(encoding_engine::info),
+        expected(make_tree(), encoding_engine::info));
+}
+
+BOOST_AUTO_TEST_CASE(prop_writer__write__ndjson__one_line_per_row)
+{
+    const auto row = "{\"hash\":\"01ab\",\"memo\":\"a \\\"quoted\\\" <value> & "
+        "{braces};\",\"value\":\"42\"}\n";
+    const auto total = "{\"count\":\"2\",\"empty\":\"\"}\n";
+    const auto expected = std::string(row) + row + total;
+    BOOST_REQUIRE_EQUAL(streamed(make_tree(), encoding_engine::ndjson),
+        expected);
+    BOOST_REQUIRE_EQUAL(streamed_rows(encoding_engine::ndjson), expected);
+}
+
+BOOST_AUTO_TEST_CASE(prop_writer__write__ndjson_empty_list__empty)
+{
+    pt::ptree tree;
+    tree.add_child("transfers", pt::ptree());
+    BOOST_REQUIRE(streamed(tree, encoding_engine::ndjson).empty());
+}
+
+BOOST_AUTO_TEST_CASE(prop_writer__abandon__json__unfinished)
+{
+    std::stringstream output;
+    std::string written;
+
+    {
+        prop_writer writer(output, encoding_engine::json);
+        writer.write("rows", make_tree().get_child("rows"));
+        written = output.str();
+        writer.abandon();
+    }
+
+    BOOST_REQUIRE(!written.empty());
+    BOOST_REQUIRE_EQUAL(output.str(), written);
+}
+
+BOOST_AUTO_TEST_CASE(prop_writer__abandon__cbor__empty)
+{
+    std::stringstream output;
+
+    {
+        prop_writer writer(output, encoding_engine::cbor);
+        writer.write(make_tree());
+        writer.abandon();
+    }
+
+    BOOST_REQUIRE(output.str().empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,177 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <boost/property_tree/ptree.hpp>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer.hpp>
+
+using namespace bc;
+using namespace bc::explorer;
+
+static pt::ptree make_tree()
+{
+    pt::ptree row;
+    row.put("hash", "01ab");
+    row.put("memo", "a \"quoted\", value\twith\ttabs");
+    row.put("value", 42);
+
+    pt::ptree rows;
+    rows.add_child("row", row);
+    rows.add_child("row", row);
+
+    pt::ptree tree;
+    tree.add_child("rows", rows);
+    tree.put("total.count", 2);
+    tree.put("total.empty", "");
+    return tree;
+}
+
+static std::string written(const pt::ptree& tree, encoding_engine engine)
+{
+    std::stringstream output;
+    write_stream(output, tree, engine);
+    return output.str();
+}
+
+BOOST_AUTO_TEST_SUITE(table_writer__write)
+
+// The total is not a row of the table, so it is not written.
+BOOST_AUTO_TEST_CASE(table_writer__write__csv__single_table)
+{
+    BOOST_REQUIRE_EQUAL(written(make_tree(), encoding_engine::csv),
+        "hash,memo,value\n"
+        "01ab,\"a \"\"quoted\"\", value\twith\ttabs\",42\n"
+        "01ab,\"a \"\"quoted\"\", value\twith\ttabs\",42\n");
+}
+
+BOOST_AUTO_TEST_CASE(table_writer__write__tsv__single_table)
+{
+    BOOST_REQUIRE_EQUAL(written(make_tree(), encoding_engine::tsv),
+        "hash\tmemo\tvalue\n"
+        "01ab\ta \"quoted\", value\\twith\\ttabs\t42\n"
+        "01ab\ta \"quoted\", value\\twith\\ttabs\t42\n");
+}
+
+BOOST_AUTO_TEST_CASE(table_writer__write__known_type__fixed_columns)
+{
+    pt::ptree transfer;
+    transfer.put("value", 1000);
+    transfer.put("received.index", 1);
+    transfer.put("received.hash", "ab");
+
+    std::stringstream output;
+    table_writer writer(output, encoding_engine::csv);
+    writer.write("transfer", transfer);
+    BOOST_REQUIRE_EQUAL(output.str(),
+        "received.hash,received.height,received.index,spent.hash,"
+        "spent.height,spent.index,value\n"
+        "ab,,1,,,,1000\n");
+}
+
+BOOST_AUTO_TEST_CASE(table_writer__write__nested_list__typed_rows)
+{
+    pt::ptree input;
+    input.put("sequence", 7);
+
+    pt::ptree transaction;
+    transaction.put("hash", "cd");
+    transaction.add_child("inputs.input", input);
+    transaction.put("version", 1);
+
+    std::stringstream output;
+    table_writer writer(output, encoding_engine::csv);
+    writer.write("transaction", transaction);
+    BOOST_REQUIRE_EQUAL(output.str(),
+        "type,hash,lock_time,version,address,previous_output.hash,"
+        "previous_output.index,script,sequence,stealth.ephemeral_public_key,"
+        "stealth.prefix,value\n"
+        "transaction,cd,,1,,,,,,,,\n"
+        "input,,,,,,,,7,,,\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(table_writer__cell)
+
+BOOST_AUTO_TEST_CASE(table_writer__cell__typed_row__expected_line)
+{
+    hash_digest hash;
+    BOOST_REQUIRE(decode_hash(hash,
+        "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f"));
+
+    std::stringstream output;
+    table_writer writer(output, encoding_engine::tsv);
+    writer.begin("match");
+    writer.cell_base16(data_chunk{ 0x02, 0xff });
+    writer.skip();
+    writer.cell(hash);
+    writer.end();
+    BOOST_REQUIRE_EQUAL(output.str(),
+        "ephemeral_public_key\tpublic_key_hash\ttransaction_hash\n"
+        "02ff\t\t"
+        "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f\n");
+}
+
+BOOST_AUTO_TEST_CASE(table_writer__cell__typed_rows__own_columns)
+{
+    std::stringstream output;
+    table_writer writer(output, encoding_engine::csv);
+    writer.begin("transaction");
+    writer.cell("ab");
+    writer.cell(uint64_t(0));
+    writer.cell(uint64_t(1));
+    writer.end();
+    writer.begin("output");
+    writer.skip();
+    writer.cell("script");
+    writer.skip();
+    writer.skip();
+    writer.cell(uint64_t(5));
+    writer.end();
+    writer.begin("match");
+    writer.cell("other");
+    writer.end();
+    BOOST_REQUIRE_EQUAL(output.str(),
+        "type,hash,lock_time,version,address,previous_output.hash,"
+        "previous_output.index,script,sequence,stealth.ephemeral_public_key,"
+        "stealth.prefix,value\n"
+        "transaction,ab,0,1,,,,,,,,\n"
+        "output,,,,,,,script,,,,5\n");
+}
+
+BOOST_AUTO_TEST_CASE(table_writer__cell__numbers__decimal)
+{
+    std::stringstream output;
+    table_writer writer(output, encoding_engine::csv);
+    writer.begin("balance");
+    writer.cell(uint64_t(0));
+    writer.cell(uint64_t(1234567890));
+    writer.cell(max_uint64);
+    writer.end();
+    BOOST_REQUIRE_EQUAL(output.str(),
+        "address,confirmed,received,unspent\n"
+        "0,1234567890,18446744073709551615\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,182 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer.hpp>
+
+using namespace bc;
+using namespace bc::explorer;
+using namespace bc::wallet;
+
+static const data_chunk seed(16, 0x42);
+
+static bool encoded_match(const short_hash& hash, const std::string& prefix,
+    uint8_t version)
+{
+    const auto address = payment_address(hash, version).encoded();
+    return address.compare(0, prefix.size(), prefix) == 0;
+}
+
+BOOST_AUTO_TEST_SUITE(vanity_search__prefix)
+
+BOOST_AUTO_TEST_CASE(vanity_prefix__one__every_hash)
+{
+    const vanity_prefix prefix("1", payment_address::mainnet_p2kh);
+    BOOST_REQUIRE_EQUAL(prefix.ranges().size(), 1u);
+    BOOST_REQUIRE_CLOSE(prefix.difficulty(), 1.0, 0.001);
+    BOOST_REQUIRE(prefix.matches(null_short_hash));
+}
+
+BOOST_AUTO_TEST_CASE(vanity_prefix__two_ones__leading_zero_byte)
+{
+    const vanity_prefix prefix("11", payment_address::mainnet_p2kh);
+    BOOST_REQUIRE_EQUAL(prefix.ranges().size(), 1u);
+    BOOST_REQUIRE_CLOSE(prefix.difficulty(), 256.0, 0.001);
+    BOOST_REQUIRE(prefix.matches(null_short_hash));
+}
+
+BOOST_AUTO_TEST_CASE(vanity_prefix__invalid__empty)
+{
+    BOOST_REQUIRE(vanity_prefix("", 0).ranges().empty());
+    BOOST_REQUIRE(vanity_prefix("0", 0).ranges().empty());
+    BOOST_REQUIRE(vanity_prefix("1Il", 0).ranges().empty());
+    BOOST_REQUIRE_EQUAL(vanity_prefix("0", 0).difficulty(), 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(vanity_prefix__other_version__empty)
+{
+    BOOST_REQUIRE(vanity_prefix("2", payment_address::mainnet_p2kh)
+        .ranges().empty());
+    BOOST_REQUIRE(vanity_prefix("1", payment_address::mainnet_p2sh)
+        .ranges().empty());
+    BOOST_REQUIRE(!vanity_prefix("3", payment_address::mainnet_p2sh)
+        .ranges().empty());
+}
+
+BOOST_AUTO_TEST_CASE(vanity_prefix__matches__random_hashes_agree)
+{
+    const std::string prefixes[] = { "1A", "1Bx", "1zz", "111", "3J" };
+    std::mt19937 engine(42);
+    std::uniform_int_distribution<uint32_t> distribution(0, 255);
+
+    for (const auto& text: prefixes)
+    {
+        const auto version = text[0] == '3' ? payment_address::mainnet_p2sh :
+            payment_address::mainnet_p2kh;
+        const vanity_prefix prefix(text, version);
+        BOOST_REQUIRE(!prefix.ranges().empty());
+
+        // Check the range boundaries as well as random hashes.
+        for (const auto& range: prefix.ranges())
+        {
+            BOOST_REQUIRE_EQUAL(prefix.matches(range.first),
+                encoded_match(range.first, text, version));
+            BOOST_REQUIRE_EQUAL(prefix.matches(range.second),
+                encoded_match(range.second, text, version));
+        }
+
+        for (size_t count = 0; count < 2000; ++count)
+        {
+            short_hash hash;
+            for (auto& byte: hash)
+                byte = static_cast<uint8_t>(distribution(engine));
+
+            // The prefix requires two leading zero bytes, so make half.
+            if (text == "111")
+            {
+                hash[0] = 0;
+                hash[1] = count % 2 == 0 ? 0 : hash[1];
+            }
+
+            BOOST_REQUIRE_EQUAL(prefix.matches(hash),
+                encoded_match(hash, text, version));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(vanity_search__search)
+
+BOOST_AUTO_TEST_CASE(vanity_search__one__first_key)
+{
+    const vanity_prefix prefix("1", payment_address::mainnet_p2kh);
+    ec_secret secret;
+    uint64_t keys;
+    BOOST_REQUIRE(vanity_search(secret, keys, prefix, seed, 1));
+    BOOST_REQUIRE_EQUAL(keys, 256u);
+
+    // The first thread starts from the key of the seed and a zero index.
+    auto thread_seed = seed;
+    extend_data(thread_seed, to_big_endian(uint32_t(0)));
+    BOOST_REQUIRE_EQUAL(encode_base16(secret), encode_base16(new_key(
+        thread_seed)));
+    BOOST_REQUIRE_EQUAL(encode_base16(secret), "726e5e73da00289dc0bef2b2b0f82c2ddd518c6a00c65d03b18fc8d9fd2af1f6");
+}
+
+BOOST_AUTO_TEST_CASE(vanity_search__prefix__address_matches)
+{
+    const vanity_prefix prefix("1A", payment_address::mainnet_p2kh);
+    ec_secret secret;
+    uint64_t keys;
+    BOOST_REQUIRE(vanity_search(secret, keys, prefix, seed, 2));
+    BOOST_REQUIRE(keys != 0);
+
+    ec_compressed point;
+    BOOST_REQUIRE(secret_to_public(point, secret));
+    const payment_address address(ec_public(point),
+        payment_address::mainnet_p2kh);
+    BOOST_REQUIRE_EQUAL(address.encoded().substr(0, 2), "1A");
+}
+
+BOOST_AUTO_TEST_CASE(vanity_search__limit__not_found)
+{
+    const vanity_prefix prefix("1zzzzzzz", payment_address::mainnet_p2kh);
+    ec_secret secret;
+    uint64_t keys;
+    BOOST_REQUIRE(!vanity_search(secret, keys, prefix, seed, 1, 512));
+    BOOST_REQUIRE_EQUAL(keys, 512u);
+}
+
+BOOST_AUTO_TEST_CASE(vanity_search__progress__each_batch)
+{
+    const vanity_prefix prefix("1zzzzzzz", payment_address::mainnet_p2kh);
+    ec_secret secret;
+    uint64_t keys;
+    std::vector<uint64_t> reported;
+    const auto progress = [&reported](uint64_t searched)
+    {
+        reported.push_back(searched);
+    };
+
+    BOOST_REQUIRE(!vanity_search(secret, keys, prefix, seed, 1, 768,
+        progress));
+    BOOST_REQUIRE_EQUAL(reported.size(), 3u);
+    BOOST_REQUIRE_EQUAL(reported[0], 256u);
+    BOOST_REQUIRE_EQUAL(reported[2], 768u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()